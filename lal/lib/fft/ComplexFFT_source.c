@@ -3,6 +3,7 @@
 #define CONCAT3x(a,b,c) a##b##c
 #define CONCAT3(a,b,c) CONCAT3x(a,b,c)
 #define STRING(a) #a
+#define XSTRING(a) STRING(a)
 
 #ifdef SINGLE_PRECISION
 #define COMPLEX_TYPE COMPLEX8
@@ -192,7 +193,9 @@ int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPL
 
     /* perform the fft */
 
+    XLAL_PROFILE_BEGIN(XSTRING(VECTOR_FFT_FUNCTION));
     FFTWX_EXECUTE_DFT(plan->plan, (FFTWX_COMPLEX *)input_data, (FFTWX_COMPLEX *)output_data);
+    XLAL_PROFILE_END(XSTRING(VECTOR_FFT_FUNCTION));
 
     /* cleanup aligned memory space if memory alignment is required;
      * copy data from temporary space to output vector */
@@ -214,6 +217,7 @@ int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPL
 #undef CONCAT3x
 #undef CONCAT3
 #undef STRING
+#undef XSTRING
 
 #undef COMPLEX_TYPE
 #undef TYPESUFFIX
@@ -3,6 +3,7 @@
 #define CONCAT3x(a,b,c) a##b##c
 #define CONCAT3(a,b,c) CONCAT3x(a,b,c)
 #define STRING(a) #a
+#define XSTRING(a) STRING(a)
 
 #ifdef SINGLE_PRECISION
 #define REAL_TYPE REAL4
@@ -204,7 +205,9 @@ int FORWARD_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * output, const REAL_VECTOR_TYPE *
 
     /* perform the fft */
 
+    XLAL_PROFILE_BEGIN(XSTRING(FORWARD_FFT_FUNCTION));
     FFTWX_EXECUTE_R2R(plan->plan, input_data, tmp);
+    XLAL_PROFILE_END(XSTRING(FORWARD_FFT_FUNCTION));
 
     /* unpack the results into the output vector */
 
@@ -294,7 +297,9 @@ int REVERSE_FFT_FUNCTION(REAL_VECTOR_TYPE * output, const COMPLEX_VECTOR_TYPE *
 
     /* perform the fft */
 
+    XLAL_PROFILE_BEGIN(XSTRING(REVERSE_FFT_FUNCTION));
     FFTWX_EXECUTE_R2R(plan->plan, tmp, output_data);
+    XLAL_PROFILE_END(XSTRING(REVERSE_FFT_FUNCTION));
 
     /* if temporary space for output data was created, copy data into
      * the output vector and free the temporary space */
@@ -359,7 +364,9 @@ int VECTOR_FFT_FUNCTION(REAL_VECTOR_TYPE * _LAL_RESTRICT_ output, const REAL_VEC
 
     /* perform the fft */
 
+    XLAL_PROFILE_BEGIN(XSTRING(VECTOR_FFT_FUNCTION));
     FFTWX_EXECUTE_R2R(plan->plan, input_data, output_data);
+    XLAL_PROFILE_END(XSTRING(VECTOR_FFT_FUNCTION));
 
     /* cleanup aligned memory space if memory alignment is required;
      * copy data from temporary space to output vector */
@@ -421,7 +428,9 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
 
     /* perform the fft */
 
+    XLAL_PROFILE_BEGIN(XSTRING(POWER_SPECTRUM_FUNCTION));
     FFTWX_EXECUTE_R2R(plan->plan, input_data, tmp);
+    XLAL_PROFILE_END(XSTRING(POWER_SPECTRUM_FUNCTION));
 
     /* compute spectrum from the fft of the data */
 
@@ -458,6 +467,7 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
 #undef CONCAT3x
 #undef CONCAT3
 #undef STRING
+#undef XSTRING
 
 #undef REAL_TYPE
 #undef COMPLEX_TYPE
@@ -27,6 +27,7 @@
 #include <lal/LALMalloc.h>
 #include <lal/LALStdio.h>
 #include <lal/LALError.h>
+#include <lal/LALProfile.h>
 
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
@@ -44,6 +45,11 @@ size_t lalMallocTotalPeak = 0;	/**< peak amount of memory allocated so far */
  *
  */
 
+#define XLAL_PROFILE_COUNT_ALLOC( size )                                  \
+    if ( lalProfileState > 0 )                                            \
+       XLALProfileCountAlloc( size );                                     \
+    else (void)(0)
+
 #define XLAL_TEST_POINTER( ptr, size )                                    \
     if ( ! (ptr) && (size) )                                              \
        XLAL_ERROR_NULL( XLAL_ENOMEM );                                    \
@@ -68,6 +74,7 @@ size_t lalMallocTotalPeak = 0;	/**< peak amount of memory allocated so far */
     else (void)(0)
 
 void *(XLALMalloc) (size_t n) {
+    XLAL_PROFILE_COUNT_ALLOC(n);
     void *p;
     p = LALMallocShort(n);
     XLAL_TEST_POINTER(p, n);
@@ -76,6 +83,7 @@ void *(XLALMalloc) (size_t n) {
 
 void *XLALMallocLong(size_t n, const char *file, int line)
 {
+    XLAL_PROFILE_COUNT_ALLOC(n);
     void *p;
     p = LALMallocLong(n, file, line);
     XLAL_TEST_POINTER_LONG(p, n, file, line);
@@ -83,6 +91,7 @@ void *XLALMallocLong(size_t n, const char *file, int line)
 }
 
 void *(XLALCalloc) (size_t m, size_t n) {
+    XLAL_PROFILE_COUNT_ALLOC(m * n);
     void *p;
     p = LALCallocShort(m, n);
     XLAL_TEST_POINTER(p, m && n);
@@ -91,6 +100,7 @@ void *(XLALCalloc) (size_t m, size_t n) {
 
 void *XLALCallocLong(size_t m, size_t n, const char *file, int line)
 {
+    XLAL_PROFILE_COUNT_ALLOC(m * n);
     void *p;
     p = LALCallocLong(m, n, file, line);
     XLAL_TEST_POINTER_LONG(p, m && n, file, line);
@@ -98,6 +108,7 @@ void *XLALCallocLong(size_t m, size_t n, const char *file, int line)
 }
 
 void *(XLALRealloc) (void *p, size_t n) {
+    XLAL_PROFILE_COUNT_ALLOC(n);
     p = LALReallocShort(p, n);
     XLAL_TEST_POINTER(p, n);
     return p;
@@ -105,6 +116,7 @@ void *(XLALRealloc) (void *p, size_t n) {
 
 void *XLALReallocLong(void *p, size_t n, const char *file, int line)
 {
+    XLAL_PROFILE_COUNT_ALLOC(n);
     p = LALReallocLong(p, n, file, line);
     XLAL_TEST_POINTER_LONG(p, n, file, line);
     return p;
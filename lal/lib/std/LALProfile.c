@@ -0,0 +1,533 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with with program; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <config.h>
+
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
+#if defined(HAVE_LINUX_PERF_EVENT_H) && defined(HAVE_SYS_SYSCALL_H) && defined(HAVE_UNISTD_H)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#define HAVE_PERF_EVENTS 1
+#endif
+
+#include <lal/LALProfile.h>
+#include <lal/LALStdio.h>
+#include <lal/LALString.h>
+#include <lal/LALError.h>
+#include <lal/XLALError.h>
+
+#ifdef __GNUC__
+#define UNUSED __attribute__ ((unused))
+#else
+#define UNUSED
+#endif
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_once_t lalOnce = PTHREAD_ONCE_INIT;
+#define LAL_ONCE(init) pthread_once(&lalOnce, (init))
+static pthread_mutex_t mut = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t thread_key;
+#else
+static int lalOnce = 1;
+#define LAL_ONCE(init) (lalOnce ? (init)(), lalOnce = 0 : 0)
+#define pthread_mutex_lock( pmut )
+#define pthread_mutex_unlock( pmut )
+#endif
+
+/* Hardware performance counters recorded for each region */
+enum { NCOUNTERS = 4 };
+static const char *const counter_names[NCOUNTERS] = { "cycles", "instructions", "cache_misses", "branch_misses" };
+
+/* Records of a code region, in a tree of regions of a thread */
+typedef struct tagProfileNode {
+    const char *name;                   /* Name of region */
+    struct tagProfileNode *parent;      /* Enclosing region */
+    struct tagProfileNode *child;       /* First nested region */
+    struct tagProfileNode *sibling;     /* Next region with the same enclosing region */
+    UINT8 calls;                        /* Number of calls to region */
+    UINT8 threads;                      /* Number of threads which called region (aggregated records only) */
+    double wall_time;                   /* Total wall-clock time spent in region */
+    double child_wall_time;             /* Total wall-clock time spent in nested regions */
+    UINT8 nallocs;                      /* Number of allocations made in region */
+    UINT8 alloc_bytes;                  /* Total size of allocations made in region */
+    UINT8 counters[NCOUNTERS];          /* Total hardware performance counts in region */
+    double start_time;                  /* Wall-clock time at which region was begun */
+    UINT8 start_counters[NCOUNTERS];    /* Hardware performance counts at which region was begun */
+} ProfileNode;
+
+/* Records of all code regions of a thread */
+typedef struct tagProfileThread {
+    ProfileNode root;                   /* Root of tree of regions */
+    ProfileNode *current;               /* Current region */
+    int perf_fd;                        /* Hardware performance counter group, or -1 if not available */
+    struct tagProfileThread *next;      /* Next thread in list of all threads */
+} ProfileThread;
+
+int lalProfileState = -1;
+static int profile_perf = 0;
+static char *profile_output = NULL;
+static ProfileThread *profile_threads = NULL;
+#ifndef LAL_PTHREAD_LOCK
+static ProfileThread *profile_thread = NULL;
+#endif
+
+static double profile_now(void)
+{
+#ifdef HAVE_CLOCK_GETTIME
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+#elif defined(HAVE_SYS_TIME_H)
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+#else
+    return ((double) clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+#ifdef HAVE_PERF_EVENTS
+
+static int profile_perf_open(int group_fd, __u64 config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.disabled = (group_fd < 0);
+    return (int) syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+static int profile_perf_open_group(void)
+{
+    static const __u64 configs[NCOUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    int fd = profile_perf_open(-1, configs[0]);
+    if (fd < 0) {
+        XLALPrintWarning("%s: hardware performance counters are not available; check /proc/sys/kernel/perf_event_paranoid\n", __func__);
+        return -1;
+    }
+    for (int i = 1; i < NCOUNTERS; ++i) {
+        if (profile_perf_open(fd, configs[i]) < 0) {
+            XLALPrintWarning("%s: hardware performance counter '%s' is not available\n", __func__, counter_names[i]);
+            close(fd);
+            return -1;
+        }
+    }
+    ioctl(fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return fd;
+}
+
+static void profile_perf_read(const ProfileThread *thread, UINT8 counters[NCOUNTERS])
+{
+    struct { __u64 nr; __u64 values[NCOUNTERS]; } data;
+    if (thread->perf_fd >= 0 && read(thread->perf_fd, &data, sizeof(data)) == (ssize_t) sizeof(data)) {
+        for (int i = 0; i < NCOUNTERS; ++i) {
+            counters[i] = data.values[i];
+        }
+    }
+}
+
+#else /* !HAVE_PERF_EVENTS */
+
+static int profile_perf_open_group(void)
+{
+    XLALPrintWarning("%s: hardware performance counters are not supported on this platform\n", __func__);
+    return -1;
+}
+
+static void profile_perf_read(const ProfileThread UNUSED *thread, UINT8 UNUSED counters[NCOUNTERS])
+{
+}
+
+#endif /* HAVE_PERF_EVENTS */
+
+/*
+ * Write records at program exit
+ */
+static void profile_write_at_exit(void)
+{
+    FILE *fp = stderr;
+    if (profile_output != NULL) {
+        fp = fopen(profile_output, "w");
+        if (fp == NULL) {
+            XLALPrintError("%s: could not open LAL_PROFILE output file '%s'\n", __func__, profile_output);
+            return;
+        }
+    }
+    if (XLALProfileWriteJSON(fp) != XLAL_SUCCESS) {
+        XLALPrintError("%s: could not write LAL_PROFILE output\n", __func__);
+    }
+    if (fp != stderr) {
+        fclose(fp);
+    }
+}
+
+/*
+ * Parse LAL_PROFILE and initialise instrumentation
+ */
+static void profile_init(void)
+{
+    lalProfileState = 0;
+
+    const char *env = getenv("LAL_PROFILE");
+    if (env == NULL || *env == '\0') {
+        return;
+    }
+
+    /* parse a comma-separated list of options */
+    const char *const seps = ",";
+    const char *token = env;
+    do {
+        size_t toklen = strcspn(token, seps);
+        if (toklen > 0) {
+            if (XLALStringNCaseCompare("perf", token, toklen) == 0 && toklen == 4) {
+                profile_perf = 1;
+            } else if (toklen == 1 && *token == '-') {
+                free(profile_output);
+                profile_output = NULL;
+            } else {
+                free(profile_output);
+                profile_output = malloc(toklen + 1);
+                if (profile_output == NULL) {
+                    lalAbortHook("%s: could not parse LAL_PROFILE='%s'\n", __func__, env);
+                    return;
+                }
+                memcpy(profile_output, token, toklen);
+                profile_output[toklen] = '\0';
+            }
+        }
+        token += toklen;
+    } while (*(token++) != '\0');
+
+#ifdef LAL_PTHREAD_LOCK
+    if (pthread_key_create(&thread_key, NULL) != 0) {
+        lalAbortHook("%s: could not create thread-specific data key\n", __func__);
+        return;
+    }
+#endif
+
+    atexit(profile_write_at_exit);
+    lalProfileState = 1;
+}
+
+/*
+ * Return the records of the calling thread, optionally creating them
+ */
+static ProfileThread *profile_get_thread(int create)
+{
+#ifdef LAL_PTHREAD_LOCK
+    ProfileThread *thread = pthread_getspecific(thread_key);
+#else
+    ProfileThread *thread = profile_thread;
+#endif
+    if (thread == NULL && create) {
+        thread = calloc(1, sizeof(*thread));
+        if (thread == NULL) {
+            return NULL;
+        }
+        thread->current = &thread->root;
+        thread->perf_fd = profile_perf ? profile_perf_open_group() : -1;
+        pthread_mutex_lock(&mut);
+        thread->next = profile_threads;
+        profile_threads = thread;
+        pthread_mutex_unlock(&mut);
+#ifdef LAL_PTHREAD_LOCK
+        pthread_setspecific(thread_key, thread);
+#else
+        profile_thread = thread;
+#endif
+    }
+    return thread;
+}
+
+/*
+ * Return the nested region of 'parent' with the given name, optionally creating it
+ */
+static ProfileNode *profile_get_child(ProfileNode *parent, const char *name, int create)
+{
+    ProfileNode **pnode = &parent->child;
+    for (; *pnode != NULL; pnode = &(*pnode)->sibling) {
+        if ((*pnode)->name == name || strcmp((*pnode)->name, name) == 0) {
+            return *pnode;
+        }
+    }
+    if (create) {
+        *pnode = calloc(1, sizeof(**pnode));
+        if (*pnode != NULL) {
+            (*pnode)->name = name;
+            (*pnode)->parent = parent;
+        }
+    }
+    return *pnode;
+}
+
+/*
+ * Free the nested regions of 'node'
+ */
+static void profile_free_children(ProfileNode *node)
+{
+    ProfileNode *child = node->child;
+    while (child != NULL) {
+        ProfileNode *next = child->sibling;
+        profile_free_children(child);
+        free(child);
+        child = next;
+    }
+    node->child = NULL;
+}
+
+/*
+ * Add the records of the nested regions of 'src' to those of 'dst'
+ */
+static int profile_merge_children(ProfileNode *dst, const ProfileNode *src)
+{
+    for (const ProfileNode *s = src->child; s != NULL; s = s->sibling) {
+        ProfileNode *d = profile_get_child(dst, s->name, 1);
+        if (d == NULL) {
+            return XLAL_FAILURE;
+        }
+        d->calls += s->calls;
+        d->threads += 1;
+        d->wall_time += s->wall_time;
+        d->child_wall_time += s->child_wall_time;
+        d->nallocs += s->nallocs;
+        d->alloc_bytes += s->alloc_bytes;
+        for (int i = 0; i < NCOUNTERS; ++i) {
+            d->counters[i] += s->counters[i];
+        }
+        if (profile_merge_children(d, s) != XLAL_SUCCESS) {
+            return XLAL_FAILURE;
+        }
+    }
+    return XLAL_SUCCESS;
+}
+
+/*
+ * Aggregate the records of all threads
+ */
+static int profile_aggregate(ProfileNode *root)
+{
+    int retn = XLAL_SUCCESS;
+    memset(root, 0, sizeof(*root));
+    pthread_mutex_lock(&mut);
+    for (const ProfileThread *thread = profile_threads; thread != NULL && retn == XLAL_SUCCESS; thread = thread->next) {
+        retn = profile_merge_children(root, &thread->root);
+    }
+    pthread_mutex_unlock(&mut);
+    if (retn != XLAL_SUCCESS) {
+        profile_free_children(root);
+        XLAL_ERROR(XLAL_ENOMEM);
+    }
+    return XLAL_SUCCESS;
+}
+
+/*
+ * Write the characters of a JSON string, escaping special characters
+ */
+static void profile_write_json_chars(FILE *fp, const char *s)
+{
+    for (; *s != '\0'; ++s) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', fp);
+            fputc(*s, fp);
+        } else if ((unsigned char) *s < 0x20) {
+            fprintf(fp, "\\u%04x", (unsigned int) *s);
+        } else {
+            fputc(*s, fp);
+        }
+    }
+}
+
+/*
+ * Write the characters of the path of region 'node', i.e. the names of it and its enclosing regions separated by '/'
+ */
+static void profile_write_json_path_chars(FILE *fp, const ProfileNode *node)
+{
+    if (node->parent != NULL && node->parent->parent != NULL) {
+        profile_write_json_path_chars(fp, node->parent);
+        fputc('/', fp);
+    }
+    profile_write_json_chars(fp, node->name);
+}
+
+/*
+ * Write the records of the nested regions of 'node' as JSON objects
+ */
+static void profile_write_json_children(FILE *fp, const ProfileNode *node, int *first)
+{
+    for (const ProfileNode *c = node->child; c != NULL; c = c->sibling) {
+        fprintf(fp, "%s\n    {\"path\": \"", *first ? "" : ",");
+        *first = 0;
+        profile_write_json_path_chars(fp, c);
+        fprintf(fp, "\", \"name\": \"");
+        profile_write_json_chars(fp, c->name);
+        fprintf(fp, "\", \"calls\": %" LAL_UINT8_FORMAT ", \"threads\": %" LAL_UINT8_FORMAT, c->calls, c->threads);
+        fprintf(fp, ", \"wall_time\": %.9g, \"self_time\": %.9g", c->wall_time, c->wall_time - c->child_wall_time);
+        fprintf(fp, ", \"allocs\": %" LAL_UINT8_FORMAT ", \"alloc_bytes\": %" LAL_UINT8_FORMAT, c->nallocs, c->alloc_bytes);
+        if (profile_perf) {
+            for (int i = 0; i < NCOUNTERS; ++i) {
+                fprintf(fp, ", \"%s\": %" LAL_UINT8_FORMAT, counter_names[i], c->counters[i]);
+            }
+        }
+        fprintf(fp, "}");
+        profile_write_json_children(fp, c, first);
+    }
+}
+
+void XLALProfileBegin(const char *name)
+{
+    LAL_ONCE(profile_init);
+    if (lalProfileState <= 0 || name == NULL) {
+        return;
+    }
+    ProfileThread *thread = profile_get_thread(1);
+    if (thread == NULL) {
+        return;
+    }
+    ProfileNode *node = profile_get_child(thread->current, name, 1);
+    if (node == NULL) {
+        return;
+    }
+    thread->current = node;
+    profile_perf_read(thread, node->start_counters);
+    node->start_time = profile_now();
+}
+
+void XLALProfileEnd(const char *name)
+{
+    const double now = profile_now();
+    ProfileThread *thread = profile_get_thread(0);
+    if (thread == NULL || thread->current == &thread->root) {
+        XLALPrintWarning("%s: ending region '%s' which was never begun\n", __func__, name);
+        return;
+    }
+    ProfileNode *node = thread->current;
+    if (name != NULL && node->name != name && strcmp(node->name, name) != 0) {
+        XLALPrintWarning("%s: ending region '%s' but current region is '%s'\n", __func__, name, node->name);
+    }
+    UINT8 counters[NCOUNTERS];
+    memcpy(counters, node->start_counters, sizeof(counters));
+    profile_perf_read(thread, counters);
+    for (int i = 0; i < NCOUNTERS; ++i) {
+        node->counters[i] += counters[i] - node->start_counters[i];
+    }
+    const double elapsed = now - node->start_time;
+    node->calls += 1;
+    node->wall_time += elapsed;
+    node->parent->child_wall_time += elapsed;
+    thread->current = node->parent;
+}
+
+void XLALProfileCountAlloc(size_t size)
+{
+    if (lalProfileState <= 0) {
+        return;
+    }
+    ProfileThread *thread = profile_get_thread(0);
+    if (thread != NULL && thread->current != &thread->root) {
+        thread->current->nallocs += 1;
+        thread->current->alloc_bytes += size;
+    }
+}
+
+int XLALProfileQuery(const char *path, UINT8 *calls, REAL8 *wall_time)
+{
+    XLAL_CHECK(path != NULL, XLAL_EFAULT);
+    if (calls != NULL) {
+        *calls = 0;
+    }
+    if (wall_time != NULL) {
+        *wall_time = 0;
+    }
+    if (lalProfileState <= 0) {
+        return XLAL_SUCCESS;
+    }
+
+    /* aggregate records of all threads */
+    ProfileNode root;
+    XLAL_CHECK(profile_aggregate(&root) == XLAL_SUCCESS, XLAL_EFUNC);
+
+    /* find region with the given path */
+    const ProfileNode *node = &root;
+    const char *token = path;
+    do {
+        size_t toklen = strcspn(token, "/");
+        const ProfileNode *child = node->child;
+        while (child != NULL && !(strlen(child->name) == toklen && strncmp(child->name, token, toklen) == 0)) {
+            child = child->sibling;
+        }
+        node = child;
+        token += toklen;
+    } while (node != NULL && *(token++) != '\0');
+
+    /* return records of region */
+    if (node != NULL) {
+        if (calls != NULL) {
+            *calls = node->calls;
+        }
+        if (wall_time != NULL) {
+            *wall_time = node->wall_time;
+        }
+    }
+
+    profile_free_children(&root);
+
+    return XLAL_SUCCESS;
+}
+
+int XLALProfileWriteJSON(FILE *fp)
+{
+    XLAL_CHECK(fp != NULL, XLAL_EFAULT);
+
+    /* aggregate records of all threads */
+    ProfileNode root;
+    if (lalProfileState > 0) {
+        XLAL_CHECK(profile_aggregate(&root) == XLAL_SUCCESS, XLAL_EFUNC);
+    } else {
+        memset(&root, 0, sizeof(root));
+    }
+
+    /* write records of all regions, depth first */
+    int first = 1;
+    fprintf(fp, "{\n  \"regions\": [");
+    profile_write_json_children(fp, &root, &first);
+    fprintf(fp, "%s]\n}\n", first ? "" : "\n  ");
+
+    profile_free_children(&root);
+
+    XLAL_CHECK(!ferror(fp), XLAL_EIO, "Error writing LAL_PROFILE output");
+
+    return XLAL_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with with program; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef _LALPROFILE_H
+#define _LALPROFILE_H
+
+#include <stdio.h>
+#include <lal/LALAtomicDatatypes.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#elif 0
+}       /* so that editors will match preceding brace */
+#endif
+
+/**
+ * \defgroup LALProfile_h Header LALProfile.h
+ * \ingroup lal_std
+ * \brief Lightweight timing and hardware-counter instrumentation of named code regions
+ *
+ * ### Synopsis ###
+ * \code
+ * #include <lal/LALProfile.h>
+ *
+ * XLAL_PROFILE_BEGIN("MyHotLoop");
+ * for (...) {
+ *   ...
+ * }
+ * XLAL_PROFILE_END("MyHotLoop");
+ * \endcode
+ *
+ * Code regions are delimited by matching calls to XLAL_PROFILE_BEGIN() and XLAL_PROFILE_END(), which take the
+ * name of the region; the name must be a string which remains valid for the lifetime of the program, usually a
+ * string literal.  Regions may be nested, and are identified by the path of region names from the outermost
+ * region, e.g. <tt>"XLALComputeFstat/XLALREAL4ForwardFFT"</tt>.  For each region, the number of calls, the
+ * total wall-clock time, the time spent outside of any nested regions, and the number and total size of
+ * allocations made with XLALMalloc() and friends are recorded.  Each thread records regions separately; the
+ * records of all threads are aggregated by region path when they are output.
+ *
+ * Instrumentation is disabled unless the environment variable <tt>LAL_PROFILE</tt> is set, in which case it
+ * is parsed as a comma-separated list of options:
+ * <dl>
+ * <dt><tt>perf</tt></dt><dd>Also record Linux hardware performance counters (CPU cycles, instructions, cache
+ * misses, branch misses) for each region, if available.</dd>
+ * <dt>anything else</dt><dd>Name of the file to which the aggregated records are written in JSON format at
+ * program exit; if not given, or <tt>-</tt>, the records are written to standard error.</dd>
+ * </dl>
+ * When instrumentation is disabled, XLAL_PROFILE_BEGIN() and XLAL_PROFILE_END() cost a single test of a global
+ * variable; they may be compiled out entirely by defining <tt>LAL_PROFILE_DISABLED</tt>.
+ */
+/** @{ */
+
+/**
+ * Instrumentation state: negative if not yet initialised, zero if disabled, positive if enabled
+ */
+extern int lalProfileState;
+
+/**
+ * Begin the code region with the given name, nested inside the current code region of the calling thread
+ */
+void XLALProfileBegin(const char *name);
+
+/**
+ * End the current code region of the calling thread, which should have the given name
+ */
+void XLALProfileEnd(const char *name);
+
+/**
+ * Record an allocation of the given size in the current code region of the calling thread
+ */
+void XLALProfileCountAlloc(size_t size);
+
+/**
+ * Return the number of calls and total wall-clock time of the code region with the given path, aggregated over all threads
+ */
+int XLALProfileQuery(const char *path, UINT8 *calls, REAL8 *wall_time);
+
+/**
+ * Write the records of all code regions, aggregated over all threads, in JSON format to the given stream
+ */
+int XLALProfileWriteJSON(FILE *fp);
+
+#if defined(LAL_PROFILE_DISABLED)
+#define XLAL_PROFILE_BEGIN(name) do { } while (0)
+#define XLAL_PROFILE_END(name) do { } while (0)
+#else
+/** Begin a code region, if instrumentation is not disabled */
+#define XLAL_PROFILE_BEGIN(name) do { if (lalProfileState != 0) XLALProfileBegin(name); } while (0)
+/** End a code region, if instrumentation is enabled */
+#define XLAL_PROFILE_END(name) do { if (lalProfileState > 0) XLALProfileEnd(name); } while (0)
+#endif
+
+/** @} */
+
+#if 0
+{       /* so that editors will match succeeding brace */
+#elif defined(__cplusplus)
+}
+#endif
+
+#endif /* _LALPROFILE_H */
@@ -133,6 +133,7 @@ void XLALH5DatasetFree(LALH5Dataset *dset);
 
 LALH5Dataset * XLALH5DatasetAlloc(LALH5File *file, const char *name, LALTYPECODE dtype, UINT4Vector *dimLength);
 LALH5Dataset * XLALH5DatasetAlloc1D(LALH5File *file, const char *name, LALTYPECODE dtype, size_t length);
+LALH5Dataset * XLALH5DatasetAllocCompressed(LALH5File *file, const char *name, LALTYPECODE dtype, UINT4Vector *dimLength, size_t chunk, int level);
 LALH5Dataset * XLALH5DatasetAllocStringData(LALH5File *file, const char *name, size_t length);
 int XLALH5DatasetWrite(LALH5Dataset *dset, void *data);
 
@@ -157,6 +158,7 @@ LALTYPECODE XLALH5DatasetQueryType(LALH5Dataset *dset);
 int XLALH5DatasetQueryNDim(LALH5Dataset *dset);
 UINT4Vector * XLALH5DatasetQueryDims(LALH5Dataset *dset);
 int XLALH5DatasetQueryData(void *data, LALH5Dataset *dset);
+int XLALH5DatasetQueryDataRows(void *data, LALH5Dataset *dset, size_t row0, size_t nrows);
 
 /* these routines are deprecated */
 int XLALH5DatasetAddScalarAttribute(LALH5Dataset *dset, const char *key, const void *value, LALTYPECODE dtype);
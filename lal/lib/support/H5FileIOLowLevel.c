@@ -1087,6 +1087,133 @@ LALH5Dataset * XLALH5DatasetAlloc1D(LALH5File UNUSED *file, const char UNUSED *n
 #endif
 }
 
+/**
+ * @brief Allocates a chunked and compressed ::LALH5Dataset
+ * @details
+ * Creates a new HDF5 dataset with name @p name within a HDF5 file
+ * associated with the ::LALH5File @p file structure and allocates a
+ * ::LALH5Dataset structure associated with the dataset, as with
+ * XLALH5DatasetAlloc().  The dataset is stored in chunks of @p chunk
+ * rows along its first dimension, each chunk spanning the remaining
+ * dimensions in full, so that contiguous ranges of rows can be read
+ * efficiently with XLALH5DatasetQueryDataRows().  If @p level is
+ * positive, each chunk is byte-shuffled and compressed with deflate at
+ * that level (1 to 9).
+ *
+ * A @p chunk of zero is replaced by the length of the first dimension.
+ * Datasets with no points cannot be chunked and are stored contiguously.
+ *
+ * The ::LALH5File @p file passed to this routine must be a file
+ * opened for writing.
+ *
+ * @param file Pointer to a ::LALH5File structure in which to create the dataset.
+ * @param name Pointer to a string with the name of the dataset to create.
+ * @param dtype \c LALTYPECODE value specifying the data type.
+ * @param dimLength Pointer to a UINT4Vector specifying the dataspace
+ * dimensions.
+ * @param chunk Number of rows along the first dimension in each chunk.
+ * @param level Deflate compression level, or 0 for no compression.
+ * @returns A pointer to a ::LALH5Dataset structure associated with the
+ * specified dataset within a HDF5 file.
+ * @retval NULL An error occurred creating the dataset.
+ */
+LALH5Dataset * XLALH5DatasetAllocCompressed(LALH5File UNUSED *file, const char UNUSED *name, LALTYPECODE UNUSED dtype, UINT4Vector UNUSED *dimLength, size_t UNUSED chunk, int UNUSED level)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR_NULL(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	LALH5Dataset *dset;
+	hsize_t *dims;
+	hsize_t *chunkdims;
+	hsize_t npoints = 1;
+	hid_t plist;
+	UINT4 dim;
+	size_t namelen;
+
+	if (name == NULL || file == NULL || dimLength == NULL)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if (dimLength->length == 0)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Dataset must have at least one dimension");
+	if (level < 0 || level > 9)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Invalid compression level %d", level);
+	if (file->mode != LAL_H5_FILE_MODE_WRITE)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Attempting to write to a read-only HDF5 file");
+
+	namelen = strlen(name);
+	dset = LALCalloc(1, sizeof(*dset) + namelen + 1);  /* use flexible array member to record name */
+	if (!dset)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+
+	/* create datatype */
+	dset->dtype_id = XLALH5TypeFromLALType(dtype);
+	if (dset->dtype_id < 0) {
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	/* copy dimensions to HDF5 type; chunks span all but the first */
+	dims = LALCalloc(2 * dimLength->length, sizeof(*dims));
+	if (!dims) {
+		threadsafe_H5Tclose(dset->dtype_id);
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+	chunkdims = dims + dimLength->length;
+	for (dim = 0; dim < dimLength->length; ++dim) {
+		dims[dim] = chunkdims[dim] = dimLength->data[dim];
+		npoints *= dims[dim];
+	}
+	if (chunk > 0 && chunk < dims[0])
+		chunkdims[0] = chunk;
+
+	/* create dataset creation property list */
+	plist = threadsafe_H5Pcreate(H5P_DATASET_CREATE);
+	if (plist < 0) {
+		LALFree(dims);
+		threadsafe_H5Tclose(dset->dtype_id);
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not create property list");
+	}
+	if (npoints > 0) {
+		if (threadsafe_H5Pset_chunk(plist, dimLength->length, chunkdims) < 0
+		    || (level > 0 && threadsafe_H5Pset_shuffle(plist) < 0)
+		    || (level > 0 && threadsafe_H5Pset_deflate(plist, level) < 0)) {
+			threadsafe_H5Pclose(plist);
+			LALFree(dims);
+			threadsafe_H5Tclose(dset->dtype_id);
+			LALFree(dset);
+			XLAL_ERROR_NULL(XLAL_EIO, "Could not set chunking and compression for dataset `%s'", name);
+		}
+	}
+
+	/* create dataspace */
+	dset->space_id = threadsafe_H5Screate_simple(dimLength->length, dims, NULL);
+	LALFree(dims);
+	if (dset->space_id < 0) {
+		threadsafe_H5Pclose(plist);
+		threadsafe_H5Tclose(dset->dtype_id);
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not create dataspace for dataset `%s'", name);
+	}
+
+	/* create dataset */
+	dset->dataset_id = threadsafe_H5Dcreate2(file->file_id, name, dset->dtype_id, dset->space_id, H5P_DEFAULT, plist, H5P_DEFAULT);
+	threadsafe_H5Pclose(plist);
+	if (dset->dataset_id < 0) {
+		threadsafe_H5Tclose(dset->dtype_id);
+		threadsafe_H5Sclose(dset->space_id);
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not create dataset `%s'", name);
+	}
+
+	/* record name of dataset and parent id */
+	snprintf(dset->name, namelen + 1, "%s", name);
+	dset->parent_id = file->file_id;
+
+	return dset;
+#endif
+}
+
 /**
  * @brief Allocates a variable-length string ::LALH5Dataset
  * @details
@@ -1476,6 +1603,99 @@ int XLALH5DatasetQueryData(void UNUSED *data, LALH5Dataset UNUSED *dset)
 #endif
 }
 
+/**
+ * @brief Gets a range of rows of the data in a ::LALH5Dataset
+ * @details
+ * Reads @p nrows rows, starting at row @p row0, along the first
+ * dimension of the HDF5 dataset associated with the ::LALH5Dataset
+ * @p dset and stores them in the buffer @p data.  Each row comprises
+ * the full extent of the remaining dimensions, so this buffer should
+ * hold XLALH5DatasetQueryNBytes() / dims[0] * @p nrows bytes.  Only
+ * the chunks that hold the requested rows are read, which makes this
+ * routine efficient for datasets allocated with
+ * XLALH5DatasetAllocCompressed().  Variable-length string data is not
+ * supported.
+ * @param data Pointer to a memory in which to store the data.
+ * @param dset Pointer to a ::LALH5Dataset from which to extract the data.
+ * @param row0 The first row to read.
+ * @param nrows The number of rows to read.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5DatasetQueryDataRows(void UNUSED *data, LALH5Dataset UNUSED *dset, size_t UNUSED row0, size_t UNUSED nrows)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	hsize_t *start;
+	hsize_t *count;
+	hid_t filespace_id;
+	hid_t memspace_id;
+	int isstrdata;
+	int rank;
+	int dim;
+
+	if (data == NULL || dset == NULL)
+		XLAL_ERROR(XLAL_EFAULT);
+	isstrdata = XLALH5DatasetCheckStringData(dset);
+	if (isstrdata < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	if (isstrdata)
+		XLAL_ERROR(XLAL_ETYPE, "Cannot read rows of variable-length string data");
+
+	rank = threadsafe_H5Sget_simple_extent_ndims(dset->space_id);
+	if (rank <= 0)
+		XLAL_ERROR(XLAL_EIO, "Could not read rank of dataset");
+	start = LALCalloc(2 * rank, sizeof(*start));
+	if (!start)
+		XLAL_ERROR(XLAL_ENOMEM);
+	count = start + rank;
+	if (threadsafe_H5Sget_simple_extent_dims(dset->space_id, count, NULL) < 0) {
+		LALFree(start);
+		XLAL_ERROR(XLAL_EIO, "Could not read dimensions of dataset");
+	}
+	if (row0 > count[0] || nrows > count[0] - row0) {
+		LALFree(start);
+		XLAL_ERROR(XLAL_EDOM, "Requested rows [%zu, %zu) lie outside dataset", row0, row0 + nrows);
+	}
+	if (nrows == 0) {
+		LALFree(start);
+		return 0;
+	}
+	start[0] = row0;
+	count[0] = nrows;
+	for (dim = 1; dim < rank; ++dim)
+		start[dim] = 0;
+
+	/* select rows in a copy of the dataset space, so that the selection
+	 * of the shared dataset space is never changed */
+	filespace_id = threadsafe_H5Scopy(dset->space_id);
+	if (filespace_id < 0) {
+		LALFree(start);
+		XLAL_ERROR(XLAL_EIO, "Could not copy dataspace");
+	}
+	if (threadsafe_H5Sselect_hyperslab(filespace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+		threadsafe_H5Sclose(filespace_id);
+		LALFree(start);
+		XLAL_ERROR(XLAL_EIO, "Could not select rows of dataset");
+	}
+	memspace_id = threadsafe_H5Screate_simple(rank, count, NULL);
+	LALFree(start);
+	if (memspace_id < 0) {
+		threadsafe_H5Sclose(filespace_id);
+		XLAL_ERROR(XLAL_EIO, "Could not create dataspace");
+	}
+	if (threadsafe_H5Dread(dset->dataset_id, dset->dtype_id, memspace_id, filespace_id, H5P_DEFAULT, data) < 0) {
+		threadsafe_H5Sclose(memspace_id);
+		threadsafe_H5Sclose(filespace_id);
+		XLAL_ERROR(XLAL_EIO, "Could not read data from dataset");
+	}
+	threadsafe_H5Sclose(memspace_id);
+	threadsafe_H5Sclose(filespace_id);
+	return 0;
+#endif
+}
+
 /** @} */
 
 /**
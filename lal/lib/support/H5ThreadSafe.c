@@ -331,6 +331,14 @@ static inline hid_t threadsafe_H5Pcreate(hid_t cls_id)
 	return retval;
 }
 
+static inline herr_t threadsafe_H5Pset_chunk(hid_t plist_id, int ndims, const hsize_t dim[])
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_chunk(plist_id, ndims, dim);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5Pset_create_intermediate_group(hid_t plist_id, unsigned crt_intmd)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -339,6 +347,22 @@ static inline herr_t threadsafe_H5Pset_create_intermediate_group(hid_t plist_id,
 	return retval;
 }
 
+static inline herr_t threadsafe_H5Pset_deflate(hid_t plist_id, unsigned level)
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_deflate(plist_id, level);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
+static inline herr_t threadsafe_H5Pset_shuffle(hid_t plist_id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_shuffle(plist_id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5Pset_vlen_mem_manager(hid_t plist_id, H5MM_allocate_t alloc_func, void *alloc_info, H5MM_free_t free_func, void *free_info)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -355,6 +379,14 @@ static inline herr_t threadsafe_H5Sclose(hid_t space_id)
 	return retval;
 }
 
+static inline hid_t threadsafe_H5Scopy(hid_t space_id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	hid_t retval = H5Scopy(space_id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline hid_t threadsafe_H5Screate(H5S_class_t type)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -395,6 +427,14 @@ static inline hssize_t threadsafe_H5Sget_simple_extent_npoints(hid_t space_id)
 	return retval;
 }
 
+static inline herr_t threadsafe_H5Sselect_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t start[], const hsize_t stride[], const hsize_t count[], const hsize_t block[])
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Sselect_hyperslab(space_id, op, start, stride, count, block);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5TBappend_records(hid_t loc_id, const char *dset_name, hsize_t nrecords, size_t type_size, const size_t *field_offset, const size_t *dst_sizes, const void *buf)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -682,14 +722,19 @@ static inline herr_t threadsafe_H5open(void)
 #define threadsafe_H5Pclose H5Pclose
 #define threadsafe_H5Pcopy H5Pcopy
 #define threadsafe_H5Pcreate H5Pcreate
+#define threadsafe_H5Pset_chunk H5Pset_chunk
 #define threadsafe_H5Pset_create_intermediate_group H5Pset_create_intermediate_group
+#define threadsafe_H5Pset_deflate H5Pset_deflate
+#define threadsafe_H5Pset_shuffle H5Pset_shuffle
 #define threadsafe_H5Pset_vlen_mem_manager H5Pset_vlen_mem_manager
 #define threadsafe_H5Sclose H5Sclose
+#define threadsafe_H5Scopy H5Scopy
 #define threadsafe_H5Screate H5Screate
 #define threadsafe_H5Screate_simple H5Screate_simple
 #define threadsafe_H5Sget_simple_extent_dims H5Sget_simple_extent_dims
 #define threadsafe_H5Sget_simple_extent_ndims H5Sget_simple_extent_ndims
 #define threadsafe_H5Sget_simple_extent_npoints H5Sget_simple_extent_npoints
+#define threadsafe_H5Sselect_hyperslab H5Sselect_hyperslab
 #define threadsafe_H5TBappend_records H5TBappend_records
 #define threadsafe_H5TBget_field_info H5TBget_field_info
 #define threadsafe_H5TBget_table_info H5TBget_table_info
@@ -208,3 +208,14 @@ EXPORT_VECTORMATH_cC2C(Shift, AVX2, AVX, SSE2, NONE)
 
 EXPORT_VECTORMATH_D2D(Round, AVX2, AVX, NONE, NONE)
 
+// ---------- define exported vector math functions with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 vector in/output (sS2U) ----------
+#define EXPORT_VECTORMATH_sS2U(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## REAL4, (UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len), (count, scalar, in, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_sS2U(CountGreater, AVX2, AVX, SSE2, NONE)
+
+// ---------- define exported vector math functions with 1 REAL4 vector and 1 UINT4 scalar inputs to 1 REAL4 and 1 UINT4 vector in/outputs (Su2SU) ----------
+#define EXPORT_VECTORMATH_Su2SU(NAME, ...)                                   \
+  EXPORT_VECTORMATH_ANY( NAME ## REAL4, (REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len), (max, idx, in, index, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_Su2SU(MaxTrack, AVX2, AVX, SSE2, NONE)
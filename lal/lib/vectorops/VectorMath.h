@@ -222,6 +222,21 @@ int XLALVectorShiftCOMPLEX8 ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in
 
 /** @} */
 
+/** \name Semicoherent Accumulation Operations */
+/** @{ */
+
+/** Increment \c count by 1 over UINT4 vector \c count and REAL4 vector \c in with \c len elements, where \f$\text{in} > \text{scalar}\f$ */
+int XLALVectorCountGreaterREAL4 ( UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len );
+
+/**
+ * Compute \f$\text{max} = max ( \text{max}, \text{in} )\f$ over REAL4 vectors \c max and \c in with \c len elements,
+ * and set \c idx to \c index over UINT4 vector \c idx where \f$\text{max} \le \text{in}\f$, i.e.\ keep track of
+ * the index of the input vector which supplied the maximum
+ */
+int XLALVectorMaxTrackREAL4 ( REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len );
+
+/** @} */
+
 /** \name Vector Element Finding Operations */
 /** @{ */
 
@@ -60,6 +60,12 @@ local_max_ps ( __m256 in1, __m256 in2 )
   return _mm256_max_ps ( in1, in2 );
 }
 
+UNUSED static inline __m256
+local_greater_ps ( __m256 in1, __m256 in2 )
+{
+  return _mm256_cmp_ps ( in1, in2, _CMP_LT_OQ );
+}
+
 UNUSED static inline __m256d
 local_add_pd ( __m256d in1, __m256d in2 )
 {
@@ -468,6 +474,80 @@ XLALVectorMath_D2D_AVXx ( REAL8 *out, const REAL8 *in, const UINT4 len, __m256d
 
 } // XLALVectorMath_D2D_AVXx()
 
+// ---------- generic AVXx operator with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 vector in/output (sS2U) ----------
+static inline int
+XLALVectorMath_sS2U_AVXx ( UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len, __m256 (*op)(__m256, __m256) )
+{
+  const V8SF scalar8 = {.f={scalar,scalar,scalar,scalar,scalar,scalar,scalar,scalar}};
+
+  // walk through vector in blocks of 8
+  UINT4 i8Max = len - ( len % 8 );
+  for ( UINT4 i8 = 0; i8 < i8Max; i8 += 8 )
+    {
+      __m256 in8p = _mm256_loadu_ps(&in[i8]);
+      __m256i count8p = _mm256_loadu_si256( (const __m256i*)&count[i8] );
+      // comparison mask is -1 where true, so subtract it to count
+      __m256i mask8p = _mm256_castps_si256 ( (*op) ( scalar8.v, in8p ) );
+#ifdef __AVX2__
+      count8p = _mm256_sub_epi32 ( count8p, mask8p );
+#else
+      // AVX has no 256-bit integer arithmetic, so subtract each 128-bit half
+      __m128i count4p_lo = _mm_sub_epi32 ( _mm256_castsi256_si128 ( count8p ), _mm256_castsi256_si128 ( mask8p ) );
+      __m128i count4p_hi = _mm_sub_epi32 ( _mm256_extractf128_si256 ( count8p, 1 ), _mm256_extractf128_si256 ( mask8p, 1 ) );
+      count8p = _mm256_insertf128_si256 ( _mm256_castsi128_si256 ( count4p_lo ), count4p_hi, 1 );
+#endif
+      _mm256_storeu_si256( (__m256i*)&count[i8], count8p );
+    }
+
+  // deal with the remaining (<=7) terms separately
+  V8SF in8 = {.f={0,0,0,0,0,0,0,0}};
+  V8SF mask8;
+  for ( UINT4 i = i8Max,j=0; i < len; i ++, j++ ) {
+    in8.f[j] = in[i];
+  }
+  mask8.v = (*op) ( scalar8.v, in8.v );
+  for ( UINT4 i = i8Max,j=0; i < len; i ++, j++ ) {
+    count[i] -= (INT4) mask8.i[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_sS2U_AVXx()
+
+// ---------- generic AVXx operator with 1 REAL4 vector and 1 UINT4 scalar inputs to 1 REAL4 and 1 UINT4 vector in/outputs (Su2SU) ----------
+static inline int
+XLALVectorMath_Su2SU_AVXx ( REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len )
+{
+  const __m256 index8p = _mm256_castsi256_ps ( _mm256_set1_epi32 ( (INT4) index ) );
+
+  // walk through vector in blocks of 8
+  UINT4 i8Max = len - ( len % 8 );
+  for ( UINT4 i8 = 0; i8 < i8Max; i8 += 8 )
+    {
+      __m256 in8p = _mm256_loadu_ps(&in[i8]);
+      __m256 max8p = _mm256_loadu_ps(&max[i8]);
+      // indexes are blended as floating-point bit patterns, which AVX supports
+      __m256 idx8p = _mm256_castsi256_ps ( _mm256_loadu_si256( (const __m256i*)&idx[i8] ) );
+      __m256 louder8p = _mm256_cmp_ps ( max8p, in8p, _CMP_LE_OQ );
+      max8p = _mm256_max_ps ( max8p, in8p );
+      idx8p = _mm256_blendv_ps ( idx8p, index8p, louder8p );
+      _mm256_storeu_ps(&max[i8], max8p);
+      _mm256_storeu_si256( (__m256i*)&idx[i8], _mm256_castps_si256 ( idx8p ) );
+    }
+
+  // deal with the remaining (<=7) terms separately
+  for ( UINT4 i = i8Max; i < len; i ++ )
+    {
+      if ( max[i] <= in[i] ) {
+        max[i] = in[i];
+        idx[i] = index;
+      }
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_Su2SU_AVXx()
+
 // ========== internal AVXx vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 REAL4 vector output (S2S) ----------
@@ -538,3 +618,15 @@ DEFINE_VECTORMATH_cC2C(Shift, local_add_ps)
   DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_AVXx, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, AVX_OP ) )
 
 DEFINE_VECTORMATH_D2D(Round, local_round_pd)
+
+// ---------- define vector math functions with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 vector in/output (sS2U) ----------
+#define DEFINE_VECTORMATH_sS2U(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_sS2U_AVXx, NAME ## REAL4, ( UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len ), ( (count != NULL) && (in != NULL) ), ( count, scalar, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_sS2U(CountGreater, local_greater_ps)
+
+// ---------- define vector math functions with 1 REAL4 vector and 1 UINT4 scalar inputs to 1 REAL4 and 1 UINT4 vector in/outputs (Su2SU) ----------
+#define DEFINE_VECTORMATH_Su2SU(NAME)                                   \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_Su2SU_AVXx, NAME ## REAL4, ( REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len ), ( (max != NULL) && (idx != NULL) && (in != NULL) ), ( max, idx, in, index, len ) )
+
+DEFINE_VECTORMATH_Su2SU(MaxTrack)
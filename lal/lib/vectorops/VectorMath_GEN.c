@@ -84,6 +84,10 @@ static inline REAL4 local_fmaxf ( REAL4 x, REAL4 y ) {
   return (x > y) ? x : y;
 }
 
+static inline UINT4 local_greaterf ( REAL4 x, REAL4 y ) {
+  return (y > x);
+}
+
 // ========== internal generic functions ==========
 
 // ---------- generic operator with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -196,6 +200,30 @@ XLALVectorMath_D2D_GEN ( REAL8 *out, const REAL8 *in, const UINT4 len, REAL8 (*o
   return XLAL_SUCCESS;
 }
 
+// ---------- generic operator with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 vector in/output (sS2U) ----------
+static inline int
+XLALVectorMath_sS2U_GEN ( UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len, UINT4 (*op)(REAL4, REAL4) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      count[i] += (*op) ( scalar, in[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 1 REAL4 vector and 1 UINT4 scalar inputs to 1 REAL4 and 1 UINT4 vector in/outputs (Su2SU) ----------
+static inline int
+XLALVectorMath_Su2SU_GEN ( REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      const UINT4 louder = ( max[i] <= in[i] );
+      max[i] = local_fmaxf ( max[i], in[i] );
+      idx[i] = louder ? index : idx[i];
+    }
+  return XLAL_SUCCESS;
+}
+
 // ========== internal vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -272,3 +300,15 @@ DEFINE_VECTORMATH_cC2C(Shift, local_caddf)
   DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_GEN, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, GEN_OP ) )
 
 DEFINE_VECTORMATH_D2D(Round, round)
+
+// ---------- define vector math functions with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 vector in/output (sS2U) ----------
+#define DEFINE_VECTORMATH_sS2U(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_sS2U_GEN, NAME ## REAL4, ( UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len ), ( (count != NULL) && (in != NULL) ), ( count, scalar, in, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_sS2U(CountGreater, local_greaterf)
+
+// ---------- define vector math functions with 1 REAL4 vector and 1 UINT4 scalar inputs to 1 REAL4 and 1 UINT4 vector in/outputs (Su2SU) ----------
+#define DEFINE_VECTORMATH_Su2SU(NAME)                                   \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_Su2SU_GEN, NAME ## REAL4, ( REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len ), ( (max != NULL) && (idx != NULL) && (in != NULL) ), ( max, idx, in, index, len ) )
+
+DEFINE_VECTORMATH_Su2SU(MaxTrack)
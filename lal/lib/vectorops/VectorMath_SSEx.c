@@ -67,6 +67,12 @@ local_max_ps ( __m128 in1, __m128 in2 )
   return _mm_max_ps ( in1, in2 );
 }
 
+UNUSED static inline __m128
+local_greater_ps ( __m128 in1, __m128 in2 )
+{
+  return _mm_cmplt_ps ( in1, in2 );
+}
+
 UNUSED static inline __m128d
 local_add_pd ( __m128d in1, __m128d in2 )
 {
@@ -401,6 +407,72 @@ XLALVectorMath_cC2C_SSEx ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in, c
 
 } // XLALVectorMath_cC2C_SSEx()
 
+// ---------- generic SSEx operator with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 vector in/output (sS2U) ----------
+static inline int
+XLALVectorMath_sS2U_SSEx ( UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len, __m128 (*op)(__m128, __m128) )
+{
+  const V4SF scalar4 = {.f={scalar,scalar,scalar,scalar}};
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m128 in4p = _mm_loadu_ps(&in[i4]);
+      __m128i count4p = _mm_loadu_si128( (const __m128i*)&count[i4] );
+      // comparison mask is -1 where true, so subtract it to count
+      __m128i mask4p = _mm_castps_si128 ( (*op) ( scalar4.v, in4p ) );
+      count4p = _mm_sub_epi32 ( count4p, mask4p );
+      _mm_storeu_si128( (__m128i*)&count[i4], count4p );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V4SF in4 = {.f={0,0,0,0}};
+  V4SF mask4;
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    in4.f[j] = in[i];
+  }
+  mask4.v = (*op) ( scalar4.v, in4.v );
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    count[i] -= (INT4) mask4.i[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_sS2U_SSEx()
+
+// ---------- generic SSEx operator with 1 REAL4 vector and 1 UINT4 scalar inputs to 1 REAL4 and 1 UINT4 vector in/outputs (Su2SU) ----------
+static inline int
+XLALVectorMath_Su2SU_SSEx ( REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len )
+{
+  const __m128i index4p = _mm_set1_epi32 ( (INT4) index );
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m128 in4p = _mm_loadu_ps(&in[i4]);
+      __m128 max4p = _mm_loadu_ps(&max[i4]);
+      __m128i idx4p = _mm_loadu_si128( (const __m128i*)&idx[i4] );
+      __m128i louder4p = _mm_castps_si128 ( _mm_cmple_ps ( max4p, in4p ) );
+      max4p = _mm_max_ps ( max4p, in4p );
+      idx4p = _mm_or_si128 ( _mm_and_si128 ( louder4p, index4p ), _mm_andnot_si128 ( louder4p, idx4p ) );
+      _mm_storeu_ps(&max[i4], max4p);
+      _mm_storeu_si128( (__m128i*)&idx[i4], idx4p );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  for ( UINT4 i = i4Max; i < len; i ++ )
+    {
+      if ( max[i] <= in[i] ) {
+        max[i] = in[i];
+        idx[i] = index;
+      }
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_Su2SU_SSEx()
+
 // ========== internal SSEx vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -469,3 +541,15 @@ DEFINE_VECTORMATH_CC2C(Add, local_add_ps)
 
 DEFINE_VECTORMATH_cC2C(Scale, local_cmul_ps)
 DEFINE_VECTORMATH_cC2C(Shift, local_add_ps)
+
+// ---------- define vector math functions with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 vector in/output (sS2U) ----------
+#define DEFINE_VECTORMATH_sS2U(NAME, SSE_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_sS2U_SSEx, NAME ## REAL4, ( UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len ), ( (count != NULL) && (in != NULL) ), ( count, scalar, in, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_sS2U(CountGreater, local_greater_ps)
+
+// ---------- define vector math functions with 1 REAL4 vector and 1 UINT4 scalar inputs to 1 REAL4 and 1 UINT4 vector in/outputs (Su2SU) ----------
+#define DEFINE_VECTORMATH_Su2SU(NAME)                                   \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_Su2SU_SSEx, NAME ## REAL4, ( REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len ), ( (max != NULL) && (idx != NULL) && (in != NULL) ), ( max, idx, in, index, len ) )
+
+DEFINE_VECTORMATH_Su2SU(MaxTrack)
@@ -136,3 +136,15 @@ DECLARE_VECTORMATH_cC2C(Shift, AVX2, AVX, SSE2, NONE)
   DECLARE_VECTORMATH_ANY( NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), __VA_ARGS__ )
 
 DECLARE_VECTORMATH_D2D(Round, AVX2, AVX, NONE, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 vector in/output (sS2U) */
+#define DECLARE_VECTORMATH_sS2U(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## REAL4, ( UINT4 *count, REAL4 scalar, const REAL4 *in, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_sS2U(CountGreater, AVX2, AVX, SSE2, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 REAL4 vector and 1 UINT4 scalar inputs to 1 REAL4 and 1 UINT4 vector in/outputs (Su2SU) */
+#define DECLARE_VECTORMATH_Su2SU(NAME, ...)                                  \
+  DECLARE_VECTORMATH_ANY( NAME ## REAL4, ( REAL4 *max, UINT4 *idx, const REAL4 *in, const UINT4 index, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_Su2SU(MaxTrack, AVX2, AVX, SSE2, NONE)
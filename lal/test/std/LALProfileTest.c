@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with with program; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/LALProfile.h>
+#include <lal/LALMalloc.h>
+#include <lal/LALStdio.h>
+#include <lal/XLALError.h>
+
+static void leaf( void )
+{
+  XLAL_PROFILE_BEGIN( "leaf" );
+  void *p = XLALMalloc( 100 );
+  XLALFree( p );
+  XLAL_PROFILE_END( "leaf" );
+}
+
+int main( void )
+{
+
+  /* Enable instrumentation, writing records to standard error */
+  XLAL_CHECK_MAIN( setenv( "LAL_PROFILE", "-", 0 ) == 0, XLAL_ESYS );
+
+  /* Call some nested regions */
+  for ( int i = 0; i < 3; ++i ) {
+    XLAL_PROFILE_BEGIN( "outer" );
+    leaf();
+    leaf();
+    XLAL_PROFILE_BEGIN( "inner" );
+    leaf();
+    XLAL_PROFILE_END( "inner" );
+    XLAL_PROFILE_END( "outer" );
+  }
+  leaf();
+  XLAL_CHECK_MAIN( lalProfileState > 0, XLAL_EFAILED, "instrumentation was not enabled" );
+
+  /* Check number of calls and times of regions */
+  {
+    const struct { const char *path; UINT8 calls; } regions[] = {
+      { "outer", 3 }, { "outer/leaf", 6 }, { "outer/inner", 3 }, { "outer/inner/leaf", 3 }, { "leaf", 1 }, { "inner", 0 }, { "outer/banana", 0 },
+    };
+    REAL8 outer_wall_time = 0;
+    XLAL_CHECK_MAIN( XLALProfileQuery( "outer", NULL, &outer_wall_time ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( size_t i = 0; i < XLAL_NUM_ELEM( regions ); ++i ) {
+      UINT8 calls = 0;
+      REAL8 wall_time = 0;
+      XLAL_CHECK_MAIN( XLALProfileQuery( regions[i].path, &calls, &wall_time ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( calls == regions[i].calls, XLAL_EFAILED, "region '%s' has %" LAL_UINT8_FORMAT " calls, expected %" LAL_UINT8_FORMAT, regions[i].path, calls, regions[i].calls );
+      XLAL_CHECK_MAIN( wall_time >= 0 && ( calls > 0 || wall_time == 0 ), XLAL_EFAILED, "region '%s' has invalid time %g", regions[i].path, wall_time );
+      XLAL_CHECK_MAIN( strncmp( regions[i].path, "outer/", 6 ) != 0 || wall_time <= outer_wall_time, XLAL_EFAILED, "nested region '%s' takes longer than enclosing region", regions[i].path );
+    }
+  }
+
+  /* Write records */
+  XLAL_CHECK_MAIN( XLALProfileWriteJSON( stdout ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
@@ -18,6 +18,7 @@
 */
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <config.h>
 
@@ -211,6 +212,47 @@
     XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxRelerr, reltol ); \
   }
 
+#define TESTBENCH_VECTORMATH_sS2U(name,in1,in2)                         \
+  {                                                                     \
+    memset ( xOutRefU4->data, 0, Ntrials * sizeof(UINT4) );             \
+    memset ( xOutU4->data, 0, Ntrials * sizeof(UINT4) );                \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##REAL4_GEN( xOutRefU4->data, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##REAL4( xOutU4->data, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
+    {                                                                   \
+      XLAL_CHECK ( xOutU4->data[i] == xOutRefU4->data[i], XLAL_ETOL, "%s: count #%u (%u) differs from reference (%u)", #name, i, xOutU4->data[i], xOutRefU4->data[i] ); \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [%5.2f ns/point]\n", XLALVector##name##REAL4_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, (toc - tic) / ((REAL8)Ntrials * Nruns) * 1e9 ); \
+  }
+
+#define TESTBENCH_VECTORMATH_Su2SU(name,in)                             \
+  {                                                                     \
+    memset ( xOutRef, 0, Ntrials * sizeof(REAL4) );                     \
+    memset ( xOut, 0, Ntrials * sizeof(REAL4) );                        \
+    memset ( xOutRefU4->data, 0, Ntrials * sizeof(UINT4) );             \
+    memset ( xOutU4->data, 0, Ntrials * sizeof(UINT4) );                \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##REAL4_GEN( xOutRef, xOutRefU4->data, in, l + 1, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##REAL4( xOut, xOutU4->data, in, l + 1, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
+    {                                                                   \
+      XLAL_CHECK ( xOut[i] == xOutRef[i], XLAL_ETOL, "%s: maximum #%u (%g) differs from reference (%g)", #name, i, xOut[i], xOutRef[i] ); \
+      XLAL_CHECK ( xOutU4->data[i] == xOutRefU4->data[i], XLAL_ETOL, "%s: index #%u (%u) differs from reference (%u)", #name, i, xOutU4->data[i], xOutRefU4->data[i] ); \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [%5.2f ns/point]\n", XLALVector##name##REAL4_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, (toc - tic) / ((REAL8)Ntrials * Nruns) * 1e9 ); \
+  }
+
 // local types
 typedef struct
 {
@@ -394,6 +436,12 @@ main ( int argc, char *argv[] )
 
   TESTBENCH_VECTORMATH_SS2uU(FindScalarLessEqual,xIn[0],xIn2);
 
+  // ==================== SEMICOHERENT ACCUMULATION ====================
+  XLALPrintInfo ("\nTesting count-greater, max-tracking for x,y in (-10000, 10000]\n");
+  TESTBENCH_VECTORMATH_sS2U(CountGreater,xIn[0],xIn2);
+
+  TESTBENCH_VECTORMATH_Su2SU(MaxTrack,xIn2);
+
   XLALPrintInfo ("\n");
 
   // ---------- clean up memory ----------
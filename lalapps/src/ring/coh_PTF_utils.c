@@ -1767,6 +1767,105 @@ XXXXX
 }
 */
 
+/* Number of time samples the coherent SNR is calculated for in one go */
+#define COH_PTF_SNR_BLOCK 64
+
+static int coh_PTF_compare_points(const void *a, const void *b)
+{
+  UINT4 pa = *(const UINT4 *) a;
+  UINT4 pb = *(const UINT4 *) b;
+  return (pa > pb) - (pa < pb);
+}
+
+static void coh_PTF_calculate_projection_matrix(
+  struct coh_PTF_params      *params,
+  REAL4                      *proj,
+  REAL4                      *Fplus,
+  REAL4                      *Fcross,
+  gsl_matrix                 *eigenvecs,
+  gsl_vector                 *eigenvals,
+  UINT4                      vecLength,
+  UINT4                      vecLengthTwo,
+  UINT4                      numInputs
+)
+{
+  // This function combines the steps of coh_PTF_calculate_rotated_vectors
+  // into four vecLengthTwo x numInputs matrices, such that
+  //   u1 = proj[0] * Re(Q|s) + proj[1] * Im(Q|s)
+  //   u2 = proj[2] * Re(Q|s) + proj[3] * Im(Q|s)
+  // where the (Q|s) are ordered by detector and then by filter component.
+  // It only depends on the sky point and template, so is done once per call
+  // rather than once per time sample.
+  UINT4 j,l,m,x,ifoNumber,input;
+  UINT4 matSize = vecLengthTwo * numInputs;
+  REAL8 amat[4*matSize];
+  REAL8 sum;
+
+  for (m = 0; m < 4*matSize; m++)
+  {
+    amat[m] = 0.;
+  }
+
+  /* The matrices taking the (Q|s) to v1 and v2 */
+  input = 0;
+  for (ifoNumber = 0; ifoNumber < LAL_NUM_IFO; ifoNumber++)
+  {
+    if (! params->haveTrig[ifoNumber])
+    {
+      continue;
+    }
+    for (l = 0; l < vecLengthTwo; l++)
+    {
+      if (params->faceOnStatistic == 1)
+      {
+        amat[0*matSize + l*numInputs + input + l] += Fplus[ifoNumber];
+        amat[1*matSize + l*numInputs + input + l] += Fcross[ifoNumber];
+        amat[2*matSize + l*numInputs + input + l] += Fcross[ifoNumber];
+        amat[3*matSize + l*numInputs + input + l] -= Fplus[ifoNumber];
+      }
+      else if (params->faceOnStatistic == 2)
+      {
+        amat[0*matSize + l*numInputs + input + l] += Fplus[ifoNumber];
+        amat[1*matSize + l*numInputs + input + l] -= Fcross[ifoNumber];
+        amat[2*matSize + l*numInputs + input + l] += Fcross[ifoNumber];
+        amat[3*matSize + l*numInputs + input + l] += Fplus[ifoNumber];
+      }
+      else if (params->faceOnStatistic)
+      {
+        fprintf(stderr,"Face-on stat is not working!");
+      }
+      else if (l < vecLength)
+      {
+        amat[0*matSize + l*numInputs + input + l] += Fplus[ifoNumber];
+        amat[3*matSize + l*numInputs + input + l] += Fplus[ifoNumber];
+      }
+      else
+      {
+        amat[0*matSize + l*numInputs + input + l-vecLength] += Fcross[ifoNumber];
+        amat[3*matSize + l*numInputs + input + l-vecLength] += Fcross[ifoNumber];
+      }
+    }
+    input += vecLength;
+  }
+
+  /* Rotate into the orthonormal basis and normalize */
+  for (x = 0; x < 4; x++)
+  {
+    for (j = 0; j < vecLengthTwo; j++)
+    {
+      for (m = 0; m < numInputs; m++)
+      {
+        sum = 0.;
+        for (l = 0; l < vecLengthTwo; l++)
+        {
+          sum += gsl_matrix_get(eigenvecs,l,j) * amat[x*matSize + l*numInputs + m];
+        }
+        proj[x*matSize + j*numInputs + m] = sum / pow(gsl_vector_get(eigenvals,j),0.5);
+      }
+    }
+  }
+}
+
 void coh_PTF_calculate_coherent_SNR(
   struct coh_PTF_params      *params,
   REAL4                      *snrData,
@@ -1788,21 +1887,25 @@ void coh_PTF_calculate_coherent_SNR(
 )
 {
   REAL4 snglSNRthresh = params->snglSNRThreshold;
-  REAL4 *v1p = LALCalloc(vecLengthTwo , sizeof(REAL4));
-  REAL4 *v2p = LALCalloc(vecLengthTwo , sizeof(REAL4));
 
   UINT4 i,j,k,ifoNumber,ifoNumber2,currPointLoc,ifoNum1,ifoNum2;
   UINT4 localCount,*localAcceptPoints,localOffset;
+  UINT4 numCandidates,maxCandidates,numInputs,numBlocks,block;
+  UINT4 ifoList[LAL_NUM_IFO],numIfos;
+  UINT4 *candidates;
   INT4 tOffset1,tOffset2;
-  REAL4 v1_dot_u1,v2_dot_u2,max_eigen,coincSNR;
+  REAL4 max_eigen,coincSNR;
   REAL4 cohSNRThresholdSq = params->threshold * params->threshold;
+  REAL4 *proj;
+  REAL8 sqrtEigenvals[vecLengthTwo];
+  UINT4 twoIfoShortcut = (params->numIFO == 2 && (! params->singlePolFlag) &&\
+                          (!params->faceOnStatistic));
 
   /* If only two detectors & standard analysis identify the 2 detectors
    * up front for speed
    */
   ifoNum1 = ifoNum2 = tOffset1 = tOffset2 = 0;
-  if (params->numIFO == 2 && (! params->singlePolFlag) &&\
-      (!params->faceOnStatistic) )
+  if (twoIfoShortcut)
   {
     for (ifoNumber = 0; ifoNumber < LAL_NUM_IFO; ifoNumber++)
     {
@@ -1818,6 +1921,25 @@ void coh_PTF_calculate_coherent_SNR(
     tOffset2 = timeOffsetPoints[ifoNum2] - params->analStartPointBuf;
   }
 
+  numIfos = 0;
+  maxCandidates = 0;
+  for (ifoNumber = 0; ifoNumber < LAL_NUM_IFO; ifoNumber++)
+  {
+    if (params->haveTrig[ifoNumber])
+    {
+      ifoList[numIfos++] = ifoNumber;
+      maxCandidates += snglAcceptCount[ifoNumber];
+    }
+  }
+  if (! maxCandidates)
+  {
+    return;
+  }
+  candidates = LALCalloc(maxCandidates, sizeof(UINT4));
+  numCandidates = 0;
+
+  /* First pass: apply the cheap single detector and coincident SNR cuts, and
+   * make a list of the points where the coherent SNR has to be calculated */
   for (ifoNumber2 = 0; ifoNumber2 < LAL_NUM_IFO; ifoNumber2++)
   {
     if (! params->haveTrig[ifoNumber2])
@@ -1858,8 +1980,7 @@ void coh_PTF_calculate_coherent_SNR(
         continue;
       }
 
-      if (params->numIFO == 2 && (! params->singlePolFlag) &&\
-          (!params->faceOnStatistic) )
+      if (twoIfoShortcut)
       { /*If only 2 detectors cohSNR = coincident SNR. SO just use that */
         max_eigen = snrComps[ifoNum1]->data->data[i+tOffset1] *
                             snrComps[ifoNum1]->data->data[i+tOffset1] +
@@ -1871,18 +1992,10 @@ void coh_PTF_calculate_coherent_SNR(
           continue;
         }
         snrData[currPointLoc] = sqrt(max_eigen);
-        if (params->storeAmpParams)
+        /* Only need the rotated vectors for the amplitude parameters */
+        if (! params->storeAmpParams)
         {
-         coh_PTF_calculate_rotated_vectors(params,PTFqVec,v1p,v2p,Fplus,Fcross,
-            timeOffsetPoints,eigenvecs,eigenvals,
-            params->numTimePoints,i,vecLength,vecLengthTwo,LAL_NUM_IFO);
-          for (j = 0 ; j < vecLengthTwo ; j++)
-          {
-            pValues[j]->data->data[currPointLoc] = \
-                           v1p[j] / (pow(gsl_vector_get(eigenvals,j),0.5));
-            pValues[j+vecLengthTwo]->data->data[currPointLoc] = \
-                           v2p[j] / (pow(gsl_vector_get(eigenvals,j),0.5));
-          }
+          continue;
         }
       }
       else
@@ -1906,65 +2019,151 @@ void coh_PTF_calculate_coherent_SNR(
           snrData[currPointLoc] = 0;
           continue;
         }
+      }
+      candidates[numCandidates++] = i;
+    }
+  }
+
+  /* A point can be accepted by more than one detector, so sort the list and
+   * remove repeats. This also makes the memory accesses below ordered. */
+  qsort(candidates, numCandidates, sizeof(UINT4), coh_PTF_compare_points);
+  for (j = 0, k = 0; k < numCandidates; k++)
+  {
+    if (j == 0 || candidates[k] != candidates[j-1])
+    {
+      candidates[j++] = candidates[k];
+    }
+  }
+  numCandidates = j;
+
+  /* The per-sky-point matrix taking (Q|s) to the rotated vectors */
+  numInputs = numIfos * vecLength;
+  proj = LALCalloc(4 * vecLengthTwo * numInputs, sizeof(REAL4));
+  coh_PTF_calculate_projection_matrix(params,proj,Fplus,Fcross,eigenvecs,\
+      eigenvals,vecLength,vecLengthTwo,numInputs);
+  for (j = 0; j < vecLengthTwo; j++)
+  {
+    sqrtEigenvals[j] = pow(gsl_vector_get(eigenvals,j),0.5);
+  }
+
+  /* Second pass: calculate the coherent SNR in blocks of time samples. The
+   * blocks are independent, so are shared out between threads. */
+  numBlocks = (numCandidates + COH_PTF_SNR_BLOCK - 1) / COH_PTF_SNR_BLOCK;
+#pragma omp parallel for schedule(dynamic)
+  for (block = 0; block < numBlocks; block++)
+  {
+    UINT4 b,c,l,m,n,pos,first,len,base;
+    UINT4 matSize = vecLengthTwo * numInputs;
+    UINT4 numPoints = params->numTimePoints;
+    REAL4 re[numInputs][COH_PTF_SNR_BLOCK],im[numInputs][COH_PTF_SNR_BLOCK];
+    REAL4 u1[vecLengthTwo][COH_PTF_SNR_BLOCK];
+    REAL4 u2[vecLengthTwo][COH_PTF_SNR_BLOCK];
+    REAL4 v1p[vecLengthTwo],v2p[vecLengthTwo];
+    REAL4 snrSq[COH_PTF_SNR_BLOCK];
+
+    first = block * COH_PTF_SNR_BLOCK;
+    len = numCandidates - first;
+    if (len > COH_PTF_SNR_BLOCK)
+      len = COH_PTF_SNR_BLOCK;
+
+    /* Gather the (Q|s) for this block of samples */
+    for (l = 0; l < numIfos; l++)
+    {
+      for (c = 0; c < vecLength; c++)
+      {
+        const COMPLEX8 *qVec = PTFqVec[ifoList[l]]->data;
+        base = c*numPoints + timeOffsetPoints[ifoList[l]];
+        for (b = 0; b < len; b++)
+        {
+          re[l*vecLength+c][b] = crealf(qVec[base+candidates[first+b]]);
+          im[l*vecLength+c][b] = cimagf(qVec[base+candidates[first+b]]);
+        }
+      }
+    }
 
-        /* This function combines the various (Q_i | s) and rotates them into
-         * the orthonormal basis, using the eigen[vector,value]s.
-         */
-        coh_PTF_calculate_rotated_vectors(params,PTFqVec,v1p,v2p,Fplus,Fcross,
-          timeOffsetPoints,eigenvecs,eigenvals,
-          params->numTimePoints,i,vecLength,vecLengthTwo,LAL_NUM_IFO);
-
-        /* And SNR is calculated
-         * For non-spin+multi-site+coherent: 
-         *               v1p[0] * v1p[0] = (\bf{F}_+\bf{h}_0 | \bf{s})^2
-         *               v1p[1] * v1p[1] = (\bf{F}_x\bf{h}_0 | \bf{s})^2
-         *               v2p[0] * v2p[0] = (\bf{F}_+\bf{h}_{\pi/2} | \bf{s})^2
-         *               v2p[1] * v2p[1] = (\bf{F}_x\bf{h}_{\pi/2} | \bf{s})^2
-         * For non-spin+single-site/face-on there will only be two components
-         * in this calculation, but otherwise the same.
-         */
-        if (spinTemplate == 0)
+    /* Rotate them into the orthonormal basis */
+    for (n = 0; n < vecLengthTwo; n++)
+    {
+      for (b = 0; b < len; b++)
+      {
+        u1[n][b] = 0.;
+        u2[n][b] = 0.;
+      }
+      for (m = 0; m < numInputs; m++)
+      {
+        REAL4 p1r = proj[0*matSize + n*numInputs + m];
+        REAL4 p1i = proj[1*matSize + n*numInputs + m];
+        REAL4 p2r = proj[2*matSize + n*numInputs + m];
+        REAL4 p2i = proj[3*matSize + n*numInputs + m];
+        for (b = 0; b < len; b++)
         {
-          v1_dot_u1 = v2_dot_u2 = 0.0;
-          for (j = 0; j < vecLengthTwo; j++)
-          {
-            v1_dot_u1 += v1p[j] * v1p[j];
-            v2_dot_u2 += v2p[j] * v2p[j];
-          }
-          max_eigen = (v1_dot_u1 + v2_dot_u2);
-          if (max_eigen < cohSNRThresholdSq)
-          {
-            snrData[currPointLoc] = 0;
-            continue;
-          }
-          else
-          {
-            snrData[currPointLoc] = sqrt(max_eigen);
-            if (params->storeAmpParams)
-            {
-              for (j = 0 ; j < vecLengthTwo ; j++)
-              {
-                pValues[j]->data->data[currPointLoc] = \
-                               v1p[j] / (pow(gsl_vector_get(eigenvals,j),0.5));
-                pValues[j+vecLengthTwo]->data->data[currPointLoc] = \
-                               v2p[j] / (pow(gsl_vector_get(eigenvals,j),0.5));
-              }
-            }
-          }
+          u1[n][b] += p1r * re[m][b] + p1i * im[m][b];
+          u2[n][b] += p2r * re[m][b] + p2i * im[m][b];
         }
-        else
-        { /* Spinning case follow PTF notation to get SNR */
-          snrData[i-params->analStartPoint] = \
-              coh_PTF_get_spin_SNR(v1p,v2p,vecLengthTwo);
-          if (params->storeAmpParams)
-          {
-            fprintf(stderr,"Spinning amplitude stuff is currently disabled\n");
-            /* coh_PTF_get_spin_amp_terms(.......) */
-          }
+      }
+    }
+
+    /* And SNR is calculated
+     * For non-spin+multi-site+coherent:
+     *               u1[0] * u1[0] = (\bf{F}_+\bf{h}_0 | \bf{s})^2
+     *               u1[1] * u1[1] = (\bf{F}_x\bf{h}_0 | \bf{s})^2
+     *               u2[0] * u2[0] = (\bf{F}_+\bf{h}_{\pi/2} | \bf{s})^2
+     *               u2[1] * u2[1] = (\bf{F}_x\bf{h}_{\pi/2} | \bf{s})^2
+     * For non-spin+single-site/face-on there will only be two components
+     * in this calculation, but otherwise the same.
+     */
+    for (b = 0; b < len; b++)
+    {
+      snrSq[b] = 0.;
+    }
+    for (n = 0; n < vecLengthTwo; n++)
+    {
+      for (b = 0; b < len; b++)
+      {
+        snrSq[b] += u1[n][b] * u1[n][b] + u2[n][b] * u2[n][b];
+      }
+    }
+
+    for (b = 0; b < len; b++)
+    {
+      pos = candidates[first+b] - params->analStartPoint;
+      if (spinTemplate && ! twoIfoShortcut)
+      { /* Spinning case follow PTF notation to get SNR */
+        for (n = 0; n < vecLengthTwo; n++)
+        {
+          v1p[n] = u1[n][b];
+          v2p[n] = u2[n][b];
+        }
+        snrData[pos] = coh_PTF_get_spin_SNR(v1p,v2p,vecLengthTwo);
+        if (params->storeAmpParams)
+        {
+          fprintf(stderr,"Spinning amplitude stuff is currently disabled\n");
+          /* coh_PTF_get_spin_amp_terms(.......) */
+        }
+        continue;
+      }
+      if (! twoIfoShortcut)
+      {
+        if (snrSq[b] < cohSNRThresholdSq)
+        {
+          snrData[pos] = 0;
+          continue;
+        }
+        snrData[pos] = sqrt(snrSq[b]);
+      }
+      if (params->storeAmpParams)
+      {
+        for (n = 0 ; n < vecLengthTwo ; n++)
+        {
+          pValues[n]->data->data[pos] = u1[n][b] / sqrtEigenvals[n];
+          pValues[n+vecLengthTwo]->data->data[pos] = u2[n][b] / sqrtEigenvals[n];
         }
       }
     }
   }
+
+  LALFree(proj);
+  LALFree(candidates);
 }
 
 UINT4 coh_PTF_template_time_series_cluster(
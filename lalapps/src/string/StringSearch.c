@@ -172,7 +172,7 @@ int CreateTemplateBank(struct CommandLineArgsTag CLA, unsigned seg_length, REAL8
 int CreateStringFilters(struct CommandLineArgsTag CLA, REAL8TimeSeries *ht, unsigned seg_length, REAL8FrequencySeries *Spec, StringTemplate *strtemplate, int NTemplates, REAL8FFTPlan *fplan, REAL8FFTPlan *rplan);
 
 /* Filters the data through the template banks  */
-int FindStringBurst(struct CommandLineArgsTag CLA, REAL8TimeSeries *ht, unsigned seg_length, const StringTemplate *strtemplate, int NTemplates, REAL8FFTPlan *fplan, REAL8FFTPlan *rplan, SnglBurst **head);
+int FindStringBurst(struct CommandLineArgsTag CLA, const REAL8TimeSeries *ht, unsigned seg_length, const StringTemplate *strtemplate, int NTemplates, SnglBurst **head);
 
 /* Finds events above SNR threshold specified  */
 int FindEvents(struct CommandLineArgsTag CLA, const StringTemplate *strtemplate,
@@ -287,7 +287,7 @@ int main(int argc,char *argv[])
 
   /****** FindStringBurst ******/
   XLALPrintInfo("FindStringBurst()\n");
-  if (FindStringBurst(CommandLineArgs, ht, seg_length, strtemplate, NTemplates, fplan, rplan, &events)) return 12;
+  if (FindStringBurst(CommandLineArgs, ht, seg_length, strtemplate, NTemplates, &events)) return 12;
   XLALDestroyREAL8TimeSeries(ht);
   XLALDestroyREAL8FFTPlan(fplan);
   XLALDestroyREAL8FFTPlan(rplan);
@@ -513,84 +513,116 @@ int OutputEvents(const struct CommandLineArgsTag *CLA, ProcessTable *proctable,
 
 /*******************************************************************************/
 
+/*
+ * Returns the index of the first sample in [p, pstop) whose magnitude is
+ * above threshold, or pstop if there is none.  Samples are tested a block at
+ * a time with a branch-free loop the compiler can vectorise, so only blocks
+ * that contain a sample above threshold are scanned one sample at a time.
+ */
+static unsigned NextAboveThreshold(const REAL8 *x, unsigned p, unsigned pstop, REAL8 threshold){
+  enum { block = 64 };
+
+  while ( p + block <= pstop ){
+    int above = 0;
+    unsigned j;
+    for ( j = 0; j < block; j++ )
+      above |= fabs(x[p+j]) > threshold;
+    if ( above )
+      break;
+    p += block;
+  }
+  while ( p < pstop && !(fabs(x[p]) > threshold) )
+    p++;
+
+  return p;
+}
+
 int FindEvents(struct CommandLineArgsTag CLA, const StringTemplate *strtemplate, const REAL8TimeSeries *vector, SnglBurst **head){
-  unsigned p;
+  const REAL8 *snr = vector->data->data;
+  const unsigned pstop = 3*vector->data->length/4;
+  const REAL8 tstart = XLALGPSDiff(&vector->epoch, &CLA.trigstarttime);
+  unsigned p, pfirst;
   INT4 pmax, pend, pstart;
 
   /* print the snr to stdout */
   if (CLA.printsnrflag)
-    for ( p = vector->data->length/4 ; p < 3*vector->data->length/4; p++ )
-      fprintf(stdout,"%p %e\n", strtemplate, vector->data->data[p]);
+    for ( p = vector->data->length/4 ; p < pstop; p++ )
+      fprintf(stdout,"%p %e\n", strtemplate, snr[p]);
+
+  /* clusters can only start at or after the trigger start time */
+  pfirst = vector->data->length/4;
+  while ( pfirst < pstop && tstart + pfirst * vector->deltaT < 0 )
+    pfirst++;
 
   /* Now find event in the inner half */
-  for ( p = vector->data->length/4 ; p < 3*vector->data->length/4; p++ ){
+  for ( p = pfirst ; p < pstop; p++ ){
     REAL8 maximum_snr = 0.0;
-    pmax=p;
-
-    /* Do we have the start of a cluster? */
-    if ( (fabs(vector->data->data[p]) > CLA.threshold) && (XLALGPSDiff(&vector->epoch, &CLA.trigstarttime) + p * vector->deltaT >= 0)){
-      SnglBurst *new;
-      REAL8 chi2, ndof;
-      int pp;
-      pend=p; pstart=p;
-
-      /* Clustering in time: While we are above threshold, or within clustering time of the last point above threshold... */
-      while( ((fabs(vector->data->data[p]) > CLA.threshold) || ((p-pend)* vector->deltaT < (float)(CLA.cluster)) )
-	     && p<3*vector->data->length/4){
-
-	/* This keeps track of the largest SNR point of the cluster */
-	if(fabs(vector->data->data[p]) > maximum_snr){
-	  maximum_snr=fabs(vector->data->data[p]);
-	  pmax=p;
-	}
-	/* pend is the last point above threshold */
-	if ( (fabs(vector->data->data[p]) > CLA.threshold))
-	  pend =  p;
-
-	p++;
-      }
+    SnglBurst *new;
+    REAL8 chi2, ndof;
+    int pp;
+
+    /* Skip to the start of the next cluster */
+    p = NextAboveThreshold(snr, p, pstop, CLA.threshold);
+    if ( p >= pstop )
+      break;
+    pmax=p; pend=p; pstart=p;
 
-      /* compute \chi^{2} */
-      chi2=0, ndof=0;
-      for(pp=-strtemplate->chi2_index; pp<strtemplate->chi2_index; pp++){
-        chi2 += (vector->data->data[pmax+pp]-vector->data->data[pmax]*strtemplate->auto_cor->data[vector->data->length/2+pp])*(vector->data->data[pmax+pp]-vector->data->data[pmax]*strtemplate->auto_cor->data[vector->data->length/2+pp]);
-        ndof += (1-strtemplate->auto_cor->data[vector->data->length/2+pp]*strtemplate->auto_cor->data[vector->data->length/2+pp]);
+    /* Clustering in time: While we are above threshold, or within clustering time of the last point above threshold... */
+    while( ((fabs(snr[p]) > CLA.threshold) || ((p-pend)* vector->deltaT < (float)(CLA.cluster)) )
+	   && p<pstop){
+
+      /* This keeps track of the largest SNR point of the cluster */
+      if(fabs(snr[p]) > maximum_snr){
+	maximum_snr=fabs(snr[p]);
+	pmax=p;
       }
+      /* pend is the last point above threshold */
+      if ( (fabs(snr[p]) > CLA.threshold))
+	pend =  p;
+
+      p++;
+    }
 
-      /* Apply the \chi^{2} cut */
-      if( CLA.chi2cut[0]    > -9999
-	  && CLA.chi2cut[1] > -9999
-	  && CLA.chi2cut[2] > -9999 )
-	if(log10(chi2/ndof)>CLA.chi2cut[0]
-	   && log10(chi2/ndof)> CLA.chi2cut[1]*log10(fabs(maximum_snr))+CLA.chi2cut[2]) continue;
-
-      /* prepend a new event to the linked list */
-      new = XLALCreateSnglBurst();
-      if ( ! new )
-        XLAL_ERROR(XLAL_EFUNC);
-      new->next = *head;
-      *head = new;
-
-      /* Now copy stuff into event */
-      strncpy( new->ifo, CLA.ChannelName, 2 );
-      new->ifo[2] = 0;
-      strncpy( new->search, "StringCusp", sizeof( new->search ) );
-      strncpy( new->channel, CLA.ChannelName, sizeof( new->channel )  - 1);
-
-      /* compute start and peak time and duration, give 1 sample of fuzz on
-       * both sides */
-      new->start_time = new->peak_time = vector->epoch;
-      XLALGPSAdd(&new->peak_time, pmax * vector->deltaT);
-      XLALGPSAdd(&new->start_time, (pstart - 1) * vector->deltaT);
-      new->duration = vector->deltaT * ( pend - pstart + 2 );
-
-      new->central_freq = (strtemplate->f+CLA.fbankstart)/2.0;
-      new->bandwidth    = strtemplate->f-CLA.fbankstart;
-      new->snr          = maximum_snr;
-      new->amplitude    = vector->data->data[pmax]/strtemplate->norm;
-      new->chisq = chi2;
-      new->chisq_dof = ndof;
+    /* compute \chi^{2} */
+    chi2=0, ndof=0;
+    for(pp=-strtemplate->chi2_index; pp<strtemplate->chi2_index; pp++){
+      chi2 += (snr[pmax+pp]-snr[pmax]*strtemplate->auto_cor->data[vector->data->length/2+pp])*(snr[pmax+pp]-snr[pmax]*strtemplate->auto_cor->data[vector->data->length/2+pp]);
+      ndof += (1-strtemplate->auto_cor->data[vector->data->length/2+pp]*strtemplate->auto_cor->data[vector->data->length/2+pp]);
     }
+
+    /* Apply the \chi^{2} cut */
+    if( CLA.chi2cut[0]    > -9999
+	&& CLA.chi2cut[1] > -9999
+	&& CLA.chi2cut[2] > -9999 )
+      if(log10(chi2/ndof)>CLA.chi2cut[0]
+	 && log10(chi2/ndof)> CLA.chi2cut[1]*log10(fabs(maximum_snr))+CLA.chi2cut[2]) continue;
+
+    /* prepend a new event to the linked list */
+    new = XLALCreateSnglBurst();
+    if ( ! new )
+      XLAL_ERROR(XLAL_EFUNC);
+    new->next = *head;
+    *head = new;
+
+    /* Now copy stuff into event */
+    strncpy( new->ifo, CLA.ChannelName, 2 );
+    new->ifo[2] = 0;
+    strncpy( new->search, "StringCusp", sizeof( new->search ) );
+    strncpy( new->channel, CLA.ChannelName, sizeof( new->channel )  - 1);
+
+    /* compute start and peak time and duration, give 1 sample of fuzz on
+     * both sides */
+    new->start_time = new->peak_time = vector->epoch;
+    XLALGPSAdd(&new->peak_time, pmax * vector->deltaT);
+    XLALGPSAdd(&new->start_time, (pstart - 1) * vector->deltaT);
+    new->duration = vector->deltaT * ( pend - pstart + 2 );
+
+    new->central_freq = (strtemplate->f+CLA.fbankstart)/2.0;
+    new->bandwidth    = strtemplate->f-CLA.fbankstart;
+    new->snr          = maximum_snr;
+    new->amplitude    = snr[pmax]/strtemplate->norm;
+    new->chisq = chi2;
+    new->chisq_dof = ndof;
   }
 
   return 0;
@@ -598,55 +630,123 @@ int FindEvents(struct CommandLineArgsTag CLA, const StringTemplate *strtemplate,
 
 /*******************************************************************************/
 
-int FindStringBurst(struct CommandLineArgsTag CLA, REAL8TimeSeries *ht, unsigned seg_length, const StringTemplate *strtemplate, int NTemplates, REAL8FFTPlan *fplan, REAL8FFTPlan *rplan, SnglBurst **head){
-  int i,m;
-  unsigned p;
-  COMPLEX16FrequencySeries *vtilde;
+int FindStringBurst(struct CommandLineArgsTag CLA, const REAL8TimeSeries *ht, unsigned seg_length, const StringTemplate *strtemplate, int NTemplates, SnglBurst **head){
+  COMPLEX16FrequencySeries **stilde;
+  SnglBurst **triggers;
+  int nseg, k;
+  int failed = 0;
+
+  /* number of overlapping chunks */
+  nseg = ceil(2*(ht->data->length*ht->deltaT)/CLA.ShortSegDuration - 1);
+  if (nseg < 0) nseg = 0;
+
+  /* FTs of the chunks, shared by all templates, and one trigger list for
+   * each (template, chunk) pair */
+  stilde = XLALCalloc(nseg, sizeof(*stilde));
+  triggers = XLALCalloc(NTemplates * nseg, sizeof(*triggers));
+  if ((nseg && !stilde) || (NTemplates > 0 && nseg && !triggers)) {
+    XLALFree(stilde);
+    XLALFree(triggers);
+    return 1;
+  }
 
-  /* create vector that will hold FFT of data;  metadata will be populated
-   * by FFT function */
-  vtilde = XLALCreateCOMPLEX16FrequencySeries( ht->name, &ht->epoch, ht->f0, 0.0, &lalDimensionlessUnit, seg_length / 2 + 1 );
+  /* each thread has its own FFT plans and workspace;  the snr time series
+   * are printed in order, so don't use threads when printing them */
+#pragma omp parallel if(!CLA.printsnrflag)
+  {
+    REAL8FFTPlan *fplan = XLALCreateForwardREAL8FFTPlan( seg_length, 1 );
+    REAL8FFTPlan *rplan = XLALCreateReverseREAL8FFTPlan( seg_length, 1 );
+    REAL8TimeSeries *vector = XLALCreateREAL8TimeSeries( ht->name, &ht->epoch, ht->f0, ht->deltaT, &ht->sampleUnits, seg_length );
+    COMPLEX16FrequencySeries *vtilde = XLALCreateCOMPLEX16FrequencySeries( ht->name, &ht->epoch, ht->f0, 0.0, &lalDimensionlessUnit, seg_length / 2 + 1 );
+    int i;
+
+    if (!fplan || !rplan || !vector || !vtilde) {
+#pragma omp atomic write
+      failed = 1;
+    }
 
-  /* loop over templates  */
-  for (m = 0; m < NTemplates; m++){
-    /* loop over overlapping chunks */
-    for(i=0; i < 2*(ht->data->length*ht->deltaT)/CLA.ShortSegDuration - 1 ;i++){
-      /* extract overlapping chunk of data */
-      REAL8TimeSeries *vector = XLALCutREAL8TimeSeries(ht, i * seg_length / 2, seg_length);
+    /* FFT each overlapping chunk of data once */
+#pragma omp for schedule(static)
+    for (i = 0; i < nseg; i++) {
+      REAL8TimeSeries *chunk;
+      int stop;
+#pragma omp atomic read
+      stop = failed;
+      if (stop) continue;
+
+      chunk = XLALCutREAL8TimeSeries(ht, i * seg_length / 2, seg_length);
+      stilde[i] = XLALCreateCOMPLEX16FrequencySeries( ht->name, &ht->epoch, ht->f0, 0.0, &lalDimensionlessUnit, seg_length / 2 + 1 );
+      if (!chunk || !stilde[i] || XLALREAL8TimeFreqFFT( stilde[i], chunk, fplan )) {
+#pragma omp atomic write
+        failed = 1;
+      }
+      XLALDestroyREAL8TimeSeries( chunk );
+    }
 
-      /* FFT it */
-      if(XLALREAL8TimeFreqFFT( vtilde, vector, fplan )) return 1;
+    /* loop over (template, chunk) pairs */
+#pragma omp for schedule(dynamic)
+    for (k = 0; k < NTemplates * nseg; k++) {
+      const StringTemplate *tmplt = &strtemplate[k / nseg];
+      COMPLEX16Sequence *workspace;
+      unsigned p;
+      int stop;
+#pragma omp atomic read
+      stop = failed;
+      if (stop) continue;
 
       /* multiply FT of data and String Filter */
+      workspace = vtilde->data;
+      *vtilde = *stilde[k % nseg];
+      vtilde->data = workspace;
       for ( p = 0 ; p < vtilde->data->length; p++ )
-        vtilde->data->data[p] *= strtemplate[m].StringFilter->data->data[p];
+        vtilde->data->data[p] = stilde[k % nseg]->data->data[p] * tmplt->StringFilter->data->data[p];
 
       /* reverse FFT it */
-      if(XLALREAL8FreqTimeFFT( vector, vtilde, rplan )) return 1;
+      if(XLALREAL8FreqTimeFFT( vector, vtilde, rplan )) {
+#pragma omp atomic write
+        failed = 1;
+        continue;
+      }
       vector->deltaT = ht->deltaT;	/* gets mucked up by round-off */
 
       /* normalise the result by template normalisation
 	 factor of 2 is from match-filter definition */
       for ( p = 0 ; p < vector->data->length; p++ )
-	vector->data->data[p] *= 2.0 / strtemplate[m].norm;
+	vector->data->data[p] *= 2.0 / tmplt->norm;
 
       /* find triggers */
-      if(FindEvents(CLA, &strtemplate[m], vector, head)) return 1;
-
-      /*
-      if(m==10){
-      	for ( int ii = 0 ; ii < vector->data->length; ii++ )
-	  printf("%.3e\n",vector->data->data[ii]);
+      if(FindEvents(CLA, tmplt, vector, &triggers[k])) {
+#pragma omp atomic write
+        failed = 1;
       }
-      */
-      /* free chunk */
-      XLALDestroyREAL8TimeSeries( vector );
     }
+
+    XLALDestroyCOMPLEX16FrequencySeries( vtilde );
+    XLALDestroyREAL8TimeSeries( vector );
+    XLALDestroyREAL8FFTPlan( fplan );
+    XLALDestroyREAL8FFTPlan( rplan );
   }
 
-  XLALDestroyCOMPLEX16FrequencySeries( vtilde );
+  /* merge the trigger lists;  they are prepended in (template, chunk) order
+   * so the result does not depend on the number of threads */
+  for (k = 0; k < NTemplates * nseg; k++) {
+    SnglBurst *last;
+    if (!triggers[k]) continue;
+    if (failed) {
+      XLALDestroySnglBurstTable(triggers[k]);
+      continue;
+    }
+    for (last = triggers[k]; last->next; last = last->next);
+    last->next = *head;
+    *head = triggers[k];
+  }
 
-  return 0;
+  for (k = 0; k < nseg; k++)
+    XLALDestroyCOMPLEX16FrequencySeries( stilde[k] );
+  XLALFree(stilde);
+  XLALFree(triggers);
+
+  return failed;
 }
 
 
@@ -31,9 +31,7 @@
 #include <math.h>
 
 
-#include <gsl/gsl_blas.h>
 #include <gsl/gsl_matrix.h>
-#include <gsl/gsl_vector.h>
 
 
 #include <lal/Date.h>
@@ -794,121 +792,164 @@ static SnglBurst *XLALTFTileToBurstEvent(
 }
 
 
-static SnglBurst *XLALComputeExcessPower(
-	const REAL8TimeFrequencyPlane *plane,
-	const LALExcessPowerFilterBank *filter_bank,
-	SnglBurst *head,
+/*
+ * Sum-of-squares cuts equivalent to the confidence threshold.  The
+ * confidence assigned to a tile is an increasing function of its sum of
+ * squares, so for each tile size there is a sum of squares below which no
+ * tile can pass the threshold.  Element k of the result is such a sum for
+ * tiles of 2^(k + 1) degrees of freedom:  tiles whose sum of squares does
+ * not exceed it are discarded without evaluating the chi^2 CCDF.  The
+ * cuts are found by bisection and are always on the safe side, so the
+ * tiles that survive are exactly those that would have survived without
+ * them.
+ */
+
+
+static REAL8Sequence *XLALExcessPowerSumSquaresCuts(
+	unsigned max_dof,
 	double confidence_threshold
 )
 {
-	gsl_vector filter_output = {
-		.size = plane->tiles.tiling_end - plane->tiles.tiling_start,
-		.stride = plane->channel_data->size2,
-		.data = NULL,
-		.block = NULL,
-		.owner = 0
-	};
-	gsl_vector_view filter_output_view;
-	gsl_vector *channel_buffer;
-	gsl_vector *unwhitened_channel_buffer;
-	unsigned channel;
-	unsigned channels;
-	unsigned channel_end;
-	double h_rss;
-	double confidence;
-	/* number of degrees of freedom in tile = number of
-	 * "virtual pixels" in tile. */
-	double tile_dof;
-	unsigned i;
+	REAL8Sequence *cuts;
+	unsigned n;
+	unsigned k;
 
-	/*
-	 * create work spaces
-	 */
+	for(n = 0; (2u << n) <= max_dof; n++);
+	cuts = XLALCreateREAL8Sequence(n ? n : 1);
+	if(!cuts)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
 
-	channel_buffer = gsl_vector_alloc(filter_output.size);
-	unwhitened_channel_buffer = gsl_vector_alloc(filter_output.size);
-	if(!channel_buffer || !unwhitened_channel_buffer) {
-		if(channel_buffer)
-			gsl_vector_free(channel_buffer);
-		if(unwhitened_channel_buffer)
-			gsl_vector_free(unwhitened_channel_buffer);
-		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	for(k = 0; k < n; k++) {
+		const double tile_dof = 2u << k;
+		/* confidence(lo) < threshold <= confidence(hi) */
+		double lo = 0;
+		double hi = tile_dof;
+		int iter;
+
+		if(confidence_threshold <= 0) {
+			/* every tile passes */
+			cuts->data[k] = -1;
+			continue;
+		}
+
+		/* see XLALComputeExcessPower() for the 0.62 */
+		while(-XLALLogChisqCCDF(hi * .62, tile_dof * .62) < confidence_threshold) {
+			if(XLALIsREAL8FailNaN(hi) || hi > 1e300) {
+				XLALDestroyREAL8Sequence(cuts);
+				XLAL_ERROR_NULL(XLAL_EFUNC);
+			}
+			lo = hi;
+			hi *= 2;
+		}
+		for(iter = 0; iter < 64 && hi - lo > 1e-9 * hi; iter++) {
+			const double mid = (lo + hi) / 2;
+			const double confidence = -XLALLogChisqCCDF(mid * .62, tile_dof * .62);
+			if(XLALIsREAL8FailNaN(confidence)) {
+				XLALDestroyREAL8Sequence(cuts);
+				XLAL_ERROR_NULL(XLAL_EFUNC);
+			}
+			if(confidence < confidence_threshold)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		cuts->data[k] = lo;
 	}
 
-	/*
-	 * enter loops.  note:  this is a quadruply-nested loop that is not
-	 * indented to help fit the code on a terminal display.
-	 */
+	return cuts;
+}
 
-	for(channels = plane->tiles.min_channels; channels <= plane->tiles.max_channels; channels *= 2) {
-		/* compute distance between "virtual pixels" for this
-		 * (wide) channel */
-		const unsigned stride = round(1.0 / (channels * plane->tiles.dof_per_pixel));
 
-	for(channel_end = (channel = 0) + channels; channel_end <= plane->channel_data->size2; channel_end = (channel += channels / plane->tiles.inv_fractional_stride) + channels) {
-		/* the root mean square of the "virtual channel",
-		 * \sqrt{\mu^{2}} in the algorithm description */
-		const double sample_rms = sqrt(channels * plane->deltaF / plane->fseries_deltaF + XLALREAL8SequenceSum(filter_bank->twice_channel_overlap, channel, channels - 1));
-		/* the root mean square of the "uwapprox" quantity computed
-		 * below, which is proportional to an approximation of the
-		 * unwhitened time series. */
-		double uwsample_rms;
-		/* true unwhitened root mean square for this channel.  the
-		 * ratio of this squared to uwsample_rms^2 is the
-		 * correction factor to be applied to uwapprox^2 to convert
-		 * it to an approximation of the square of the unwhitened
-		 * channel */
-		const double strain_rms = sqrt(compute_unwhitened_mean_square(filter_bank, channel, channels) + XLALREAL8SequenceSum(filter_bank->unwhitened_cross, channel, channels - 1));
-
-		/* compute uwsample_rms */
-		uwsample_rms = compute_unwhitened_mean_square(filter_bank, channel, channels);
-		for(i = channel; i < channel_end - 1; i++)
-			uwsample_rms += filter_bank->twice_channel_overlap->data[i] * filter_bank->basis_filters[i].unwhitened_rms * filter_bank->basis_filters[i + 1].unwhitened_rms * plane->fseries_deltaF / plane->deltaF;
-		uwsample_rms = sqrt(uwsample_rms);
-
-		/* reconstruct the time series and unwhitened time series
-		 * for this (possibly multi-filter) channel.  both time
-		 * series are normalized so that each sample has a mean
-		 * square of 1 */
-		filter_output.data = plane->channel_data->data + filter_output.stride * plane->tiles.tiling_start + channel;
-		filter_output_view = gsl_vector_subvector_with_stride(&filter_output, 0, stride, filter_output.size / stride);
-		gsl_vector_set_zero(channel_buffer);
-		gsl_vector_set_zero(unwhitened_channel_buffer);
-		channel_buffer->size = unwhitened_channel_buffer->size = filter_output_view.vector.size;
-		for(i = channel; i < channel_end; filter_output_view.vector.data++, i++) {
-			gsl_blas_daxpy(1.0 / sample_rms, &filter_output_view.vector, channel_buffer);
-			gsl_blas_daxpy(filter_bank->basis_filters[i].unwhitened_rms * sqrt(plane->fseries_deltaF / plane->deltaF) / uwsample_rms, &filter_output_view.vector, unwhitened_channel_buffer);
-		}
+/*
+ * Compute the excess power in every tile of one "virtual channel", the sum
+ * of channels channels of the time-frequency plane starting at channel.
+ * The squared samples of the virtual channel are accumulated into prefix
+ * sums, so the sum of squares of each tile is the difference of two of
+ * them.  cumsum and uwcumsum must each have room for one more than the
+ * number of samples in the channel.  Tiles above threshold are prepended
+ * to *head.
+ */
 
-#if 0
-		/* diagnostic code to dump data for the s_{j} histogram */
-		{
-		FILE *f = fopen("sj.dat", "a");
-		for(i = 0; i < channel_buffer->size; i++)
-			fprintf(f, "%g\n", gsl_vector_get(unwhitened_channel_buffer, i));
-		fclose(f);
-		}
-#endif
 
-		/* square the samples in the channel time series because
-		 * from now on that's all we'll need */
-		for(i = 0; i < channel_buffer->size; i++) {
-			gsl_vector_set(channel_buffer, i, pow(gsl_vector_get(channel_buffer, i), 2));
-			gsl_vector_set(unwhitened_channel_buffer, i, pow(gsl_vector_get(unwhitened_channel_buffer, i), 2));
+static int XLALComputeExcessPowerVirtualChannel(
+	const REAL8TimeFrequencyPlane *plane,
+	const LALExcessPowerFilterBank *filter_bank,
+	unsigned channel,
+	unsigned channels,
+	unsigned stride,
+	double confidence_threshold,
+	const REAL8Sequence *sumsquares_cut,
+	double *cumsum,
+	double *uwcumsum,
+	SnglBurst **head
+)
+{
+	const unsigned channel_end = channel + channels;
+	const unsigned n = (plane->tiles.tiling_end - plane->tiles.tiling_start) / stride;
+	const size_t tda = plane->channel_data->tda;
+	const double *data = plane->channel_data->data + plane->tiles.tiling_start * tda + channel;
+	/* the root mean square of the "virtual channel",
+	 * \sqrt{\mu^{2}} in the algorithm description */
+	const double sample_rms = sqrt(channels * plane->deltaF / plane->fseries_deltaF + XLALREAL8SequenceSum(filter_bank->twice_channel_overlap, channel, channels - 1));
+	/* the root mean square of the "uwapprox" quantity computed
+	 * below, which is proportional to an approximation of the
+	 * unwhitened time series. */
+	double uwsample_rms;
+	/* true unwhitened root mean square for this channel.  the
+	 * ratio of this squared to uwsample_rms^2 is the
+	 * correction factor to be applied to uwapprox^2 to convert
+	 * it to an approximation of the square of the unwhitened
+	 * channel */
+	const double strain_rms = sqrt(compute_unwhitened_mean_square(filter_bank, channel, channels) + XLALREAL8SequenceSum(filter_bank->unwhitened_cross, channel, channels - 1));
+	/* normalizations of the samples of the time series and of the
+	 * unwhitened time series */
+	double norm;
+	double uwnorm;
+	/* number of degrees of freedom in tile = number of
+	 * "virtual pixels" in tile. */
+	double tile_dof;
+	unsigned k;
+	unsigned i, j;
+
+	/* compute uwsample_rms */
+	uwsample_rms = compute_unwhitened_mean_square(filter_bank, channel, channels);
+	for(i = channel; i < channel_end - 1; i++)
+		uwsample_rms += filter_bank->twice_channel_overlap->data[i] * filter_bank->basis_filters[i].unwhitened_rms * filter_bank->basis_filters[i + 1].unwhitened_rms * plane->fseries_deltaF / plane->deltaF;
+	uwsample_rms = sqrt(uwsample_rms);
+	norm = 1.0 / sample_rms;
+	uwnorm = sqrt(plane->fseries_deltaF / plane->deltaF) / uwsample_rms;
+
+	/* reconstruct the time series and unwhitened time series for this
+	 * (possibly multi-filter) channel, normalized so that each sample
+	 * has a mean square of 1, and accumulate the prefix sums of their
+	 * squares because from now on that's all we'll need */
+	cumsum[0] = uwcumsum[0] = 0;
+	for(j = 0; j < n; j++, data += stride * tda) {
+		double sample = 0;
+		double uwsample = 0;
+		for(i = 0; i < channels; i++) {
+			sample += norm * data[i];
+			uwsample += filter_bank->basis_filters[channel + i].unwhitened_rms * uwnorm * data[i];
 		}
+		cumsum[j + 1] = cumsum[j] + sample * sample;
+		uwcumsum[j + 1] = uwcumsum[j] + uwsample * uwsample;
+	}
 
 	/* start with at least 2 degrees of freedom */
-	for(tile_dof = 2; tile_dof <= plane->tiles.max_length / stride; tile_dof *= 2) {
+	for(tile_dof = 2, k = 0; tile_dof <= plane->tiles.max_length / stride; tile_dof *= 2, k++) {
+		const double cut = sumsquares_cut->data[k];
 		unsigned start;
-	for(start = 0; start + tile_dof <= channel_buffer->size; start += tile_dof / plane->tiles.inv_fractional_stride) {
-		/* compute sum of squares, and unwhitened sum of squares
-		 * (samples have already been squared) */
-		double sumsquares = 0;
-		double uwsumsquares = 0;
-		for(i = start; i < start + tile_dof; i++) {
-			sumsquares += gsl_vector_get(channel_buffer, i);
-			uwsumsquares += gsl_vector_get(unwhitened_channel_buffer, i);
-		}
+	for(start = 0; start + tile_dof <= n; start += tile_dof / plane->tiles.inv_fractional_stride) {
+		/* sum of squares, and unwhitened sum of squares */
+		const double sumsquares = cumsum[start + (unsigned) tile_dof] - cumsum[start];
+		const double uwsumsquares = uwcumsum[start + (unsigned) tile_dof] - uwcumsum[start];
+		double confidence;
+
+		/* only tiles whose statistical confidence can be above
+		 * threshold and that have real-valued h_rss can be
+		 * recorded */
+		if(sumsquares <= cut || uwsumsquares < tile_dof)
+			continue;
 
 		/* compute statistical confidence */
 		/* FIXME:  the 0.62 is an empirically determined
@@ -919,37 +960,114 @@ static SnglBurst *XLALComputeExcessPower(
 		 * non-zero inner product of the time-domain impulse
 		 * response of the channel filter for adjacent pixels */
 		confidence = -XLALLogChisqCCDF(sumsquares * .62, tile_dof * .62);
-		if(XLALIsREAL8FailNaN(confidence)) {
-			gsl_vector_free(channel_buffer);
-			gsl_vector_free(unwhitened_channel_buffer);
-			XLAL_ERROR_NULL(XLAL_EFUNC);
-		}
+		if(XLALIsREAL8FailNaN(confidence))
+			XLAL_ERROR(XLAL_EFUNC);
 
 		/* record tiles whose statistical confidence is above
-		 * threshold and that have real-valued h_rss */
-		if((confidence >= confidence_threshold) && (uwsumsquares >= tile_dof)) {
-			SnglBurst *oldhead = head;
+		 * threshold */
+		if(confidence >= confidence_threshold) {
+			SnglBurst *oldhead = *head;
 
 			/* compute h_rss */
-			h_rss = sqrt((uwsumsquares - tile_dof) * (stride * plane->deltaT)) * strain_rms;
+			const double h_rss = sqrt((uwsumsquares - tile_dof) * (stride * plane->deltaT)) * strain_rms;
 
 			/* add new event to head of linked list */
-			head = XLALTFTileToBurstEvent(plane, plane->tiles.tiling_start + (start - 0.5) * stride, tile_dof * stride, plane->flow + (channel + .5 * channels) * plane->deltaF, channels * plane->deltaF, h_rss, sumsquares, tile_dof, confidence);
-			if(!head) {
-				gsl_vector_free(channel_buffer);
-				gsl_vector_free(unwhitened_channel_buffer);
-				XLAL_ERROR_NULL(XLAL_EFUNC);
+			*head = XLALTFTileToBurstEvent(plane, plane->tiles.tiling_start + (start - 0.5) * stride, tile_dof * stride, plane->flow + (channel + .5 * channels) * plane->deltaF, channels * plane->deltaF, h_rss, sumsquares, tile_dof, confidence);
+			if(!*head) {
+				*head = oldhead;
+				XLAL_ERROR(XLAL_EFUNC);
 			}
-			head->next = oldhead;
+			(*head)->next = oldhead;
 		}
 	}
 	}
-	}
+
+	return 0;
+}
+
+
+/*
+ * Compute the excess power for every tile in the time-frequency plane, and
+ * prepend those above threshold to head.  The virtual channels of each
+ * bandwidth are analyzed in parallel, and their events are joined in
+ * channel order so that the list is the same regardless of the number of
+ * threads.
+ */
+
+
+static SnglBurst *XLALComputeExcessPower(
+	const REAL8TimeFrequencyPlane *plane,
+	const LALExcessPowerFilterBank *filter_bank,
+	SnglBurst *head,
+	double confidence_threshold,
+	const REAL8Sequence *sumsquares_cut
+)
+{
+	const unsigned length = plane->tiles.tiling_end - plane->tiles.tiling_start;
+	unsigned channels;
+
+	for(channels = plane->tiles.min_channels; channels <= plane->tiles.max_channels; channels *= 2) {
+		/* compute distance between "virtual pixels" for this
+		 * (wide) channel */
+		const unsigned stride = round(1.0 / (channels * plane->tiles.dof_per_pixel));
+		const unsigned channel_step = channels / plane->tiles.inv_fractional_stride;
+		const unsigned n_virtual = plane->channel_data->size2 < channels ? 0 : (plane->channel_data->size2 - channels) / channel_step + 1;
+		SnglBurst **heads;
+		int failed = 0;
+		unsigned k;
+
+		if(!n_virtual)
+			continue;
+		heads = XLALCalloc(n_virtual, sizeof(*heads));
+		if(!heads)
+			XLAL_ERROR_NULL(XLAL_EFUNC);
+
+#pragma omp parallel
+		{
+		double *cumsum = XLALMalloc(2 * (length / stride + 1) * sizeof(*cumsum));
+		int i;
+
+		if(!cumsum) {
+#pragma omp atomic write
+			failed = 1;
+		}
+
+#pragma omp for schedule(dynamic)
+		for(i = 0; i < (int) n_virtual; i++) {
+			int stop;
+#pragma omp atomic read
+			stop = failed;
+			if(stop)
+				continue;
+			if(XLALComputeExcessPowerVirtualChannel(plane, filter_bank, i * channel_step, channels, stride, confidence_threshold, sumsquares_cut, cumsum, cumsum + length / stride + 1, &heads[i]) < 0) {
+#pragma omp atomic write
+				failed = 1;
+			}
+		}
+
+		XLALFree(cumsum);
+		}
+
+		/* join the events in the order in which a serial loop over
+		 * the virtual channels would have produced them */
+		for(k = 0; k < n_virtual; k++) {
+			SnglBurst *tail = heads[k];
+			if(!tail)
+				continue;
+			while(tail->next)
+				tail = tail->next;
+			tail->next = head;
+			head = heads[k];
+		}
+		XLALFree(heads);
+
+		if(failed) {
+			XLALDestroySnglBurstTable(head);
+			XLAL_ERROR_NULL(XLAL_EFUNC);
+		}
 	}
 
 	/* success */
-	gsl_vector_free(channel_buffer);
-	gsl_vector_free(unwhitened_channel_buffer);
 	return head;
 }
 
@@ -988,6 +1106,7 @@ SnglBurst *XLALEPSearch(
 	REAL8TimeSeries *cuttseries = NULL;
 	LALExcessPowerFilterBank *filter_bank = NULL;
 	REAL8TimeFrequencyPlane *plane = NULL;
+	REAL8Sequence *sumsquares_cut = NULL;
 
 	/*
 	 * Construct forward and reverse FFT plans, storage for the PSD,
@@ -1009,6 +1128,17 @@ SnglBurst *XLALEPSearch(
 		goto error;
 	}
 
+	/*
+	 * Convert the confidence threshold to a sum-of-squares cut for
+	 * each tile size.
+	 */
+
+	sumsquares_cut = XLALExcessPowerSumSquaresCuts(plane->tiles.max_length, confidence_threshold);
+	if(!sumsquares_cut) {
+		errorcode = XLAL_EFUNC;
+		goto error;
+	}
+
 #if 0
 	/* diagnostic code to replace the input time series with stationary
 	 * Gaussian white noise.  the normalization is such that it yields
@@ -1137,7 +1267,7 @@ SnglBurst *XLALEPSearch(
 
 		XLALPrintInfo("%s(): computing the excess power for each tile\n", __func__);
 		XLALClearErrno();
-		head = XLALComputeExcessPower(plane, filter_bank, head, confidence_threshold);
+		head = XLALComputeExcessPower(plane, filter_bank, head, confidence_threshold, sumsquares_cut);
 		if(xlalErrno) {
 			errorcode = XLAL_EFUNC;
 			goto error;
@@ -1158,6 +1288,7 @@ SnglBurst *XLALEPSearch(
 	XLALDestroyCOMPLEX16FrequencySeries(fseries);
 	XLALDestroyExcessPowerFilterBank(filter_bank);
 	XLALDestroyTFPlane(plane);
+	XLALDestroyREAL8Sequence(sumsquares_cut);
 	if(errorcode) {
 		XLALDestroySnglBurstTable(head);
 		XLAL_ERROR_NULL(errorcode);
@@ -33,6 +33,7 @@
 #include <lal/FrequencySeries.h>
 #include <lal/TimeFreqFFT.h>
 #include <lal/LALInferenceDistanceMarg.h>
+#include <lal/LALProfile.h>
 
 #include <gsl/gsl_sf_bessel.h>
 #include <gsl/gsl_sf_dawson.h>
@@ -314,10 +315,13 @@ REAL8 LALInferenceUndecomposedFreqDomainLogLikelihood(LALInferenceVariables *cur
                                                       LALInferenceIFOData *data,
                                                       LALInferenceModel *model)
 {
-  return LALInferenceFusedFreqDomainLogLikelihood(currentParams,
+  XLAL_PROFILE_BEGIN("LALInferenceUndecomposedFreqDomainLogLikelihood");
+  REAL8 loglikelihood = LALInferenceFusedFreqDomainLogLikelihood(currentParams,
                                                  data,
                                                  model,
                                                   GAUSSIAN);
+  XLAL_PROFILE_END("LALInferenceUndecomposedFreqDomainLogLikelihood");
+  return loglikelihood;
 }
 
 
@@ -1635,7 +1639,10 @@ REAL8 LALInferenceMarginalisedTimeLogLikelihood(LALInferenceVariables *currentPa
                                                 LALInferenceModel *model)
 {
 
-  return ( LALInferenceFusedFreqDomainLogLikelihood(currentParams,data,model,MARGTIME));
+  XLAL_PROFILE_BEGIN("LALInferenceMarginalisedTimeLogLikelihood");
+  REAL8 loglikelihood = LALInferenceFusedFreqDomainLogLikelihood(currentParams,data,model,MARGTIME);
+  XLAL_PROFILE_END("LALInferenceMarginalisedTimeLogLikelihood");
+  return ( loglikelihood );
 
 
 }
@@ -1645,7 +1652,10 @@ REAL8 LALInferenceMarginalisedTimePhaseLogLikelihood(LALInferenceVariables *curr
                                                 LALInferenceModel *model)
 {
 
-  return ( LALInferenceFusedFreqDomainLogLikelihood(currentParams,data,model,MARGTIMEPHI));
+  XLAL_PROFILE_BEGIN("LALInferenceMarginalisedTimePhaseLogLikelihood");
+  REAL8 loglikelihood = LALInferenceFusedFreqDomainLogLikelihood(currentParams,data,model,MARGTIMEPHI);
+  XLAL_PROFILE_END("LALInferenceMarginalisedTimePhaseLogLikelihood");
+  return ( loglikelihood );
 
 
 }
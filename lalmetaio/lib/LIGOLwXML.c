@@ -52,11 +52,28 @@
  */
 
 
+#include <float.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <lal/FileIO.h>
 #include <lal/LALMalloc.h>
 #include <lal/LIGOLwXML.h>
 #include <lal/XLALError.h>
 #include <LIGOLwXMLHeaders.h>
+#include "LIGOLwXML_internal.h"
+
+
+/* size of the block buffer of a row writer */
+#define LIGOLW_XML_ROW_BUFFER_SIZE (1 << 20)
+
+/* longest text of one column that is not a string;  a real has at most
+ * 17 significant digits, a sign, a decimal point, 4 leading zeros and a
+ * 5 character exponent */
+#define LIGOLW_XML_ROW_COLUMN_MAX 64
 
 
 /**
@@ -167,3 +184,346 @@ int XLALCreateLIGODataFileName(
       /* return success */
       return 0;
 }
+
+
+/*
+ * ============================================================================
+ *
+ *                                 Row Writer
+ *
+ * ============================================================================
+ */
+
+
+/**
+ * Start writing the rows of a table to an XML stream.  The Stream element
+ * must already have been opened.  The block buffer is allocated here and
+ * freed by XLALLIGOLwXMLRowWriterClose().
+ */
+int XLALLIGOLwXMLRowWriterOpen(
+	LIGOLwXMLRowWriter *row,
+	LIGOLwXMLStream *xml
+)
+{
+	if(!row || !xml)
+		XLAL_ERROR(XLAL_EFAULT);
+	row->fp = xml->fp;
+	row->buf = XLALMalloc(LIGOLW_XML_ROW_BUFFER_SIZE);
+	if(!row->buf)
+		XLAL_ERROR(XLAL_ENOMEM);
+	row->len = 0;
+	row->rows = 0;
+	row->first = 1;
+	row->error = 0;
+	return 0;
+}
+
+
+/*
+ * write the block buffer to the file, and empty it
+ */
+
+
+static void row_flush(LIGOLwXMLRowWriter *row)
+{
+	if(row->len && !row->error && XLALFileWrite(row->buf, 1, row->len, row->fp) != row->len)
+		row->error = 1;
+	row->len = 0;
+}
+
+
+/*
+ * return room for n more bytes in the block buffer, or NULL if there is
+ * not room even in an empty buffer, or an earlier block could not be
+ * written
+ */
+
+
+static char *row_reserve(LIGOLwXMLRowWriter *row, size_t n)
+{
+	if(LIGOLW_XML_ROW_BUFFER_SIZE - row->len < n)
+		row_flush(row);
+	if(LIGOLW_XML_ROW_BUFFER_SIZE < n)
+		row->error = 1;
+	return row->error ? NULL : row->buf + row->len;
+}
+
+
+/**
+ * Write the remaining rows to the file, and free the block buffer.
+ * Returns 0 on success, or XLAL_FAILURE if any of the rows could not be
+ * written.
+ */
+int XLALLIGOLwXMLRowWriterClose(
+	LIGOLwXMLRowWriter *row
+)
+{
+	int error;
+	if(!row)
+		XLAL_ERROR(XLAL_EFAULT);
+	row_flush(row);
+	error = row->error;
+	XLALFree(row->buf);
+	row->buf = NULL;
+	if(error)
+		XLAL_ERROR(XLAL_EIO);
+	return 0;
+}
+
+
+/**
+ * Begin a new row.  The rows of a Stream are separated by a comma and
+ * start on a new, indented, line.
+ */
+void XLALLIGOLwXMLRowBegin(
+	LIGOLwXMLRowWriter *row
+)
+{
+	static const char row_head[] = ",\n\t\t\t";
+	const char *head = row->rows ? row_head : row_head + 1;
+	size_t n = row->rows ? sizeof(row_head) - 1 : sizeof(row_head) - 2;
+	char *s = row_reserve(row, n);
+	row->rows++;
+	row->first = 1;
+	if(!s)
+		return;
+	memcpy(s, head, n);
+	row->len += n;
+}
+
+
+/*
+ * return room for n more bytes of the current column, after the comma
+ * separating it from the previous column in the row, or NULL as
+ * row_reserve()
+ */
+
+
+static char *column_reserve(LIGOLwXMLRowWriter *row, size_t n)
+{
+	char *s = row_reserve(row, n + 1);
+	if(s && !row->first)
+		*s++ = ',';
+	row->first = 0;
+	return s;
+}
+
+
+/*
+ * write the decimal digits of an unsigned integer to s, and return the
+ * end of the text
+ */
+
+
+static char *format_uint(char *s, uint64_t value)
+{
+	char digits[20];
+	char *d = digits + sizeof(digits);
+	do {
+		*--d = '0' + value % 10;
+		value /= 10;
+	} while(value);
+	memcpy(s, d, digits + sizeof(digits) - d);
+	return s + (digits + sizeof(digits) - d);
+}
+
+
+/**
+ * Write an integer column, as by \c %ld.
+ */
+void XLALLIGOLwXMLRowInt(
+	LIGOLwXMLRowWriter *row,
+	long value
+)
+{
+	char *s = column_reserve(row, LIGOLW_XML_ROW_COLUMN_MAX);
+	char *end;
+	if(!s)
+		return;
+	if(value < 0) {
+		*s = '-';
+		end = format_uint(s + 1, -(uint64_t) value);
+	} else
+		end = format_uint(s, value);
+	row->len = end - row->buf;
+}
+
+
+/**
+ * Write an unsigned integer column, as by \c %lu.
+ */
+void XLALLIGOLwXMLRowUInt(
+	LIGOLwXMLRowWriter *row,
+	unsigned long value
+)
+{
+	char *s = column_reserve(row, LIGOLW_XML_ROW_COLUMN_MAX);
+	if(s)
+		row->len = format_uint(s, value) - row->buf;
+}
+
+
+/*
+ * write value to s as by %.<precision>g, and return the end of the text.
+ * value is scaled by an exact power of ten to a precision-digit number,
+ * and the rounding error of the scaling is recovered with fma(), so the
+ * digits are exact unless the scaled value is within a few ulp of a
+ * rounding tie.  Everything else --- ties, values whose rounding carries
+ * into the next decade, very large and small exponents, non-finite values
+ * --- is left to snprintf().
+ */
+
+
+static char *format_real(char *s, double value, int precision)
+{
+	static const double powers_of_ten[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	char digits[17];
+	double x, scaled, error, whole, frac, rounded;
+	uint64_t mantissa;
+	int exponent, shift, ndigits, i;
+
+	if(!isfinite(value) || precision < 1 || precision > 16)
+		goto fallback;
+	if(value == 0) {
+		if(signbit(value))
+			*s++ = '-';
+		*s++ = '0';
+		return s;
+	}
+
+	x = fabs(value);
+	exponent = floor(log10(x));
+	shift = precision - 1 - exponent;
+	if(shift > 22 || shift < -22)
+		goto fallback;
+	if(shift >= 0) {
+		scaled = x * powers_of_ten[shift];
+		error = fma(x, powers_of_ten[shift], -scaled);
+	} else {
+		scaled = x / powers_of_ten[-shift];
+		error = fma(-scaled, powers_of_ten[-shift], x) / powers_of_ten[-shift];
+	}
+	if(!(scaled < powers_of_ten[precision]))
+		goto fallback;
+	/* round whole + frac, the exact scaled value to within 2^-51, to the
+	 * nearest integer */
+	whole = floor(scaled);
+	frac = (scaled - whole) + error;
+	rounded = floor(frac + 0.5);
+	if(fabs(frac - (rounded - 0.5)) <= 4 * DBL_EPSILON)
+		goto fallback;
+	/* a misjudged exponent, or rounding into the next decade */
+	if(whole < powers_of_ten[precision - 1] || (whole == powers_of_ten[precision - 1] && frac < 0))
+		goto fallback;
+	mantissa = (uint64_t) whole + (int64_t) rounded;
+	if(mantissa >= (uint64_t) powers_of_ten[precision])
+		goto fallback;
+
+	/* the significant digits, without trailing zeros */
+	for(i = precision - 1; i >= 0; i--) {
+		digits[i] = '0' + mantissa % 10;
+		mantissa /= 10;
+	}
+	for(ndigits = precision; ndigits > 1 && digits[ndigits - 1] == '0'; ndigits--);
+
+	if(value < 0)
+		*s++ = '-';
+	if(exponent < -4 || exponent >= precision) {
+		/* style e */
+		*s++ = digits[0];
+		if(ndigits > 1) {
+			*s++ = '.';
+			memcpy(s, digits + 1, ndigits - 1);
+			s += ndigits - 1;
+		}
+		*s++ = 'e';
+		*s++ = exponent < 0 ? '-' : '+';
+		if(abs(exponent) < 10)
+			*s++ = '0';
+		s = format_uint(s, abs(exponent));
+	} else if(exponent >= 0) {
+		/* style f, |value| >= 1 */
+		memcpy(s, digits, exponent + 1);
+		s += exponent + 1;
+		if(ndigits > exponent + 1) {
+			*s++ = '.';
+			memcpy(s, digits + exponent + 1, ndigits - exponent - 1);
+			s += ndigits - exponent - 1;
+		}
+	} else {
+		/* style f, |value| < 1 */
+		*s++ = '0';
+		*s++ = '.';
+		for(i = exponent + 1; i < 0; i++)
+			*s++ = '0';
+		memcpy(s, digits, ndigits);
+		s += ndigits;
+	}
+	return s;
+
+fallback:
+	return s + snprintf(s, LIGOLW_XML_ROW_COLUMN_MAX, "%.*g", precision, value);
+}
+
+
+/**
+ * Write a real column, as by <tt>%.<em>precision</em>g</tt>.
+ */
+void XLALLIGOLwXMLRowReal(
+	LIGOLwXMLRowWriter *row,
+	double value,
+	int precision
+)
+{
+	char *s = column_reserve(row, LIGOLW_XML_ROW_COLUMN_MAX);
+	if(s)
+		row->len = format_real(s, value, precision) - row->buf;
+}
+
+
+/**
+ * Write a string column, as by <tt>"%s"</tt>.  The string is not escaped.
+ */
+void XLALLIGOLwXMLRowString(
+	LIGOLwXMLRowWriter *row,
+	const char *value
+)
+{
+	size_t n = strlen(value);
+	char *s = column_reserve(row, n + 2);
+	if(!s)
+		return;
+	*s++ = '"';
+	memcpy(s, value, n);
+	s += n;
+	*s++ = '"';
+	row->len = s - row->buf;
+}
+
+
+/**
+ * Write a column formatted by the printf()-style format fmt, for the few
+ * columns that are not written with one of the conversions above.
+ */
+void XLALLIGOLwXMLRowPrintf(
+	LIGOLwXMLRowWriter *row,
+	const char *fmt,
+	...
+)
+{
+	va_list ap;
+	char *s = column_reserve(row, LIGOLW_XML_ROW_COLUMN_MAX);
+	int n;
+	if(!s)
+		return;
+	va_start(ap, fmt);
+	n = vsnprintf(s, LIGOLW_XML_ROW_COLUMN_MAX, fmt, ap);
+	va_end(ap);
+	if(n < 0 || n >= LIGOLW_XML_ROW_COLUMN_MAX)
+		row->error = 1;
+	else
+		row->len = s + n - row->buf;
+}
@@ -46,6 +46,7 @@
 #include <stdlib.h>
 #include <lal/FileIO.h>
 #include <lal/LALAtomicDatatypes.h>
+#include <lal/LIGOMetadataColumns.h>
 #include <lal/LIGOMetadataTables.h>
 
 #if defined(__cplusplus)
@@ -109,6 +110,16 @@ int XLALWriteLIGOLwXMLSnglInspiralTable(
 	const SnglInspiralTable *sngl_inspiral
 );
 
+int XLALWriteLIGOLwXMLSnglBurstColumns(
+	LIGOLwXMLStream *xml,
+	const SnglBurstColumns *cols
+);
+
+int XLALWriteLIGOLwXMLSnglInspiralColumns(
+	LIGOLwXMLStream *xml,
+	const SnglInspiralColumns *cols
+);
+
 int XLALWriteLIGOLwXMLSimBurstTable(
 	LIGOLwXMLStream *,
 	const SimBurst *
@@ -43,6 +43,7 @@
 #ifndef _LIGOLWXMLREAD_H
 #define _LIGOLWXMLREAD_H
 
+#include <lal/LIGOMetadataColumns.h>
 #include <lal/LIGOMetadataTables.h>
 
 #ifdef  __cplusplus
@@ -124,6 +125,18 @@ XLALSearchSummaryTableFromLIGOLw (
     const char *fileName
 );
 
+/* native Stream readers, in LIGOLwXMLStreamRead.c */
+
+SnglInspiralColumns *
+XLALSnglInspiralColumnsFromLIGOLw (
+    const char *filename
+);
+
+SnglBurstColumns *
+XLALSnglBurstColumnsFromLIGOLw (
+    const char *filename
+);
+
 #ifdef  __cplusplus
 }
 #endif
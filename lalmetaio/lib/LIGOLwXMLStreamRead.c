@@ -0,0 +1,829 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/*
+ * Native reader for the Stream elements of LIGO Light Weight XML tables.
+ *
+ * The document is memory-mapped when it is an uncompressed regular file
+ * and loaded into memory otherwise.  The requested table is located by a
+ * simple scan for its Table element, its Column elements are matched
+ * against a descriptor list for the row structure, and the Stream body is
+ * then parsed in two passes:  a sequential pass that finds the start of
+ * each row (this must respect quoting, so cannot be split), and a pass that
+ * converts the rows directly into their final location, run in parallel
+ * over blocks of rows when OpenMP is available.
+ *
+ * This is not a general XML parser.  It relies on the document being in
+ * the form written by LAL and by the glue/ligolw libraries:  one Table
+ * element per table name, Column elements preceding the Stream element,
+ * and no comments or CDATA inside the table.
+ */
+
+
+#include <config.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+#include <lal/Date.h>
+#include <lal/FileIO.h>
+#include <lal/LALMalloc.h>
+#include <lal/LIGOLwXMLRead.h>
+#include <lal/LIGOMetadataColumns.h>
+#include <lal/LIGOMetadataTables.h>
+#include <lal/XLALError.h>
+
+
+/*
+ * ============================================================================
+ *
+ *                                  Documents
+ *
+ * ============================================================================
+ */
+
+
+struct ligolw_document {
+	const char *data;
+	size_t length;
+	char *loaded;		/* non-NULL if read into memory */
+	void *mapped;		/* non-NULL if memory-mapped */
+};
+
+
+static int ligolw_document_open(struct ligolw_document *doc, const char *filename)
+{
+	memset(doc, 0, sizeof(*doc));
+
+#ifdef HAVE_SYS_MMAN_H
+	if(XLALFileIsCompressed(filename) == 0) {
+		struct stat st;
+		int fd = open(filename, O_RDONLY);
+		if(fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(map != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+				madvise(map, st.st_size, MADV_SEQUENTIAL);
+#endif
+				doc->mapped = map;
+				doc->data = map;
+				doc->length = st.st_size;
+			}
+		}
+		if(fd >= 0)
+			close(fd);
+		if(doc->mapped)
+			return 0;
+	}
+	XLALClearErrno();
+#endif
+
+	/* compressed, or memory mapping not available */
+	doc->loaded = XLALFileLoad(filename);
+	if(!doc->loaded) {
+		XLALPrintError("%s(): error opening \"%s\"\n", __func__, filename);
+		XLAL_ERROR(XLAL_EIO);
+	}
+	doc->data = doc->loaded;
+	doc->length = strlen(doc->loaded);
+
+	return 0;
+}
+
+
+static void ligolw_document_close(struct ligolw_document *doc)
+{
+#ifdef HAVE_SYS_MMAN_H
+	if(doc->mapped)
+		munmap(doc->mapped, doc->length);
+#endif
+	XLALFree(doc->loaded);
+	memset(doc, 0, sizeof(*doc));
+}
+
+
+/* find needle in [s, end), or return NULL */
+static const char *ligolw_find(const char *s, const char *end, const char *needle)
+{
+	const size_t n = strlen(needle);
+
+	while(end - s >= (ptrdiff_t) n) {
+		s = memchr(s, needle[0], end - s - n + 1);
+		if(!s)
+			return NULL;
+		if(!memcmp(s, needle, n))
+			return s;
+		s++;
+	}
+	return NULL;
+}
+
+
+/*
+ * extract the value of an attribute from the start tag [tag, tag_end).
+ * the value is returned as a pointer/length pair into the document
+ */
+static int ligolw_attribute(const char *tag, const char *tag_end, const char *name, const char **value, size_t *length)
+{
+	const size_t n = strlen(name);
+	const char *s = tag;
+
+	while((s = ligolw_find(s, tag_end, name))) {
+		const char *v = s + n;
+		/* must be a whole attribute name followed by =" */
+		if(s > tag && (s[-1] == ' ' || s[-1] == '\t' || s[-1] == '\n' || s[-1] == '\r') && v + 1 < tag_end && v[0] == '=' && (v[1] == '"' || v[1] == '\'')) {
+			const char quote = v[1];
+			const char *e = memchr(v + 2, quote, tag_end - (v + 2));
+			if(!e)
+				return -1;
+			*value = v + 2;
+			*length = e - (v + 2);
+			return 0;
+		}
+		s = v;
+	}
+	return -1;
+}
+
+
+/* strip "table:" prefixes and a ":table" suffix from a name */
+static void ligolw_strip_name(const char **name, size_t *length, const char *suffix)
+{
+	const size_t n = strlen(suffix);
+	const char *colon;
+
+	if(*length >= n && !memcmp(*name + *length - n, suffix, n))
+		*length -= n;
+	while((colon = memchr(*name, ':', *length))) {
+		*length -= colon + 1 - *name;
+		*name = colon + 1;
+	}
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                              Value conversion
+ *
+ * ============================================================================
+ */
+
+
+/* exactly representable powers of ten */
+static const double ligolw_pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+/*
+ * convert [s, end) to a double.  numbers with at most 15 significant
+ * digits and a decimal exponent of at most 22 in magnitude are converted
+ * exactly with a single multiplication or division (Clinger's fast path);
+ * anything else is handed to strtod()
+ */
+static int ligolw_parse_real8(const char *s, const char *end, double *value)
+{
+	const char *p = s;
+	unsigned long long mantissa = 0;
+	int digits = 0;
+	int exponent = 0;
+	int negative = 0;
+	int any = 0;
+
+	if(p < end && (*p == '-' || *p == '+'))
+		negative = *p++ == '-';
+	while(p < end && *p == '0') {
+		p++;
+		any = 1;
+	}
+	for(; p < end && *p >= '0' && *p <= '9'; p++, any = 1)
+		if(digits < 19) {
+			mantissa = 10 * mantissa + (*p - '0');
+			digits++;
+		} else
+			exponent++;
+	if(p < end && *p == '.') {
+		p++;
+		if(!digits)
+			for(; p < end && *p == '0'; p++, any = 1)
+				exponent--;
+		for(; p < end && *p >= '0' && *p <= '9'; p++, any = 1)
+			if(digits < 19) {
+				mantissa = 10 * mantissa + (*p - '0');
+				digits++;
+				exponent--;
+			}
+	}
+	if(any && p < end && (*p == 'e' || *p == 'E')) {
+		int e = 0, eneg = 0;
+		p++;
+		if(p < end && (*p == '-' || *p == '+'))
+			eneg = *p++ == '-';
+		if(p == end || *p < '0' || *p > '9')
+			return -1;
+		for(; p < end && *p >= '0' && *p <= '9'; p++)
+			if(e < 100000)
+				e = 10 * e + (*p - '0');
+		exponent += eneg ? -e : e;
+	}
+
+	if(any && p == end && digits <= 15) {
+		if(mantissa == 0) {
+			*value = negative ? -0.0 : 0.0;
+			return 0;
+		}
+		if(exponent >= -22 && exponent <= 22) {
+			double x = (double) mantissa;
+			x = exponent < 0 ? x / ligolw_pow10[-exponent] : x * ligolw_pow10[exponent];
+			*value = negative ? -x : x;
+			return 0;
+		}
+	}
+
+	/* slow path:  long mantissas, large exponents, inf, nan */
+	{
+		char buf[128];
+		char *stop;
+		if(end - s >= (ptrdiff_t) sizeof(buf))
+			return -1;
+		memcpy(buf, s, end - s);
+		buf[end - s] = '\0';
+		*value = strtod(buf, &stop);
+		if(stop == buf || *stop)
+			return -1;
+	}
+	return 0;
+}
+
+
+static int ligolw_parse_int8(const char *s, const char *end, long long *value)
+{
+	const char *p = s;
+	unsigned long long x = 0;
+	int negative = 0;
+
+	if(p < end && (*p == '-' || *p == '+'))
+		negative = *p++ == '-';
+	if(p == end)
+		return -1;
+	for(; p < end; p++) {
+		if(*p < '0' || *p > '9' || x > (~0ULL - 9) / 10)
+			return -1;
+		x = 10 * x + (*p - '0');
+	}
+	if(x > (unsigned long long) 9223372036854775807LL + negative)
+		return -1;
+	*value = negative ? (long long) (0 - x) : (long long) x;
+	return 0;
+}
+
+
+/* copy a quoted string [s, end), undoing backslash escapes */
+static void ligolw_parse_string(const char *s, const char *end, char *dst, size_t size)
+{
+	size_t n = 0;
+
+	for(; s < end && n + 1 < size; s++) {
+		if(*s == '\\' && s + 1 < end)
+			s++;
+		dst[n++] = *s;
+	}
+	dst[n] = '\0';
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                               Table streams
+ *
+ * ============================================================================
+ */
+
+
+enum ligolw_type {
+	LIGOLW_INT_4S,
+	LIGOLW_INT_8S,
+	LIGOLW_REAL_4,
+	LIGOLW_REAL_8,
+	LIGOLW_LSTRING
+};
+
+
+/* where a column is stored in the row structure */
+struct ligolw_column {
+	const char *name;
+	enum ligolw_type type;
+	size_t offset;
+	size_t size;		/* for strings */
+};
+
+
+struct ligolw_table_stream {
+	struct ligolw_document doc;
+	const char *end;	/* end of Stream body */
+	char delimiter;
+	size_t ncolumns;	/* number of columns in the Stream */
+	const struct ligolw_column **map;	/* descriptor of each, or NULL */
+	size_t nrows;
+	const char **rows;	/* start of each row */
+};
+
+
+static int ligolw_type_matches(enum ligolw_type type, const char *name, size_t length)
+{
+	static const char *const names[][3] = {
+		[LIGOLW_INT_4S] = {"int_4s", "int", NULL},
+		[LIGOLW_INT_8S] = {"int_8s", "long", NULL},
+		[LIGOLW_REAL_4] = {"real_4", "float", NULL},
+		[LIGOLW_REAL_8] = {"real_8", "double", NULL},
+		[LIGOLW_LSTRING] = {"lstring", "string", NULL},
+	};
+	int i;
+
+	for(i = 0; names[type][i]; i++)
+		if(strlen(names[type][i]) == length && !memcmp(names[type][i], name, length))
+			return 1;
+	return 0;
+}
+
+
+/*
+ * find the next token in [*p, end).  on return [*start, *stop) holds the
+ * token with surrounding whitespace and quotes removed, *p points past the
+ * delimiter following it, and *quoted says whether it was quoted.  returns
+ * 1 if a token was found, 0 at the end of the stream, -1 on a syntax error
+ */
+static int ligolw_next_token(const char **p, const char *end, char delimiter, const char **start, const char **stop, int *quoted)
+{
+	const char *s = *p;
+
+	while(s < end && (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r'))
+		s++;
+	if(s == end)
+		return 0;
+
+	if(*s == '"') {
+		*quoted = 1;
+		*start = ++s;
+		while(s < end && *s != '"')
+			s += *s == '\\' ? 2 : 1;
+		if(s >= end)
+			return -1;
+		*stop = s++;
+		while(s < end && (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r'))
+			s++;
+	} else {
+		const char *e;
+		*quoted = 0;
+		*start = s;
+		while(s < end && *s != delimiter)
+			s++;
+		for(e = s; e > *start && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\n' || e[-1] == '\r'); e--);
+		*stop = e;
+	}
+
+	if(s < end) {
+		if(*s != delimiter)
+			return -1;
+		s++;
+	}
+	*p = s;
+	return 1;
+}
+
+
+static void ligolw_table_stream_close(struct ligolw_table_stream *stream)
+{
+	XLALFree(stream->map);
+	XLALFree(stream->rows);
+	ligolw_document_close(&stream->doc);
+}
+
+
+/*
+ * open the named table, match its columns against the descriptors, and
+ * find the start of every row
+ */
+static int ligolw_table_stream_open(struct ligolw_table_stream *stream, const char *filename, const char *table_name, const struct ligolw_column *columns, size_t ncolumns)
+{
+	const char *doc_end;
+	const char *table = NULL;
+	const char *stream_tag;
+	const char *p;
+	const char *value;
+	size_t length;
+	size_t capacity = 0;
+	size_t ntokens = 0;
+	size_t i;
+
+	memset(stream, 0, sizeof(*stream));
+	if(ligolw_document_open(&stream->doc, filename))
+		XLAL_ERROR(XLAL_EFUNC);
+	doc_end = stream->doc.data + stream->doc.length;
+
+	/* find the table */
+
+	for(p = stream->doc.data; (p = ligolw_find(p, doc_end, "<Table")); p++) {
+		const char *tag_end = memchr(p, '>', doc_end - p);
+		if(!tag_end)
+			break;
+		if(!ligolw_attribute(p, tag_end, "Name", &value, &length)) {
+			ligolw_strip_name(&value, &length, ":table");
+			if(length == strlen(table_name) && !memcmp(value, table_name, length)) {
+				table = tag_end + 1;
+				break;
+			}
+		}
+	}
+	if(!table) {
+		ligolw_table_stream_close(stream);
+		XLALPrintError("%s(): cannot find %s table in \"%s\"\n", __func__, table_name, filename);
+		XLAL_ERROR(XLAL_EIO);
+	}
+
+	/* columns */
+
+	stream_tag = ligolw_find(table, doc_end, "<Stream");
+	if(!stream_tag) {
+		ligolw_table_stream_close(stream);
+		XLALPrintError("%s(): %s table has no Stream\n", __func__, table_name);
+		XLAL_ERROR(XLAL_EIO);
+	}
+	for(p = table; (p = ligolw_find(p, stream_tag, "<Column")); p++)
+		stream->ncolumns++;
+	stream->map = XLALCalloc(stream->ncolumns ? stream->ncolumns : 1, sizeof(*stream->map));
+	if(!stream->map) {
+		ligolw_table_stream_close(stream);
+		XLAL_ERROR(XLAL_ENOMEM);
+	}
+	for(p = table, i = 0; (p = ligolw_find(p, stream_tag, "<Column")); p++, i++) {
+		const char *tag_end = memchr(p, '>', stream_tag - p);
+		const char *type;
+		size_t type_length;
+		size_t j;
+		if(!tag_end || ligolw_attribute(p, tag_end, "Name", &value, &length) || ligolw_attribute(p, tag_end, "Type", &type, &type_length)) {
+			ligolw_table_stream_close(stream);
+			XLALPrintError("%s(): malformed Column in %s table\n", __func__, table_name);
+			XLAL_ERROR(XLAL_EIO);
+		}
+		ligolw_strip_name(&value, &length, "");
+		for(j = 0; j < ncolumns; j++)
+			if(strlen(columns[j].name) == length && !memcmp(columns[j].name, value, length))
+				break;
+		if(j == ncolumns)
+			continue;	/* not a column we store */
+		if(!ligolw_type_matches(columns[j].type, type, type_length)) {
+			ligolw_table_stream_close(stream);
+			XLALPrintError("%s(): column \"%s\" has wrong type\n", __func__, columns[j].name);
+			XLAL_ERROR(XLAL_EDATA);
+		}
+		stream->map[i] = &columns[j];
+	}
+	for(i = 0; i < ncolumns; i++) {
+		size_t j;
+		for(j = 0; j < stream->ncolumns; j++)
+			if(stream->map[j] == &columns[i])
+				break;
+		if(j == stream->ncolumns) {
+			ligolw_table_stream_close(stream);
+			XLALPrintError("%s(): missing required column \"%s\"\n", __func__, columns[i].name);
+			XLAL_ERROR(XLAL_EDATA);
+		}
+	}
+
+	/* stream body */
+
+	p = memchr(stream_tag, '>', doc_end - stream_tag);
+	if(!p) {
+		ligolw_table_stream_close(stream);
+		XLAL_ERROR(XLAL_EIO);
+	}
+	stream->delimiter = ',';
+	if(!ligolw_attribute(stream_tag, p, "Delimiter", &value, &length) && length == 1)
+		stream->delimiter = value[0];
+	p++;
+	stream->end = ligolw_find(p, doc_end, "</Stream>");
+	if(!stream->end || !stream->ncolumns) {
+		ligolw_table_stream_close(stream);
+		XLALPrintError("%s(): malformed Stream in %s table\n", __func__, table_name);
+		XLAL_ERROR(XLAL_EIO);
+	}
+
+	/* find the start of each row */
+
+	while(1) {
+		const char *start, *stop;
+		const char *token = p;
+		int quoted;
+		int retval = ligolw_next_token(&p, stream->end, stream->delimiter, &start, &stop, &quoted);
+		if(retval < 0) {
+			ligolw_table_stream_close(stream);
+			XLALPrintError("%s(): syntax error in %s table Stream\n", __func__, table_name);
+			XLAL_ERROR(XLAL_EIO);
+		}
+		if(!retval)
+			break;
+		if(ntokens++ % stream->ncolumns)
+			continue;
+		if(stream->nrows == capacity) {
+			const char **rows = XLALRealloc(stream->rows, (capacity = capacity ? 2 * capacity : 1024) * sizeof(*rows));
+			if(!rows) {
+				ligolw_table_stream_close(stream);
+				XLAL_ERROR(XLAL_ENOMEM);
+			}
+			stream->rows = rows;
+		}
+		stream->rows[stream->nrows++] = token;
+	}
+	if(ntokens % stream->ncolumns) {
+		ligolw_table_stream_close(stream);
+		XLALPrintError("%s(): %s table Stream has an incomplete row\n", __func__, table_name);
+		XLAL_ERROR(XLAL_EIO);
+	}
+
+	return 0;
+}
+
+
+/* convert one row of the stream into the row structure at dst */
+static int ligolw_table_stream_parse_row(const struct ligolw_table_stream *stream, size_t row, char *dst)
+{
+	const char *p = stream->rows[row];
+	size_t i;
+
+	for(i = 0; i < stream->ncolumns; i++) {
+		const struct ligolw_column *column = stream->map[i];
+		const char *start, *stop;
+		int quoted;
+		long long ivalue;
+		double rvalue;
+
+		if(ligolw_next_token(&p, stream->end, stream->delimiter, &start, &stop, &quoted) <= 0)
+			return -1;
+		if(!column)
+			continue;
+
+		switch(column->type) {
+		case LIGOLW_INT_4S:
+			if(ligolw_parse_int8(start, stop, &ivalue) || ivalue < -2147483647LL - 1 || ivalue > 2147483647LL)
+				return -1;
+			*(INT4 *) (dst + column->offset) = ivalue;
+			break;
+		case LIGOLW_INT_8S:
+			if(ligolw_parse_int8(start, stop, &ivalue))
+				return -1;
+			*(long *) (dst + column->offset) = ivalue;
+			break;
+		case LIGOLW_REAL_4:
+			if(ligolw_parse_real8(start, stop, &rvalue))
+				return -1;
+			*(REAL4 *) (dst + column->offset) = rvalue;
+			break;
+		case LIGOLW_REAL_8:
+			if(ligolw_parse_real8(start, stop, &rvalue))
+				return -1;
+			*(REAL8 *) (dst + column->offset) = rvalue;
+			break;
+		case LIGOLW_LSTRING:
+			ligolw_parse_string(start, stop, dst + column->offset, column->size);
+			break;
+		}
+	}
+
+	return 0;
+}
+
+
+/* convert all rows into the array of row structures at rows */
+static int ligolw_table_stream_read(const struct ligolw_table_stream *stream, void *rows, size_t rowsize)
+{
+	long nbad = 0;
+	long i;
+
+#pragma omp parallel for schedule(static, 1024) reduction(+:nbad)
+	for(i = 0; i < (long) stream->nrows; i++)
+		if(ligolw_table_stream_parse_row(stream, i, (char *) rows + i * rowsize))
+			nbad++;
+
+	if(nbad) {
+		XLALPrintError("%s(): %ld malformed rows\n", __func__, nbad);
+		XLAL_ERROR(XLAL_EDATA);
+	}
+
+	return 0;
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                               sngl_inspiral
+ *
+ * ============================================================================
+ */
+
+
+#define SNGL_INSPIRAL_COLUMN(name, type, member) {name, type, offsetof(SnglInspiralTable, member), sizeof(((SnglInspiralTable *) NULL)->member)}
+
+
+static const struct ligolw_column sngl_inspiral_columns[] = {
+	SNGL_INSPIRAL_COLUMN("process_id", LIGOLW_INT_8S, process_id),
+	SNGL_INSPIRAL_COLUMN("ifo", LIGOLW_LSTRING, ifo),
+	SNGL_INSPIRAL_COLUMN("search", LIGOLW_LSTRING, search),
+	SNGL_INSPIRAL_COLUMN("channel", LIGOLW_LSTRING, channel),
+	SNGL_INSPIRAL_COLUMN("end_time", LIGOLW_INT_4S, end.gpsSeconds),
+	SNGL_INSPIRAL_COLUMN("end_time_ns", LIGOLW_INT_4S, end.gpsNanoSeconds),
+	SNGL_INSPIRAL_COLUMN("end_time_gmst", LIGOLW_REAL_8, end_time_gmst),
+	SNGL_INSPIRAL_COLUMN("impulse_time", LIGOLW_INT_4S, impulse_time.gpsSeconds),
+	SNGL_INSPIRAL_COLUMN("impulse_time_ns", LIGOLW_INT_4S, impulse_time.gpsNanoSeconds),
+	SNGL_INSPIRAL_COLUMN("template_duration", LIGOLW_REAL_8, template_duration),
+	SNGL_INSPIRAL_COLUMN("event_duration", LIGOLW_REAL_8, event_duration),
+	SNGL_INSPIRAL_COLUMN("amplitude", LIGOLW_REAL_4, amplitude),
+	SNGL_INSPIRAL_COLUMN("eff_distance", LIGOLW_REAL_4, eff_distance),
+	SNGL_INSPIRAL_COLUMN("coa_phase", LIGOLW_REAL_4, coa_phase),
+	SNGL_INSPIRAL_COLUMN("mass1", LIGOLW_REAL_4, mass1),
+	SNGL_INSPIRAL_COLUMN("mass2", LIGOLW_REAL_4, mass2),
+	SNGL_INSPIRAL_COLUMN("mchirp", LIGOLW_REAL_4, mchirp),
+	SNGL_INSPIRAL_COLUMN("mtotal", LIGOLW_REAL_4, mtotal),
+	SNGL_INSPIRAL_COLUMN("eta", LIGOLW_REAL_4, eta),
+	SNGL_INSPIRAL_COLUMN("tau0", LIGOLW_REAL_4, tau0),
+	SNGL_INSPIRAL_COLUMN("tau2", LIGOLW_REAL_4, tau2),
+	SNGL_INSPIRAL_COLUMN("tau3", LIGOLW_REAL_4, tau3),
+	SNGL_INSPIRAL_COLUMN("tau4", LIGOLW_REAL_4, tau4),
+	SNGL_INSPIRAL_COLUMN("tau5", LIGOLW_REAL_4, tau5),
+	SNGL_INSPIRAL_COLUMN("ttotal", LIGOLW_REAL_4, ttotal),
+	SNGL_INSPIRAL_COLUMN("psi0", LIGOLW_REAL_4, psi0),
+	SNGL_INSPIRAL_COLUMN("psi3", LIGOLW_REAL_4, psi3),
+	SNGL_INSPIRAL_COLUMN("alpha", LIGOLW_REAL_4, alpha),
+	SNGL_INSPIRAL_COLUMN("alpha1", LIGOLW_REAL_4, alpha1),
+	SNGL_INSPIRAL_COLUMN("alpha2", LIGOLW_REAL_4, alpha2),
+	SNGL_INSPIRAL_COLUMN("alpha3", LIGOLW_REAL_4, alpha3),
+	SNGL_INSPIRAL_COLUMN("alpha4", LIGOLW_REAL_4, alpha4),
+	SNGL_INSPIRAL_COLUMN("alpha5", LIGOLW_REAL_4, alpha5),
+	SNGL_INSPIRAL_COLUMN("alpha6", LIGOLW_REAL_4, alpha6),
+	SNGL_INSPIRAL_COLUMN("beta", LIGOLW_REAL_4, beta),
+	SNGL_INSPIRAL_COLUMN("f_final", LIGOLW_REAL_4, f_final),
+	SNGL_INSPIRAL_COLUMN("snr", LIGOLW_REAL_4, snr),
+	SNGL_INSPIRAL_COLUMN("chisq", LIGOLW_REAL_4, chisq),
+	SNGL_INSPIRAL_COLUMN("chisq_dof", LIGOLW_INT_4S, chisq_dof),
+	SNGL_INSPIRAL_COLUMN("bank_chisq", LIGOLW_REAL_4, bank_chisq),
+	SNGL_INSPIRAL_COLUMN("bank_chisq_dof", LIGOLW_INT_4S, bank_chisq_dof),
+	SNGL_INSPIRAL_COLUMN("cont_chisq", LIGOLW_REAL_4, cont_chisq),
+	SNGL_INSPIRAL_COLUMN("cont_chisq_dof", LIGOLW_INT_4S, cont_chisq_dof),
+	SNGL_INSPIRAL_COLUMN("sigmasq", LIGOLW_REAL_8, sigmasq),
+	SNGL_INSPIRAL_COLUMN("rsqveto_duration", LIGOLW_REAL_4, rsqveto_duration),
+	SNGL_INSPIRAL_COLUMN("Gamma0", LIGOLW_REAL_4, Gamma[0]),
+	SNGL_INSPIRAL_COLUMN("Gamma1", LIGOLW_REAL_4, Gamma[1]),
+	SNGL_INSPIRAL_COLUMN("Gamma2", LIGOLW_REAL_4, Gamma[2]),
+	SNGL_INSPIRAL_COLUMN("Gamma3", LIGOLW_REAL_4, Gamma[3]),
+	SNGL_INSPIRAL_COLUMN("Gamma4", LIGOLW_REAL_4, Gamma[4]),
+	SNGL_INSPIRAL_COLUMN("Gamma5", LIGOLW_REAL_4, Gamma[5]),
+	SNGL_INSPIRAL_COLUMN("Gamma6", LIGOLW_REAL_4, Gamma[6]),
+	SNGL_INSPIRAL_COLUMN("Gamma7", LIGOLW_REAL_4, Gamma[7]),
+	SNGL_INSPIRAL_COLUMN("Gamma8", LIGOLW_REAL_4, Gamma[8]),
+	SNGL_INSPIRAL_COLUMN("Gamma9", LIGOLW_REAL_4, Gamma[9]),
+	SNGL_INSPIRAL_COLUMN("kappa", LIGOLW_REAL_4, kappa),
+	SNGL_INSPIRAL_COLUMN("chi", LIGOLW_REAL_4, chi),
+	SNGL_INSPIRAL_COLUMN("spin1x", LIGOLW_REAL_4, spin1x),
+	SNGL_INSPIRAL_COLUMN("spin1y", LIGOLW_REAL_4, spin1y),
+	SNGL_INSPIRAL_COLUMN("spin1z", LIGOLW_REAL_4, spin1z),
+	SNGL_INSPIRAL_COLUMN("spin2x", LIGOLW_REAL_4, spin2x),
+	SNGL_INSPIRAL_COLUMN("spin2y", LIGOLW_REAL_4, spin2y),
+	SNGL_INSPIRAL_COLUMN("spin2z", LIGOLW_REAL_4, spin2z),
+	SNGL_INSPIRAL_COLUMN("event_id", LIGOLW_INT_8S, event_id),
+};
+
+
+/**
+ * Read the sngl_inspiral table from a LIGO Light Weight XML file into a
+ * SnglInspiralColumns container, without going through libmetaio.  The
+ * same columns are required as by XLALSnglInspiralTableFromLIGOLw().
+ * Uncompressed files are memory-mapped, and the rows are converted in
+ * parallel when OpenMP is enabled.
+ */
+SnglInspiralColumns *XLALSnglInspiralColumnsFromLIGOLw(
+	const char *filename
+)
+{
+	struct ligolw_table_stream stream;
+	SnglInspiralColumns *cols;
+
+	if(ligolw_table_stream_open(&stream, filename, "sngl_inspiral", sngl_inspiral_columns, XLAL_NUM_ELEM(sngl_inspiral_columns)))
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	cols = XLALCreateSnglInspiralColumns(stream.nrows);
+	if(!cols) {
+		ligolw_table_stream_close(&stream);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	memset(cols->rows, 0, stream.nrows * sizeof(*cols->rows));
+
+	if(ligolw_table_stream_read(&stream, cols->rows, sizeof(*cols->rows))) {
+		ligolw_table_stream_close(&stream);
+		XLALDestroySnglInspiralColumns(cols);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	cols->length = stream.nrows;
+	XLALSnglInspiralColumnsRefresh(cols);
+
+	ligolw_table_stream_close(&stream);
+	return cols;
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                                sngl_burst
+ *
+ * ============================================================================
+ */
+
+
+#define SNGL_BURST_COLUMN(name, type, member) {name, type, offsetof(SnglBurst, member), sizeof(((SnglBurst *) NULL)->member)}
+
+
+static const struct ligolw_column sngl_burst_columns[] = {
+	SNGL_BURST_COLUMN("process_id", LIGOLW_INT_8S, process_id),
+	SNGL_BURST_COLUMN("ifo", LIGOLW_LSTRING, ifo),
+	SNGL_BURST_COLUMN("search", LIGOLW_LSTRING, search),
+	SNGL_BURST_COLUMN("channel", LIGOLW_LSTRING, channel),
+	SNGL_BURST_COLUMN("start_time", LIGOLW_INT_4S, start_time.gpsSeconds),
+	SNGL_BURST_COLUMN("start_time_ns", LIGOLW_INT_4S, start_time.gpsNanoSeconds),
+	SNGL_BURST_COLUMN("peak_time", LIGOLW_INT_4S, peak_time.gpsSeconds),
+	SNGL_BURST_COLUMN("peak_time_ns", LIGOLW_INT_4S, peak_time.gpsNanoSeconds),
+	SNGL_BURST_COLUMN("duration", LIGOLW_REAL_4, duration),
+	SNGL_BURST_COLUMN("central_freq", LIGOLW_REAL_4, central_freq),
+	SNGL_BURST_COLUMN("bandwidth", LIGOLW_REAL_4, bandwidth),
+	SNGL_BURST_COLUMN("amplitude", LIGOLW_REAL_4, amplitude),
+	SNGL_BURST_COLUMN("snr", LIGOLW_REAL_4, snr),
+	SNGL_BURST_COLUMN("confidence", LIGOLW_REAL_4, confidence),
+	SNGL_BURST_COLUMN("chisq", LIGOLW_REAL_8, chisq),
+	SNGL_BURST_COLUMN("chisq_dof", LIGOLW_REAL_8, chisq_dof),
+	SNGL_BURST_COLUMN("event_id", LIGOLW_INT_8S, event_id),
+};
+
+
+/**
+ * Read the sngl_burst table from a LIGO Light Weight XML file into a
+ * SnglBurstColumns container, without going through libmetaio.  The same
+ * columns are required as by XLALSnglBurstTableFromLIGOLw().  Uncompressed
+ * files are memory-mapped, and the rows are converted in parallel when
+ * OpenMP is enabled.
+ */
+SnglBurstColumns *XLALSnglBurstColumnsFromLIGOLw(
+	const char *filename
+)
+{
+	struct ligolw_table_stream stream;
+	SnglBurstColumns *cols;
+
+	if(ligolw_table_stream_open(&stream, filename, "sngl_burst", sngl_burst_columns, XLAL_NUM_ELEM(sngl_burst_columns)))
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	cols = XLALCreateSnglBurstColumns(stream.nrows);
+	if(!cols) {
+		ligolw_table_stream_close(&stream);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	memset(cols->rows, 0, stream.nrows * sizeof(*cols->rows));
+
+	if(ligolw_table_stream_read(&stream, cols->rows, sizeof(*cols->rows))) {
+		ligolw_table_stream_close(&stream);
+		XLALDestroySnglBurstColumns(cols);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	cols->length = stream.nrows;
+	XLALSnglBurstColumnsRefresh(cols);
+
+	ligolw_table_stream_close(&stream);
+	return cols;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/**
+ * \file
+ * \ingroup lalmetaio_general
+ * \brief Internal row writer for the Stream elements of LIGO_LW tables
+ *
+ * The table writers format their rows with these functions instead of one
+ * XLALFilePrintf() per row.  The rows are formatted into a block buffer
+ * owned by the writer, and each full block is passed to the file with a
+ * single XLALFileWrite().  The text is identical to that of the printf()
+ * conversions the writers used before:  an integer is written as by
+ * \c %ld or \c %lu, a string as by <tt>"%s"</tt>, and a real as by
+ * <tt>%.<em>precision</em>g</tt>.
+ *
+ * Errors are sticky:  once a block cannot be written, the remaining rows
+ * are discarded, and the error is reported by
+ * XLALLIGOLwXMLRowWriterClose().
+ */
+
+#ifndef _LIGOLWXML_INTERNAL_H
+#define _LIGOLWXML_INTERNAL_H
+
+#include <stddef.h>
+#include <lal/FileIO.h>
+#include <lal/LALStddef.h>
+#include <lal/LIGOLwXML.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#elif 0
+}       /* so that editors will match preceding brace */
+#endif
+
+/**
+ * State of a row writer.  The members are private.
+ */
+typedef struct tagLIGOLwXMLRowWriter {
+	LALFILE *fp;	/**< file the rows are written to */
+	char *buf;	/**< block buffer */
+	size_t len;	/**< number of bytes in the block buffer */
+	size_t rows;	/**< number of rows begun so far */
+	int first;	/**< no column has been written in the current row */
+	int error;	/**< a block could not be written */
+} LIGOLwXMLRowWriter;
+
+int XLALLIGOLwXMLRowWriterOpen(LIGOLwXMLRowWriter *row, LIGOLwXMLStream *xml);
+int XLALLIGOLwXMLRowWriterClose(LIGOLwXMLRowWriter *row);
+
+void XLALLIGOLwXMLRowBegin(LIGOLwXMLRowWriter *row);
+void XLALLIGOLwXMLRowInt(LIGOLwXMLRowWriter *row, long value);
+void XLALLIGOLwXMLRowUInt(LIGOLwXMLRowWriter *row, unsigned long value);
+void XLALLIGOLwXMLRowReal(LIGOLwXMLRowWriter *row, double value, int precision);
+void XLALLIGOLwXMLRowString(LIGOLwXMLRowWriter *row, const char *value);
+void XLALLIGOLwXMLRowPrintf(LIGOLwXMLRowWriter *row, const char *fmt, ...) _LAL_GCC_PRINTF_FORMAT_(2,3);
+
+#if 0
+{       /* so that editors will match succeeding brace */
+#elif defined(__cplusplus)
+}
+#endif
+
+#endif /* _LIGOLWXML_INTERNAL_H */
@@ -0,0 +1,893 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include <lal/Date.h>
+#include <lal/LALMalloc.h>
+#include <lal/LIGOMetadataColumns.h>
+#include <lal/LIGOMetadataTables.h>
+#include <lal/LIGOMetadataUtils.h>
+#include <lal/XLALError.h>
+
+
+/*
+ * ============================================================================
+ *
+ *                              Internal helpers
+ *
+ * ============================================================================
+ */
+
+
+/*
+ * sort keys.  integer keys (times) go in i, real keys in x;  the row index
+ * breaks ties so the sort is stable.  NaNs sort after all other values in
+ * either direction
+ */
+
+
+struct sort_key {
+	INT8 i;
+	REAL8 x;
+	size_t index;
+};
+
+
+static int sort_key_compare(const struct sort_key *ka, const struct sort_key *kb, int descending)
+{
+	const int nan_a = isnan(ka->x);
+	const int nan_b = isnan(kb->x);
+
+	if(nan_a != nan_b)
+		return nan_a ? +1 : -1;
+	if(ka->i != kb->i)
+		return (ka->i < kb->i) != descending ? -1 : +1;
+	if(!nan_a && ka->x != kb->x)
+		return (ka->x < kb->x) != descending ? -1 : +1;
+	return ka->index < kb->index ? -1 : ka->index > kb->index;
+}
+
+
+static int sort_key_compare_ascending(const void *a, const void *b)
+{
+	return sort_key_compare(a, b, 0);
+}
+
+
+static int sort_key_compare_descending(const void *a, const void *b)
+{
+	return sort_key_compare(a, b, 1);
+}
+
+
+static size_t *sort_keys_to_index(struct sort_key *keys, size_t n, int descending)
+{
+	size_t *index = XLALMalloc((n ? n : 1) * sizeof(*index));
+	size_t i;
+
+	if(!index) {
+		XLALFree(keys);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+
+	qsort(keys, n, sizeof(*keys), descending ? sort_key_compare_descending : sort_key_compare_ascending);
+	for(i = 0; i < n; i++)
+		index[i] = keys[i].index;
+
+	XLALFree(keys);
+	return index;
+}
+
+
+/*
+ * the rows and key columns of each container, for the X-macros below
+ */
+
+
+#define SNGL_INSPIRAL_COLUMNS(X) X(rows) X(end) X(snr) X(chisq) X(mass1) X(mass2) X(mchirp) X(mtotal) X(eta)
+#define SNGL_BURST_COLUMNS(X) X(rows) X(peak) X(start) X(duration) X(central_freq) X(bandwidth) X(snr) X(confidence)
+
+#define COLUMN_FREE(c) XLALFree(cols->c);
+#define COLUMN_RESERVE(c) { void *p = XLALRealloc(cols->c, capacity * sizeof(*cols->c)); if(!p) XLAL_ERROR(XLAL_ENOMEM); cols->c = p; }
+#define COLUMN_MOVE(c) cols->c[j] = cols->c[i];
+#define COLUMN_GATHER(c) for(i = 0; i < n; i++) new->c[i] = cols->c[index[i]];
+#define COLUMN_SWAP(c) { void *p = cols->c; cols->c = new->c; new->c = p; }
+
+
+/*
+ * ============================================================================
+ *
+ *                               sngl_inspiral
+ *
+ * ============================================================================
+ */
+
+
+/* link the rows in the arena in order */
+static void sngl_inspiral_columns_link(SnglInspiralColumns *cols)
+{
+	size_t i;
+
+	for(i = 0; i + 1 < cols->length; i++)
+		cols->rows[i].next = &cols->rows[i + 1];
+	if(cols->length)
+		cols->rows[cols->length - 1].next = NULL;
+}
+
+
+/* copy the key fields of row i into the columns */
+static void sngl_inspiral_columns_load(SnglInspiralColumns *cols, size_t i)
+{
+	const SnglInspiralTable *row = &cols->rows[i];
+
+	cols->end[i] = XLALGPSToINT8NS(&row->end);
+	cols->snr[i] = row->snr;
+	cols->chisq[i] = row->chisq;
+	cols->mass1[i] = row->mass1;
+	cols->mass2[i] = row->mass2;
+	cols->mchirp[i] = row->mchirp;
+	cols->mtotal[i] = row->mtotal;
+	cols->eta[i] = row->eta;
+}
+
+
+static const REAL4 *sngl_inspiral_columns_real4(const SnglInspiralColumns *cols, SnglInspiralColumnsKey key)
+{
+	switch(key) {
+	case LAL_SNGL_INSPIRAL_KEY_SNR:
+		return cols->snr;
+	case LAL_SNGL_INSPIRAL_KEY_CHISQ:
+		return cols->chisq;
+	case LAL_SNGL_INSPIRAL_KEY_MASS1:
+		return cols->mass1;
+	case LAL_SNGL_INSPIRAL_KEY_MASS2:
+		return cols->mass2;
+	case LAL_SNGL_INSPIRAL_KEY_MCHIRP:
+		return cols->mchirp;
+	case LAL_SNGL_INSPIRAL_KEY_MTOTAL:
+		return cols->mtotal;
+	case LAL_SNGL_INSPIRAL_KEY_ETA:
+		return cols->eta;
+	default:
+		return NULL;
+	}
+}
+
+
+static int sngl_inspiral_columns_reserve(SnglInspiralColumns *cols, size_t capacity)
+{
+	if(capacity <= cols->capacity)
+		return 0;
+	SNGL_INSPIRAL_COLUMNS(COLUMN_RESERVE)
+	cols->capacity = capacity;
+	sngl_inspiral_columns_link(cols);
+	return 0;
+}
+
+
+/**
+ * Create an empty SnglInspiralColumns container with room for capacity
+ * rows.  The container grows as needed, so capacity is only a hint.
+ */
+SnglInspiralColumns *XLALCreateSnglInspiralColumns(size_t capacity)
+{
+	SnglInspiralColumns *cols = XLALCalloc(1, sizeof(*cols));
+
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	if(sngl_inspiral_columns_reserve(cols, capacity ? capacity : 1)) {
+		XLALDestroySnglInspiralColumns(cols);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	return cols;
+}
+
+
+/**
+ * Destroy a SnglInspiralColumns container, including its rows.
+ */
+void XLALDestroySnglInspiralColumns(SnglInspiralColumns *cols)
+{
+	if(cols) {
+		SNGL_INSPIRAL_COLUMNS(COLUMN_FREE)
+		XLALFree(cols);
+	}
+}
+
+
+/**
+ * Append a copy of a row to a SnglInspiralColumns container.  The row's
+ * next pointer is ignored.
+ */
+int XLALSnglInspiralColumnsAppend(SnglInspiralColumns *cols, const SnglInspiralTable *row)
+{
+	if(!cols || !row)
+		XLAL_ERROR(XLAL_EFAULT);
+
+	if(cols->length == cols->capacity)
+		if(sngl_inspiral_columns_reserve(cols, 2 * cols->capacity))
+			XLAL_ERROR(XLAL_EFUNC);
+
+	cols->rows[cols->length] = *row;
+	cols->rows[cols->length].next = NULL;
+	if(cols->length)
+		cols->rows[cols->length - 1].next = &cols->rows[cols->length];
+	sngl_inspiral_columns_load(cols, cols->length);
+	cols->length++;
+
+	return 0;
+}
+
+
+/**
+ * Copy a linked list of SnglInspiralTable rows into a new SnglInspiralColumns
+ * container, preserving their order.
+ */
+SnglInspiralColumns *XLALSnglInspiralColumnsFromTable(const SnglInspiralTable *head)
+{
+	SnglInspiralColumns *cols;
+	const SnglInspiralTable *row;
+	size_t n = 0;
+
+	for(row = head; row; row = row->next)
+		n++;
+
+	cols = XLALCreateSnglInspiralColumns(n);
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	for(row = head; row; row = row->next)
+		if(XLALSnglInspiralColumnsAppend(cols, row)) {
+			XLALDestroySnglInspiralColumns(cols);
+			XLAL_ERROR_NULL(XLAL_EFUNC);
+		}
+
+	return cols;
+}
+
+
+/**
+ * Return the rows of a SnglInspiralColumns container as a linked list,
+ * without copying.  The list is owned by the container and is invalidated
+ * by any routine that adds, removes or reorders rows.  Returns NULL if the
+ * container is empty.
+ */
+SnglInspiralTable *XLALSnglInspiralColumnsAsTable(SnglInspiralColumns *cols)
+{
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	return cols->length ? cols->rows : NULL;
+}
+
+
+/**
+ * Copy the rows of a SnglInspiralColumns container into a newly-allocated
+ * linked list that can be freed with XLALDestroySnglInspiralTable().
+ */
+SnglInspiralTable *XLALSnglInspiralColumnsToTable(const SnglInspiralColumns *cols)
+{
+	SnglInspiralTable *head = NULL;
+	SnglInspiralTable **next = &head;
+	size_t i;
+
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+
+	for(i = 0; i < cols->length; i++) {
+		SnglInspiralTable *row = XLALMalloc(sizeof(*row));
+		if(!row) {
+			XLALDestroySnglInspiralTable(head);
+			XLAL_ERROR_NULL(XLAL_ENOMEM);
+		}
+		*row = cols->rows[i];
+		row->next = NULL;
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+/**
+ * Recompute the key columns of a SnglInspiralColumns container from its
+ * rows, after they have been modified in place.
+ */
+void XLALSnglInspiralColumnsRefresh(SnglInspiralColumns *cols)
+{
+	size_t i;
+
+	if(!cols)
+		return;
+	for(i = 0; i < cols->length; i++)
+		sngl_inspiral_columns_load(cols, i);
+	sngl_inspiral_columns_link(cols);
+}
+
+
+/**
+ * Remove the rows of a SnglInspiralColumns container for which keep[i] is
+ * zero.  The order of the remaining rows is preserved.
+ */
+int XLALSnglInspiralColumnsSelect(SnglInspiralColumns *cols, const unsigned char *keep)
+{
+	size_t i, j;
+
+	if(!cols || (cols->length && !keep))
+		XLAL_ERROR(XLAL_EFAULT);
+
+	for(i = j = 0; i < cols->length; i++)
+		if(keep[i]) {
+			if(i != j) {
+				SNGL_INSPIRAL_COLUMNS(COLUMN_MOVE)
+			}
+			j++;
+		}
+	cols->length = j;
+	sngl_inspiral_columns_link(cols);
+
+	return 0;
+}
+
+
+/**
+ * Replace the rows of a SnglInspiralColumns container with rows
+ * index[0], ..., index[n-1].  Indices may repeat or be omitted.
+ */
+int XLALSnglInspiralColumnsGather(SnglInspiralColumns *cols, const size_t *index, size_t n)
+{
+	SnglInspiralColumns *new;
+	size_t i;
+
+	if(!cols || (n && !index))
+		XLAL_ERROR(XLAL_EFAULT);
+	for(i = 0; i < n; i++)
+		if(index[i] >= cols->length)
+			XLAL_ERROR(XLAL_EDOM, "index %zu out of range", index[i]);
+
+	new = XLALCreateSnglInspiralColumns(n);
+	if(!new)
+		XLAL_ERROR(XLAL_EFUNC);
+	SNGL_INSPIRAL_COLUMNS(COLUMN_GATHER)
+	SNGL_INSPIRAL_COLUMNS(COLUMN_SWAP)
+	new->length = cols->length;
+	cols->length = n;
+	cols->capacity = new->capacity;
+	XLALDestroySnglInspiralColumns(new);
+	sngl_inspiral_columns_link(cols);
+
+	return 0;
+}
+
+
+/**
+ * Return the permutation that sorts a SnglInspiralColumns container by the
+ * given key column;  the caller frees it with XLALFree().  The sort is
+ * stable, and rows whose key is NaN are placed last in either direction.
+ */
+size_t *XLALSnglInspiralColumnsSortIndex(const SnglInspiralColumns *cols, SnglInspiralColumnsKey key, int descending)
+{
+	const REAL4 *x = NULL;
+	struct sort_key *keys;
+	size_t i;
+
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if(key != LAL_SNGL_INSPIRAL_KEY_END && !(x = sngl_inspiral_columns_real4(cols, key)))
+		XLAL_ERROR_NULL(XLAL_EINVAL, "unrecognized key %d", key);
+
+	keys = XLALMalloc((cols->length ? cols->length : 1) * sizeof(*keys));
+	if(!keys)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	for(i = 0; i < cols->length; i++) {
+		keys[i].i = x ? 0 : cols->end[i];
+		keys[i].x = x ? x[i] : 0.0;
+		keys[i].index = i;
+	}
+
+	return sort_keys_to_index(keys, cols->length, descending);
+}
+
+
+/**
+ * Sort a SnglInspiralColumns container by the given key column.
+ */
+int XLALSnglInspiralColumnsSort(SnglInspiralColumns *cols, SnglInspiralColumnsKey key, int descending)
+{
+	size_t *index = XLALSnglInspiralColumnsSortIndex(cols, key, descending);
+	int retval;
+
+	if(!index)
+		XLAL_ERROR(XLAL_EFUNC);
+	retval = XLALSnglInspiralColumnsGather(cols, index, cols->length);
+	XLALFree(index);
+	if(retval)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	return 0;
+}
+
+
+/**
+ * Keep only the rows of a SnglInspiralColumns container with low <= key <=
+ * high.  For LAL_SNGL_INSPIRAL_KEY_END, low and high are GPS seconds.
+ */
+int XLALSnglInspiralColumnsRangeCut(SnglInspiralColumns *cols, SnglInspiralColumnsKey key, REAL8 low, REAL8 high)
+{
+	const REAL4 *x = NULL;
+	unsigned char *keep;
+	size_t i;
+	int retval;
+
+	if(!cols)
+		XLAL_ERROR(XLAL_EFAULT);
+	if(key != LAL_SNGL_INSPIRAL_KEY_END && !(x = sngl_inspiral_columns_real4(cols, key)))
+		XLAL_ERROR(XLAL_EINVAL, "unrecognized key %d", key);
+
+	keep = XLALMalloc(cols->length ? cols->length : 1);
+	if(!keep)
+		XLAL_ERROR(XLAL_ENOMEM);
+	if(x)
+		for(i = 0; i < cols->length; i++)
+			keep[i] = (low <= x[i]) & (x[i] <= high);
+	else {
+		const INT8 lo = (INT8) ceil(low * XLAL_BILLION_REAL8);
+		const INT8 hi = (INT8) floor(high * XLAL_BILLION_REAL8);
+		for(i = 0; i < cols->length; i++)
+			keep[i] = (lo <= cols->end[i]) & (cols->end[i] <= hi);
+	}
+
+	retval = XLALSnglInspiralColumnsSelect(cols, keep);
+	XLALFree(keep);
+	if(retval)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	return 0;
+}
+
+
+/**
+ * Keep only the rows of a SnglInspiralColumns container with end times in
+ * [start, end).  Either bound may be NULL.
+ */
+int XLALSnglInspiralColumnsTimeCut(SnglInspiralColumns *cols, const LIGOTimeGPS *start, const LIGOTimeGPS *end)
+{
+	const INT8 lo = start ? XLALGPSToINT8NS(start) : INT64_MIN;
+	const INT8 hi = end ? XLALGPSToINT8NS(end) : INT64_MAX;
+	unsigned char *keep;
+	size_t i;
+	int retval;
+
+	if(!cols)
+		XLAL_ERROR(XLAL_EFAULT);
+
+	keep = XLALMalloc(cols->length ? cols->length : 1);
+	if(!keep)
+		XLAL_ERROR(XLAL_ENOMEM);
+	for(i = 0; i < cols->length; i++)
+		keep[i] = (lo <= cols->end[i]) & (cols->end[i] < hi);
+
+	retval = XLALSnglInspiralColumnsSelect(cols, keep);
+	XLALFree(keep);
+	if(retval)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	return 0;
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                                sngl_burst
+ *
+ * ============================================================================
+ */
+
+
+/* link the rows in the arena in order */
+static void sngl_burst_columns_link(SnglBurstColumns *cols)
+{
+	size_t i;
+
+	for(i = 0; i + 1 < cols->length; i++)
+		cols->rows[i].next = &cols->rows[i + 1];
+	if(cols->length)
+		cols->rows[cols->length - 1].next = NULL;
+}
+
+
+/* copy the key fields of row i into the columns */
+static void sngl_burst_columns_load(SnglBurstColumns *cols, size_t i)
+{
+	const SnglBurst *row = &cols->rows[i];
+
+	cols->peak[i] = XLALGPSToINT8NS(&row->peak_time);
+	cols->start[i] = XLALGPSToINT8NS(&row->start_time);
+	cols->duration[i] = row->duration;
+	cols->central_freq[i] = row->central_freq;
+	cols->bandwidth[i] = row->bandwidth;
+	cols->snr[i] = row->snr;
+	cols->confidence[i] = row->confidence;
+}
+
+
+static const INT8 *sngl_burst_columns_int8(const SnglBurstColumns *cols, SnglBurstColumnsKey key)
+{
+	switch(key) {
+	case LAL_SNGL_BURST_KEY_PEAK:
+		return cols->peak;
+	case LAL_SNGL_BURST_KEY_START:
+		return cols->start;
+	default:
+		return NULL;
+	}
+}
+
+
+static const REAL4 *sngl_burst_columns_real4(const SnglBurstColumns *cols, SnglBurstColumnsKey key)
+{
+	switch(key) {
+	case LAL_SNGL_BURST_KEY_DURATION:
+		return cols->duration;
+	case LAL_SNGL_BURST_KEY_CENTRAL_FREQ:
+		return cols->central_freq;
+	case LAL_SNGL_BURST_KEY_BANDWIDTH:
+		return cols->bandwidth;
+	case LAL_SNGL_BURST_KEY_SNR:
+		return cols->snr;
+	case LAL_SNGL_BURST_KEY_CONFIDENCE:
+		return cols->confidence;
+	default:
+		return NULL;
+	}
+}
+
+
+static int sngl_burst_columns_reserve(SnglBurstColumns *cols, size_t capacity)
+{
+	if(capacity <= cols->capacity)
+		return 0;
+	SNGL_BURST_COLUMNS(COLUMN_RESERVE)
+	cols->capacity = capacity;
+	sngl_burst_columns_link(cols);
+	return 0;
+}
+
+
+/**
+ * Create an empty SnglBurstColumns container with room for capacity rows.
+ * The container grows as needed, so capacity is only a hint.
+ */
+SnglBurstColumns *XLALCreateSnglBurstColumns(size_t capacity)
+{
+	SnglBurstColumns *cols = XLALCalloc(1, sizeof(*cols));
+
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	if(sngl_burst_columns_reserve(cols, capacity ? capacity : 1)) {
+		XLALDestroySnglBurstColumns(cols);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	return cols;
+}
+
+
+/**
+ * Destroy a SnglBurstColumns container, including its rows.
+ */
+void XLALDestroySnglBurstColumns(SnglBurstColumns *cols)
+{
+	if(cols) {
+		SNGL_BURST_COLUMNS(COLUMN_FREE)
+		XLALFree(cols);
+	}
+}
+
+
+/**
+ * Append a copy of a row to a SnglBurstColumns container.  The row's next
+ * pointer is ignored.
+ */
+int XLALSnglBurstColumnsAppend(SnglBurstColumns *cols, const SnglBurst *row)
+{
+	if(!cols || !row)
+		XLAL_ERROR(XLAL_EFAULT);
+
+	if(cols->length == cols->capacity)
+		if(sngl_burst_columns_reserve(cols, 2 * cols->capacity))
+			XLAL_ERROR(XLAL_EFUNC);
+
+	cols->rows[cols->length] = *row;
+	cols->rows[cols->length].next = NULL;
+	if(cols->length)
+		cols->rows[cols->length - 1].next = &cols->rows[cols->length];
+	sngl_burst_columns_load(cols, cols->length);
+	cols->length++;
+
+	return 0;
+}
+
+
+/**
+ * Copy a linked list of SnglBurst rows into a new SnglBurstColumns
+ * container, preserving their order.
+ */
+SnglBurstColumns *XLALSnglBurstColumnsFromTable(const SnglBurst *head)
+{
+	SnglBurstColumns *cols;
+	const SnglBurst *row;
+	size_t n = 0;
+
+	for(row = head; row; row = row->next)
+		n++;
+
+	cols = XLALCreateSnglBurstColumns(n);
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	for(row = head; row; row = row->next)
+		if(XLALSnglBurstColumnsAppend(cols, row)) {
+			XLALDestroySnglBurstColumns(cols);
+			XLAL_ERROR_NULL(XLAL_EFUNC);
+		}
+
+	return cols;
+}
+
+
+/**
+ * Return the rows of a SnglBurstColumns container as a linked list, without
+ * copying.  The list is owned by the container and is invalidated by any
+ * routine that adds, removes or reorders rows.  Returns NULL if the
+ * container is empty.
+ */
+SnglBurst *XLALSnglBurstColumnsAsTable(SnglBurstColumns *cols)
+{
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	return cols->length ? cols->rows : NULL;
+}
+
+
+/**
+ * Copy the rows of a SnglBurstColumns container into a newly-allocated
+ * linked list that can be freed with XLALDestroySnglBurstTable().
+ */
+SnglBurst *XLALSnglBurstColumnsToTable(const SnglBurstColumns *cols)
+{
+	SnglBurst *head = NULL;
+	SnglBurst **next = &head;
+	size_t i;
+
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+
+	for(i = 0; i < cols->length; i++) {
+		SnglBurst *row = XLALMalloc(sizeof(*row));
+		if(!row) {
+			XLALDestroySnglBurstTable(head);
+			XLAL_ERROR_NULL(XLAL_ENOMEM);
+		}
+		*row = cols->rows[i];
+		row->next = NULL;
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+/**
+ * Recompute the key columns of a SnglBurstColumns container from its rows,
+ * after they have been modified in place.
+ */
+void XLALSnglBurstColumnsRefresh(SnglBurstColumns *cols)
+{
+	size_t i;
+
+	if(!cols)
+		return;
+	for(i = 0; i < cols->length; i++)
+		sngl_burst_columns_load(cols, i);
+	sngl_burst_columns_link(cols);
+}
+
+
+/**
+ * Remove the rows of a SnglBurstColumns container for which keep[i] is zero.
+ * The order of the remaining rows is preserved.
+ */
+int XLALSnglBurstColumnsSelect(SnglBurstColumns *cols, const unsigned char *keep)
+{
+	size_t i, j;
+
+	if(!cols || (cols->length && !keep))
+		XLAL_ERROR(XLAL_EFAULT);
+
+	for(i = j = 0; i < cols->length; i++)
+		if(keep[i]) {
+			if(i != j) {
+				SNGL_BURST_COLUMNS(COLUMN_MOVE)
+			}
+			j++;
+		}
+	cols->length = j;
+	sngl_burst_columns_link(cols);
+
+	return 0;
+}
+
+
+/**
+ * Replace the rows of a SnglBurstColumns container with rows index[0], ...,
+ * index[n-1].  Indices may repeat or be omitted.
+ */
+int XLALSnglBurstColumnsGather(SnglBurstColumns *cols, const size_t *index, size_t n)
+{
+	SnglBurstColumns *new;
+	size_t i;
+
+	if(!cols || (n && !index))
+		XLAL_ERROR(XLAL_EFAULT);
+	for(i = 0; i < n; i++)
+		if(index[i] >= cols->length)
+			XLAL_ERROR(XLAL_EDOM, "index %zu out of range", index[i]);
+
+	new = XLALCreateSnglBurstColumns(n);
+	if(!new)
+		XLAL_ERROR(XLAL_EFUNC);
+	SNGL_BURST_COLUMNS(COLUMN_GATHER)
+	SNGL_BURST_COLUMNS(COLUMN_SWAP)
+	new->length = cols->length;
+	cols->length = n;
+	cols->capacity = new->capacity;
+	XLALDestroySnglBurstColumns(new);
+	sngl_burst_columns_link(cols);
+
+	return 0;
+}
+
+
+/**
+ * Return the permutation that sorts a SnglBurstColumns container by the
+ * given key column;  the caller frees it with XLALFree().  The sort is
+ * stable, and rows whose key is NaN are placed last in either direction.
+ */
+size_t *XLALSnglBurstColumnsSortIndex(const SnglBurstColumns *cols, SnglBurstColumnsKey key, int descending)
+{
+	const INT8 *t;
+	const REAL4 *x = NULL;
+	struct sort_key *keys;
+	size_t i;
+
+	if(!cols)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	t = sngl_burst_columns_int8(cols, key);
+	if(!t && !(x = sngl_burst_columns_real4(cols, key)))
+		XLAL_ERROR_NULL(XLAL_EINVAL, "unrecognized key %d", key);
+
+	keys = XLALMalloc((cols->length ? cols->length : 1) * sizeof(*keys));
+	if(!keys)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	for(i = 0; i < cols->length; i++) {
+		keys[i].i = t ? t[i] : 0;
+		keys[i].x = x ? x[i] : 0.0;
+		keys[i].index = i;
+	}
+
+	return sort_keys_to_index(keys, cols->length, descending);
+}
+
+
+/**
+ * Sort a SnglBurstColumns container by the given key column.
+ */
+int XLALSnglBurstColumnsSort(SnglBurstColumns *cols, SnglBurstColumnsKey key, int descending)
+{
+	size_t *index = XLALSnglBurstColumnsSortIndex(cols, key, descending);
+	int retval;
+
+	if(!index)
+		XLAL_ERROR(XLAL_EFUNC);
+	retval = XLALSnglBurstColumnsGather(cols, index, cols->length);
+	XLALFree(index);
+	if(retval)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	return 0;
+}
+
+
+/**
+ * Keep only the rows of a SnglBurstColumns container with low <= key <=
+ * high.  For the time keys, low and high are GPS seconds.
+ */
+int XLALSnglBurstColumnsRangeCut(SnglBurstColumns *cols, SnglBurstColumnsKey key, REAL8 low, REAL8 high)
+{
+	const INT8 *t;
+	const REAL4 *x = NULL;
+	unsigned char *keep;
+	size_t i;
+	int retval;
+
+	if(!cols)
+		XLAL_ERROR(XLAL_EFAULT);
+	t = sngl_burst_columns_int8(cols, key);
+	if(!t && !(x = sngl_burst_columns_real4(cols, key)))
+		XLAL_ERROR(XLAL_EINVAL, "unrecognized key %d", key);
+
+	keep = XLALMalloc(cols->length ? cols->length : 1);
+	if(!keep)
+		XLAL_ERROR(XLAL_ENOMEM);
+	if(x)
+		for(i = 0; i < cols->length; i++)
+			keep[i] = (low <= x[i]) & (x[i] <= high);
+	else {
+		const INT8 lo = (INT8) ceil(low * XLAL_BILLION_REAL8);
+		const INT8 hi = (INT8) floor(high * XLAL_BILLION_REAL8);
+		for(i = 0; i < cols->length; i++)
+			keep[i] = (lo <= t[i]) & (t[i] <= hi);
+	}
+
+	retval = XLALSnglBurstColumnsSelect(cols, keep);
+	XLALFree(keep);
+	if(retval)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	return 0;
+}
+
+
+/**
+ * Keep only the rows of a SnglBurstColumns container with peak times in
+ * [start, end).  Either bound may be NULL.
+ */
+int XLALSnglBurstColumnsTimeCut(SnglBurstColumns *cols, const LIGOTimeGPS *start, const LIGOTimeGPS *end)
+{
+	const INT8 lo = start ? XLALGPSToINT8NS(start) : INT64_MIN;
+	const INT8 hi = end ? XLALGPSToINT8NS(end) : INT64_MAX;
+	unsigned char *keep;
+	size_t i;
+	int retval;
+
+	if(!cols)
+		XLAL_ERROR(XLAL_EFAULT);
+
+	keep = XLALMalloc(cols->length ? cols->length : 1);
+	if(!keep)
+		XLAL_ERROR(XLAL_ENOMEM);
+	for(i = 0; i < cols->length; i++)
+		keep[i] = (lo <= cols->peak[i]) & (cols->peak[i] < hi);
+
+	retval = XLALSnglBurstColumnsSelect(cols, keep);
+	XLALFree(keep);
+	if(retval)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/**
+ * \file
+ * \ingroup lalmetaio_general
+ * \brief Columnar containers for large trigger tables.
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/LIGOMetadataColumns.h>
+ * \endcode
+ *
+ * The trigger tables of \ref LIGOMetadataTables.h are singly linked lists
+ * with one allocation per row, which makes cutting, sorting and clustering
+ * millions of triggers slow.  The containers declared here store the rows
+ * of a table contiguously in a single block (the arena) together with
+ * struct-of-arrays copies of the columns most often used as keys.  Cuts and
+ * sorts run over the key columns and move the rows in bulk.
+ *
+ * The rows in the arena are kept linked through their \c next pointers, so
+ * the list returned by, e.g., XLALSnglInspiralColumnsAsTable() can be passed
+ * without copying to any routine that reads a linked list.  Such a list is
+ * owned by the container:  it must not be freed with the row destructors,
+ * and it is invalidated by any routine that adds, removes or reorders rows.
+ * Routines that edit rows through the list should call, e.g.,
+ * XLALSnglInspiralColumnsRefresh() afterwards to update the key columns.
+ */
+
+#ifndef _LIGOMETADATACOLUMNS_H
+#define _LIGOMETADATACOLUMNS_H
+
+#if defined(__cplusplus)
+extern "C" {
+#elif 0
+} /* so that editors will match preceding brace */
+#endif
+
+#include <stddef.h>
+#include <lal/LALDatatypes.h>
+#include <lal/LIGOMetadataTables.h>
+
+
+/*
+ *
+ * sngl_inspiral
+ *
+ */
+
+/**
+ * Key columns of a ::SnglInspiralColumns container.
+ */
+typedef enum
+tagSnglInspiralColumnsKey
+{
+  LAL_SNGL_INSPIRAL_KEY_END,
+  LAL_SNGL_INSPIRAL_KEY_SNR,
+  LAL_SNGL_INSPIRAL_KEY_CHISQ,
+  LAL_SNGL_INSPIRAL_KEY_MASS1,
+  LAL_SNGL_INSPIRAL_KEY_MASS2,
+  LAL_SNGL_INSPIRAL_KEY_MCHIRP,
+  LAL_SNGL_INSPIRAL_KEY_MTOTAL,
+  LAL_SNGL_INSPIRAL_KEY_ETA
+}
+SnglInspiralColumnsKey;
+
+/**
+ * Columnar container of sngl_inspiral rows.  Element i of each key column
+ * is a copy of the corresponding field of rows[i]; end times are stored as
+ * integer nanoseconds.
+ */
+typedef struct
+tagSnglInspiralColumns
+{
+  size_t              length;     /**< number of rows */
+  size_t              capacity;   /**< number of rows allocated */
+#ifndef SWIG   // exclude from SWIG interface
+  SnglInspiralTable  *rows;       /**< arena of rows, linked in order */
+  INT8               *end;        /**< end time (ns) */
+  REAL4              *snr;        /**< signal-to-noise ratio */
+  REAL4              *chisq;      /**< chi squared */
+  REAL4              *mass1;      /**< first component mass */
+  REAL4              *mass2;      /**< second component mass */
+  REAL4              *mchirp;     /**< chirp mass */
+  REAL4              *mtotal;     /**< total mass */
+  REAL4              *eta;        /**< symmetric mass ratio */
+#endif   // SWIG
+}
+SnglInspiralColumns;
+
+SnglInspiralColumns *XLALCreateSnglInspiralColumns(size_t capacity);
+void XLALDestroySnglInspiralColumns(SnglInspiralColumns *cols);
+int XLALSnglInspiralColumnsAppend(SnglInspiralColumns *cols, const SnglInspiralTable *row);
+SnglInspiralColumns *XLALSnglInspiralColumnsFromTable(const SnglInspiralTable *head);
+SnglInspiralTable *XLALSnglInspiralColumnsAsTable(SnglInspiralColumns *cols);
+SnglInspiralTable *XLALSnglInspiralColumnsToTable(const SnglInspiralColumns *cols);
+void XLALSnglInspiralColumnsRefresh(SnglInspiralColumns *cols);
+#ifndef SWIG   // exclude from SWIG interface
+int XLALSnglInspiralColumnsSelect(SnglInspiralColumns *cols, const unsigned char *keep);
+int XLALSnglInspiralColumnsGather(SnglInspiralColumns *cols, const size_t *index, size_t n);
+size_t *XLALSnglInspiralColumnsSortIndex(const SnglInspiralColumns *cols, SnglInspiralColumnsKey key, int descending);
+#endif   // SWIG
+int XLALSnglInspiralColumnsSort(SnglInspiralColumns *cols, SnglInspiralColumnsKey key, int descending);
+int XLALSnglInspiralColumnsRangeCut(SnglInspiralColumns *cols, SnglInspiralColumnsKey key, REAL8 low, REAL8 high);
+int XLALSnglInspiralColumnsTimeCut(SnglInspiralColumns *cols, const LIGOTimeGPS *start, const LIGOTimeGPS *end);
+
+
+/*
+ *
+ * sngl_burst
+ *
+ */
+
+/**
+ * Key columns of a ::SnglBurstColumns container.
+ */
+typedef enum
+tagSnglBurstColumnsKey
+{
+  LAL_SNGL_BURST_KEY_PEAK,
+  LAL_SNGL_BURST_KEY_START,
+  LAL_SNGL_BURST_KEY_DURATION,
+  LAL_SNGL_BURST_KEY_CENTRAL_FREQ,
+  LAL_SNGL_BURST_KEY_BANDWIDTH,
+  LAL_SNGL_BURST_KEY_SNR,
+  LAL_SNGL_BURST_KEY_CONFIDENCE
+}
+SnglBurstColumnsKey;
+
+/**
+ * Columnar container of sngl_burst rows.  Element i of each key column is
+ * a copy of the corresponding field of rows[i]; times are stored as integer
+ * nanoseconds.
+ */
+typedef struct
+tagSnglBurstColumns
+{
+  size_t      length;         /**< number of rows */
+  size_t      capacity;       /**< number of rows allocated */
+#ifndef SWIG   // exclude from SWIG interface
+  SnglBurst  *rows;           /**< arena of rows, linked in order */
+  INT8       *peak;           /**< peak time (ns) */
+  INT8       *start;          /**< start time (ns) */
+  REAL4      *duration;       /**< duration */
+  REAL4      *central_freq;   /**< central frequency */
+  REAL4      *bandwidth;      /**< bandwidth */
+  REAL4      *snr;            /**< signal-to-noise ratio */
+  REAL4      *confidence;     /**< confidence */
+#endif   // SWIG
+}
+SnglBurstColumns;
+
+SnglBurstColumns *XLALCreateSnglBurstColumns(size_t capacity);
+void XLALDestroySnglBurstColumns(SnglBurstColumns *cols);
+int XLALSnglBurstColumnsAppend(SnglBurstColumns *cols, const SnglBurst *row);
+SnglBurstColumns *XLALSnglBurstColumnsFromTable(const SnglBurst *head);
+SnglBurst *XLALSnglBurstColumnsAsTable(SnglBurstColumns *cols);
+SnglBurst *XLALSnglBurstColumnsToTable(const SnglBurstColumns *cols);
+void XLALSnglBurstColumnsRefresh(SnglBurstColumns *cols);
+#ifndef SWIG   // exclude from SWIG interface
+int XLALSnglBurstColumnsSelect(SnglBurstColumns *cols, const unsigned char *keep);
+int XLALSnglBurstColumnsGather(SnglBurstColumns *cols, const size_t *index, size_t n);
+size_t *XLALSnglBurstColumnsSortIndex(const SnglBurstColumns *cols, SnglBurstColumnsKey key, int descending);
+#endif   // SWIG
+int XLALSnglBurstColumnsSort(SnglBurstColumns *cols, SnglBurstColumnsKey key, int descending);
+int XLALSnglBurstColumnsRangeCut(SnglBurstColumns *cols, SnglBurstColumnsKey key, REAL8 low, REAL8 high);
+int XLALSnglBurstColumnsTimeCut(SnglBurstColumns *cols, const LIGOTimeGPS *start, const LIGOTimeGPS *end);
+
+#if 0
+{ /* so that editors will match succeeding brace */
+#elif defined(__cplusplus)
+}
+#endif
+
+#endif /* _LIGOMETADATACOLUMNS_H */
@@ -0,0 +1,1129 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/*
+ * HDF5 storage of metadata tables.
+ *
+ * Every table is handled by the same two routines, driven by a descriptor
+ * that lists the table's columns and where each is stored in the row
+ * structure.  The descriptors list the columns written by the LIGO Light
+ * Weight XML writers, in the same order.  Writing gathers each column from
+ * the linked list into a contiguous buffer, converting the C types of the
+ * row structures to fixed-width types, and stores it as a chunked,
+ * compressed dataset.  Reading does the reverse for the requested columns
+ * and range of rows.
+ */
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include <lal/AVFactories.h>
+#include <lal/Date.h>
+#include <lal/H5FileIO.h>
+#include <lal/LALMalloc.h>
+#include <lal/LIGOMetadataH5.h>
+#include <lal/LIGOMetadataTables.h>
+#include <lal/LIGOMetadataUtils.h>
+#include <lal/XLALError.h>
+
+
+/* rows per chunk, and deflate level, of column datasets */
+#define LIGOMETA_H5_CHUNK 4096
+#define LIGOMETA_H5_DEFLATE_LEVEL 6
+
+
+/*
+ * ============================================================================
+ *
+ *                            Table Descriptors
+ *
+ * ============================================================================
+ */
+
+
+enum h5_column_type {
+	H5_INT_4S,	/* INT4 */
+	H5_INT_8S,	/* long, stored as INT8 */
+	H5_INT_8U,	/* unsigned long, stored as UINT8 */
+	H5_REAL_4,
+	H5_REAL_8,
+	H5_LSTRING	/* CHAR array of the field's width */
+};
+
+
+/* where a column is stored in the row structure */
+struct h5_column {
+	const char *name;
+	enum h5_column_type type;
+	size_t offset;
+	size_t size;
+};
+
+
+struct h5_table {
+	const char *name;
+	const struct h5_column *columns;
+	size_t ncolumns;
+	size_t row_size;
+	/* columns holding the time used for GPS cuts, or NULL */
+	const char *time;
+	const char *time_ns;
+};
+
+
+/* every row structure begins with its next pointer */
+#define H5_ROW_NEXT(row) (*(void **) (row))
+
+
+static LALTYPECODE h5_column_typecode(enum h5_column_type type)
+{
+	switch(type) {
+	case H5_INT_4S:
+		return LAL_I4_TYPE_CODE;
+	case H5_INT_8S:
+		return LAL_I8_TYPE_CODE;
+	case H5_INT_8U:
+		return LAL_U8_TYPE_CODE;
+	case H5_REAL_4:
+		return LAL_S_TYPE_CODE;
+	case H5_REAL_8:
+		return LAL_D_TYPE_CODE;
+	case H5_LSTRING:
+	default:
+		return LAL_CHAR_TYPE_CODE;
+	}
+}
+
+
+/* size of one element of a column in a dataset, per row */
+static size_t h5_column_width(const struct h5_column *column)
+{
+	switch(column->type) {
+	case H5_INT_4S:
+		return sizeof(INT4);
+	case H5_INT_8S:
+		return sizeof(INT8);
+	case H5_INT_8U:
+		return sizeof(UINT8);
+	case H5_REAL_4:
+		return sizeof(REAL4);
+	case H5_REAL_8:
+		return sizeof(REAL8);
+	case H5_LSTRING:
+	default:
+		return column->size;
+	}
+}
+
+
+static const struct h5_column *h5_table_find_column(const struct h5_table *table, const char *name, size_t length)
+{
+	size_t i;
+
+	for(i = 0; i < table->ncolumns; i++)
+		if(strlen(table->columns[i].name) == length && !strncmp(table->columns[i].name, name, length))
+			return &table->columns[i];
+	return NULL;
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                             Column Transfer
+ *
+ * ============================================================================
+ */
+
+
+/* copy a column out of the rows into a contiguous buffer */
+static void h5_column_gather(char *dst, const struct h5_column *column, const void *head)
+{
+	size_t width = h5_column_width(column);
+	const char *row;
+
+	for(row = head; row; row = H5_ROW_NEXT(row), dst += width) {
+		const char *field = row + column->offset;
+		switch(column->type) {
+		case H5_INT_4S:
+			*(INT4 *) dst = *(const INT4 *) field;
+			break;
+		case H5_INT_8S:
+			*(INT8 *) dst = *(const long *) field;
+			break;
+		case H5_INT_8U:
+			*(UINT8 *) dst = *(const unsigned long *) field;
+			break;
+		case H5_REAL_4:
+			*(REAL4 *) dst = *(const REAL4 *) field;
+			break;
+		case H5_REAL_8:
+			*(REAL8 *) dst = *(const REAL8 *) field;
+			break;
+		case H5_LSTRING:
+			/* pad with zeros, not whatever follows the terminator */
+			strncpy(dst, field, width);
+			dst[width - 1] = '\0';
+			break;
+		}
+	}
+}
+
+
+/* copy selected elements of a contiguous buffer into the rows */
+static void h5_column_scatter(void **rows, size_t nrows, const struct h5_column *column, const char *src, size_t src_width, const size_t *index)
+{
+	size_t i;
+
+	for(i = 0; i < nrows; i++) {
+		const char *elem = src + index[i] * src_width;
+		char *field = (char *) rows[i] + column->offset;
+		switch(column->type) {
+		case H5_INT_4S:
+			*(INT4 *) field = *(const INT4 *) elem;
+			break;
+		case H5_INT_8S:
+			*(long *) field = *(const INT8 *) elem;
+			break;
+		case H5_INT_8U:
+			*(unsigned long *) field = *(const UINT8 *) elem;
+			break;
+		case H5_REAL_4:
+			*(REAL4 *) field = *(const REAL4 *) elem;
+			break;
+		case H5_REAL_8:
+			*(REAL8 *) field = *(const REAL8 *) elem;
+			break;
+		case H5_LSTRING: {
+			/* the stored width may differ from the field's */
+			size_t n = src_width < column->size ? src_width : column->size - 1;
+			memcpy(field, elem, n);
+			field[n] = '\0';
+			break;
+		}
+		}
+	}
+}
+
+
+/* open a column's dataset and check its type and shape */
+static LALH5Dataset *h5_column_open(LALH5File *group, const struct h5_column *column, size_t *nrows, size_t *width)
+{
+	LALH5Dataset *dset;
+	UINT4Vector *dims;
+
+	dset = XLALH5DatasetRead(group, column->name);
+	if(!dset)
+		XLAL_ERROR_NULL(XLAL_EFUNC, "cannot open column \"%s\"", column->name);
+	if(XLALH5DatasetQueryType(dset) != h5_column_typecode(column->type)) {
+		XLALH5DatasetFree(dset);
+		XLAL_ERROR_NULL(XLAL_ETYPE, "column \"%s\" has wrong type", column->name);
+	}
+	dims = XLALH5DatasetQueryDims(dset);
+	if(!dims) {
+		XLALH5DatasetFree(dset);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	if(dims->length != (column->type == H5_LSTRING ? 2 : 1) || (column->type == H5_LSTRING && dims->data[1] == 0)) {
+		XLALDestroyUINT4Vector(dims);
+		XLALH5DatasetFree(dset);
+		XLAL_ERROR_NULL(XLAL_EDATA, "column \"%s\" has wrong shape", column->name);
+	}
+	*nrows = dims->data[0];
+	*width = column->type == H5_LSTRING ? dims->data[1] : h5_column_width(column);
+	XLALDestroyUINT4Vector(dims);
+
+	return dset;
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                              Table Transfer
+ *
+ * ============================================================================
+ */
+
+
+static int h5_table_write(LALH5File *file, const struct h5_table *table, const void *head)
+{
+	LALH5File *group;
+	UINT4 dim_data[2];
+	UINT4Vector dims = {0, dim_data};
+	char *buffer = NULL;
+	size_t buffer_size = 0;
+	size_t nrows = 0;
+	const void *row;
+	size_t i;
+
+	if(!file)
+		XLAL_ERROR(XLAL_EFAULT);
+
+	for(row = head; row; row = H5_ROW_NEXT(row))
+		nrows++;
+	if(nrows > UINT32_MAX)
+		XLAL_ERROR(XLAL_EBADLEN, "too many rows in %s table", table->name);
+
+	group = XLALH5GroupOpen(file, table->name);
+	if(!group)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	for(i = 0; i < table->ncolumns; i++) {
+		const struct h5_column *column = &table->columns[i];
+		size_t size = nrows * h5_column_width(column);
+		LALH5Dataset *dset;
+
+		if(size > buffer_size) {
+			char *new = XLALRealloc(buffer, size);
+			if(!new) {
+				XLALFree(buffer);
+				XLALH5FileClose(group);
+				XLAL_ERROR(XLAL_EFUNC);
+			}
+			buffer = new;
+			buffer_size = size;
+		}
+		h5_column_gather(buffer, column, head);
+
+		dims.length = column->type == H5_LSTRING ? 2 : 1;
+		dims.data[0] = nrows;
+		dims.data[1] = column->size;
+		dset = XLALH5DatasetAllocCompressed(group, column->name, h5_column_typecode(column->type), &dims, LIGOMETA_H5_CHUNK, LIGOMETA_H5_DEFLATE_LEVEL);
+		if(!dset || (nrows && XLALH5DatasetWrite(dset, buffer))) {
+			XLALH5DatasetFree(dset);
+			XLALFree(buffer);
+			XLALH5FileClose(group);
+			XLAL_ERROR(XLAL_EFUNC, "failure writing column \"%s\" of %s table", column->name, table->name);
+		}
+		XLALH5DatasetFree(dset);
+	}
+
+	XLALFree(buffer);
+	XLALH5FileClose(group);
+	return 0;
+}
+
+
+/* rows of the table whose time lies in [start, end), as indices from *row0 */
+static size_t *h5_table_time_cut(LALH5File *group, const struct h5_table *table, size_t nrows, const LIGOTimeGPS *start, const LIGOTimeGPS *end, size_t *row0, size_t *nselected)
+{
+	const struct h5_column *columns[2];
+	INT4 *times[2] = {NULL, NULL};
+	size_t *index;
+	size_t n = 0;
+	size_t i;
+
+	columns[0] = h5_table_find_column(table, table->time, strlen(table->time));
+	columns[1] = h5_table_find_column(table, table->time_ns, strlen(table->time_ns));
+	index = XLALMalloc((nrows ? nrows : 1) * sizeof(*index));
+	if(!index)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	for(i = 0; i < 2; i++) {
+		size_t length, width;
+		LALH5Dataset *dset = h5_column_open(group, columns[i], &length, &width);
+		if(!dset || length != nrows) {
+			XLALH5DatasetFree(dset);
+			XLALFree(times[0]);
+			XLALFree(index);
+			XLAL_ERROR_NULL(dset ? XLAL_EDATA : XLAL_EFUNC, "columns of %s table differ in length", table->name);
+		}
+		times[i] = XLALMalloc((nrows ? nrows : 1) * sizeof(**times));
+		if(!times[i] || (nrows && XLALH5DatasetQueryData(times[i], dset))) {
+			XLALH5DatasetFree(dset);
+			XLALFree(times[0]);
+			XLALFree(times[1]);
+			XLALFree(index);
+			XLAL_ERROR_NULL(XLAL_EFUNC);
+		}
+		XLALH5DatasetFree(dset);
+	}
+
+	for(i = 0; i < nrows; i++) {
+		LIGOTimeGPS t;
+		XLALGPSSet(&t, times[0][i], times[1][i]);
+		if(start && XLALGPSCmp(&t, start) < 0)
+			continue;
+		if(end && XLALGPSCmp(&t, end) >= 0)
+			continue;
+		index[n++] = i;
+	}
+	XLALFree(times[0]);
+	XLALFree(times[1]);
+
+	/* make the indices relative to the first selected row */
+	*row0 = n ? index[0] : 0;
+	for(i = 0; i < n; i++)
+		index[i] -= *row0;
+	*nselected = n;
+	return index;
+}
+
+
+static void *h5_table_read(LALH5File *file, const struct h5_table *table, const char *columns, const LIGOTimeGPS *start, const LIGOTimeGPS *end, void (*destroy)(void *))
+{
+	LALH5File *group;
+	LALH5Dataset *dset;
+	unsigned char *selected;
+	size_t *index = NULL;
+	void **rows = NULL;
+	char *buffer = NULL;
+	void *head = NULL;
+	size_t nrows = 0;
+	size_t nselected;
+	size_t row0 = 0;
+	size_t span;
+	size_t width;
+	size_t i;
+
+	if(!file)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if(start && end && XLALGPSCmp(start, end) > 0)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "start time after end time");
+
+	/* which columns to read */
+	selected = XLALCalloc(table->ncolumns, sizeof(*selected));
+	if(!selected)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	if(columns) {
+		const char *name = columns;
+		while(*name) {
+			size_t length = strcspn(name, ",");
+			const struct h5_column *column;
+			while(length && name[0] == ' ')
+				name++, length--;
+			column = h5_table_find_column(table, name, length);
+			if(!column && length) {
+				XLALFree(selected);
+				XLAL_ERROR_NULL(XLAL_EINVAL, "%s table has no column \"%.*s\"", table->name, (int) length, name);
+			}
+			if(column)
+				selected[column - table->columns] = 1;
+			name += length;
+			if(*name == ',')
+				name++;
+		}
+	} else
+		memset(selected, 1, table->ncolumns);
+
+	group = XLALH5GroupOpen(file, table->name);
+	if(!group) {
+		XLALFree(selected);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	/* the number of rows is the length of the columns */
+	dset = h5_column_open(group, &table->columns[0], &nrows, &width);
+	if(!dset)
+		goto error;
+	XLALH5DatasetFree(dset);
+
+	/* which rows to read */
+	if(table->time && (start || end)) {
+		index = h5_table_time_cut(group, table, nrows, start, end, &row0, &nselected);
+		if(!index)
+			goto error;
+	} else {
+		index = XLALMalloc((nrows ? nrows : 1) * sizeof(*index));
+		if(!index)
+			goto error;
+		for(i = 0; i < nrows; i++)
+			index[i] = i;
+		nselected = nrows;
+	}
+	span = nselected ? index[nselected - 1] + 1 : 0;
+
+	/* allocate the rows, zeroed so that unread columns are zero */
+	rows = XLALMalloc((nselected ? nselected : 1) * sizeof(*rows));
+	if(!rows)
+		goto error;
+	for(i = nselected; i > 0; i--) {
+		rows[i - 1] = XLALCalloc(1, table->row_size);
+		if(!rows[i - 1])
+			goto error;
+		H5_ROW_NEXT(rows[i - 1]) = head;
+		head = rows[i - 1];
+	}
+
+	/* read the rows spanning the selection of each column */
+	for(i = 0; i < table->ncolumns && nselected; i++) {
+		const struct h5_column *column = &table->columns[i];
+		size_t length;
+		char *new;
+
+		if(!selected[i])
+			continue;
+		dset = h5_column_open(group, column, &length, &width);
+		if(!dset)
+			goto error;
+		if(length != nrows) {
+			XLALH5DatasetFree(dset);
+			XLALPrintError("%s(): columns of %s table differ in length\n", __func__, table->name);
+			goto error;
+		}
+		new = XLALRealloc(buffer, span * width);
+		if(!new) {
+			XLALH5DatasetFree(dset);
+			goto error;
+		}
+		buffer = new;
+		if(XLALH5DatasetQueryDataRows(buffer, dset, row0, span)) {
+			XLALH5DatasetFree(dset);
+			goto error;
+		}
+		XLALH5DatasetFree(dset);
+		h5_column_scatter(rows, nselected, column, buffer, width, index);
+	}
+
+	XLALFree(buffer);
+	XLALFree(rows);
+	XLALFree(index);
+	XLALFree(selected);
+	XLALH5FileClose(group);
+	return head;
+
+error:
+	destroy(head);
+	XLALFree(buffer);
+	XLALFree(rows);
+	XLALFree(index);
+	XLALFree(selected);
+	XLALH5FileClose(group);
+	XLAL_ERROR_NULL(XLAL_EFUNC, "failure reading %s table", table->name);
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                                  process
+ *
+ * ============================================================================
+ */
+
+
+#define PROCESS_COLUMN(name, type, member) {name, type, offsetof(ProcessTable, member), sizeof(((ProcessTable *) NULL)->member)}
+
+
+static const struct h5_column process_columns[] = {
+	PROCESS_COLUMN("program", H5_LSTRING, program),
+	PROCESS_COLUMN("version", H5_LSTRING, version),
+	PROCESS_COLUMN("cvs_repository", H5_LSTRING, cvs_repository),
+	PROCESS_COLUMN("cvs_entry_time", H5_INT_4S, cvs_entry_time.gpsSeconds),
+	PROCESS_COLUMN("comment", H5_LSTRING, comment),
+	PROCESS_COLUMN("is_online", H5_INT_4S, is_online),
+	PROCESS_COLUMN("node", H5_LSTRING, node),
+	PROCESS_COLUMN("username", H5_LSTRING, username),
+	PROCESS_COLUMN("unix_procid", H5_INT_4S, unix_procid),
+	PROCESS_COLUMN("start_time", H5_INT_4S, start_time.gpsSeconds),
+	PROCESS_COLUMN("end_time", H5_INT_4S, end_time.gpsSeconds),
+	PROCESS_COLUMN("jobid", H5_INT_4S, jobid),
+	PROCESS_COLUMN("domain", H5_LSTRING, domain),
+	PROCESS_COLUMN("ifos", H5_LSTRING, ifos),
+	PROCESS_COLUMN("process_id", H5_INT_8S, process_id),
+};
+
+
+static const struct h5_table process_table = {"process", process_columns, XLAL_NUM_ELEM(process_columns), sizeof(ProcessTable), NULL, NULL};
+
+
+static void process_destroy(void *head)
+{
+	XLALDestroyProcessTable(head);
+}
+
+
+/**
+ * Write a process table to a group named "process" in an HDF5 file.
+ */
+int XLALWriteProcessTableH5(
+	LALH5File *file,
+	const ProcessTable *process
+)
+{
+	return h5_table_write(file, &process_table, process) ? XLAL_FAILURE : 0;
+}
+
+
+/**
+ * Read the process table from an HDF5 file.  columns is a comma-separated
+ * list of the columns to read, or NULL to read all columns.
+ */
+ProcessTable *XLALReadProcessTableH5(
+	LALH5File *file,
+	const char *columns
+)
+{
+	return h5_table_read(file, &process_table, columns, NULL, NULL, process_destroy);
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                              process_params
+ *
+ * ============================================================================
+ */
+
+
+#define PROCESS_PARAMS_COLUMN(name, type, member) {name, type, offsetof(ProcessParamsTable, member), sizeof(((ProcessParamsTable *) NULL)->member)}
+
+
+static const struct h5_column process_params_columns[] = {
+	PROCESS_PARAMS_COLUMN("program", H5_LSTRING, program),
+	PROCESS_PARAMS_COLUMN("process_id", H5_INT_8S, process_id),
+	PROCESS_PARAMS_COLUMN("param", H5_LSTRING, param),
+	PROCESS_PARAMS_COLUMN("type", H5_LSTRING, type),
+	PROCESS_PARAMS_COLUMN("value", H5_LSTRING, value),
+};
+
+
+static const struct h5_table process_params_table = {"process_params", process_params_columns, XLAL_NUM_ELEM(process_params_columns), sizeof(ProcessParamsTable), NULL, NULL};
+
+
+static void process_params_destroy(void *head)
+{
+	XLALDestroyProcessParamsTable(head);
+}
+
+
+/**
+ * Write a process_params table to a group named "process_params" in an
+ * HDF5 file.
+ */
+int XLALWriteProcessParamsTableH5(
+	LALH5File *file,
+	const ProcessParamsTable *process_params
+)
+{
+	return h5_table_write(file, &process_params_table, process_params) ? XLAL_FAILURE : 0;
+}
+
+
+/**
+ * Read the process_params table from an HDF5 file.  columns is a
+ * comma-separated list of the columns to read, or NULL to read all
+ * columns.
+ */
+ProcessParamsTable *XLALReadProcessParamsTableH5(
+	LALH5File *file,
+	const char *columns
+)
+{
+	return h5_table_read(file, &process_params_table, columns, NULL, NULL, process_params_destroy);
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                               sngl_inspiral
+ *
+ * ============================================================================
+ */
+
+
+#define SNGL_INSPIRAL_COLUMN(name, type, member) {name, type, offsetof(SnglInspiralTable, member), sizeof(((SnglInspiralTable *) NULL)->member)}
+
+
+static const struct h5_column sngl_inspiral_columns[] = {
+	SNGL_INSPIRAL_COLUMN("process_id", H5_INT_8S, process_id),
+	SNGL_INSPIRAL_COLUMN("ifo", H5_LSTRING, ifo),
+	SNGL_INSPIRAL_COLUMN("search", H5_LSTRING, search),
+	SNGL_INSPIRAL_COLUMN("channel", H5_LSTRING, channel),
+	SNGL_INSPIRAL_COLUMN("end_time", H5_INT_4S, end.gpsSeconds),
+	SNGL_INSPIRAL_COLUMN("end_time_ns", H5_INT_4S, end.gpsNanoSeconds),
+	SNGL_INSPIRAL_COLUMN("end_time_gmst", H5_REAL_8, end_time_gmst),
+	SNGL_INSPIRAL_COLUMN("impulse_time", H5_INT_4S, impulse_time.gpsSeconds),
+	SNGL_INSPIRAL_COLUMN("impulse_time_ns", H5_INT_4S, impulse_time.gpsNanoSeconds),
+	SNGL_INSPIRAL_COLUMN("template_duration", H5_REAL_8, template_duration),
+	SNGL_INSPIRAL_COLUMN("event_duration", H5_REAL_8, event_duration),
+	SNGL_INSPIRAL_COLUMN("amplitude", H5_REAL_4, amplitude),
+	SNGL_INSPIRAL_COLUMN("eff_distance", H5_REAL_4, eff_distance),
+	SNGL_INSPIRAL_COLUMN("coa_phase", H5_REAL_4, coa_phase),
+	SNGL_INSPIRAL_COLUMN("mass1", H5_REAL_4, mass1),
+	SNGL_INSPIRAL_COLUMN("mass2", H5_REAL_4, mass2),
+	SNGL_INSPIRAL_COLUMN("mchirp", H5_REAL_4, mchirp),
+	SNGL_INSPIRAL_COLUMN("mtotal", H5_REAL_4, mtotal),
+	SNGL_INSPIRAL_COLUMN("eta", H5_REAL_4, eta),
+	SNGL_INSPIRAL_COLUMN("kappa", H5_REAL_4, kappa),
+	SNGL_INSPIRAL_COLUMN("chi", H5_REAL_4, chi),
+	SNGL_INSPIRAL_COLUMN("tau0", H5_REAL_4, tau0),
+	SNGL_INSPIRAL_COLUMN("tau2", H5_REAL_4, tau2),
+	SNGL_INSPIRAL_COLUMN("tau3", H5_REAL_4, tau3),
+	SNGL_INSPIRAL_COLUMN("tau4", H5_REAL_4, tau4),
+	SNGL_INSPIRAL_COLUMN("tau5", H5_REAL_4, tau5),
+	SNGL_INSPIRAL_COLUMN("ttotal", H5_REAL_4, ttotal),
+	SNGL_INSPIRAL_COLUMN("psi0", H5_REAL_4, psi0),
+	SNGL_INSPIRAL_COLUMN("psi3", H5_REAL_4, psi3),
+	SNGL_INSPIRAL_COLUMN("alpha", H5_REAL_4, alpha),
+	SNGL_INSPIRAL_COLUMN("alpha1", H5_REAL_4, alpha1),
+	SNGL_INSPIRAL_COLUMN("alpha2", H5_REAL_4, alpha2),
+	SNGL_INSPIRAL_COLUMN("alpha3", H5_REAL_4, alpha3),
+	SNGL_INSPIRAL_COLUMN("alpha4", H5_REAL_4, alpha4),
+	SNGL_INSPIRAL_COLUMN("alpha5", H5_REAL_4, alpha5),
+	SNGL_INSPIRAL_COLUMN("alpha6", H5_REAL_4, alpha6),
+	SNGL_INSPIRAL_COLUMN("beta", H5_REAL_4, beta),
+	SNGL_INSPIRAL_COLUMN("f_final", H5_REAL_4, f_final),
+	SNGL_INSPIRAL_COLUMN("snr", H5_REAL_4, snr),
+	SNGL_INSPIRAL_COLUMN("chisq", H5_REAL_4, chisq),
+	SNGL_INSPIRAL_COLUMN("chisq_dof", H5_INT_4S, chisq_dof),
+	SNGL_INSPIRAL_COLUMN("bank_chisq", H5_REAL_4, bank_chisq),
+	SNGL_INSPIRAL_COLUMN("bank_chisq_dof", H5_INT_4S, bank_chisq_dof),
+	SNGL_INSPIRAL_COLUMN("cont_chisq", H5_REAL_4, cont_chisq),
+	SNGL_INSPIRAL_COLUMN("cont_chisq_dof", H5_INT_4S, cont_chisq_dof),
+	SNGL_INSPIRAL_COLUMN("sigmasq", H5_REAL_8, sigmasq),
+	SNGL_INSPIRAL_COLUMN("rsqveto_duration", H5_REAL_4, rsqveto_duration),
+	SNGL_INSPIRAL_COLUMN("Gamma0", H5_REAL_4, Gamma[0]),
+	SNGL_INSPIRAL_COLUMN("Gamma1", H5_REAL_4, Gamma[1]),
+	SNGL_INSPIRAL_COLUMN("Gamma2", H5_REAL_4, Gamma[2]),
+	SNGL_INSPIRAL_COLUMN("Gamma3", H5_REAL_4, Gamma[3]),
+	SNGL_INSPIRAL_COLUMN("Gamma4", H5_REAL_4, Gamma[4]),
+	SNGL_INSPIRAL_COLUMN("Gamma5", H5_REAL_4, Gamma[5]),
+	SNGL_INSPIRAL_COLUMN("Gamma6", H5_REAL_4, Gamma[6]),
+	SNGL_INSPIRAL_COLUMN("Gamma7", H5_REAL_4, Gamma[7]),
+	SNGL_INSPIRAL_COLUMN("Gamma8", H5_REAL_4, Gamma[8]),
+	SNGL_INSPIRAL_COLUMN("Gamma9", H5_REAL_4, Gamma[9]),
+	SNGL_INSPIRAL_COLUMN("spin1x", H5_REAL_4, spin1x),
+	SNGL_INSPIRAL_COLUMN("spin1y", H5_REAL_4, spin1y),
+	SNGL_INSPIRAL_COLUMN("spin1z", H5_REAL_4, spin1z),
+	SNGL_INSPIRAL_COLUMN("spin2x", H5_REAL_4, spin2x),
+	SNGL_INSPIRAL_COLUMN("spin2y", H5_REAL_4, spin2y),
+	SNGL_INSPIRAL_COLUMN("spin2z", H5_REAL_4, spin2z),
+	SNGL_INSPIRAL_COLUMN("event_id", H5_INT_8S, event_id),
+};
+
+
+static const struct h5_table sngl_inspiral_table = {"sngl_inspiral", sngl_inspiral_columns, XLAL_NUM_ELEM(sngl_inspiral_columns), sizeof(SnglInspiralTable), "end_time", "end_time_ns"};
+
+
+static void sngl_inspiral_destroy(void *head)
+{
+	XLALDestroySnglInspiralTable(head);
+}
+
+
+/**
+ * Write a sngl_inspiral table to a group named "sngl_inspiral" in an HDF5
+ * file.
+ */
+int XLALWriteSnglInspiralTableH5(
+	LALH5File *file,
+	const SnglInspiralTable *sngl_inspiral
+)
+{
+	return h5_table_write(file, &sngl_inspiral_table, sngl_inspiral) ? XLAL_FAILURE : 0;
+}
+
+
+/**
+ * Read the sngl_inspiral table from an HDF5 file.  columns is a
+ * comma-separated list of the columns to read, or NULL to read all
+ * columns.  If start or end is not NULL, only the rows whose end time
+ * lies in [start, end) are returned.
+ */
+SnglInspiralTable *XLALReadSnglInspiralTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+)
+{
+	return h5_table_read(file, &sngl_inspiral_table, columns, start, end, sngl_inspiral_destroy);
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                                sngl_burst
+ *
+ * ============================================================================
+ */
+
+
+#define SNGL_BURST_COLUMN(name, type, member) {name, type, offsetof(SnglBurst, member), sizeof(((SnglBurst *) NULL)->member)}
+
+
+static const struct h5_column sngl_burst_columns[] = {
+	SNGL_BURST_COLUMN("process_id", H5_INT_8S, process_id),
+	SNGL_BURST_COLUMN("ifo", H5_LSTRING, ifo),
+	SNGL_BURST_COLUMN("search", H5_LSTRING, search),
+	SNGL_BURST_COLUMN("channel", H5_LSTRING, channel),
+	SNGL_BURST_COLUMN("start_time", H5_INT_4S, start_time.gpsSeconds),
+	SNGL_BURST_COLUMN("start_time_ns", H5_INT_4S, start_time.gpsNanoSeconds),
+	SNGL_BURST_COLUMN("peak_time", H5_INT_4S, peak_time.gpsSeconds),
+	SNGL_BURST_COLUMN("peak_time_ns", H5_INT_4S, peak_time.gpsNanoSeconds),
+	SNGL_BURST_COLUMN("duration", H5_REAL_4, duration),
+	SNGL_BURST_COLUMN("central_freq", H5_REAL_4, central_freq),
+	SNGL_BURST_COLUMN("bandwidth", H5_REAL_4, bandwidth),
+	SNGL_BURST_COLUMN("amplitude", H5_REAL_4, amplitude),
+	SNGL_BURST_COLUMN("snr", H5_REAL_4, snr),
+	SNGL_BURST_COLUMN("confidence", H5_REAL_4, confidence),
+	SNGL_BURST_COLUMN("chisq", H5_REAL_8, chisq),
+	SNGL_BURST_COLUMN("chisq_dof", H5_REAL_8, chisq_dof),
+	SNGL_BURST_COLUMN("event_id", H5_INT_8S, event_id),
+};
+
+
+static const struct h5_table sngl_burst_table = {"sngl_burst", sngl_burst_columns, XLAL_NUM_ELEM(sngl_burst_columns), sizeof(SnglBurst), "peak_time", "peak_time_ns"};
+
+
+static void sngl_burst_destroy(void *head)
+{
+	XLALDestroySnglBurstTable(head);
+}
+
+
+/**
+ * Write a sngl_burst table to a group named "sngl_burst" in an HDF5 file.
+ */
+int XLALWriteSnglBurstTableH5(
+	LALH5File *file,
+	const SnglBurst *sngl_burst
+)
+{
+	return h5_table_write(file, &sngl_burst_table, sngl_burst) ? XLAL_FAILURE : 0;
+}
+
+
+/**
+ * Read the sngl_burst table from an HDF5 file.  columns is a
+ * comma-separated list of the columns to read, or NULL to read all
+ * columns.  If start or end is not NULL, only the rows whose peak time
+ * lies in [start, end) are returned.
+ */
+SnglBurst *XLALReadSnglBurstTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+)
+{
+	return h5_table_read(file, &sngl_burst_table, columns, start, end, sngl_burst_destroy);
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                               sim_inspiral
+ *
+ * ============================================================================
+ */
+
+
+#define SIM_INSPIRAL_COLUMN(name, type, member) {name, type, offsetof(SimInspiralTable, member), sizeof(((SimInspiralTable *) NULL)->member)}
+
+
+static const struct h5_column sim_inspiral_columns[] = {
+	SIM_INSPIRAL_COLUMN("process_id", H5_INT_8S, process_id),
+	SIM_INSPIRAL_COLUMN("waveform", H5_LSTRING, waveform),
+	SIM_INSPIRAL_COLUMN("geocent_end_time", H5_INT_4S, geocent_end_time.gpsSeconds),
+	SIM_INSPIRAL_COLUMN("geocent_end_time_ns", H5_INT_4S, geocent_end_time.gpsNanoSeconds),
+	SIM_INSPIRAL_COLUMN("h_end_time", H5_INT_4S, h_end_time.gpsSeconds),
+	SIM_INSPIRAL_COLUMN("h_end_time_ns", H5_INT_4S, h_end_time.gpsNanoSeconds),
+	SIM_INSPIRAL_COLUMN("l_end_time", H5_INT_4S, l_end_time.gpsSeconds),
+	SIM_INSPIRAL_COLUMN("l_end_time_ns", H5_INT_4S, l_end_time.gpsNanoSeconds),
+	SIM_INSPIRAL_COLUMN("g_end_time", H5_INT_4S, g_end_time.gpsSeconds),
+	SIM_INSPIRAL_COLUMN("g_end_time_ns", H5_INT_4S, g_end_time.gpsNanoSeconds),
+	SIM_INSPIRAL_COLUMN("t_end_time", H5_INT_4S, t_end_time.gpsSeconds),
+	SIM_INSPIRAL_COLUMN("t_end_time_ns", H5_INT_4S, t_end_time.gpsNanoSeconds),
+	SIM_INSPIRAL_COLUMN("v_end_time", H5_INT_4S, v_end_time.gpsSeconds),
+	SIM_INSPIRAL_COLUMN("v_end_time_ns", H5_INT_4S, v_end_time.gpsNanoSeconds),
+	SIM_INSPIRAL_COLUMN("end_time_gmst", H5_REAL_8, end_time_gmst),
+	SIM_INSPIRAL_COLUMN("source", H5_LSTRING, source),
+	SIM_INSPIRAL_COLUMN("mass1", H5_REAL_4, mass1),
+	SIM_INSPIRAL_COLUMN("mass2", H5_REAL_4, mass2),
+	SIM_INSPIRAL_COLUMN("mchirp", H5_REAL_4, mchirp),
+	SIM_INSPIRAL_COLUMN("eta", H5_REAL_4, eta),
+	SIM_INSPIRAL_COLUMN("distance", H5_REAL_4, distance),
+	SIM_INSPIRAL_COLUMN("longitude", H5_REAL_4, longitude),
+	SIM_INSPIRAL_COLUMN("latitude", H5_REAL_4, latitude),
+	SIM_INSPIRAL_COLUMN("inclination", H5_REAL_4, inclination),
+	SIM_INSPIRAL_COLUMN("coa_phase", H5_REAL_4, coa_phase),
+	SIM_INSPIRAL_COLUMN("polarization", H5_REAL_4, polarization),
+	SIM_INSPIRAL_COLUMN("psi0", H5_REAL_4, psi0),
+	SIM_INSPIRAL_COLUMN("psi3", H5_REAL_4, psi3),
+	SIM_INSPIRAL_COLUMN("alpha", H5_REAL_4, alpha),
+	SIM_INSPIRAL_COLUMN("alpha1", H5_REAL_4, alpha1),
+	SIM_INSPIRAL_COLUMN("alpha2", H5_REAL_4, alpha2),
+	SIM_INSPIRAL_COLUMN("alpha3", H5_REAL_4, alpha3),
+	SIM_INSPIRAL_COLUMN("alpha4", H5_REAL_4, alpha4),
+	SIM_INSPIRAL_COLUMN("alpha5", H5_REAL_4, alpha5),
+	SIM_INSPIRAL_COLUMN("alpha6", H5_REAL_4, alpha6),
+	SIM_INSPIRAL_COLUMN("beta", H5_REAL_4, beta),
+	SIM_INSPIRAL_COLUMN("spin1x", H5_REAL_4, spin1x),
+	SIM_INSPIRAL_COLUMN("spin1y", H5_REAL_4, spin1y),
+	SIM_INSPIRAL_COLUMN("spin1z", H5_REAL_4, spin1z),
+	SIM_INSPIRAL_COLUMN("spin2x", H5_REAL_4, spin2x),
+	SIM_INSPIRAL_COLUMN("spin2y", H5_REAL_4, spin2y),
+	SIM_INSPIRAL_COLUMN("spin2z", H5_REAL_4, spin2z),
+	SIM_INSPIRAL_COLUMN("theta0", H5_REAL_4, theta0),
+	SIM_INSPIRAL_COLUMN("phi0", H5_REAL_4, phi0),
+	SIM_INSPIRAL_COLUMN("f_lower", H5_REAL_4, f_lower),
+	SIM_INSPIRAL_COLUMN("f_final", H5_REAL_4, f_final),
+	SIM_INSPIRAL_COLUMN("eff_dist_h", H5_REAL_4, eff_dist_h),
+	SIM_INSPIRAL_COLUMN("eff_dist_l", H5_REAL_4, eff_dist_l),
+	SIM_INSPIRAL_COLUMN("eff_dist_g", H5_REAL_4, eff_dist_g),
+	SIM_INSPIRAL_COLUMN("eff_dist_t", H5_REAL_4, eff_dist_t),
+	SIM_INSPIRAL_COLUMN("eff_dist_v", H5_REAL_4, eff_dist_v),
+	SIM_INSPIRAL_COLUMN("numrel_mode_min", H5_INT_4S, numrel_mode_min),
+	SIM_INSPIRAL_COLUMN("numrel_mode_max", H5_INT_4S, numrel_mode_max),
+	SIM_INSPIRAL_COLUMN("numrel_data", H5_LSTRING, numrel_data),
+	SIM_INSPIRAL_COLUMN("amp_order", H5_INT_4S, amp_order),
+	SIM_INSPIRAL_COLUMN("taper", H5_LSTRING, taper),
+	SIM_INSPIRAL_COLUMN("bandpass", H5_INT_4S, bandpass),
+	SIM_INSPIRAL_COLUMN("simulation_id", H5_INT_8S, simulation_id),
+};
+
+
+static const struct h5_table sim_inspiral_table = {"sim_inspiral", sim_inspiral_columns, XLAL_NUM_ELEM(sim_inspiral_columns), sizeof(SimInspiralTable), "geocent_end_time", "geocent_end_time_ns"};
+
+
+static void sim_inspiral_destroy(void *head)
+{
+	XLALDestroySimInspiralTable(head);
+}
+
+
+/**
+ * Write a sim_inspiral table to a group named "sim_inspiral" in an HDF5
+ * file.
+ */
+int XLALWriteSimInspiralTableH5(
+	LALH5File *file,
+	const SimInspiralTable *sim_inspiral
+)
+{
+	return h5_table_write(file, &sim_inspiral_table, sim_inspiral) ? XLAL_FAILURE : 0;
+}
+
+
+/**
+ * Read the sim_inspiral table from an HDF5 file.  columns is a
+ * comma-separated list of the columns to read, or NULL to read all
+ * columns.  If start or end is not NULL, only the rows whose geocentre
+ * end time lies in [start, end) are returned.
+ */
+SimInspiralTable *XLALReadSimInspiralTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+)
+{
+	return h5_table_read(file, &sim_inspiral_table, columns, start, end, sim_inspiral_destroy);
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                                 sim_burst
+ *
+ * ============================================================================
+ */
+
+
+#define SIM_BURST_COLUMN(name, type, member) {name, type, offsetof(SimBurst, member), sizeof(((SimBurst *) NULL)->member)}
+
+
+static const struct h5_column sim_burst_columns[] = {
+	SIM_BURST_COLUMN("process_id", H5_INT_8S, process_id),
+	SIM_BURST_COLUMN("waveform", H5_LSTRING, waveform),
+	SIM_BURST_COLUMN("ra", H5_REAL_8, ra),
+	SIM_BURST_COLUMN("dec", H5_REAL_8, dec),
+	SIM_BURST_COLUMN("psi", H5_REAL_8, psi),
+	SIM_BURST_COLUMN("time_geocent_gps", H5_INT_4S, time_geocent_gps.gpsSeconds),
+	SIM_BURST_COLUMN("time_geocent_gps_ns", H5_INT_4S, time_geocent_gps.gpsNanoSeconds),
+	SIM_BURST_COLUMN("time_geocent_gmst", H5_REAL_8, time_geocent_gmst),
+	SIM_BURST_COLUMN("duration", H5_REAL_8, duration),
+	SIM_BURST_COLUMN("frequency", H5_REAL_8, frequency),
+	SIM_BURST_COLUMN("bandwidth", H5_REAL_8, bandwidth),
+	SIM_BURST_COLUMN("q", H5_REAL_8, q),
+	SIM_BURST_COLUMN("pol_ellipse_angle", H5_REAL_8, pol_ellipse_angle),
+	SIM_BURST_COLUMN("pol_ellipse_e", H5_REAL_8, pol_ellipse_e),
+	SIM_BURST_COLUMN("amplitude", H5_REAL_8, amplitude),
+	SIM_BURST_COLUMN("hrss", H5_REAL_8, hrss),
+	SIM_BURST_COLUMN("egw_over_rsquared", H5_REAL_8, egw_over_rsquared),
+	SIM_BURST_COLUMN("waveform_number", H5_INT_8U, waveform_number),
+	SIM_BURST_COLUMN("time_slide_id", H5_INT_8S, time_slide_id),
+	SIM_BURST_COLUMN("simulation_id", H5_INT_8S, simulation_id),
+};
+
+
+static const struct h5_table sim_burst_table = {"sim_burst", sim_burst_columns, XLAL_NUM_ELEM(sim_burst_columns), sizeof(SimBurst), "time_geocent_gps", "time_geocent_gps_ns"};
+
+
+static void sim_burst_destroy(void *head)
+{
+	XLALDestroySimBurstTable(head);
+}
+
+
+/**
+ * Write a sim_burst table to a group named "sim_burst" in an HDF5 file.
+ */
+int XLALWriteSimBurstTableH5(
+	LALH5File *file,
+	const SimBurst *sim_burst
+)
+{
+	return h5_table_write(file, &sim_burst_table, sim_burst) ? XLAL_FAILURE : 0;
+}
+
+
+/**
+ * Read the sim_burst table from an HDF5 file.  columns is a
+ * comma-separated list of the columns to read, or NULL to read all
+ * columns.  If start or end is not NULL, only the rows whose geocentre
+ * time lies in [start, end) are returned.
+ */
+SimBurst *XLALReadSimBurstTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+)
+{
+	return h5_table_read(file, &sim_burst_table, columns, start, end, sim_burst_destroy);
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                                  segment
+ *
+ * ============================================================================
+ */
+
+
+#define SEGMENT_COLUMN(name, type, member) {name, type, offsetof(SegmentTable, member), sizeof(((SegmentTable *) NULL)->member)}
+
+
+static const struct h5_column segment_columns[] = {
+	SEGMENT_COLUMN("process_id", H5_INT_8S, process_id),
+	SEGMENT_COLUMN("segment_id", H5_INT_8S, segment_id),
+	SEGMENT_COLUMN("start_time", H5_INT_4S, start_time.gpsSeconds),
+	SEGMENT_COLUMN("start_time_ns", H5_INT_4S, start_time.gpsNanoSeconds),
+	SEGMENT_COLUMN("end_time", H5_INT_4S, end_time.gpsSeconds),
+	SEGMENT_COLUMN("end_time_ns", H5_INT_4S, end_time.gpsNanoSeconds),
+	SEGMENT_COLUMN("segment_def_id", H5_INT_8S, segment_def_id),
+};
+
+
+static const struct h5_table segment_table = {"segment", segment_columns, XLAL_NUM_ELEM(segment_columns), sizeof(SegmentTable), "start_time", "start_time_ns"};
+
+
+static void segment_destroy(void *head)
+{
+	XLALDestroySegmentTable(head);
+}
+
+
+/**
+ * Write a segment table to a group named "segment" in an HDF5 file.
+ */
+int XLALWriteSegmentTableH5(
+	LALH5File *file,
+	const SegmentTable *segment
+)
+{
+	return h5_table_write(file, &segment_table, segment) ? XLAL_FAILURE : 0;
+}
+
+
+/**
+ * Read the segment table from an HDF5 file.  columns is a comma-separated
+ * list of the columns to read, or NULL to read all columns.  If start or
+ * end is not NULL, only the segments whose start time lies in [start,
+ * end) are returned.
+ */
+SegmentTable *XLALReadSegmentTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+)
+{
+	return h5_table_read(file, &segment_table, columns, start, end, segment_destroy);
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                                time_slide
+ *
+ * ============================================================================
+ */
+
+
+#define TIME_SLIDE_COLUMN(name, type, member) {name, type, offsetof(TimeSlide, member), sizeof(((TimeSlide *) NULL)->member)}
+
+
+static const struct h5_column time_slide_columns[] = {
+	TIME_SLIDE_COLUMN("process_id", H5_INT_8S, process_id),
+	TIME_SLIDE_COLUMN("time_slide_id", H5_INT_8S, time_slide_id),
+	TIME_SLIDE_COLUMN("instrument", H5_LSTRING, instrument),
+	TIME_SLIDE_COLUMN("offset", H5_REAL_8, offset),
+};
+
+
+static const struct h5_table time_slide_table = {"time_slide", time_slide_columns, XLAL_NUM_ELEM(time_slide_columns), sizeof(TimeSlide), NULL, NULL};
+
+
+static void time_slide_destroy(void *head)
+{
+	XLALDestroyTimeSlideTable(head);
+}
+
+
+/**
+ * Write a time_slide table to a group named "time_slide" in an HDF5 file.
+ */
+int XLALWriteTimeSlideTableH5(
+	LALH5File *file,
+	const TimeSlide *time_slide
+)
+{
+	return h5_table_write(file, &time_slide_table, time_slide) ? XLAL_FAILURE : 0;
+}
+
+
+/**
+ * Read the time_slide table from an HDF5 file.  columns is a
+ * comma-separated list of the columns to read, or NULL to read all
+ * columns.
+ */
+TimeSlide *XLALReadTimeSlideTableH5(
+	LALH5File *file,
+	const char *columns
+)
+{
+	return h5_table_read(file, &time_slide_table, columns, NULL, NULL, time_slide_destroy);
+}
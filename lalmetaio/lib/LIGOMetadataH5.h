@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/**
+ * \file
+ * \ingroup lalmetaio_general
+ * \brief HDF5 input and output of metadata tables.
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/LIGOMetadataH5.h>
+ * \endcode
+ *
+ * The routines declared here store the tables of \ref LIGOMetadataTables.h
+ * in HDF5 files opened with XLALH5FileOpen().  Each table is written to a
+ * group named after the table, and each column of the table to a separate
+ * dataset in that group, named after the column.  The columns are the
+ * same, with the same types, as those written by the LIGO Light Weight XML
+ * routines of \ref LIGOLwXML.h, so a table converted between the two
+ * formats is unchanged.  GPS times are stored as pairs of integer second
+ * and nanosecond columns, ID columns as 64-bit integers, and string
+ * columns as two-dimensional character datasets whose second dimension is
+ * the width of the corresponding field.
+ *
+ * Columns are stored in compressed chunks of rows, so readers need only
+ * decompress the columns, and the ranges of rows, they ask for.  The read
+ * routines take an optional comma-separated list of column names; fields
+ * of columns that are not listed are set to zero.  The routines for tables
+ * with a natural time column also take an optional GPS interval [start,
+ * end), either end of which may be NULL, and return only the rows whose
+ * time lies in it.  Only the time columns are read in full to apply the
+ * cut, and the other columns are read over the range of rows that spans
+ * the selected rows, which is small when the table is time-ordered.
+ *
+ * HDF5 support is provided by the LALSupport library;  if it was built
+ * without HDF5, all of these routines fail with ::XLAL_EFAILED.
+ */
+
+#ifndef _LIGOMETADATAH5_H
+#define _LIGOMETADATAH5_H
+
+#if defined(__cplusplus)
+extern "C" {
+#elif 0
+} /* so that editors will match preceding brace */
+#endif
+
+#include <lal/H5FileIO.h>
+#include <lal/LALDatatypes.h>
+#include <lal/LIGOMetadataTables.h>
+
+int XLALWriteProcessTableH5(
+	LALH5File *file,
+	const ProcessTable *process
+);
+
+int XLALWriteProcessParamsTableH5(
+	LALH5File *file,
+	const ProcessParamsTable *process_params
+);
+
+int XLALWriteSnglInspiralTableH5(
+	LALH5File *file,
+	const SnglInspiralTable *sngl_inspiral
+);
+
+int XLALWriteSnglBurstTableH5(
+	LALH5File *file,
+	const SnglBurst *sngl_burst
+);
+
+int XLALWriteSimInspiralTableH5(
+	LALH5File *file,
+	const SimInspiralTable *sim_inspiral
+);
+
+int XLALWriteSimBurstTableH5(
+	LALH5File *file,
+	const SimBurst *sim_burst
+);
+
+int XLALWriteSegmentTableH5(
+	LALH5File *file,
+	const SegmentTable *segment
+);
+
+int XLALWriteTimeSlideTableH5(
+	LALH5File *file,
+	const TimeSlide *time_slide
+);
+
+ProcessTable *XLALReadProcessTableH5(
+	LALH5File *file,
+	const char *columns
+);
+
+ProcessParamsTable *XLALReadProcessParamsTableH5(
+	LALH5File *file,
+	const char *columns
+);
+
+SnglInspiralTable *XLALReadSnglInspiralTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+);
+
+SnglBurst *XLALReadSnglBurstTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+);
+
+SimInspiralTable *XLALReadSimInspiralTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+);
+
+SimBurst *XLALReadSimBurstTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+);
+
+SegmentTable *XLALReadSegmentTableH5(
+	LALH5File *file,
+	const char *columns,
+	const LIGOTimeGPS *start,
+	const LIGOTimeGPS *end
+);
+
+TimeSlide *XLALReadTimeSlideTableH5(
+	LALH5File *file,
+	const char *columns
+);
+
+#if 0
+{ /* so that editors will match succeeding brace */
+#elif defined(__cplusplus)
+}
+#endif
+
+#endif /* _LIGOMETADATAH5_H */
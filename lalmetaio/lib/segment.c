@@ -32,6 +32,7 @@
 #include <lal/LIGOMetadataTables.h>
 #include <lal/LIGOMetadataUtils.h>
 #include <lal/XLALError.h>
+#include "LIGOLwXML_internal.h"
 
 
 /**
@@ -95,7 +96,7 @@ int XLALWriteLIGOLwXMLSegmentTable(
 	const SegmentTable *segment_table
 )
 {
-	const char *row_head = "\n\t\t\t";
+	LIGOLwXMLRowWriter row;
 
 	/* table header */
 
@@ -114,11 +115,20 @@ int XLALWriteLIGOLwXMLSegmentTable(
 
 	/* rows */
 
+	if(XLALLIGOLwXMLRowWriterOpen(&row, xml))
+		XLAL_ERROR(XLAL_EFUNC);
 	for(; segment_table; segment_table = segment_table->next) {
-		if(XLALFilePrintf(xml->fp, "%s%ld,%ld,%d,%d,%d,%d,%ld", row_head, segment_table->process_id, segment_table->segment_id, segment_table->start_time.gpsSeconds, segment_table->start_time.gpsNanoSeconds, segment_table->end_time.gpsSeconds, segment_table->end_time.gpsNanoSeconds, segment_table->segment_def_id) < 0)
-			XLAL_ERROR(XLAL_EFUNC);
-		row_head = ",\n\t\t\t";
+		XLALLIGOLwXMLRowBegin(&row);
+		XLALLIGOLwXMLRowInt(&row, segment_table->process_id);
+		XLALLIGOLwXMLRowInt(&row, segment_table->segment_id);
+		XLALLIGOLwXMLRowInt(&row, segment_table->start_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, segment_table->start_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, segment_table->end_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, segment_table->end_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, segment_table->segment_def_id);
 	}
+	if(XLALLIGOLwXMLRowWriterClose(&row))
+		XLAL_ERROR(XLAL_EFUNC);
 
 	/* table footer */
 
@@ -32,6 +32,7 @@
 #include <lal/LIGOMetadataTables.h>
 #include <lal/LIGOMetadataUtils.h>
 #include <lal/XLALError.h>
+#include "LIGOLwXML_internal.h"
 
 
 /**
@@ -307,7 +308,7 @@ int XLALWriteLIGOLwXMLSimBurstTable(
 	const SimBurst *sim_burst
 )
 {
-	const char *row_head = "\n\t\t\t";
+	LIGOLwXMLRowWriter row;
 
 	/* table header */
 
@@ -339,33 +340,33 @@ int XLALWriteLIGOLwXMLSimBurstTable(
 
 	/* rows */
 
+	if(XLALLIGOLwXMLRowWriterOpen(&row, xml))
+		XLAL_ERROR(XLAL_EFUNC);
 	for(; sim_burst; sim_burst = sim_burst->next) {
-		if(XLALFilePrintf(xml->fp, "%s%ld,\"%s\",%.16g,%.16g,%.16g,%d,%d,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%lu,%ld,%ld",
-			row_head,
-			sim_burst->process_id,
-			sim_burst->waveform,
-			sim_burst->ra,
-			sim_burst->dec,
-			sim_burst->psi,
-			sim_burst->time_geocent_gps.gpsSeconds,
-			sim_burst->time_geocent_gps.gpsNanoSeconds,
-			sim_burst->time_geocent_gmst,
-			sim_burst->duration,
-			sim_burst->frequency,
-			sim_burst->bandwidth,
-			sim_burst->q,
-			sim_burst->pol_ellipse_angle,
-			sim_burst->pol_ellipse_e,
-			sim_burst->amplitude,
-			sim_burst->hrss,
-			sim_burst->egw_over_rsquared,
-			sim_burst->waveform_number,
-			sim_burst->time_slide_id,
-			sim_burst->simulation_id
-		) < 0)
-			XLAL_ERROR(XLAL_EFUNC);
-		row_head = ",\n\t\t\t";
+		XLALLIGOLwXMLRowBegin(&row);
+		XLALLIGOLwXMLRowInt(&row, sim_burst->process_id);
+		XLALLIGOLwXMLRowString(&row, sim_burst->waveform);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->ra, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->dec, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->psi, 16);
+		XLALLIGOLwXMLRowInt(&row, sim_burst->time_geocent_gps.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_burst->time_geocent_gps.gpsNanoSeconds);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->time_geocent_gmst, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->duration, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->frequency, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->bandwidth, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->q, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->pol_ellipse_angle, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->pol_ellipse_e, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->amplitude, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->hrss, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_burst->egw_over_rsquared, 16);
+		XLALLIGOLwXMLRowUInt(&row, sim_burst->waveform_number);
+		XLALLIGOLwXMLRowInt(&row, sim_burst->time_slide_id);
+		XLALLIGOLwXMLRowInt(&row, sim_burst->simulation_id);
 	}
+	if(XLALLIGOLwXMLRowWriterClose(&row))
+		XLAL_ERROR(XLAL_EFUNC);
 
 	/* table footer */
 
@@ -32,6 +32,7 @@
 #include <lal/LIGOMetadataTables.h>
 #include <lal/LIGOMetadataUtils.h>
 #include <lal/XLALError.h>
+#include "LIGOLwXML_internal.h"
 
 
 /**
@@ -367,7 +368,7 @@ int XLALWriteLIGOLwXMLSimInspiralTable(
 	const SimInspiralTable *sim_inspiral
 )
 {
-	const char *row_head = "\n\t\t\t";
+	LIGOLwXMLRowWriter row;
 
 	/* table header */
 
@@ -438,71 +439,71 @@ int XLALWriteLIGOLwXMLSimInspiralTable(
 
 	/* rows */
 
+	if(XLALLIGOLwXMLRowWriterOpen(&row, xml))
+		XLAL_ERROR(XLAL_EFUNC);
 	for(; sim_inspiral; sim_inspiral = sim_inspiral->next) {
-		if(XLALFilePrintf(xml->fp, "%s%ld,\"%s\",%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%.16g,\"%s\",%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%16g,%d,%d,\"%s\",%d,\"%s\",%d,%ld",
-					row_head,
-					sim_inspiral->process_id,
-					sim_inspiral->waveform,
-					sim_inspiral->geocent_end_time.gpsSeconds,
-					sim_inspiral->geocent_end_time.gpsNanoSeconds,
-					sim_inspiral->h_end_time.gpsSeconds,
-					sim_inspiral->h_end_time.gpsNanoSeconds,
-					sim_inspiral->l_end_time.gpsSeconds,
-					sim_inspiral->l_end_time.gpsNanoSeconds,
-					sim_inspiral->g_end_time.gpsSeconds,
-					sim_inspiral->g_end_time.gpsNanoSeconds,
-					sim_inspiral->t_end_time.gpsSeconds,
-					sim_inspiral->t_end_time.gpsNanoSeconds,
-					sim_inspiral->v_end_time.gpsSeconds,
-					sim_inspiral->v_end_time.gpsNanoSeconds,
-					sim_inspiral->end_time_gmst,
-					sim_inspiral->source,
-					sim_inspiral->mass1,
-					sim_inspiral->mass2,
-					sim_inspiral->mchirp,
-					sim_inspiral->eta,
-					sim_inspiral->distance,
-					sim_inspiral->longitude,
-					sim_inspiral->latitude,
-					sim_inspiral->inclination,
-					sim_inspiral->coa_phase,
-					sim_inspiral->polarization,
-					sim_inspiral->psi0,
-					sim_inspiral->psi3,
-					sim_inspiral->alpha,
-					sim_inspiral->alpha1,
-					sim_inspiral->alpha2,
-					sim_inspiral->alpha3,
-					sim_inspiral->alpha4,
-					sim_inspiral->alpha5,
-					sim_inspiral->alpha6,
-					sim_inspiral->beta,
-					sim_inspiral->spin1x,
-					sim_inspiral->spin1y,
-					sim_inspiral->spin1z,
-					sim_inspiral->spin2x,
-					sim_inspiral->spin2y,
-					sim_inspiral->spin2z,
-					sim_inspiral->theta0,
-					sim_inspiral->phi0,
-					sim_inspiral->f_lower,
-					sim_inspiral->f_final,
-					sim_inspiral->eff_dist_h,
-					sim_inspiral->eff_dist_l,
-					sim_inspiral->eff_dist_g,
-					sim_inspiral->eff_dist_t,
-					sim_inspiral->eff_dist_v,
-					sim_inspiral->numrel_mode_min,
-					sim_inspiral->numrel_mode_max,
-					sim_inspiral->numrel_data,
-					sim_inspiral->amp_order,
-					sim_inspiral->taper,
-					sim_inspiral->bandpass,
-					sim_inspiral->simulation_id
-						) < 0)
-						XLAL_ERROR(XLAL_EFUNC);
-		row_head = ",\n\t\t\t";
+		XLALLIGOLwXMLRowBegin(&row);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->process_id);
+		XLALLIGOLwXMLRowString(&row, sim_inspiral->waveform);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->geocent_end_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->geocent_end_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->h_end_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->h_end_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->l_end_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->l_end_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->g_end_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->g_end_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->t_end_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->t_end_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->v_end_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->v_end_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->end_time_gmst, 16);
+		XLALLIGOLwXMLRowString(&row, sim_inspiral->source);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->mass1, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->mass2, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->mchirp, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->eta, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->distance, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->longitude, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->latitude, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->inclination, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->coa_phase, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->polarization, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->psi0, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->psi3, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->alpha, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->alpha1, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->alpha2, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->alpha3, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->alpha4, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->alpha5, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->alpha6, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->beta, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->spin1x, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->spin1y, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->spin1z, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->spin2x, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->spin2y, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->spin2z, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->theta0, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->phi0, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->f_lower, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->f_final, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->eff_dist_h, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->eff_dist_l, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->eff_dist_g, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_inspiral->eff_dist_t, 16);
+		XLALLIGOLwXMLRowPrintf(&row, "%16g", sim_inspiral->eff_dist_v);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->numrel_mode_min);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->numrel_mode_max);
+		XLALLIGOLwXMLRowString(&row, sim_inspiral->numrel_data);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->amp_order);
+		XLALLIGOLwXMLRowString(&row, sim_inspiral->taper);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->bandpass);
+		XLALLIGOLwXMLRowInt(&row, sim_inspiral->simulation_id);
 	}
+	if(XLALLIGOLwXMLRowWriterClose(&row))
+		XLAL_ERROR(XLAL_EFUNC);
 
 	/* table footer */
 
@@ -32,6 +32,7 @@
 #include <lal/LIGOMetadataTables.h>
 #include <lal/LIGOMetadataUtils.h>
 #include <lal/XLALError.h>
+#include "LIGOLwXML_internal.h"
 
 
 /**
@@ -264,7 +265,7 @@ int XLALWriteLIGOLwXMLSimRingdownTable(
 	const SimRingdownTable *sim_ringdown
 )
 {
-	const char *row_head = "\n\t\t\t";
+	LIGOLwXMLRowWriter row;
 
 	/* table header */
 
@@ -308,45 +309,45 @@ int XLALWriteLIGOLwXMLSimRingdownTable(
 
 	/* rows */
 
+	if(XLALLIGOLwXMLRowWriterOpen(&row, xml))
+		XLAL_ERROR(XLAL_EFUNC);
 	for(; sim_ringdown; sim_ringdown = sim_ringdown->next) {
-		if(XLALFilePrintf(xml->fp, "%s%ld,\"%s\",\"%s\",%d,%d,%d,%d,%d,%d,%d,%d,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%.16g,%ld",
-			row_head,
-			0,	/* process_id */
-			sim_ringdown->waveform,
-			sim_ringdown->coordinates,
-			sim_ringdown->geocent_start_time.gpsSeconds,
-			sim_ringdown->geocent_start_time.gpsNanoSeconds,
-			sim_ringdown->h_start_time.gpsSeconds,
-			sim_ringdown->h_start_time.gpsNanoSeconds,
-			sim_ringdown->l_start_time.gpsSeconds,
-			sim_ringdown->l_start_time.gpsNanoSeconds,
-			sim_ringdown->v_start_time.gpsSeconds,
-			sim_ringdown->v_start_time.gpsNanoSeconds,
-			sim_ringdown->start_time_gmst,
-			sim_ringdown->longitude,
-			sim_ringdown->latitude,
-			sim_ringdown->distance,
-			sim_ringdown->inclination,
-			sim_ringdown->polarization,
-			sim_ringdown->frequency,
-			sim_ringdown->quality,
-			sim_ringdown->phase,
-			sim_ringdown->mass,
-			sim_ringdown->spin,
-			sim_ringdown->epsilon,
-			sim_ringdown->amplitude,
-			sim_ringdown->eff_dist_h,
-			sim_ringdown->eff_dist_l,
-			sim_ringdown->eff_dist_v,
-			sim_ringdown->hrss,
-			sim_ringdown->hrss_h,
-			sim_ringdown->hrss_l,
-			sim_ringdown->hrss_v,
-			sim_ringdown->simulation_id
-		) < 0)
-			XLAL_ERROR(XLAL_EFUNC);
-		row_head = ",\n\t\t\t";
+		XLALLIGOLwXMLRowBegin(&row);
+		XLALLIGOLwXMLRowInt(&row, 0);	/* process_id */
+		XLALLIGOLwXMLRowString(&row, sim_ringdown->waveform);
+		XLALLIGOLwXMLRowString(&row, sim_ringdown->coordinates);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->geocent_start_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->geocent_start_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->h_start_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->h_start_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->l_start_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->l_start_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->v_start_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->v_start_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->start_time_gmst, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->longitude, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->latitude, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->distance, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->inclination, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->polarization, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->frequency, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->quality, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->phase, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->mass, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->spin, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->epsilon, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->amplitude, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->eff_dist_h, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->eff_dist_l, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->eff_dist_v, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->hrss, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->hrss_h, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->hrss_l, 16);
+		XLALLIGOLwXMLRowReal(&row, sim_ringdown->hrss_v, 16);
+		XLALLIGOLwXMLRowInt(&row, sim_ringdown->simulation_id);
 	}
+	if(XLALLIGOLwXMLRowWriterClose(&row))
+		XLAL_ERROR(XLAL_EFUNC);
 
 	/* table footer */
 
@@ -29,9 +29,11 @@
 #include <lal/LALMalloc.h>
 #include <lal/LIGOLwXML.h>
 #include <lal/LIGOLwXMLRead.h>
+#include <lal/LIGOMetadataColumns.h>
 #include <lal/LIGOMetadataTables.h>
 #include <lal/LIGOMetadataUtils.h>
 #include <lal/XLALError.h>
+#include "LIGOLwXML_internal.h"
 
 
 /**
@@ -232,7 +234,7 @@ int XLALWriteLIGOLwXMLSnglBurstTable(
 	const SnglBurst *sngl_burst
 )
 {
-	const char *row_head = "\n\t\t\t";
+	LIGOLwXMLRowWriter row;
 
 	/* table header */
 
@@ -261,30 +263,30 @@ int XLALWriteLIGOLwXMLSnglBurstTable(
 
 	/* rows */
 
+	if(XLALLIGOLwXMLRowWriterOpen(&row, xml))
+		XLAL_ERROR(XLAL_EFUNC);
 	for(; sngl_burst; sngl_burst = sngl_burst->next) {
-		if(XLALFilePrintf(xml->fp, "%s%ld,\"%s\",\"%s\",\"%s\",%d,%d,%d,%d,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.16g,%.16g,%ld",
-			row_head,
-			sngl_burst->process_id,
-			sngl_burst->ifo,
-			sngl_burst->search,
-			sngl_burst->channel,
-			sngl_burst->start_time.gpsSeconds,
-			sngl_burst->start_time.gpsNanoSeconds,
-			sngl_burst->peak_time.gpsSeconds,
-			sngl_burst->peak_time.gpsNanoSeconds,
-			sngl_burst->duration,
-			sngl_burst->central_freq,
-			sngl_burst->bandwidth,
-			sngl_burst->amplitude,
-			sngl_burst->snr,
-			sngl_burst->confidence,
-			sngl_burst->chisq,
-			sngl_burst->chisq_dof,
-			sngl_burst->event_id
-		) < 0)
-			XLAL_ERROR(XLAL_EFUNC);
-		row_head = ",\n\t\t\t";
+		XLALLIGOLwXMLRowBegin(&row);
+		XLALLIGOLwXMLRowInt(&row, sngl_burst->process_id);
+		XLALLIGOLwXMLRowString(&row, sngl_burst->ifo);
+		XLALLIGOLwXMLRowString(&row, sngl_burst->search);
+		XLALLIGOLwXMLRowString(&row, sngl_burst->channel);
+		XLALLIGOLwXMLRowInt(&row, sngl_burst->start_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sngl_burst->start_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowInt(&row, sngl_burst->peak_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sngl_burst->peak_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowReal(&row, sngl_burst->duration, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_burst->central_freq, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_burst->bandwidth, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_burst->amplitude, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_burst->snr, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_burst->confidence, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_burst->chisq, 16);
+		XLALLIGOLwXMLRowReal(&row, sngl_burst->chisq_dof, 16);
+		XLALLIGOLwXMLRowInt(&row, sngl_burst->event_id);
 	}
+	if(XLALLIGOLwXMLRowWriterClose(&row))
+		XLAL_ERROR(XLAL_EFUNC);
 
 	/* table footer */
 
@@ -297,6 +299,23 @@ int XLALWriteLIGOLwXMLSnglBurstTable(
 }
 
 
+/**
+ * Write the rows of a SnglBurstColumns container to a sngl_burst table in
+ * an XML file.  The rows are written in place, without copying.
+ */
+int XLALWriteLIGOLwXMLSnglBurstColumns(
+	LIGOLwXMLStream *xml,
+	const SnglBurstColumns *cols
+)
+{
+	if(!cols)
+		XLAL_ERROR(XLAL_EFAULT);
+	if(XLALWriteLIGOLwXMLSnglBurstTable(xml, cols->length ? cols->rows : NULL))
+		XLAL_ERROR(XLAL_EFUNC);
+	return 0;
+}
+
+
 /**
  * Assign event_id values to the entries in a SnglBurst linked list.  All
  * SnglBurst rows in the list will be blamed on the given process_id, and
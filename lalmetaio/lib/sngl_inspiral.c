@@ -29,9 +29,11 @@
 #include <lal/LALMalloc.h>
 #include <lal/LIGOLwXML.h>
 #include <lal/LIGOLwXMLRead.h>
+#include <lal/LIGOMetadataColumns.h>
 #include <lal/LIGOMetadataTables.h>
 #include <lal/LIGOMetadataUtils.h>
 #include <lal/XLALError.h>
+#include "LIGOLwXML_internal.h"
 
 
 /**
@@ -360,7 +362,7 @@ int XLALWriteLIGOLwXMLSnglInspiralTable(
 	const SnglInspiralTable *sngl_inspiral
 )
 {
-	const char *row_head = "\n\t\t\t";
+	LIGOLwXMLRowWriter row;
 
 	/* table header */
 
@@ -436,76 +438,77 @@ int XLALWriteLIGOLwXMLSnglInspiralTable(
 
 	/* rows */
 
+	if(XLALLIGOLwXMLRowWriterOpen(&row, xml))
+		XLAL_ERROR(XLAL_EFUNC);
 	for(; sngl_inspiral; sngl_inspiral = sngl_inspiral->next) {
-		if( XLALFilePrintf(xml->fp,"%s%ld,\"%s\",\"%s\",\"%s\",%d,%d,%.16g,%d,%d,%.16g,%.16g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%u,%.8g,%u,%.8g,%u,%.16g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%ld",
-			row_head,
-			sngl_inspiral->process_id,
-			sngl_inspiral->ifo,
-			sngl_inspiral->search,
-			sngl_inspiral->channel,
-			sngl_inspiral->end.gpsSeconds,
-			sngl_inspiral->end.gpsNanoSeconds,
-			sngl_inspiral->end_time_gmst,
-			sngl_inspiral->impulse_time.gpsSeconds,
-			sngl_inspiral->impulse_time.gpsNanoSeconds,
-			sngl_inspiral->template_duration,
-			sngl_inspiral->event_duration,
-			sngl_inspiral->amplitude,
-			sngl_inspiral->eff_distance,
-			sngl_inspiral->coa_phase,
-			sngl_inspiral->mass1,
-			sngl_inspiral->mass2,
-			sngl_inspiral->mchirp,
-			sngl_inspiral->mtotal,
-			sngl_inspiral->eta,
-			sngl_inspiral->kappa,
-			sngl_inspiral->chi,
-			sngl_inspiral->tau0,
-			sngl_inspiral->tau2,
-			sngl_inspiral->tau3,
-			sngl_inspiral->tau4,
-			sngl_inspiral->tau5,
-			sngl_inspiral->ttotal,
-			sngl_inspiral->psi0,
-			sngl_inspiral->psi3,
-			sngl_inspiral->alpha,
-			sngl_inspiral->alpha1,
-			sngl_inspiral->alpha2,
-			sngl_inspiral->alpha3,
-			sngl_inspiral->alpha4,
-			sngl_inspiral->alpha5,
-			sngl_inspiral->alpha6,
-			sngl_inspiral->beta,
-			sngl_inspiral->f_final,
-			sngl_inspiral->snr,
-			sngl_inspiral->chisq,
-			sngl_inspiral->chisq_dof,
-			sngl_inspiral->bank_chisq,
-			sngl_inspiral->bank_chisq_dof,
-			sngl_inspiral->cont_chisq,
-			sngl_inspiral->cont_chisq_dof,
-			sngl_inspiral->sigmasq,
-			sngl_inspiral->rsqveto_duration,
-			sngl_inspiral->Gamma[0],
-			sngl_inspiral->Gamma[1],
-			sngl_inspiral->Gamma[2],
-			sngl_inspiral->Gamma[3],
-			sngl_inspiral->Gamma[4],
-			sngl_inspiral->Gamma[5],
-			sngl_inspiral->Gamma[6],
-			sngl_inspiral->Gamma[7],
-			sngl_inspiral->Gamma[8],
-			sngl_inspiral->Gamma[9],
-			sngl_inspiral->spin1x,
-			sngl_inspiral->spin1y,
-			sngl_inspiral->spin1z,
-			sngl_inspiral->spin2x,
-			sngl_inspiral->spin2y,
-			sngl_inspiral->spin2z,
-			sngl_inspiral->event_id ) < 0)
-			XLAL_ERROR(XLAL_EFUNC);
-		row_head = ",\n\t\t\t";
+		XLALLIGOLwXMLRowBegin(&row);
+		XLALLIGOLwXMLRowInt(&row, sngl_inspiral->process_id);
+		XLALLIGOLwXMLRowString(&row, sngl_inspiral->ifo);
+		XLALLIGOLwXMLRowString(&row, sngl_inspiral->search);
+		XLALLIGOLwXMLRowString(&row, sngl_inspiral->channel);
+		XLALLIGOLwXMLRowInt(&row, sngl_inspiral->end.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sngl_inspiral->end.gpsNanoSeconds);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->end_time_gmst, 16);
+		XLALLIGOLwXMLRowInt(&row, sngl_inspiral->impulse_time.gpsSeconds);
+		XLALLIGOLwXMLRowInt(&row, sngl_inspiral->impulse_time.gpsNanoSeconds);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->template_duration, 16);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->event_duration, 16);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->amplitude, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->eff_distance, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->coa_phase, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->mass1, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->mass2, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->mchirp, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->mtotal, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->eta, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->kappa, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->chi, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->tau0, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->tau2, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->tau3, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->tau4, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->tau5, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->ttotal, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->psi0, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->psi3, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->alpha, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->alpha1, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->alpha2, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->alpha3, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->alpha4, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->alpha5, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->alpha6, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->beta, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->f_final, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->snr, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->chisq, 8);
+		XLALLIGOLwXMLRowUInt(&row, (UINT4) sngl_inspiral->chisq_dof);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->bank_chisq, 8);
+		XLALLIGOLwXMLRowUInt(&row, (UINT4) sngl_inspiral->bank_chisq_dof);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->cont_chisq, 8);
+		XLALLIGOLwXMLRowUInt(&row, (UINT4) sngl_inspiral->cont_chisq_dof);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->sigmasq, 16);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->rsqveto_duration, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[0], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[1], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[2], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[3], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[4], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[5], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[6], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[7], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[8], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->Gamma[9], 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->spin1x, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->spin1y, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->spin1z, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->spin2x, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->spin2y, 8);
+		XLALLIGOLwXMLRowReal(&row, sngl_inspiral->spin2z, 8);
+		XLALLIGOLwXMLRowInt(&row, sngl_inspiral->event_id);
 	}
+	if(XLALLIGOLwXMLRowWriterClose(&row))
+		XLAL_ERROR(XLAL_EFUNC);
 
 	/* table footer */
 	if(XLALFilePuts("\n\t\t</Stream>\n\t</Table>\n", xml->fp) < 0)
@@ -514,3 +517,21 @@ int XLALWriteLIGOLwXMLSnglInspiralTable(
 	/* done */
 	return 0;
 }
+
+
+/**
+ * Write the rows of a SnglInspiralColumns container to the sngl_inspiral
+ * table in a LIGO Light Weight XML file.  The rows are written in place,
+ * without copying.
+ */
+int XLALWriteLIGOLwXMLSnglInspiralColumns(
+	LIGOLwXMLStream *xml,
+	const SnglInspiralColumns *cols
+)
+{
+	if(!cols)
+		XLAL_ERROR(XLAL_EFAULT);
+	if(XLALWriteLIGOLwXMLSnglInspiralTable(xml, cols->length ? cols->rows : NULL))
+		XLAL_ERROR(XLAL_EFUNC);
+	return 0;
+}
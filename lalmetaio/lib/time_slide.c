@@ -32,6 +32,7 @@
 #include <lal/LIGOMetadataTables.h>
 #include <lal/LIGOMetadataUtils.h>
 #include <lal/XLALError.h>
+#include "LIGOLwXML_internal.h"
 
 
 /**
@@ -224,7 +225,7 @@ int XLALWriteLIGOLwXMLTimeSlideTable(
 	const TimeSlide *time_slide
 )
 {
-	const char *row_head = "\n\t\t\t";
+	LIGOLwXMLRowWriter row;
 
 	/* table header */
 
@@ -240,11 +241,17 @@ int XLALWriteLIGOLwXMLTimeSlideTable(
 
 	/* rows */
 
+	if(XLALLIGOLwXMLRowWriterOpen(&row, xml))
+		XLAL_ERROR(XLAL_EFUNC);
 	for(; time_slide; time_slide = time_slide->next) {
-		if(XLALFilePrintf(xml->fp, "%s%ld,%ld,\"%s\",%.16g", row_head, time_slide->process_id, time_slide->time_slide_id, time_slide->instrument, time_slide->offset) < 0)
-			XLAL_ERROR(XLAL_EFUNC);
-		row_head = ",\n\t\t\t";
+		XLALLIGOLwXMLRowBegin(&row);
+		XLALLIGOLwXMLRowInt(&row, time_slide->process_id);
+		XLALLIGOLwXMLRowInt(&row, time_slide->time_slide_id);
+		XLALLIGOLwXMLRowString(&row, time_slide->instrument);
+		XLALLIGOLwXMLRowReal(&row, time_slide->offset, 16);
 	}
+	if(XLALLIGOLwXMLRowWriterClose(&row))
+		XLAL_ERROR(XLAL_EFUNC);
 
 	/* table footer */
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/*
+ * Tests the native sngl_inspiral and sngl_burst readers against the
+ * libmetaio readers, on plain and gzip-compressed documents.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/Date.h>
+#include <lal/LALStdlib.h>
+#include <lal/Random.h>
+#include <lal/LIGOLwXML.h>
+#include <lal/LIGOLwXMLRead.h>
+#include <lal/LIGOMetadataColumns.h>
+#include <lal/LIGOMetadataTables.h>
+#include <lal/LIGOMetadataUtils.h>
+#include <lal/XLALError.h>
+
+
+#define NUM_ROWS 2000
+
+
+/*
+ * the columns of each table;  S(x) is a string, T(x) a GPS time, V(x) a
+ * number
+ */
+
+
+#define SNGL_INSPIRAL_FIELDS(S, T, V) \
+	V(process_id) S(ifo) S(search) S(channel) T(end) V(end_time_gmst) \
+	T(impulse_time) V(template_duration) V(event_duration) V(amplitude) \
+	V(eff_distance) V(coa_phase) V(mass1) V(mass2) V(mchirp) V(mtotal) \
+	V(eta) V(tau0) V(tau2) V(tau3) V(tau4) V(tau5) V(ttotal) V(psi0) \
+	V(psi3) V(alpha) V(alpha1) V(alpha2) V(alpha3) V(alpha4) V(alpha5) \
+	V(alpha6) V(beta) V(f_final) V(snr) V(chisq) V(chisq_dof) \
+	V(bank_chisq) V(bank_chisq_dof) V(cont_chisq) V(cont_chisq_dof) \
+	V(sigmasq) V(rsqveto_duration) V(Gamma[0]) V(Gamma[1]) V(Gamma[2]) \
+	V(Gamma[3]) V(Gamma[4]) V(Gamma[5]) V(Gamma[6]) V(Gamma[7]) \
+	V(Gamma[8]) V(Gamma[9]) V(kappa) V(chi) V(spin1x) V(spin1y) V(spin1z) \
+	V(spin2x) V(spin2y) V(spin2z) V(event_id)
+
+#define SNGL_BURST_FIELDS(S, T, V) \
+	V(process_id) S(ifo) S(search) S(channel) T(start_time) T(peak_time) \
+	V(duration) V(central_freq) V(bandwidth) V(amplitude) V(snr) \
+	V(confidence) V(chisq) V(chisq_dof) V(event_id)
+
+#define FILL_STRING(x) snprintf(row->x, sizeof(row->x), "%s%zu", #x, i % 7);
+#define FILL_TIME(x) XLALINT8NSToGPS(&row->x, 1000000000LL * XLAL_BILLION_INT8 + (INT8) (1e12 * XLALUniformDeviate(rng)));
+#define FILL_VALUE(x) row->x = 1000 * XLALUniformDeviate(rng);
+
+#define EQUAL_STRING(x) if(strcmp(a->x, b->x)) XLAL_ERROR(XLAL_EFAILED, "row %zu: %s differs: \"%s\" != \"%s\"", i, #x, a->x, b->x);
+#define EQUAL_TIME(x) if(XLALGPSCmp(&a->x, &b->x)) XLAL_ERROR(XLAL_EFAILED, "row %zu: %s differs", i, #x);
+#define EQUAL_VALUE(x) if(a->x != b->x) XLAL_ERROR(XLAL_EFAILED, "row %zu: %s differs: %.17g != %.17g", i, #x, (double) a->x, (double) b->x);
+
+
+static SnglInspiralTable *make_sngl_inspiral_table(RandomParams *rng)
+{
+	SnglInspiralTable *head = NULL;
+	SnglInspiralTable **next = &head;
+	size_t i;
+
+	for(i = 0; i < NUM_ROWS; i++) {
+		SnglInspiralTable *row = XLALCreateSnglInspiralTableRow(NULL);
+		XLAL_CHECK_NULL(row, XLAL_EFUNC);
+		SNGL_INSPIRAL_FIELDS(FILL_STRING, FILL_TIME, FILL_VALUE)
+		row->process_id = 0;
+		row->event_id = i;
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+static SnglBurst *make_sngl_burst_table(RandomParams *rng)
+{
+	SnglBurst *head = NULL;
+	SnglBurst **next = &head;
+	size_t i;
+
+	for(i = 0; i < NUM_ROWS; i++) {
+		SnglBurst *row = XLALCreateSnglBurst();
+		XLAL_CHECK_NULL(row, XLAL_EFUNC);
+		SNGL_BURST_FIELDS(FILL_STRING, FILL_TIME, FILL_VALUE)
+		row->process_id = 0;
+		row->event_id = i;
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+/* the native reader must reproduce the libmetaio reader exactly */
+static int compare_sngl_inspiral(const char *filename)
+{
+	SnglInspiralTable *table = XLALSnglInspiralTableFromLIGOLw(filename);
+	SnglInspiralColumns *cols = XLALSnglInspiralColumnsFromLIGOLw(filename);
+	const SnglInspiralTable *a, *b;
+	size_t i;
+
+	XLAL_CHECK(table && cols, XLAL_EFUNC, "%s: cannot read sngl_inspiral table", filename);
+	XLAL_CHECK(cols->length == NUM_ROWS, XLAL_EFAILED, "%s: read %zu rows, expected %d", filename, cols->length, NUM_ROWS);
+	for(i = 0, a = XLALSnglInspiralColumnsAsTable(cols), b = table; a && b; i++, a = a->next, b = b->next) {
+		SNGL_INSPIRAL_FIELDS(EQUAL_STRING, EQUAL_TIME, EQUAL_VALUE)
+	}
+	XLAL_CHECK(!a && !b, XLAL_EFAILED, "%s: readers returned different numbers of rows", filename);
+
+	XLALDestroySnglInspiralColumns(cols);
+	XLALDestroySnglInspiralTable(table);
+	return 0;
+}
+
+
+static int compare_sngl_burst(const char *filename)
+{
+	SnglBurst *table = XLALSnglBurstTableFromLIGOLw(filename);
+	SnglBurstColumns *cols = XLALSnglBurstColumnsFromLIGOLw(filename);
+	const SnglBurst *a, *b;
+	size_t i;
+
+	XLAL_CHECK(table && cols, XLAL_EFUNC, "%s: cannot read sngl_burst table", filename);
+	XLAL_CHECK(cols->length == NUM_ROWS, XLAL_EFAILED, "%s: read %zu rows, expected %d", filename, cols->length, NUM_ROWS);
+	for(i = 0, a = XLALSnglBurstColumnsAsTable(cols), b = table; a && b; i++, a = a->next, b = b->next) {
+		SNGL_BURST_FIELDS(EQUAL_STRING, EQUAL_TIME, EQUAL_VALUE)
+	}
+	XLAL_CHECK(!a && !b, XLAL_EFAILED, "%s: readers returned different numbers of rows", filename);
+
+	XLALDestroySnglBurstColumns(cols);
+	XLALDestroySnglBurstTable(table);
+	return 0;
+}
+
+
+static int write_document(const char *filename, const SnglInspiralTable *sngl_inspiral, const SnglBurst *sngl_burst)
+{
+	LIGOLwXMLStream *xml = XLALOpenLIGOLwXMLFile(filename);
+
+	XLAL_CHECK(xml, XLAL_EFUNC);
+	XLAL_CHECK(XLALWriteLIGOLwXMLSnglInspiralTable(xml, sngl_inspiral) == 0, XLAL_EFUNC);
+	XLAL_CHECK(XLALWriteLIGOLwXMLSnglBurstTable(xml, sngl_burst) == 0, XLAL_EFUNC);
+	XLAL_CHECK(XLALCloseLIGOLwXMLFile(xml) == 0, XLAL_EFUNC);
+
+	return 0;
+}
+
+
+int main(void)
+{
+	const char *filenames[] = {"LIGOLwXMLStreamReadTest.xml", "LIGOLwXMLStreamReadTest.xml.gz"};
+	RandomParams *rng = XLALCreateRandomParams(1234);
+	SnglInspiralTable *sngl_inspiral;
+	SnglBurst *sngl_burst;
+	size_t i;
+
+	XLAL_CHECK_MAIN(rng, XLAL_EFUNC);
+	XLAL_CHECK_MAIN((sngl_inspiral = make_sngl_inspiral_table(rng)), XLAL_EFUNC);
+	XLAL_CHECK_MAIN((sngl_burst = make_sngl_burst_table(rng)), XLAL_EFUNC);
+
+	for(i = 0; i < XLAL_NUM_ELEM(filenames); i++) {
+		XLAL_CHECK_MAIN(write_document(filenames[i], sngl_inspiral, sngl_burst) == 0, XLAL_EFUNC, "cannot write %s", filenames[i]);
+		XLAL_CHECK_MAIN(compare_sngl_inspiral(filenames[i]) == 0, XLAL_EFUNC);
+		XLAL_CHECK_MAIN(compare_sngl_burst(filenames[i]) == 0, XLAL_EFUNC);
+	}
+
+	XLALDestroySnglBurstTable(sngl_burst);
+	XLALDestroySnglInspiralTable(sngl_inspiral);
+	XLALDestroyRandomParams(rng);
+
+	LALCheckMemoryLeaks();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/*
+ * Tests that the row writer of the table writers produces exactly the text
+ * of the printf() conversions it replaced, for reals spanning many decades,
+ * on plain and gzip-compressed documents several blocks long.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/Date.h>
+#include <lal/FileIO.h>
+#include <lal/LALStdlib.h>
+#include <lal/Random.h>
+#include <lal/LIGOLwXML.h>
+#include <lal/LIGOMetadataTables.h>
+#include <lal/LIGOMetadataUtils.h>
+#include <lal/XLALError.h>
+
+
+#define NUM_ROWS 20000
+
+
+/* a real of random sign and magnitude between 1e-40 and 1e30, or one of a
+ * few values at the edges of the %g conversion */
+static double random_real(RandomParams *rng, size_t i)
+{
+	static const double special[] = {
+		0.0, -0.0, 1.0, 1e-4, 1e-5, 99999999.5, 9.9999999949999996e15,
+		0.125, 2.5, 1e16, 1e22, 1e23, 5e-324
+	};
+	double x;
+	if(i < XLAL_NUM_ELEM(special))
+		return special[i];
+	x = XLALUniformDeviate(rng) * pow(10.0, floor(70 * XLALUniformDeviate(rng)) - 40);
+	return XLALUniformDeviate(rng) < 0.5 ? -x : x;
+}
+
+
+static SnglBurst *make_sngl_burst_table(RandomParams *rng)
+{
+	SnglBurst *head = NULL;
+	SnglBurst **next = &head;
+	size_t i;
+
+	for(i = 0; i < NUM_ROWS; i++) {
+		SnglBurst *row = XLALCreateSnglBurst();
+		XLAL_CHECK_NULL(row, XLAL_EFUNC);
+		row->process_id = i % 3;
+		snprintf(row->ifo, sizeof(row->ifo), "H%zu", i % 2 + 1);
+		snprintf(row->search, sizeof(row->search), "search%zu", i % 7);
+		snprintf(row->channel, sizeof(row->channel), "%s", i % 5 ? "LSC-STRAIN" : "");
+		XLALINT8NSToGPS(&row->start_time, 1000000000LL * XLAL_BILLION_INT8 + (INT8) (1e12 * XLALUniformDeviate(rng)));
+		XLALINT8NSToGPS(&row->peak_time, -1000000000LL * XLAL_BILLION_INT8 + (INT8) (1e12 * XLALUniformDeviate(rng)));
+		row->duration = random_real(rng, i);
+		row->central_freq = random_real(rng, i);
+		row->bandwidth = random_real(rng, i);
+		row->amplitude = random_real(rng, i);
+		row->snr = random_real(rng, i);
+		row->confidence = random_real(rng, i);
+		row->chisq = random_real(rng, i);
+		row->chisq_dof = random_real(rng, i);
+		row->event_id = i ? (long) i : -1;
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+/* the Stream element must hold exactly the rows XLALFilePrintf() used to
+ * write */
+static int compare_sngl_burst(const char *filename, const SnglBurst *sngl_burst)
+{
+	const char *row_head = "\n\t\t\t";
+	char *document = XLALFileLoad(filename);
+	const char *s;
+	char expected[1024];
+	size_t i;
+
+	XLAL_CHECK(document, XLAL_EFUNC, "cannot load %s", filename);
+	s = strstr(document, "<Stream Name=\"sngl_burst:table\"");
+	XLAL_CHECK(s && (s = strchr(s, '>')), XLAL_EFAILED, "%s: no sngl_burst Stream", filename);
+	s++;
+
+	for(i = 0; sngl_burst; i++, sngl_burst = sngl_burst->next) {
+		int n = snprintf(expected, sizeof(expected), "%s%ld,\"%s\",\"%s\",\"%s\",%d,%d,%d,%d,%.8g,%.8g,%.8g,%.8g,%.8g,%.8g,%.16g,%.16g,%ld",
+			row_head,
+			sngl_burst->process_id,
+			sngl_burst->ifo,
+			sngl_burst->search,
+			sngl_burst->channel,
+			sngl_burst->start_time.gpsSeconds,
+			sngl_burst->start_time.gpsNanoSeconds,
+			sngl_burst->peak_time.gpsSeconds,
+			sngl_burst->peak_time.gpsNanoSeconds,
+			sngl_burst->duration,
+			sngl_burst->central_freq,
+			sngl_burst->bandwidth,
+			sngl_burst->amplitude,
+			sngl_burst->snr,
+			sngl_burst->confidence,
+			sngl_burst->chisq,
+			sngl_burst->chisq_dof,
+			sngl_burst->event_id
+		);
+		XLAL_CHECK(strncmp(s, expected, n) == 0, XLAL_EFAILED, "%s: row %zu differs:\n%.*s\nexpected:\n%s", filename, i, n, s, expected);
+		s += n;
+		row_head = ",\n\t\t\t";
+	}
+	XLAL_CHECK(strncmp(s, "\n\t\t</Stream>", 12) == 0, XLAL_EFAILED, "%s: text after the last row", filename);
+
+	XLALFree(document);
+	return 0;
+}
+
+
+int main(void)
+{
+	const char *filenames[] = {"LIGOLwXMLWriteTest.xml", "LIGOLwXMLWriteTest.xml.gz"};
+	RandomParams *rng = XLALCreateRandomParams(4321);
+	SnglBurst *sngl_burst;
+	size_t i;
+
+	XLAL_CHECK_MAIN(rng, XLAL_EFUNC);
+	XLAL_CHECK_MAIN((sngl_burst = make_sngl_burst_table(rng)), XLAL_EFUNC);
+
+	for(i = 0; i < XLAL_NUM_ELEM(filenames); i++) {
+		LIGOLwXMLStream *xml = XLALOpenLIGOLwXMLFile(filenames[i]);
+		XLAL_CHECK_MAIN(xml, XLAL_EFUNC, "cannot open %s", filenames[i]);
+		XLAL_CHECK_MAIN(XLALWriteLIGOLwXMLSnglBurstTable(xml, sngl_burst) == 0, XLAL_EFUNC);
+		XLAL_CHECK_MAIN(XLALCloseLIGOLwXMLFile(xml) == 0, XLAL_EFUNC);
+		XLAL_CHECK_MAIN(compare_sngl_burst(filenames[i], sngl_burst) == 0, XLAL_EFUNC);
+	}
+
+	XLALDestroySnglBurstTable(sngl_burst);
+	XLALDestroyRandomParams(rng);
+
+	LALCheckMemoryLeaks();
+	return EXIT_SUCCESS;
+}
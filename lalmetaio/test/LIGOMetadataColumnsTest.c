@@ -0,0 +1,417 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/*
+ * Tests of the columnar trigger containers:  round trips through linked
+ * lists, gathers, sorts (including ties and NaN keys) and cuts.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/Date.h>
+#include <lal/LALStdlib.h>
+#include <lal/Random.h>
+#include <lal/LIGOMetadataColumns.h>
+#include <lal/LIGOMetadataTables.h>
+#include <lal/LIGOMetadataUtils.h>
+#include <lal/XLALError.h>
+
+
+#define NUM_ROWS 1000
+
+
+/*
+ * ============================================================================
+ *
+ *                               sngl_inspiral
+ *
+ * ============================================================================
+ */
+
+
+/* rows with many ties and a few NaNs in the key columns;  the event_id
+ * records the original position */
+static SnglInspiralTable *make_sngl_inspiral_table(RandomParams *rng, size_t n)
+{
+	SnglInspiralTable *head = NULL;
+	SnglInspiralTable **next = &head;
+	size_t i;
+
+	for(i = 0; i < n; i++) {
+		SnglInspiralTable *row = XLALCreateSnglInspiralTableRow(NULL);
+		XLAL_CHECK_NULL(row, XLAL_EFUNC);
+		row->event_id = i;
+		snprintf(row->ifo, sizeof(row->ifo), "%s", i % 2 ? "H1" : "L1");
+		XLALINT8NSToGPS(&row->end, 1000000000LL * XLAL_BILLION_INT8 + (INT8) (XLALUniformDeviate(rng) * 50) * 100000000LL);
+		row->snr = i % 97 == 0 ? NAN : floor(20.0 * XLALUniformDeviate(rng)) / 2.0;
+		row->chisq = XLALUniformDeviate(rng) * 100.0;
+		row->mass1 = 1.0 + floor(10.0 * XLALUniformDeviate(rng));
+		row->mass2 = 1.0 + floor(10.0 * XLALUniformDeviate(rng));
+		row->mtotal = row->mass1 + row->mass2;
+		row->eta = row->mass1 * row->mass2 / (row->mtotal * row->mtotal);
+		row->mchirp = row->mtotal * pow(row->eta, 0.6);
+		row->template_duration = XLALUniformDeviate(rng);
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+static int sngl_inspiral_equal(const SnglInspiralTable *a, const SnglInspiralTable *b)
+{
+	return a->event_id == b->event_id && !strcmp(a->ifo, b->ifo) && !XLALGPSCmp(&a->end, &b->end) && (a->snr == b->snr || (isnan(a->snr) && isnan(b->snr))) && a->chisq == b->chisq && a->mass1 == b->mass1 && a->mass2 == b->mass2 && a->mchirp == b->mchirp && a->mtotal == b->mtotal && a->eta == b->eta && a->template_duration == b->template_duration;
+}
+
+
+/* the key columns must agree with the rows, and the rows must be linked in
+ * order */
+static int check_sngl_inspiral_columns(SnglInspiralColumns *cols)
+{
+	const SnglInspiralTable *row = XLALSnglInspiralColumnsAsTable(cols);
+	size_t i;
+
+	for(i = 0; i < cols->length; i++, row = row->next) {
+		XLAL_CHECK(row == &cols->rows[i], XLAL_EFAILED, "row %zu is not linked in order", i);
+		XLAL_CHECK(cols->end[i] == XLALGPSToINT8NS(&row->end) && (cols->snr[i] == row->snr || (isnan(cols->snr[i]) && isnan(row->snr))) && cols->chisq[i] == row->chisq && cols->mass1[i] == row->mass1 && cols->mass2[i] == row->mass2 && cols->mchirp[i] == row->mchirp && cols->mtotal[i] == row->mtotal && cols->eta[i] == row->eta, XLAL_EFAILED, "key columns of row %zu disagree with the row", i);
+	}
+	XLAL_CHECK(row == NULL, XLAL_EFAILED, "list is longer than the container");
+
+	return 0;
+}
+
+
+/* consecutive rows must be in order, ties in original order, NaNs last */
+static int check_order(double a, double b, long id_a, long id_b, int descending)
+{
+	if(isnan(a))
+		XLAL_CHECK(isnan(b) && id_a < id_b, XLAL_EFAILED, "NaN key is not last or not stable");
+	else if(isnan(b) || a != b)
+		XLAL_CHECK(isnan(b) || (descending ? a > b : a < b), XLAL_EFAILED, "keys %g, %g out of order", a, b);
+	else
+		XLAL_CHECK(id_a < id_b, XLAL_EFAILED, "sort is not stable");
+	return 0;
+}
+
+
+static int check_time_order(INT8 a, INT8 b, long id_a, long id_b, int descending)
+{
+	if(a != b)
+		XLAL_CHECK(descending ? a > b : a < b, XLAL_EFAILED, "times %" LAL_INT8_FORMAT ", %" LAL_INT8_FORMAT " out of order", a, b);
+	else
+		XLAL_CHECK(id_a < id_b, XLAL_EFAILED, "sort is not stable");
+	return 0;
+}
+
+
+static int test_sngl_inspiral(RandomParams *rng)
+{
+	const SnglInspiralColumnsKey real4_keys[] = {LAL_SNGL_INSPIRAL_KEY_SNR, LAL_SNGL_INSPIRAL_KEY_CHISQ, LAL_SNGL_INSPIRAL_KEY_MASS1, LAL_SNGL_INSPIRAL_KEY_MASS2, LAL_SNGL_INSPIRAL_KEY_MCHIRP, LAL_SNGL_INSPIRAL_KEY_MTOTAL, LAL_SNGL_INSPIRAL_KEY_ETA};
+	SnglInspiralTable *table = make_sngl_inspiral_table(rng, NUM_ROWS);
+	SnglInspiralTable *copy, *row, *orig;
+	SnglInspiralTable **byid;
+	SnglInspiralColumns *cols;
+	size_t index[NUM_ROWS / 2];
+	LIGOTimeGPS start, end;
+	size_t i, k;
+	int descending;
+
+	XLAL_CHECK(table, XLAL_EFUNC);
+	XLAL_CHECK((byid = XLALMalloc(NUM_ROWS * sizeof(*byid))), XLAL_ENOMEM);
+	for(i = 0, row = table; row; row = row->next)
+		byid[i++] = row;
+
+	/* round trip through the linked list */
+	XLAL_CHECK((cols = XLALSnglInspiralColumnsFromTable(table)), XLAL_EFUNC);
+	XLAL_CHECK(cols->length == NUM_ROWS, XLAL_EFAILED);
+	XLAL_CHECK(check_sngl_inspiral_columns(cols) == 0, XLAL_EFUNC);
+	XLAL_CHECK((copy = XLALSnglInspiralColumnsToTable(cols)), XLAL_EFUNC);
+	for(row = copy, orig = table; row && orig; row = row->next, orig = orig->next)
+		XLAL_CHECK(sngl_inspiral_equal(row, orig), XLAL_EFAILED, "round trip changed row %ld", orig->event_id);
+	XLAL_CHECK(!row && !orig, XLAL_EFAILED, "round trip changed the number of rows");
+	XLALDestroySnglInspiralTable(copy);
+
+	/* gather with repeated and omitted rows */
+	for(i = 0; i < XLAL_NUM_ELEM(index); i++)
+		index[i] = (7 * i * i + 3) % NUM_ROWS;
+	XLAL_CHECK(XLALSnglInspiralColumnsGather(cols, index, XLAL_NUM_ELEM(index)) == 0, XLAL_EFUNC);
+	XLAL_CHECK(cols->length == XLAL_NUM_ELEM(index), XLAL_EFAILED);
+	XLAL_CHECK(check_sngl_inspiral_columns(cols) == 0, XLAL_EFUNC);
+	for(i = 0; i < cols->length; i++)
+		XLAL_CHECK(sngl_inspiral_equal(&cols->rows[i], byid[index[i]]), XLAL_EFAILED, "gathered row %zu is not row %zu", i, index[i]);
+	XLALDestroySnglInspiralColumns(cols);
+
+	/* sorts by every key in both directions */
+	for(descending = 0; descending < 2; descending++) {
+		for(k = 0; k < XLAL_NUM_ELEM(real4_keys); k++) {
+			size_t *perm;
+			XLAL_CHECK((cols = XLALSnglInspiralColumnsFromTable(table)), XLAL_EFUNC);
+			XLAL_CHECK((perm = XLALSnglInspiralColumnsSortIndex(cols, real4_keys[k], descending)), XLAL_EFUNC);
+			XLAL_CHECK(XLALSnglInspiralColumnsSort(cols, real4_keys[k], descending) == 0, XLAL_EFUNC);
+			XLAL_CHECK(cols->length == NUM_ROWS, XLAL_EFAILED);
+			XLAL_CHECK(check_sngl_inspiral_columns(cols) == 0, XLAL_EFUNC);
+			for(i = 0; i < cols->length; i++) {
+				XLAL_CHECK(cols->rows[i].event_id == (long) perm[i], XLAL_EFAILED, "sort disagrees with sort index");
+				XLAL_CHECK(sngl_inspiral_equal(&cols->rows[i], byid[perm[i]]), XLAL_EFAILED, "sort changed row %zu", perm[i]);
+			}
+			for(i = 0; i + 1 < cols->length; i++) {
+				double a = 0.0, b = 0.0;
+				switch(real4_keys[k]) {
+				case LAL_SNGL_INSPIRAL_KEY_SNR: a = cols->snr[i]; b = cols->snr[i + 1]; break;
+				case LAL_SNGL_INSPIRAL_KEY_CHISQ: a = cols->chisq[i]; b = cols->chisq[i + 1]; break;
+				case LAL_SNGL_INSPIRAL_KEY_MASS1: a = cols->mass1[i]; b = cols->mass1[i + 1]; break;
+				case LAL_SNGL_INSPIRAL_KEY_MASS2: a = cols->mass2[i]; b = cols->mass2[i + 1]; break;
+				case LAL_SNGL_INSPIRAL_KEY_MCHIRP: a = cols->mchirp[i]; b = cols->mchirp[i + 1]; break;
+				case LAL_SNGL_INSPIRAL_KEY_MTOTAL: a = cols->mtotal[i]; b = cols->mtotal[i + 1]; break;
+				case LAL_SNGL_INSPIRAL_KEY_ETA: a = cols->eta[i]; b = cols->eta[i + 1]; break;
+				default: break;
+				}
+				XLAL_CHECK(check_order(a, b, cols->rows[i].event_id, cols->rows[i + 1].event_id, descending) == 0, XLAL_EFUNC, "key %d, descending = %d, rows %zu, %zu", real4_keys[k], descending, i, i + 1);
+			}
+			XLALFree(perm);
+			XLALDestroySnglInspiralColumns(cols);
+		}
+
+		XLAL_CHECK((cols = XLALSnglInspiralColumnsFromTable(table)), XLAL_EFUNC);
+		XLAL_CHECK(XLALSnglInspiralColumnsSort(cols, LAL_SNGL_INSPIRAL_KEY_END, descending) == 0, XLAL_EFUNC);
+		XLAL_CHECK(check_sngl_inspiral_columns(cols) == 0, XLAL_EFUNC);
+		for(i = 0; i + 1 < cols->length; i++)
+			XLAL_CHECK(check_time_order(cols->end[i], cols->end[i + 1], cols->rows[i].event_id, cols->rows[i + 1].event_id, descending) == 0, XLAL_EFUNC, "end time, descending = %d, rows %zu, %zu", descending, i, i + 1);
+		XLALDestroySnglInspiralColumns(cols);
+	}
+
+	/* cuts keep the matching rows in their original order */
+	XLAL_CHECK((cols = XLALSnglInspiralColumnsFromTable(table)), XLAL_EFUNC);
+	XLAL_CHECK(XLALSnglInspiralColumnsRangeCut(cols, LAL_SNGL_INSPIRAL_KEY_SNR, 2.0, 6.0) == 0, XLAL_EFUNC);
+	XLAL_CHECK(check_sngl_inspiral_columns(cols) == 0, XLAL_EFUNC);
+	for(i = 0, row = table; row; row = row->next)
+		if(row->snr >= 2.0 && row->snr <= 6.0) {
+			XLAL_CHECK(i < cols->length && sngl_inspiral_equal(&cols->rows[i], row), XLAL_EFAILED, "SNR cut lost row %ld", row->event_id);
+			i++;
+		}
+	XLAL_CHECK(i == cols->length, XLAL_EFAILED, "SNR cut kept extra rows");
+	XLALDestroySnglInspiralColumns(cols);
+
+	XLALINT8NSToGPS(&start, 1000000001LL * XLAL_BILLION_INT8);
+	XLALINT8NSToGPS(&end, 1000000003LL * XLAL_BILLION_INT8);
+	XLAL_CHECK((cols = XLALSnglInspiralColumnsFromTable(table)), XLAL_EFUNC);
+	XLAL_CHECK(XLALSnglInspiralColumnsTimeCut(cols, &start, &end) == 0, XLAL_EFUNC);
+	XLAL_CHECK(check_sngl_inspiral_columns(cols) == 0, XLAL_EFUNC);
+	for(i = 0, row = table; row; row = row->next)
+		if(XLALGPSCmp(&row->end, &start) >= 0 && XLALGPSCmp(&row->end, &end) < 0) {
+			XLAL_CHECK(i < cols->length && sngl_inspiral_equal(&cols->rows[i], row), XLAL_EFAILED, "time cut lost row %ld", row->event_id);
+			i++;
+		}
+	XLAL_CHECK(i == cols->length, XLAL_EFAILED, "time cut kept extra rows");
+	XLALDestroySnglInspiralColumns(cols);
+
+	XLALFree(byid);
+	XLALDestroySnglInspiralTable(table);
+	return 0;
+}
+
+
+/*
+ * ============================================================================
+ *
+ *                                sngl_burst
+ *
+ * ============================================================================
+ */
+
+
+static SnglBurst *make_sngl_burst_table(RandomParams *rng, size_t n)
+{
+	SnglBurst *head = NULL;
+	SnglBurst **next = &head;
+	size_t i;
+
+	for(i = 0; i < n; i++) {
+		SnglBurst *row = XLALCreateSnglBurst();
+		XLAL_CHECK_NULL(row, XLAL_EFUNC);
+		row->event_id = i;
+		snprintf(row->ifo, sizeof(row->ifo), "%s", i % 2 ? "H1" : "V1");
+		XLALINT8NSToGPS(&row->peak_time, 1000000000LL * XLAL_BILLION_INT8 + (INT8) (XLALUniformDeviate(rng) * 50) * 100000000LL);
+		row->duration = floor(8.0 * XLALUniformDeviate(rng)) / 8.0;
+		row->start_time = row->peak_time;
+		XLALGPSAdd(&row->start_time, -0.5 * row->duration);
+		row->central_freq = 40.0 + floor(100.0 * XLALUniformDeviate(rng));
+		row->bandwidth = i % 89 == 0 ? NAN : floor(16.0 * XLALUniformDeviate(rng));
+		row->snr = floor(20.0 * XLALUniformDeviate(rng)) / 2.0;
+		row->confidence = i % 101 == 0 ? NAN : 10.0 * XLALUniformDeviate(rng);
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+static int real4_equal(REAL4 a, REAL4 b)
+{
+	return a == b || (isnan(a) && isnan(b));
+}
+
+
+static int sngl_burst_equal(const SnglBurst *a, const SnglBurst *b)
+{
+	return a->event_id == b->event_id && !strcmp(a->ifo, b->ifo) && !XLALGPSCmp(&a->peak_time, &b->peak_time) && !XLALGPSCmp(&a->start_time, &b->start_time) && real4_equal(a->duration, b->duration) && real4_equal(a->central_freq, b->central_freq) && real4_equal(a->bandwidth, b->bandwidth) && real4_equal(a->snr, b->snr) && real4_equal(a->confidence, b->confidence);
+}
+
+
+static int check_sngl_burst_columns(SnglBurstColumns *cols)
+{
+	const SnglBurst *row = XLALSnglBurstColumnsAsTable(cols);
+	size_t i;
+
+	for(i = 0; i < cols->length; i++, row = row->next) {
+		XLAL_CHECK(row == &cols->rows[i], XLAL_EFAILED, "row %zu is not linked in order", i);
+		XLAL_CHECK(cols->peak[i] == XLALGPSToINT8NS(&row->peak_time) && cols->start[i] == XLALGPSToINT8NS(&row->start_time) && real4_equal(cols->duration[i], row->duration) && real4_equal(cols->central_freq[i], row->central_freq) && real4_equal(cols->bandwidth[i], row->bandwidth) && real4_equal(cols->snr[i], row->snr) && real4_equal(cols->confidence[i], row->confidence), XLAL_EFAILED, "key columns of row %zu disagree with the row", i);
+	}
+	XLAL_CHECK(row == NULL, XLAL_EFAILED, "list is longer than the container");
+
+	return 0;
+}
+
+
+static int test_sngl_burst(RandomParams *rng)
+{
+	const SnglBurstColumnsKey real4_keys[] = {LAL_SNGL_BURST_KEY_DURATION, LAL_SNGL_BURST_KEY_CENTRAL_FREQ, LAL_SNGL_BURST_KEY_BANDWIDTH, LAL_SNGL_BURST_KEY_SNR, LAL_SNGL_BURST_KEY_CONFIDENCE};
+	const SnglBurstColumnsKey time_keys[] = {LAL_SNGL_BURST_KEY_PEAK, LAL_SNGL_BURST_KEY_START};
+	SnglBurst *table = make_sngl_burst_table(rng, NUM_ROWS);
+	SnglBurst *copy, *row, *orig;
+	SnglBurst **byid;
+	SnglBurstColumns *cols;
+	size_t index[NUM_ROWS / 2];
+	LIGOTimeGPS start, end;
+	size_t i, k;
+	int descending;
+
+	XLAL_CHECK(table, XLAL_EFUNC);
+	XLAL_CHECK((byid = XLALMalloc(NUM_ROWS * sizeof(*byid))), XLAL_ENOMEM);
+	for(i = 0, row = table; row; row = row->next)
+		byid[i++] = row;
+
+	/* round trip through the linked list */
+	XLAL_CHECK((cols = XLALSnglBurstColumnsFromTable(table)), XLAL_EFUNC);
+	XLAL_CHECK(cols->length == NUM_ROWS, XLAL_EFAILED);
+	XLAL_CHECK(check_sngl_burst_columns(cols) == 0, XLAL_EFUNC);
+	XLAL_CHECK((copy = XLALSnglBurstColumnsToTable(cols)), XLAL_EFUNC);
+	for(row = copy, orig = table; row && orig; row = row->next, orig = orig->next)
+		XLAL_CHECK(sngl_burst_equal(row, orig), XLAL_EFAILED, "round trip changed row %ld", orig->event_id);
+	XLAL_CHECK(!row && !orig, XLAL_EFAILED, "round trip changed the number of rows");
+	XLALDestroySnglBurstTable(copy);
+
+	/* gather with repeated and omitted rows */
+	for(i = 0; i < XLAL_NUM_ELEM(index); i++)
+		index[i] = (5 * i * i + 11) % NUM_ROWS;
+	XLAL_CHECK(XLALSnglBurstColumnsGather(cols, index, XLAL_NUM_ELEM(index)) == 0, XLAL_EFUNC);
+	XLAL_CHECK(cols->length == XLAL_NUM_ELEM(index), XLAL_EFAILED);
+	XLAL_CHECK(check_sngl_burst_columns(cols) == 0, XLAL_EFUNC);
+	for(i = 0; i < cols->length; i++)
+		XLAL_CHECK(sngl_burst_equal(&cols->rows[i], byid[index[i]]), XLAL_EFAILED, "gathered row %zu is not row %zu", i, index[i]);
+	XLALDestroySnglBurstColumns(cols);
+
+	/* sorts by every key in both directions */
+	for(descending = 0; descending < 2; descending++) {
+		for(k = 0; k < XLAL_NUM_ELEM(real4_keys); k++) {
+			size_t *perm;
+			XLAL_CHECK((cols = XLALSnglBurstColumnsFromTable(table)), XLAL_EFUNC);
+			XLAL_CHECK((perm = XLALSnglBurstColumnsSortIndex(cols, real4_keys[k], descending)), XLAL_EFUNC);
+			XLAL_CHECK(XLALSnglBurstColumnsSort(cols, real4_keys[k], descending) == 0, XLAL_EFUNC);
+			XLAL_CHECK(cols->length == NUM_ROWS, XLAL_EFAILED);
+			XLAL_CHECK(check_sngl_burst_columns(cols) == 0, XLAL_EFUNC);
+			for(i = 0; i < cols->length; i++) {
+				XLAL_CHECK(cols->rows[i].event_id == (long) perm[i], XLAL_EFAILED, "sort disagrees with sort index");
+				XLAL_CHECK(sngl_burst_equal(&cols->rows[i], byid[perm[i]]), XLAL_EFAILED, "sort changed row %zu", perm[i]);
+			}
+			for(i = 0; i + 1 < cols->length; i++) {
+				double a = 0.0, b = 0.0;
+				switch(real4_keys[k]) {
+				case LAL_SNGL_BURST_KEY_DURATION: a = cols->duration[i]; b = cols->duration[i + 1]; break;
+				case LAL_SNGL_BURST_KEY_CENTRAL_FREQ: a = cols->central_freq[i]; b = cols->central_freq[i + 1]; break;
+				case LAL_SNGL_BURST_KEY_BANDWIDTH: a = cols->bandwidth[i]; b = cols->bandwidth[i + 1]; break;
+				case LAL_SNGL_BURST_KEY_SNR: a = cols->snr[i]; b = cols->snr[i + 1]; break;
+				case LAL_SNGL_BURST_KEY_CONFIDENCE: a = cols->confidence[i]; b = cols->confidence[i + 1]; break;
+				default: break;
+				}
+				XLAL_CHECK(check_order(a, b, cols->rows[i].event_id, cols->rows[i + 1].event_id, descending) == 0, XLAL_EFUNC, "key %d, descending = %d, rows %zu, %zu", real4_keys[k], descending, i, i + 1);
+			}
+			XLALFree(perm);
+			XLALDestroySnglBurstColumns(cols);
+		}
+
+		for(k = 0; k < XLAL_NUM_ELEM(time_keys); k++) {
+			const INT8 *t;
+			XLAL_CHECK((cols = XLALSnglBurstColumnsFromTable(table)), XLAL_EFUNC);
+			XLAL_CHECK(XLALSnglBurstColumnsSort(cols, time_keys[k], descending) == 0, XLAL_EFUNC);
+			XLAL_CHECK(check_sngl_burst_columns(cols) == 0, XLAL_EFUNC);
+			t = time_keys[k] == LAL_SNGL_BURST_KEY_PEAK ? cols->peak : cols->start;
+			for(i = 0; i + 1 < cols->length; i++)
+				XLAL_CHECK(check_time_order(t[i], t[i + 1], cols->rows[i].event_id, cols->rows[i + 1].event_id, descending) == 0, XLAL_EFUNC, "key %d, descending = %d, rows %zu, %zu", time_keys[k], descending, i, i + 1);
+			XLALDestroySnglBurstColumns(cols);
+		}
+	}
+
+	/* cuts keep the matching rows in their original order */
+	XLAL_CHECK((cols = XLALSnglBurstColumnsFromTable(table)), XLAL_EFUNC);
+	XLAL_CHECK(XLALSnglBurstColumnsRangeCut(cols, LAL_SNGL_BURST_KEY_CENTRAL_FREQ, 60.0, 100.0) == 0, XLAL_EFUNC);
+	XLAL_CHECK(check_sngl_burst_columns(cols) == 0, XLAL_EFUNC);
+	for(i = 0, row = table; row; row = row->next)
+		if(row->central_freq >= 60.0 && row->central_freq <= 100.0) {
+			XLAL_CHECK(i < cols->length && sngl_burst_equal(&cols->rows[i], row), XLAL_EFAILED, "frequency cut lost row %ld", row->event_id);
+			i++;
+		}
+	XLAL_CHECK(i == cols->length, XLAL_EFAILED, "frequency cut kept extra rows");
+	XLALDestroySnglBurstColumns(cols);
+
+	XLALINT8NSToGPS(&start, 1000000001LL * XLAL_BILLION_INT8);
+	XLALINT8NSToGPS(&end, 1000000003LL * XLAL_BILLION_INT8);
+	XLAL_CHECK((cols = XLALSnglBurstColumnsFromTable(table)), XLAL_EFUNC);
+	XLAL_CHECK(XLALSnglBurstColumnsTimeCut(cols, &start, &end) == 0, XLAL_EFUNC);
+	XLAL_CHECK(check_sngl_burst_columns(cols) == 0, XLAL_EFUNC);
+	for(i = 0, row = table; row; row = row->next)
+		if(XLALGPSCmp(&row->peak_time, &start) >= 0 && XLALGPSCmp(&row->peak_time, &end) < 0) {
+			XLAL_CHECK(i < cols->length && sngl_burst_equal(&cols->rows[i], row), XLAL_EFAILED, "time cut lost row %ld", row->event_id);
+			i++;
+		}
+	XLAL_CHECK(i == cols->length, XLAL_EFAILED, "time cut kept extra rows");
+	XLALDestroySnglBurstColumns(cols);
+
+	XLALFree(byid);
+	XLALDestroySnglBurstTable(table);
+	return 0;
+}
+
+
+int main(void)
+{
+	RandomParams *rng = XLALCreateRandomParams(1234);
+
+	XLAL_CHECK_MAIN(rng, XLAL_EFUNC);
+	XLAL_CHECK_MAIN(test_sngl_inspiral(rng) == 0, XLAL_EFUNC);
+	XLAL_CHECK_MAIN(test_sngl_burst(rng) == 0, XLAL_EFUNC);
+	XLALDestroyRandomParams(rng);
+
+	LALCheckMemoryLeaks();
+	return EXIT_SUCCESS;
+}
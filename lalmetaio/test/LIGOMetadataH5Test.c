@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with with program; see the file COPYING. If not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+/*
+ * Tests the HDF5 sngl_inspiral and sngl_burst readers against the LIGO
+ * Light Weight XML readers, in full, with subsets of columns, and with GPS
+ * cuts.
+ */
+
+#include <lal/LALConfig.h>
+
+#ifndef LAL_HDF5_ENABLED
+int main(void) { return 77; /* don't do any testing */ }
+#else
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/Date.h>
+#include <lal/H5FileIO.h>
+#include <lal/LALStdlib.h>
+#include <lal/Random.h>
+#include <lal/LIGOLwXML.h>
+#include <lal/LIGOLwXMLRead.h>
+#include <lal/LIGOMetadataH5.h>
+#include <lal/LIGOMetadataTables.h>
+#include <lal/LIGOMetadataUtils.h>
+#include <lal/XLALError.h>
+
+
+/* more than one chunk of rows, so that row ranges cross chunks */
+#define NUM_ROWS 10000
+
+#define H5_FILENAME "LIGOMetadataH5Test.h5"
+#define XML_FILENAME "LIGOMetadataH5Test.xml"
+
+
+/*
+ * the columns of each table;  S(x) is a string, T(x) a GPS time, V(x) a
+ * number
+ */
+
+
+#define SNGL_INSPIRAL_FIELDS(S, T, V) \
+	V(process_id) S(ifo) S(search) S(channel) T(end) V(end_time_gmst) \
+	T(impulse_time) V(template_duration) V(event_duration) V(amplitude) \
+	V(eff_distance) V(coa_phase) V(mass1) V(mass2) V(mchirp) V(mtotal) \
+	V(eta) V(tau0) V(tau2) V(tau3) V(tau4) V(tau5) V(ttotal) V(psi0) \
+	V(psi3) V(alpha) V(alpha1) V(alpha2) V(alpha3) V(alpha4) V(alpha5) \
+	V(alpha6) V(beta) V(f_final) V(snr) V(chisq) V(chisq_dof) \
+	V(bank_chisq) V(bank_chisq_dof) V(cont_chisq) V(cont_chisq_dof) \
+	V(sigmasq) V(rsqveto_duration) V(Gamma[0]) V(Gamma[1]) V(Gamma[2]) \
+	V(Gamma[3]) V(Gamma[4]) V(Gamma[5]) V(Gamma[6]) V(Gamma[7]) \
+	V(Gamma[8]) V(Gamma[9]) V(kappa) V(chi) V(spin1x) V(spin1y) V(spin1z) \
+	V(spin2x) V(spin2y) V(spin2z) V(event_id)
+
+#define SNGL_BURST_FIELDS(S, T, V) \
+	V(process_id) S(ifo) S(search) S(channel) T(start_time) T(peak_time) \
+	V(duration) V(central_freq) V(bandwidth) V(amplitude) V(snr) \
+	V(confidence) V(chisq) V(chisq_dof) V(event_id)
+
+/* the columns read in the subset tests, and the fields that hold them */
+#define SNGL_INSPIRAL_SUBSET "ifo, end_time,end_time_ns,snr,Gamma3,chisq_dof,event_id"
+#define SNGL_INSPIRAL_SUBSET_FIELDS(S, T, V) \
+	S(ifo) T(end) V(snr) V(Gamma[3]) V(chisq_dof) V(event_id)
+
+#define SNGL_BURST_SUBSET "channel,peak_time,peak_time_ns,chisq_dof,confidence"
+#define SNGL_BURST_SUBSET_FIELDS(S, T, V) \
+	S(channel) T(peak_time) V(chisq_dof) V(confidence)
+
+#define FILL_STRING(x) snprintf(row->x, sizeof(row->x), "%s%zu", #x, i % 7);
+#define FILL_TIME(x) XLALINT8NSToGPS(&row->x, 1000000000LL * XLAL_BILLION_INT8 + (INT8) (1e12 * XLALUniformDeviate(rng)));
+#define FILL_VALUE(x) row->x = 1000 * XLALUniformDeviate(rng);
+
+#define COPY_STRING(x) memcpy(expect.x, b->x, sizeof(expect.x));
+#define COPY_TIME(x) expect.x = b->x;
+#define COPY_VALUE(x) expect.x = b->x;
+
+#define EQUAL_STRING(x) if(strcmp(a->x, b->x)) XLAL_ERROR(XLAL_EFAILED, "row %zu: %s differs: \"%s\" != \"%s\"", i, #x, a->x, b->x);
+#define EQUAL_TIME(x) if(XLALGPSCmp(&a->x, &b->x)) XLAL_ERROR(XLAL_EFAILED, "row %zu: %s differs", i, #x);
+#define EQUAL_VALUE(x) if(a->x != b->x) XLAL_ERROR(XLAL_EFAILED, "row %zu: %s differs: %.17g != %.17g", i, #x, (double) a->x, (double) b->x);
+
+
+/* GPS cuts as offsets in seconds from the earliest time, or NaN for none */
+static const double cuts[][2] = {
+	{100.0, 200.0},
+	{0.0, 1000.0},
+	{NAN, 500.0},
+	{999.5, NAN},
+	{250.0, 250.0},
+	{2000.0, NAN},
+};
+
+
+static SnglInspiralTable *make_sngl_inspiral_table(RandomParams *rng)
+{
+	SnglInspiralTable *head = NULL;
+	SnglInspiralTable **next = &head;
+	size_t i;
+
+	for(i = 0; i < NUM_ROWS; i++) {
+		SnglInspiralTable *row = XLALCreateSnglInspiralTableRow(NULL);
+		XLAL_CHECK_NULL(row, XLAL_EFUNC);
+		SNGL_INSPIRAL_FIELDS(FILL_STRING, FILL_TIME, FILL_VALUE)
+		row->process_id = 0;
+		row->event_id = i;
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+static SnglBurst *make_sngl_burst_table(RandomParams *rng)
+{
+	SnglBurst *head = NULL;
+	SnglBurst **next = &head;
+	size_t i;
+
+	for(i = 0; i < NUM_ROWS; i++) {
+		SnglBurst *row = XLALCreateSnglBurst();
+		XLAL_CHECK_NULL(row, XLAL_EFUNC);
+		SNGL_BURST_FIELDS(FILL_STRING, FILL_TIME, FILL_VALUE)
+		row->process_id = 0;
+		row->event_id = i;
+		*next = row;
+		next = &row->next;
+	}
+
+	return head;
+}
+
+
+static int write_documents(const SnglInspiralTable *sngl_inspiral, const SnglBurst *sngl_burst)
+{
+	LIGOLwXMLStream *xml = XLALOpenLIGOLwXMLFile(XML_FILENAME);
+	LALH5File *h5 = XLALH5FileOpen(H5_FILENAME, "w");
+
+	XLAL_CHECK(xml && h5, XLAL_EFUNC);
+	XLAL_CHECK(XLALWriteLIGOLwXMLSnglInspiralTable(xml, sngl_inspiral) == 0, XLAL_EFUNC);
+	XLAL_CHECK(XLALWriteLIGOLwXMLSnglBurstTable(xml, sngl_burst) == 0, XLAL_EFUNC);
+	XLAL_CHECK(XLALCloseLIGOLwXMLFile(xml) == 0, XLAL_EFUNC);
+	XLAL_CHECK(XLALWriteSnglInspiralTableH5(h5, sngl_inspiral) == 0, XLAL_EFUNC);
+	XLAL_CHECK(XLALWriteSnglBurstTableH5(h5, sngl_burst) == 0, XLAL_EFUNC);
+	XLALH5FileClose(h5);
+
+	return 0;
+}
+
+
+/* [start, end) from a row of cuts;  pointers are NULL where there is no cut */
+static void make_cut(size_t k, LIGOTimeGPS *t, const LIGOTimeGPS **start, const LIGOTimeGPS **end)
+{
+	XLALGPSSet(&t[0], 1000000000, 0);
+	XLALGPSSet(&t[1], 1000000000, 0);
+	*start = isnan(cuts[k][0]) ? NULL : XLALGPSAdd(&t[0], cuts[k][0]);
+	*end = isnan(cuts[k][1]) ? NULL : XLALGPSAdd(&t[1], cuts[k][1]);
+}
+
+
+static int in_cut(const LIGOTimeGPS *t, const LIGOTimeGPS *start, const LIGOTimeGPS *end)
+{
+	return (!start || XLALGPSCmp(t, start) >= 0) && (!end || XLALGPSCmp(t, end) < 0);
+}
+
+
+/*
+ * the HDF5 reader must reproduce the XML reader exactly, with the fields
+ * of unlisted columns zero, and with only the rows that pass the cut
+ */
+static int compare_sngl_inspiral(const SnglInspiralTable *xml, const char *columns, const LIGOTimeGPS *start, const LIGOTimeGPS *end)
+{
+	LALH5File *h5 = XLALH5FileOpen(H5_FILENAME, "r");
+	SnglInspiralTable *table;
+	const SnglInspiralTable *a, *ref;
+	size_t i;
+
+	XLAL_CHECK(h5, XLAL_EFUNC);
+	table = XLALReadSnglInspiralTableH5(h5, columns, start, end);
+	XLALH5FileClose(h5);
+	XLAL_CHECK(table || xlalErrno == 0, XLAL_EFUNC, "cannot read sngl_inspiral table");
+
+	for(i = 0, a = table, ref = xml; ref; ref = ref->next) {
+		SnglInspiralTable expect;
+		const SnglInspiralTable *b = ref;
+		if(!in_cut(&ref->end, start, end))
+			continue;
+		XLAL_CHECK(a, XLAL_EFAILED, "HDF5 reader returned %zu rows, expected more", i);
+		if(columns) {
+			memset(&expect, 0, sizeof(expect));
+			SNGL_INSPIRAL_SUBSET_FIELDS(COPY_STRING, COPY_TIME, COPY_VALUE)
+			b = &expect;
+		}
+		SNGL_INSPIRAL_FIELDS(EQUAL_STRING, EQUAL_TIME, EQUAL_VALUE)
+		a = a->next;
+		i++;
+	}
+	XLAL_CHECK(!a, XLAL_EFAILED, "HDF5 reader returned more than %zu rows", i);
+
+	XLALDestroySnglInspiralTable(table);
+	return 0;
+}
+
+
+static int compare_sngl_burst(const SnglBurst *xml, const char *columns, const LIGOTimeGPS *start, const LIGOTimeGPS *end)
+{
+	LALH5File *h5 = XLALH5FileOpen(H5_FILENAME, "r");
+	SnglBurst *table;
+	const SnglBurst *a, *ref;
+	size_t i;
+
+	XLAL_CHECK(h5, XLAL_EFUNC);
+	table = XLALReadSnglBurstTableH5(h5, columns, start, end);
+	XLALH5FileClose(h5);
+	XLAL_CHECK(table || xlalErrno == 0, XLAL_EFUNC, "cannot read sngl_burst table");
+
+	for(i = 0, a = table, ref = xml; ref; ref = ref->next) {
+		SnglBurst expect;
+		const SnglBurst *b = ref;
+		if(!in_cut(&ref->peak_time, start, end))
+			continue;
+		XLAL_CHECK(a, XLAL_EFAILED, "HDF5 reader returned %zu rows, expected more", i);
+		if(columns) {
+			memset(&expect, 0, sizeof(expect));
+			SNGL_BURST_SUBSET_FIELDS(COPY_STRING, COPY_TIME, COPY_VALUE)
+			b = &expect;
+		}
+		SNGL_BURST_FIELDS(EQUAL_STRING, EQUAL_TIME, EQUAL_VALUE)
+		a = a->next;
+		i++;
+	}
+	XLAL_CHECK(!a, XLAL_EFAILED, "HDF5 reader returned more than %zu rows", i);
+
+	XLALDestroySnglBurstTable(table);
+	return 0;
+}
+
+
+int main(void)
+{
+	RandomParams *rng = XLALCreateRandomParams(1234);
+	SnglInspiralTable *sngl_inspiral, *xml_sngl_inspiral;
+	SnglBurst *sngl_burst, *xml_sngl_burst;
+	size_t k;
+
+	XLAL_CHECK_MAIN(rng, XLAL_EFUNC);
+	XLAL_CHECK_MAIN((sngl_inspiral = make_sngl_inspiral_table(rng)), XLAL_EFUNC);
+	XLAL_CHECK_MAIN((sngl_burst = make_sngl_burst_table(rng)), XLAL_EFUNC);
+	XLAL_CHECK_MAIN(write_documents(sngl_inspiral, sngl_burst) == 0, XLAL_EFUNC);
+	XLAL_CHECK_MAIN((xml_sngl_inspiral = XLALSnglInspiralTableFromLIGOLw(XML_FILENAME)), XLAL_EFUNC);
+	XLAL_CHECK_MAIN((xml_sngl_burst = XLALSnglBurstTableFromLIGOLw(XML_FILENAME)), XLAL_EFUNC);
+
+	/* all columns and rows */
+	XLAL_CHECK_MAIN(compare_sngl_inspiral(xml_sngl_inspiral, NULL, NULL, NULL) == 0, XLAL_EFUNC);
+	XLAL_CHECK_MAIN(compare_sngl_burst(xml_sngl_burst, NULL, NULL, NULL) == 0, XLAL_EFUNC);
+
+	/* subsets of columns */
+	XLAL_CHECK_MAIN(compare_sngl_inspiral(xml_sngl_inspiral, SNGL_INSPIRAL_SUBSET, NULL, NULL) == 0, XLAL_EFUNC);
+	XLAL_CHECK_MAIN(compare_sngl_burst(xml_sngl_burst, SNGL_BURST_SUBSET, NULL, NULL) == 0, XLAL_EFUNC);
+
+	/* GPS cuts, with all columns and with subsets */
+	for(k = 0; k < XLAL_NUM_ELEM(cuts); k++) {
+		LIGOTimeGPS t[2];
+		const LIGOTimeGPS *start, *end;
+		make_cut(k, t, &start, &end);
+		XLAL_CHECK_MAIN(compare_sngl_inspiral(xml_sngl_inspiral, NULL, start, end) == 0, XLAL_EFUNC, "cut %zu", k);
+		XLAL_CHECK_MAIN(compare_sngl_burst(xml_sngl_burst, NULL, start, end) == 0, XLAL_EFUNC, "cut %zu", k);
+		XLAL_CHECK_MAIN(compare_sngl_inspiral(xml_sngl_inspiral, SNGL_INSPIRAL_SUBSET, start, end) == 0, XLAL_EFUNC, "cut %zu", k);
+		XLAL_CHECK_MAIN(compare_sngl_burst(xml_sngl_burst, SNGL_BURST_SUBSET, start, end) == 0, XLAL_EFUNC, "cut %zu", k);
+	}
+
+	XLALDestroySnglBurstTable(xml_sngl_burst);
+	XLALDestroySnglInspiralTable(xml_sngl_inspiral);
+	XLALDestroySnglBurstTable(sngl_burst);
+	XLALDestroySnglInspiralTable(sngl_inspiral);
+	XLALDestroyRandomParams(rng);
+
+	LALCheckMemoryLeaks();
+	return EXIT_SUCCESS;
+}
+
+#endif /* LAL_HDF5_ENABLED */
@@ -1047,6 +1047,7 @@ int main(int argc, char *argv[]){
 
   int numpoints = 0;
   int numorb = 0;
+  REAL8 templateLoopTime = 0; /* wall-clock time spent in the loop over templates */
   if (uvar.resamp == TRUE){
       // Resampled loop 
       XLALDestroyMultiSFTVector ( inputSFTs );
@@ -1060,7 +1061,9 @@ int main(int argc, char *argv[]){
         LogPrintf ( LOG_CRITICAL, "%s: XLALCreateREAL8Vector() failed with errno=%d\n", __func__, xlalErrno );
         XLAL_ERROR( XLAL_EFUNC );
       }
+      REAL8 tic_templateLoop = XLALGetTimeOfDay();
       demodLoopCrossCorr(multiBinaryTimes, multiSSBTimes, dopplerpos, dopplerShiftFlag, binaryTemplateSpacings, minBinaryTemplate, maxBinaryTemplate, fCount, aCount, tCount, pCount, fSpacingNum, aSpacingNum, tSpacingNum, pSpacingNum, shiftedFreqs, lowestBins, expSignalPhases, sincList, uvar, sftIndices, inputSFTs, badBins, Tsft, multiWeights, ccStat, evSquared, estSens, GammaAve, sftPairs, thisCandidate, ccToplist, ndim, dimf, dima, dimT, dimP, g_ij, &numpoints, &numorb, &config);
+      templateLoopTime = XLALGetTimeOfDay() - tic_templateLoop;
 
       XLALDestroyMultiSFTVector ( inputSFTs );
       XLALDestroyCOMPLEX8Vector ( expSignalPhases );
@@ -1158,6 +1161,13 @@ int main(int argc, char *argv[]){
     fprintf(fp, "jobStartTime = %" LAL_INT4_FORMAT "\n", computingStartGPSTime.gpsSeconds); /*job start time in GPS-time*/
     fprintf(fp, "jobEndTime = %" LAL_INT4_FORMAT "\n", computingEndGPSTime.gpsSeconds); /*job end time in GPS-time*/
     fprintf(fp, "computingTime = %" LAL_UINT4_FORMAT "\n", computingTime); /*total time in sec*/
+    if (templateLoopTime > 0) {
+      UINT8 numTemplates = (uvar.useLattice == TRUE) ? (UINT8)numpoints : (fSpacingNum + 1) * (aSpacingNum + 1) * (tSpacingNum + 1) * (pSpacingNum + 1);
+      fprintf(fp, "templateLoopTime = %.6g\n", templateLoopTime); /*time in sec spent in the loop over templates*/
+      if (numTemplates > 0 && sftPairs->length > 0) {
+        fprintf(fp, "tauTemplatePair = %.6g\n", templateLoopTime / numTemplates / sftPairs->length); /*time in sec per template and SFT pair*/
+      }
+    }
     fprintf(fp, "SFTnum = %" LAL_UINT4_FORMAT "\n", sftIndices->length); /*total number of SFT*/
     fprintf(fp, "pairnum = %" LAL_UINT4_FORMAT "\n", sftPairs->length); /*total number of pair of SFT*/
     fprintf(fp, "Tsft = %.6g\n", Tsft); /*SFT duration*/
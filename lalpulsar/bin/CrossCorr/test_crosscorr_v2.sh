@@ -48,7 +48,7 @@ mfd_CL="--fmin=$mfd_fmin --Band=$mfd_Band --Freq=$mfd_Freq --outSFTbname=./sfts
 mfd_CL1="${mfd_CL} --IFO=$mfd_ifo1 --randSeed=$mfd_seed1"
 mfd_CL2="${mfd_CL} --IFO=$mfd_ifo2 --randSeed=$mfd_seed2"
 
-pcc_CL="--startTime=$startTime --endTime=$endTime --sftLocation='./sfts/*.sft' --fStart=$pcc_fStart --fBand=$pcc_fBand --alphaRad=$alphaRad --deltaRad=$deltaRad --maxLag=$pcc_maxLag --orbitAsiniSec=$pcc_orbitAsiniSec --orbitAsiniSecBand=$pcc_orbitAsiniSecBand --orbitPSec=$pcc_orbitPSec --orbitTimeAsc=$pcc_orbitTimeAsc --orbitTimeAscBand=$pcc_orbitTimeAscBand --numBins=$pcc_numBins --mismatchF=$pcc_mismatchF --mismatchA=$pcc_mismatchA --mismatchT=$pcc_mismatchT --mismatchP=$pcc_mismatchP"
+pcc_CL="--startTime=$startTime --endTime=$endTime --sftLocation='./sfts/*.sft' --fStart=$pcc_fStart --fBand=$pcc_fBand --alphaRad=$alphaRad --deltaRad=$deltaRad --maxLag=$pcc_maxLag --orbitAsiniSec=$pcc_orbitAsiniSec --orbitAsiniSecBand=$pcc_orbitAsiniSecBand --orbitPSec=$pcc_orbitPSec --orbitTimeAsc=$pcc_orbitTimeAsc --orbitTimeAscBand=$pcc_orbitTimeAscBand --mismatchF=$pcc_mismatchF --mismatchA=$pcc_mismatchA --mismatchT=$pcc_mismatchT --mismatchP=$pcc_mismatchP"
 
 ## ---------- Run MFDv4 ----------
 cmdline="$mfd_code $mfd_CL1";
@@ -74,7 +74,7 @@ else
 fi
 
 ## ---------- Run PulsarCrossCorr_v2 ----------
-cmdline="$pcc_code $pcc_CL"
+cmdline="$pcc_code $pcc_CL --numBins=$pcc_numBins"
 echo $cmdline
 echo -n "Running ${pcc_code} ... "
 if ! tmp=`eval $cmdline`; then
@@ -85,5 +85,32 @@ else
     echo "OK."
 fi
 
+## ---------- Run PulsarCrossCorr_v2 with several bins, on one and several threads ----------
+## the statistic factorizes over bins, and sums over SFT pairs in fixed blocks, so the toplists must be identical
+pcc_numBins_multi=3
+for nthreads in 1 4; do
+    cmdline="$pcc_code $pcc_CL --numBins=$pcc_numBins_multi --toplistFilename=./toplist_crosscorr_T${nthreads}.dat --logFilename=./crosscorr_T${nthreads}.log"
+    echo "OMP_NUM_THREADS=$nthreads $cmdline"
+    echo -n "Running ${pcc_code} with numBins=$pcc_numBins_multi on $nthreads thread(s) ... "
+    export OMP_NUM_THREADS=$nthreads
+    if ! tmp=`eval $cmdline`; then
+        echo "FAILED:"
+        echo $cmdline
+        exit 1;
+    else
+        echo "OK."
+    fi
+    grep -E '^(templateLoopTime|tauTemplatePair) = ' ./crosscorr_T${nthreads}.log
+done
+unset OMP_NUM_THREADS
+
+echo -n "Comparing toplists from 1 and 4 threads ... "
+if ! cmp ./toplist_crosscorr_T1.dat ./toplist_crosscorr_T4.dat; then
+    echo "FAILED: toplists depend on the number of threads"
+    exit 1
+else
+    echo "OK."
+fi
+
 rm -rf ./sfts/
-rm -f ./toplist_crosscorr.dat
+rm -f ./toplist_crosscorr.dat ./toplist_crosscorr_T1.dat ./toplist_crosscorr_T4.dat ./crosscorr_T1.log ./crosscorr_T4.log
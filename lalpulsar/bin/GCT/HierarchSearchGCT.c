@@ -45,12 +45,10 @@
 
 #include "HierarchSearchGCT.h"
 
-#ifdef GC_SSE2_OPT
-#include <gc_hotloop_sse2.h>
-#else
+#include <lal/VectorMath.h>
+
 #define ALRealloc LALRealloc
 #define ALFree LALFree
-#endif
 
 /* ---------- Defines -------------------- */
 /* #define DIAGNOSISMODE 1 */
@@ -572,8 +570,7 @@ int main( int argc, char *argv[]) {
     maxseg -= 1;
     if ( (UINT8)uvar_nStacksMax > maxseg) {
       fprintf(stderr,
-              "Number of segments exceeds %" LAL_UINT8_FORMAT "!\n"
-              "Compile without GC_SSE2_OPT to extend the available segment range\n",
+              "Number of segments exceeds %" LAL_UINT8_FORMAT "!\n",
               maxseg);
       return( HIERARCHICALSEARCH_EBAD );
     }
@@ -1354,14 +1351,8 @@ int main( int argc, char *argv[]) {
           /* number of detectors, needed for sumTwoFX array */
           finegrid.numDetectors = coarsegrid.numDetectors;
 
-          /* allocate memory for finegrid points */
-          /* FIXME: The SSE2 optimized code relies on an identical alignment modulo 16 bytes of the
-             arrays finegrid.nc and finegrid.sumTwoF !!
-             MacOS enforces 16 byte alignment of memory blocks with size >= 16 bytes allocated
-             with malloc and realloc, but e.g. for 32 bit Linux this will NOT hold.
-             Alternatives might be using (posix_)memalign under Linux.
-             Windows ==>???
-          */
+          /* allocate memory for finegrid points; the vector functions used to
+             sum over segments do not require any particular alignment */
 
           finegrid.nc = (FINEGRID_NC_T *)ALRealloc( finegrid.nc, finegrid.length * sizeof(FINEGRID_NC_T));
           finegrid.sumTwoF = (REAL4 *)ALRealloc( finegrid.sumTwoF, finegrid.length * sizeof(REAL4));
@@ -1617,87 +1608,31 @@ int main( int argc, char *argv[]) {
                 FINEGRID_NC_T * fgridnc = finegrid.nc + FG_INDEX(finegrid, 0);
 #endif
 
-#ifdef GC_SSE2_OPT
-                if ( uvar_getMaxFperSeg ) {
-                  /* disables number count keeping */
-                  REAL4 * fgrid2Fmax = finegrid.maxTwoFl + FG_INDEX(finegrid, 0);
-                  UINT4 * fgrid2FmaxIdx = finegrid.maxTwoFlIdx + FG_INDEX(finegrid, 0);
-
-                  gc_hotloop_2Fmax_tracking (fgrid2F, fgrid2Fmax, fgrid2FmaxIdx, cgrid2F, k, finegrid.freqlength);
-                } else {
-#ifndef EXP_NO_NUM_COUNT
-                  gc_hotloop( fgrid2F, cgrid2F, fgridnc, TwoFthreshold, finegrid.freqlength );
-#else
-                  gc_hotloop_no_nc ( fgrid2F, cgrid2F, finegrid.freqlength );
-#endif
-		}
-                if ( uvar_computeBSGL ) {
-                  for (UINT4 X = 0; X < finegrid.numDetectors; X++) {
-                    REAL4 * cgrid2FX = coarsegrid.TwoFX + CG_FX_INDEX(coarsegrid, X, k, U1idx);
-                    REAL4 * fgrid2FX = finegrid.sumTwoFX + FG_FX_INDEX(finegrid, X, 0);
-
-                    if ( uvar_getMaxFperSeg ) {
-                      REAL4 * fgrid2FXmax = finegrid.maxTwoFXl + FG_FX_INDEX(finegrid,X, 0);
-                      UINT4 * fgrid2FXmaxIdx = finegrid.maxTwoFXlIdx + FG_FX_INDEX(finegrid,X, 0);
-
-                      gc_hotloop_2Fmax_tracking (fgrid2FX, fgrid2FXmax, fgrid2FXmaxIdx, cgrid2FX, k, finegrid.freqlength  );
-                    } else {
-                      gc_hotloop_no_nc( fgrid2FX, cgrid2FX, finegrid.freqlength );
-                    }
-                  } /* for  X  */
-                }
-#else // GC_SSE2_OPT
-                for(UINT4 ifreq_fg=0; ifreq_fg < finegrid.freqlength; ifreq_fg++) {
-                  fgrid2F[0] += cgrid2F[0];
+                /* semicoherent sum, number count and per-segment maximum of the 2F values;
+                   the vector functions select the fastest available SIMD instruction set at runtime */
+                XLAL_CHECK_MAIN( XLALVectorAddREAL4( fgrid2F, fgrid2F, cgrid2F, finegrid.freqlength ) == XLAL_SUCCESS, XLAL_EFUNC );
 #ifndef EXP_NO_NUM_COUNT
-                  fgridnc[0] += (TwoFthreshold < cgrid2F[0]);
-                  fgridnc++;
+                XLAL_CHECK_MAIN( XLALVectorCountGreaterREAL4( fgridnc, TwoFthreshold, cgrid2F, finegrid.freqlength ) == XLAL_SUCCESS, XLAL_EFUNC );
 #endif // EXP_NO_NUM_COUNT
-                  fgrid2F++;
-                  cgrid2F++;
-                }
                 if ( uvar_computeBSGL ) {
                   for (UINT4 X = 0; X < finegrid.numDetectors; X++) {
                     REAL4 * cgrid2FX = coarsegrid.TwoFX + CG_FX_INDEX(coarsegrid, X, k, U1idx);
                     REAL4 * fgrid2FX = finegrid.sumTwoFX + FG_FX_INDEX(finegrid, X, 0);
-                    for(UINT4 ifreq_fg=0; ifreq_fg < finegrid.freqlength; ifreq_fg++) {
-                      fgrid2FX[0] += cgrid2FX[0];
-                      fgrid2FX++;
-                      cgrid2FX++;
-                    }
+                    XLAL_CHECK_MAIN( XLALVectorAddREAL4( fgrid2FX, fgrid2FX, cgrid2FX, finegrid.freqlength ) == XLAL_SUCCESS, XLAL_EFUNC );
                   }
                 }
 
-
                 if ( uvar_getMaxFperSeg ) {
-                  cgrid2F = coarsegrid.TwoF + CG_INDEX(coarsegrid, k, U1idx);
                   REAL4 * fgridMax2Fl = finegrid.maxTwoFl + FG_INDEX(finegrid, 0);
                   UINT4 * fgrid2FmaxIdx = finegrid.maxTwoFlIdx + FG_INDEX(finegrid, 0);
-                  int isLouder;
-                  for (UINT4 ifreq_fg=0; ifreq_fg < finegrid.freqlength; ifreq_fg++) {
-                    isLouder=(fgridMax2Fl[0] <= cgrid2F[0]);
-                    fgridMax2Fl[0] = fmaxf ( fgridMax2Fl[0], cgrid2F[0] );
-                    fgrid2FmaxIdx[0]= isLouder*k + (1-isLouder)*fgrid2FmaxIdx[0];
-                    fgridMax2Fl++;
-                    fgrid2FmaxIdx++;
-                    cgrid2F++;
-                  }
+                  XLAL_CHECK_MAIN( XLALVectorMaxTrackREAL4( fgridMax2Fl, fgrid2FmaxIdx, cgrid2F, k, finegrid.freqlength ) == XLAL_SUCCESS, XLAL_EFUNC );
                   for (UINT4 X = 0; X < finegrid.numDetectors; X++) {
                     REAL4 * cgrid2FX = coarsegrid.TwoFX + CG_FX_INDEX(coarsegrid, X, k, U1idx);
                     REAL4 * fgridMax2FXl = finegrid.maxTwoFXl + FG_FX_INDEX(finegrid, X, 0);
                     UINT4 * fgrid2FXmaxIdx = finegrid.maxTwoFXlIdx + FG_FX_INDEX(finegrid,X, 0);
-
-                    for(UINT4 ifreq_fg=0; ifreq_fg < finegrid.freqlength; ifreq_fg++) {
-                      isLouder=(fgridMax2FXl[0] <= cgrid2FX[0]);
-                      fgridMax2FXl[0] = fmaxf ( fgridMax2FXl[0], cgrid2FX[0] );
-                      fgrid2FXmaxIdx[0] = isLouder*k + (1-isLouder)*fgrid2FXmaxIdx[0];
-                      fgrid2FXmaxIdx++;
-                      fgridMax2FXl++;
-                      cgrid2FX++;
-                    }
+                    XLAL_CHECK_MAIN( XLALVectorMaxTrackREAL4( fgridMax2FXl, fgrid2FXmaxIdx, cgrid2FX, k, finegrid.freqlength ) == XLAL_SUCCESS, XLAL_EFUNC );
                   }
                 }
-#endif // GC_SSE2_OPT
                 time_SumFine += ( GETTIME() - tic_SumFine );
 
               } /* end: ------------- MAIN LOOP over Segments --------------------*/
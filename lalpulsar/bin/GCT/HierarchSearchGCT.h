@@ -145,11 +145,7 @@ extern "C" {
 
 
   /** structure for storing fine-grid points */
-#ifdef GC_SSE2_OPT
-#define FINEGRID_NC_T UCHAR
-#else
 #define FINEGRID_NC_T UINT4
-#endif
   typedef struct tagFineGrid {
     REAL8 freqmin_fg;       /**< fine-grid start in frequency */
     REAL8 dfreq_fg;         /**< fine-grid spacing in frequency */
@@ -72,18 +72,15 @@ INT4 verbose=0;
 
 int main(int argc, char *argv[]){
   InputParams inputParams;
-  HeterodyneParams hetParams;
 
-  Filters iirFilters;
+  HeterodynePulsar *pulsars=NULL; /* pulsars heterodyned from the same data */
+  UINT4 numPulsars=0;
 
   LALFILE *fpin=NULL;
-  FILE *fpout=NULL;
   LALCache *cache=NULL;
   INT4 count=0;
 
-  CHAR outputfile[256]="";
   CHAR channel[128]="";
-  const CHAR *psrname;
 
   INT4Vector *starts=NULL, *stops=NULL; /* science segment start and stop times */
   INT4 numSegs=0;
@@ -91,6 +88,9 @@ int main(int argc, char *argv[]){
 
   FilterResponse *filtresp=NULL; /* variable for the filter response function */
 
+  EphemerisData *edat=NULL; /* ephemeris data shared by all pulsars */
+  TimeCorrectionData *tdat=NULL; /* Einstein delay look-up table shared by all pulsars */
+
   /* set error handler */
   XLALSetErrorHandler(XLALAbortErrorHandler);
 
@@ -103,124 +103,67 @@ int main(int argc, char *argv[]){
 
   if( inputParams.verbose ) verbose=1;
 
-  hetParams.heterodyneflag = inputParams.heterodyneflag; /* set type of heterodyne */
-
-  /* read in pulsar data */
-  hetParams.het = XLALReadTEMPOParFile( inputParams.paramfile );
-  hetParams.hetUpdate = NULL;
-  hetParams.outputPhase = inputParams.outputPhase;
+  if(inputParams.heterodyneflag == 1 || inputParams.heterodyneflag == 2 ||
+    inputParams.heterodyneflag == 4 ){
+    if(inputParams.filterknee == 0.){
+      fprintf(stderr, "REMINDER: You aren't giving a filter knee frequency from\
+ the coarse heterodyne stage! You could be reheterodyning data that has\
+ already had the filter response removed, but are you sure this is what you're\
+ doing?\n");
+    }
 
-  /* set pulsar name - take from par file if available, or if not get from command line args */
-  if( PulsarCheckParam( hetParams.het, "PSRJ" ) )
-    psrname = PulsarGetStringParam( hetParams.het, "PSRJ" );
-  else if( PulsarCheckParam( hetParams.het, "PSRB" ) )
-    psrname = PulsarGetStringParam( hetParams.het, "PSRB" );
-  else if( PulsarCheckParam( hetParams.het, "NAME" ) )
-    psrname = PulsarGetStringParam( hetParams.het, "NAME" );
-  else if( PulsarCheckParam( hetParams.het, "PSR" ) )
-    psrname = PulsarGetStringParam( hetParams.het, "PSR" );
-  else{
-    fprintf(stderr, "No pulsar name specified!\n");
-    exit(0);
-  }
+    /* calculate the frequency and phase response of the filter used in the
+       coarse heterodyne */
+    filtresp = create_filter_response( inputParams.filterknee );
 
-  /* if there is an epoch given manually (i.e. not from the pulsar parameter
-     file) then set it here and overwrite any other value - this is used, for
-     example, with the pulsar hardware injections in which this should be set
-     at 751680013.0 */
-  if(inputParams.manualEpoch != 0.){
-    PulsarSetParam( hetParams.het, "PEPOCH", &inputParams.manualEpoch );
-    PulsarSetParam( hetParams.het, "POSEPOCH", &inputParams.manualEpoch );
+    /* reset the filter knee to zero so the filtering is not performed on the
+       fine heterodyned data*/
+    inputParams.filterknee = 0.;
   }
 
-  if(verbose){
-    fprintf(stderr, "I've read in the pulsar parameters for %s.\n", psrname);
-    REAL8 rav, decv, pepochv;
-    if ( PulsarCheckParam( hetParams.het, "RAJ" ) ){ rav = PulsarGetREAL8Param( hetParams.het, "RAJ" ); }
-    else { rav = PulsarGetREAL8ParamOrZero( hetParams.het, "RA" ); }
-
-    if ( PulsarCheckParam( hetParams.het, "DECJ" ) ){ decv = PulsarGetREAL8Param( hetParams.het, "DECJ" ); }
-    else { decv = PulsarGetREAL8ParamOrZero( hetParams.het, "DEC" ); }
+  /* set up the pulsars to heterodyne - either a single pulsar given on the
+     command line, or a list of pulsars which are all heterodyned from a single
+     pass through the frame data */
+  if( inputParams.pulsarlist[0] != '\0' ){
+    CHAR **paramfiles=NULL, **outputfiles=NULL;
 
-    fprintf(stderr, "alpha = %lf rads, delta = %lf rads.\n", rav, decv);
+    numPulsars = get_pulsar_list(&paramfiles, &outputfiles, inputParams.pulsarlist);
 
-    if ( PulsarCheckParam( hetParams.het, "F" ) ) {
-      const REAL8Vector *freqsv = PulsarGetREAL8VectorParam( hetParams.het, "F" );
-      UINT4 i = 0;
+    if( (pulsars = XLALCalloc(numPulsars, sizeof(HeterodynePulsar))) == NULL )
+      {  XLALPrintError("Error allocating pulsar memory.\n");  }
 
-      pepochv = PulsarGetREAL8ParamOrZero( hetParams.het, "PEPOCH" );
-      for ( i=0; i<freqsv->length; i++ ){ fprintf(stderr, "f%u = %.1e Hz/s^%u, ", i, freqsv->data[i], i); }
-      fprintf(stderr, "epoch = %.1lf.\n", pepochv);
+    for( UINT4 n=0; n<numPulsars; n++ ){
+      set_pulsar(&pulsars[n], &inputParams, paramfiles[n], outputfiles[n], argc, argv);
+      XLALFree( paramfiles[n] );
+      XLALFree( outputfiles[n] );
     }
+    XLALFree( paramfiles );
+    XLALFree( outputfiles );
 
-    fprintf(stderr, "I'm looking for gravitational waves at %.2lf times the pulsars spin frequency.\n", inputParams.freqfactor);
+    if(verbose){  fprintf(stderr, "I've set up %u pulsars to heterodyne.\n", numPulsars);  }
   }
+  else{
+    numPulsars = 1;
 
-  /*if performing fine heterdoyne using same params as coarse */
-  if(inputParams.heterodyneflag == 1 || inputParams.heterodyneflag == 3)
-    hetParams.hetUpdate = hetParams.het;
-
-  hetParams.samplerate = inputParams.samplerate;
-
-  /* set detector */
-  hetParams.detector = *XLALGetSiteInfo( inputParams.ifo );
-
-  if(verbose){  fprintf(stderr, "I've set the detector location for %s.\n", inputParams.ifo); }
-
-  if(inputParams.heterodyneflag == 2 || inputParams.heterodyneflag == 4){ /* if updating parameters read in updated par file */
-    hetParams.hetUpdate = XLALReadTEMPOParFile( inputParams.paramfileupdate );
-
-    /* if there is an epoch given manually (i.e. not from the pulsar parameter
-       file) then set it here and overwrite any other value */
-    if(inputParams.manualEpoch != 0.){
-      PulsarSetParam( hetParams.hetUpdate, "PEPOCH", &inputParams.manualEpoch );
-      PulsarSetParam( hetParams.hetUpdate, "POSEPOCH", &inputParams.manualEpoch );
-    }
-
-    if(verbose){
-      fprintf(stderr, "I've read the updated parameters for %s.\n", psrname);
-
-      REAL8 rav, decv, pepochv;
-      if ( PulsarCheckParam( hetParams.hetUpdate, "RAJ" ) ){ rav = PulsarGetREAL8Param( hetParams.hetUpdate, "RAJ" ); }
-      else { rav = PulsarGetREAL8ParamOrZero( hetParams.hetUpdate, "RA" ); }
-
-      if ( PulsarCheckParam( hetParams.hetUpdate, "DECJ" ) ){ decv = PulsarGetREAL8Param( hetParams.hetUpdate, "DECJ" ); }
-      else { decv = PulsarGetREAL8ParamOrZero( hetParams.hetUpdate, "DEC" ); }
-
-      fprintf(stderr, "alpha = %lf rads, delta = %lf rads.\n", rav, decv);
-
-      if ( PulsarCheckParam( hetParams.hetUpdate, "F" ) ) {
-        const REAL8Vector *freqsv = PulsarGetREAL8VectorParam( hetParams.hetUpdate, "F" );
-        UINT4 i = 0;
+    if( (pulsars = XLALCalloc(numPulsars, sizeof(HeterodynePulsar))) == NULL )
+      {  XLALPrintError("Error allocating pulsar memory.\n");  }
 
-        pepochv = PulsarGetREAL8ParamOrZero( hetParams.hetUpdate, "PEPOCH" );
-        for ( i=0; i<freqsv->length; i++ ){ fprintf(stderr, "f%u = %.1e Hz/s^%u, ", i, freqsv->data[i], i); }
-        fprintf(stderr, "epoch = %.1lf.\n", pepochv);
-      }
-    }
+    set_pulsar(&pulsars[0], &inputParams, inputParams.paramfile, inputParams.outputfile, argc, argv);
   }
 
+  /* read in the ephemeris files (and Einstein delay look-up table) once, and
+     share them between all pulsars and all stretches of data */
   if( inputParams.heterodyneflag > 0 ){
-    snprintf(hetParams.earthfile, sizeof(hetParams.earthfile), "%s",
-      inputParams.earthfile);
-    snprintf(hetParams.sunfile, sizeof(hetParams.sunfile), "%s",
-      inputParams.sunfile);
-
-    if( inputParams.timeCorrFile != NULL ){
-      hetParams.timeCorrFile = XLALStringDuplicate( inputParams.timeCorrFile );
+    XLAL_CHECK_MAIN( (edat = XLALInitBarycenter( inputParams.earthfile, inputParams.sunfile )) != NULL, XLAL_EFUNC );
 
-      if ( PulsarCheckParam( hetParams.hetUpdate, "UNITS" ) ){
-        if ( !strcmp( PulsarGetStringParam( hetParams.hetUpdate, "UNITS" ), "TDB" ) )
-          hetParams.ttype = TIMECORRECTION_TDB; /* use TDB units i.e. TEMPO standard */
-        else
-          hetParams.ttype = TIMECORRECTION_TCB; /* default to TCB i.e. TEMPO2 standard */
+    for( UINT4 n=0; n<numPulsars; n++ ){
+      if ( pulsars[n].hetParams.ttype != TIMECORRECTION_ORIGINAL ){
+        if ( tdat == NULL ){
+          XLAL_CHECK_MAIN( (tdat = XLALInitTimeCorrections( inputParams.timeCorrFile )) != NULL, XLAL_EFUNC );
+        }
+        pulsars[n].hetParams.tdat = tdat;
       }
-      else /* don't recognise units type, so default to the original code */
-        hetParams.ttype = TIMECORRECTION_ORIGINAL;
-    }
-    else{
-      hetParams.timeCorrFile = NULL;
-      hetParams.ttype = TIMECORRECTION_ORIGINAL;
+      pulsars[n].hetParams.edat = edat;
     }
   }
 
@@ -247,87 +190,8 @@ data!\n");
     if(verbose){  fprintf(stderr, "I've read in the frame list.\n");  }
   }
 
-  if(inputParams.heterodyneflag == 1 || inputParams.heterodyneflag == 2 ||
-    inputParams.heterodyneflag == 4 ){
-    if(inputParams.filterknee == 0.){
-      fprintf(stderr, "REMINDER: You aren't giving a filter knee frequency from\
- the coarse heterodyne stage! You could be reheterodyning data that has\
- already had the filter response removed, but are you sure this is what you're\
- doing?\n");
-    }
-
-    /* calculate the frequency and phase response of the filter used in the
-       coarse heterodyne */
-    filtresp = create_filter_response( inputParams.filterknee );
-
-    /* reset the filter knee to zero so the filtering is not performed on the
-       fine heterodyned data*/
-    inputParams.filterknee = 0.;
-  }
-
   /************************BIT THAT DOES EVERYTHING****************************/
 
-  /* set filters - values held for the whole data set so we don't get lots of
-     glitches from the filter ringing */
-  if(inputParams.filterknee > 0.0){
-    set_filters(&iirFilters, inputParams.filterknee, inputParams.samplerate);
-    if(verbose){  fprintf(stderr, "I've set up the filters.\n");  }
-  }
-
-  /* set output file */
-  snprintf(outputfile, sizeof(outputfile), "%s", inputParams.outputfile);
-
-  // check if output should be gzipped due to ".gz" suffix on file name */
-  if ( XLALStringCaseSubstring( outputfile, ".gz" ) != NULL ){
-    if ( inputParams.binaryoutput ){
-      XLALPrintError("Error... do not use a \".gz\" file extension for a binary output file\n");
-    }
-
-    inputParams.gzipoutput = 1;
-    // remove ".gz" suffix
-    CHAR *strloc = XLALStringCaseSubstring( outputfile, ".gz" );
-    strloc[0] = '\0';
-  }
-
-  /* add header to the files: header information will be a string consisting of several lines starting with %%s.
-   *  - the first line will contain the time and date of the file creation
-   *  - the next set of lines will contain the version and git hash of the lalsuite versions
-   *  - the penulimate line will contain the command line inputs used to create the file
-   *  - the final will contain headers for the three columns in the file: GPS time, Real, Imag */
-  if( (fpout = fopen(outputfile, "w")) == NULL ){
-    fprintf(stderr, "Error... can't open output file %s!\n", outputfile);
-    return 0;
-  }
-
-  CHAR *headerinfo = XLALStringDuplicate("%% File created on ");
-  headerinfo = XLALStringAppend(headerinfo, LogTimeToString( XLALGetTimeOfDay() ));
-  headerinfo = XLALStringAppend(headerinfo, "\n");
-  headerinfo = XLALStringAppend(headerinfo, XLALVCSInfoString( lalPulsarVCSInfoList, 0, "%% " ) );
-  headerinfo = XLALStringAppend(headerinfo, "%% ");
-  for ( INT4 j=0; j<argc; j++ ) {
-    headerinfo = XLALStringAppend(headerinfo, argv[j]);
-    headerinfo = XLALStringAppend(headerinfo, " ");
-  }
-  CHAR dataline[] = "\n%% GPS time\tReal\tImag\n";
-  if ( strlen(headerinfo)+strlen(dataline) > HEADERSIZE ) {
-    fprintf(stderr, "Error... HEADERSIZE needs to be increased to accommodate information\n");
-    return 0;
-  }
-  else{
-    /* fill in rest of string with whitespace */
-    for ( INT4 j=strlen(headerinfo); j<HEADERSIZE; j++ ){ headerinfo = XLALStringAppend(headerinfo, " "); }
-    memcpy(&headerinfo[HEADERSIZE-strlen(dataline)], &dataline[0], sizeof(CHAR)*strlen(dataline));
-
-    /* output the header to the file */
-    size_t rc = fwrite(&headerinfo[0], sizeof(CHAR), HEADERSIZE, fpout);
-    if ( ferror(fpout) || !rc ){
-      fprintf(stderr, "Error... problem writing out header data!\n");
-      exit(1);
-    }
-  }
-  XLALFree( headerinfo );
-  fclose(fpout);
-
   snprintf(channel, sizeof(channel), "%s", inputParams.channel);
 
   #if TRACKMEMUSE
@@ -343,7 +207,6 @@ data!\n");
      as it should be significantly downsampled */
   do{
     COMPLEX16TimeSeries *data=NULL; /* data for heterodyning */
-    COMPLEX16TimeSeries *resampData=NULL; /* resampled data */
     REAL8Vector *times=NULL; /*times of data read from coarse heterodyne file*/
     INT4 i;
 
@@ -353,10 +216,6 @@ data!\n");
       INT4 duration;
       REAL8TimeSeries *datareal=NULL;
       LALCache *smalllist=NULL; /* list of frame files for a science segment */
-      LIGOTimeGPS epochdummy;
-
-      epochdummy.gpsSeconds = 0;
-      epochdummy.gpsNanoSeconds = 0;
 
       /* if the seg list has segment before the start time of the available
          data frame then increment the segment and continue */
@@ -376,8 +235,6 @@ data!\n");
       fprintf(stderr, "Getting data between %d and %d.\n", starts->data[count],
         starts->data[count]+duration);
 
-      hetParams.timestamp = (REAL8)starts->data[count];
-      hetParams.length = inputParams.samplerate * duration;
       gpstime = (REAL8)starts->data[count];
 
       /* if there was no frame file for that segment move on */
@@ -397,13 +254,7 @@ data!\n");
         }
       }
 
-      /* make vector (make sure imaginary parts are set to zero) */
-      if( (data = XLALCreateCOMPLEX16TimeSeries( "", &epochdummy,
-        PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ), 1./inputParams.samplerate, &lalSecondUnit,
-        (INT4)inputParams.samplerate * duration )) == NULL )
-        {  XLALPrintError("Error allocating data memory.\n");  }
-
-      /* read in frame data */
+      /* read in frame data - this is done once and shared by all pulsars */
       if( (datareal = get_frame_data(smalllist, channel, gpstime,
         inputParams.samplerate * duration, duration, inputParams.samplerate,
         inputParams.scaleFac, inputParams.highPass)) == NULL ){
@@ -413,14 +264,11 @@ data!\n");
         if( count < numSegs ){
           count++;/*if not finished reading in all data try next set of frames*/
 
-          XLALDestroyCOMPLEX16TimeSeries( data );
-
           XLALDestroyCache( smalllist );
 
           continue;
         }
         else{
-          XLALDestroyCOMPLEX16TimeSeries( data );
           break; /* if at the end of data anyway then break */
         }
       }
@@ -428,16 +276,41 @@ data!\n");
       /* if any data has successfully been read-in set flag to 0 */
       nodata = 0;
 
-      /* put data into COMPLEX16 vector and set imaginary parts to zero */
-      for( i=0;i<inputParams.samplerate * duration;i++ ){
-        data->data->data[i] = (REAL8)datareal->data->data[i];
-      }
-
-      XLALDestroyREAL8TimeSeries( datareal );
-
       XLALDestroyCache( smalllist );
 
       count++;
+
+      /* heterodyne the data for each pulsar, spreading the pulsars between threads */
+#pragma omp parallel for schedule(dynamic, 1)
+      for( INT4 n=0; n<(INT4)numPulsars; n++ ){
+        HeterodynePulsar *pulsar = &pulsars[n];
+        COMPLEX16TimeSeries *psrdata=NULL;
+        LIGOTimeGPS epochdummy;
+
+        /* error handlers are set per thread */
+        XLALSetErrorHandler(XLALAbortErrorHandler);
+
+        epochdummy.gpsSeconds = 0;
+        epochdummy.gpsNanoSeconds = 0;
+
+        pulsar->hetParams.timestamp = gpstime;
+        pulsar->hetParams.length = inputParams.samplerate * duration;
+
+        /* make vector (make sure imaginary parts are set to zero) */
+        if( (psrdata = XLALCreateCOMPLEX16TimeSeries( "", &epochdummy,
+          PulsarGetREAL8VectorParamIndividual( pulsar->hetParams.het, "F0" ), 1./inputParams.samplerate, &lalSecondUnit,
+          (INT4)inputParams.samplerate * duration )) == NULL )
+          {  XLALPrintError("Error allocating data memory.\n");  }
+
+        /* put data into COMPLEX16 vector and set imaginary parts to zero */
+        for( INT4 j=0;j<inputParams.samplerate * duration;j++ ){
+          psrdata->data->data[j] = (REAL8)datareal->data->data[j];
+        }
+
+        heterodyne_chunk(pulsar, psrdata, NULL, &inputParams, starts, stops, filtresp);
+      }
+
+      XLALDestroyREAL8TimeSeries( datareal );
     }
     else if( inputParams.heterodyneflag == 1 ||
       inputParams.heterodyneflag == 2 ||inputParams.heterodyneflag == 4 ){
@@ -449,7 +322,7 @@ data!\n");
       epochdummy.gpsNanoSeconds = 0;
 
       if( (data = XLALCreateCOMPLEX16TimeSeries( "", &epochdummy,
-        PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ), 1./inputParams.samplerate, &lalSecondUnit, 1))
+        PulsarGetREAL8VectorParamIndividual( pulsars[0].hetParams.het, "F0" ), 1./inputParams.samplerate, &lalSecondUnit, 1))
           == NULL || (times = XLALCreateREAL8Vector( 1 )) == NULL )
         {  XLALPrintError("Error allocating memory for data.\n");  }
       i=0;
@@ -558,190 +431,453 @@ data!\n");
 
       XLALFileClose(fpin);
 
-      hetParams.timestamp = times->data[0]; /* set initial time stamp */
+      pulsars[0].hetParams.timestamp = times->data[0]; /* set initial time stamp */
 
       /* resize vector to actual size */
       if( (data = XLALResizeCOMPLEX16TimeSeries( data, 0, i )) == NULL ||
           (times = XLALResizeREAL8Vector(times, i)) == NULL )
         {  XLALPrintError("Error resizing data memory.\n");  }
-      hetParams.length = i;
+      pulsars[0].hetParams.length = i;
 
       if( verbose ) fprintf(stderr, "I've read in the fine heterodyne data.\n");
+
+      heterodyne_chunk(&pulsars[0], data, times, &inputParams, starts, stops, filtresp);
     }
     else{
       fprintf(stderr, "Error... Heterodyne flag = %d, should be 0, 1, 2, 3 or 4.\n", inputParams.heterodyneflag);
       return 0;
     }
+  }while( count < numSegs && (inputParams.heterodyneflag==0 || inputParams.heterodyneflag==3) );
 
-    XLALGPSSetREAL8(&data->epoch, hetParams.timestamp);
+  /* check if any data has been read - if not exit with an error */
+  if ( nodata && (inputParams.heterodyneflag==0 || inputParams.heterodyneflag==3) ){
+    fprintf(stderr, "Error... no data was read in.\n");
+    exit(1);
+  }
 
-    /* heterodyne data */
-    heterodyne_data(data, times, hetParams, inputParams.freqfactor, filtresp);
-    if( verbose ){ fprintf(stderr, "I've heterodyned the data.\n"); }
+  /* check whether to gzip the output */
+  for( UINT4 n=0; n<numPulsars; n++ ){
+    if ( !inputParams.binaryoutput && pulsars[n].gzipoutput ){
+      fprintf(stderr, "Outputing %s to gzipped file\n", pulsars[n].outputfile);
+      if ( XLALGzipTextFile(pulsars[n].outputfile) != XLAL_SUCCESS ){ // gzip it
+        XLALPrintError("Error... problem gzipping the output file.\n");
+      }
+    }
+  }
 
-    /* filter data */
-    if( inputParams.filterknee > 0. ){/* filter if knee frequency is not zero */
-      filter_data(data, &iirFilters);
+  #if TRACKMEMUSE
+    fprintf(stderr, "Memory usage after completion of main loop:\n"); printmemuse();
+  #endif
+
+  fprintf(stderr, "Heterodyning complete.\n");
+
+  XLALDestroyINT4Vector( stops );
+  XLALDestroyINT4Vector( starts );
+
+  if( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3){
+    XLALDestroyCache(cache);
+  }
 
-      if( verbose ){  fprintf(stderr, "I've low pass filtered the data at %.2lf Hz\n", inputParams.filterknee);  }
+  for( UINT4 n=0; n<numPulsars; n++ ){
+    if( inputParams.filterknee > 0. ){
+      XLALDestroyREAL8IIRFilter( pulsars[n].iirFilters.filter1Re );
+      XLALDestroyREAL8IIRFilter( pulsars[n].iirFilters.filter1Im );
+      XLALDestroyREAL8IIRFilter( pulsars[n].iirFilters.filter2Re );
+      XLALDestroyREAL8IIRFilter( pulsars[n].iirFilters.filter2Im );
+      XLALDestroyREAL8IIRFilter( pulsars[n].iirFilters.filter3Re );
+      XLALDestroyREAL8IIRFilter( pulsars[n].iirFilters.filter3Im );
     }
 
-    if( inputParams.heterodyneflag==0 || inputParams.heterodyneflag==3 )
-      if( (times = XLALCreateREAL8Vector( data->data->length )) == NULL )
-        XLALPrintError("Error creating vector of data times.\n");
+    PulsarFreeParams( pulsars[n].hetParams.het );
+    if ( inputParams.heterodyneflag == 2 || inputParams.heterodyneflag == 4 ){ PulsarFreeParams( pulsars[n].hetParams.hetUpdate ); }
+    XLALFree( pulsars[n].hetParams.timeCorrFile );
+  }
+  if( inputParams.filterknee > 0. && verbose ){ fprintf(stderr, "I've destroyed all filters.\n"); }
+  XLALFree( pulsars );
 
-    /* resample data and data times */
-    resampData = resample_data(data, times, starts, stops,
-      inputParams.samplerate, inputParams.resamplerate,
-      inputParams.heterodyneflag);
-    if( verbose ){  fprintf(stderr, "I've resampled the data from %.2lf to %.4lf Hz\n", inputParams.samplerate, inputParams.resamplerate);  }
+  if ( filtresp != NULL ){ destroy_filter_response( filtresp ); }
 
-    XLALDestroyCOMPLEX16TimeSeries( data );
+  XLALDestroyEphemerisData( edat );
+  XLALDestroyTimeCorrectionData( tdat );
 
-    /*perform outlier removal twice incase very large outliers skew the stddev*/
-    if( inputParams.stddevthresh != 0. ){
-      INT4 numOutliers=0;
-      numOutliers = remove_outliers(resampData, times,
-        inputParams.stddevthresh);
-      if( verbose ){
-        fprintf(stderr, "I've removed %lf%% of data above the threshold %.1lf sigma for 1st time.\n",
-          100.*(double)numOutliers/(double)resampData->data->length,
-          inputParams.stddevthresh);
-      }
+  #if TRACKMEMUSE
+    fprintf(stderr, "Memory use at the end of the code:\n"); printmemuse();
+  #endif
+
+  return 0;
+}
+
+/* function to read in a pulsar parameter file and set up the heterodyne,
+   filters and output file for that pulsar */
+void set_pulsar(HeterodynePulsar *pulsar, InputParams *inputParams,
+  const CHAR *paramfile, const CHAR *outputfile, int argc, char *argv[]){
+  HeterodyneParams *hetParams = &pulsar->hetParams;
+  FILE *fpout=NULL;
+
+  hetParams->heterodyneflag = inputParams->heterodyneflag; /* set type of heterodyne */
+
+  /* read in pulsar data */
+  hetParams->het = XLALReadTEMPOParFile( paramfile );
+  hetParams->hetUpdate = NULL;
+  hetParams->outputPhase = inputParams->outputPhase;
+
+  /* set pulsar name - take from par file if available, or if not get from command line args */
+  if( PulsarCheckParam( hetParams->het, "PSRJ" ) )
+    pulsar->psrname = PulsarGetStringParam( hetParams->het, "PSRJ" );
+  else if( PulsarCheckParam( hetParams->het, "PSRB" ) )
+    pulsar->psrname = PulsarGetStringParam( hetParams->het, "PSRB" );
+  else if( PulsarCheckParam( hetParams->het, "NAME" ) )
+    pulsar->psrname = PulsarGetStringParam( hetParams->het, "NAME" );
+  else if( PulsarCheckParam( hetParams->het, "PSR" ) )
+    pulsar->psrname = PulsarGetStringParam( hetParams->het, "PSR" );
+  else{
+    fprintf(stderr, "No pulsar name specified!\n");
+    exit(0);
+  }
+
+  /* if there is an epoch given manually (i.e. not from the pulsar parameter
+     file) then set it here and overwrite any other value - this is used, for
+     example, with the pulsar hardware injections in which this should be set
+     at 751680013.0 */
+  if(inputParams->manualEpoch != 0.){
+    PulsarSetParam( hetParams->het, "PEPOCH", &inputParams->manualEpoch );
+    PulsarSetParam( hetParams->het, "POSEPOCH", &inputParams->manualEpoch );
+  }
+
+  if(verbose){
+    fprintf(stderr, "I've read in the pulsar parameters for %s.\n", pulsar->psrname);
+    REAL8 rav, decv, pepochv;
+    if ( PulsarCheckParam( hetParams->het, "RAJ" ) ){ rav = PulsarGetREAL8Param( hetParams->het, "RAJ" ); }
+    else { rav = PulsarGetREAL8ParamOrZero( hetParams->het, "RA" ); }
+
+    if ( PulsarCheckParam( hetParams->het, "DECJ" ) ){ decv = PulsarGetREAL8Param( hetParams->het, "DECJ" ); }
+    else { decv = PulsarGetREAL8ParamOrZero( hetParams->het, "DEC" ); }
+
+    fprintf(stderr, "alpha = %lf rads, delta = %lf rads.\n", rav, decv);
+
+    if ( PulsarCheckParam( hetParams->het, "F" ) ) {
+      const REAL8Vector *freqsv = PulsarGetREAL8VectorParam( hetParams->het, "F" );
+      UINT4 i = 0;
+
+      pepochv = PulsarGetREAL8ParamOrZero( hetParams->het, "PEPOCH" );
+      for ( i=0; i<freqsv->length; i++ ){ fprintf(stderr, "f%u = %.1e Hz/s^%u, ", i, freqsv->data[i], i); }
+      fprintf(stderr, "epoch = %.1lf.\n", pepochv);
     }
 
-    /* calibrate */
-    if( inputParams.calibrate ){
-      calibrate(resampData, times, inputParams.calibfiles,
-        inputParams.freqfactor*PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ), inputParams.channel);
-      if( verbose ){ fprintf(stderr, "I've calibrated the data at %.1lf Hz\n", inputParams.freqfactor*PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ));  }
-    }
-
-    /* remove outliers above our threshold */
-    if( inputParams.stddevthresh != 0. ){
-      INT4 numOutliers = 0;
-      numOutliers = remove_outliers(resampData, times,
-        inputParams.stddevthresh);
-      if( verbose ){
-        fprintf(stderr, "I've removed %lf%% of data above the threshold %.1lf sigma for 2nd time.\n",
-          100.*(double)numOutliers/(double)resampData->data->length,
-          inputParams.stddevthresh);
+    fprintf(stderr, "I'm looking for gravitational waves at %.2lf times the pulsars spin frequency.\n", inputParams->freqfactor);
+  }
+
+  /*if performing fine heterdoyne using same params as coarse */
+  if(inputParams->heterodyneflag == 1 || inputParams->heterodyneflag == 3)
+    hetParams->hetUpdate = hetParams->het;
+
+  hetParams->samplerate = inputParams->samplerate;
+
+  /* set detector */
+  hetParams->detector = *XLALGetSiteInfo( inputParams->ifo );
+
+  if(verbose){  fprintf(stderr, "I've set the detector location for %s.\n", inputParams->ifo); }
+
+  if(inputParams->heterodyneflag == 2 || inputParams->heterodyneflag == 4){ /* if updating parameters read in updated par file */
+    hetParams->hetUpdate = XLALReadTEMPOParFile( inputParams->paramfileupdate );
+
+    /* if there is an epoch given manually (i.e. not from the pulsar parameter
+       file) then set it here and overwrite any other value */
+    if(inputParams->manualEpoch != 0.){
+      PulsarSetParam( hetParams->hetUpdate, "PEPOCH", &inputParams->manualEpoch );
+      PulsarSetParam( hetParams->hetUpdate, "POSEPOCH", &inputParams->manualEpoch );
+    }
+
+    if(verbose){
+      fprintf(stderr, "I've read the updated parameters for %s.\n", pulsar->psrname);
+
+      REAL8 rav, decv, pepochv;
+      if ( PulsarCheckParam( hetParams->hetUpdate, "RAJ" ) ){ rav = PulsarGetREAL8Param( hetParams->hetUpdate, "RAJ" ); }
+      else { rav = PulsarGetREAL8ParamOrZero( hetParams->hetUpdate, "RA" ); }
+
+      if ( PulsarCheckParam( hetParams->hetUpdate, "DECJ" ) ){ decv = PulsarGetREAL8Param( hetParams->hetUpdate, "DECJ" ); }
+      else { decv = PulsarGetREAL8ParamOrZero( hetParams->hetUpdate, "DEC" ); }
+
+      fprintf(stderr, "alpha = %lf rads, delta = %lf rads.\n", rav, decv);
+
+      if ( PulsarCheckParam( hetParams->hetUpdate, "F" ) ) {
+        const REAL8Vector *freqsv = PulsarGetREAL8VectorParam( hetParams->hetUpdate, "F" );
+        UINT4 i = 0;
+
+        pepochv = PulsarGetREAL8ParamOrZero( hetParams->hetUpdate, "PEPOCH" );
+        for ( i=0; i<freqsv->length; i++ ){ fprintf(stderr, "f%u = %.1e Hz/s^%u, ", i, freqsv->data[i], i); }
+        fprintf(stderr, "epoch = %.1lf.\n", pepochv);
       }
     }
+  }
+
+  if( inputParams->heterodyneflag > 0 ){
+    snprintf(hetParams->earthfile, sizeof(hetParams->earthfile), "%s",
+      inputParams->earthfile);
+    snprintf(hetParams->sunfile, sizeof(hetParams->sunfile), "%s",
+      inputParams->sunfile);
 
-    /* output data */
-    if( inputParams.binaryoutput ){
-      if((fpout = fopen(outputfile, "ab"))==NULL){
-        fprintf(stderr, "Error... can't open output file %s!\n", outputfile);
-        return 0;
+    if( inputParams->timeCorrFile != NULL ){
+      hetParams->timeCorrFile = XLALStringDuplicate( inputParams->timeCorrFile );
+
+      if ( PulsarCheckParam( hetParams->hetUpdate, "UNITS" ) ){
+        if ( !strcmp( PulsarGetStringParam( hetParams->hetUpdate, "UNITS" ), "TDB" ) )
+          hetParams->ttype = TIMECORRECTION_TDB; /* use TDB units i.e. TEMPO standard */
+        else
+          hetParams->ttype = TIMECORRECTION_TCB; /* default to TCB i.e. TEMPO2 standard */
       }
+      else /* don't recognise units type, so default to the original code */
+        hetParams->ttype = TIMECORRECTION_ORIGINAL;
     }
     else{
-      if( (fpout = fopen(outputfile, "a")) == NULL ){
-        fprintf(stderr, "Error... can't open output file %s!\n", outputfile);
-        return 0;
-      }
+      hetParams->timeCorrFile = NULL;
+      hetParams->ttype = TIMECORRECTION_ORIGINAL;
     }
+  }
 
-    /* buffer the output, so that file system is not thrashed when outputing */
-    /* buffer will be 1Mb */
-    if( setvbuf(fpout, NULL, _IOFBF, 0x100000) ){ fprintf(stderr, "Warning: Unable to set output file buffer!"); }
+  /* ephemeris data is read in by heterodyne_data unless shared between pulsars */
+  hetParams->edat = NULL;
+  hetParams->tdat = NULL;
 
-    for( i=0;i<(INT4)resampData->data->length;i++ ){
-      /* if data has been scaled then undo scaling for output */
+  /* set filters - values held for the whole data set so we don't get lots of
+     glitches from the filter ringing */
+  if(inputParams->filterknee > 0.0){
+    set_filters(&pulsar->iirFilters, inputParams->filterknee, inputParams->samplerate);
+    if(verbose){  fprintf(stderr, "I've set up the filters.\n");  }
+  }
 
-      if( inputParams.binaryoutput ){
-        size_t rc = 0;
-        REAL8 tempreal, tempimag;
+  /* set output file */
+  snprintf(pulsar->outputfile, sizeof(pulsar->outputfile), "%s", outputfile);
+  pulsar->gzipoutput = inputParams->gzipoutput;
 
-        tempreal = creal(resampData->data->data[i]);
-        tempimag = cimag(resampData->data->data[i]);
+  // check if output should be gzipped due to ".gz" suffix on file name */
+  if ( XLALStringCaseSubstring( pulsar->outputfile, ".gz" ) != NULL ){
+    if ( inputParams->binaryoutput ){
+      XLALPrintError("Error... do not use a \".gz\" file extension for a binary output file\n");
+    }
 
-        /* binary output will be same as ASCII text - time real imag */
-        if( inputParams.scaleFac > 1.0 ){
-          tempreal /= inputParams.scaleFac;
-          tempimag /= inputParams.scaleFac;
-        }
+    pulsar->gzipoutput = 1;
+    // remove ".gz" suffix
+    CHAR *strloc = XLALStringCaseSubstring( pulsar->outputfile, ".gz" );
+    strloc[0] = '\0';
+  }
 
-        rc = fwrite(&times->data[i], sizeof(REAL8), 1, fpout);
-        rc = fwrite(&tempreal, sizeof(REAL8), 1, fpout);
-        rc = fwrite(&tempimag, sizeof(REAL8), 1, fpout);
+  /* add header to the files: header information will be a string consisting of several lines starting with %%s.
+   *  - the first line will contain the time and date of the file creation
+   *  - the next set of lines will contain the version and git hash of the lalsuite versions
+   *  - the penulimate line will contain the command line inputs used to create the file
+   *  - the final will contain headers for the three columns in the file: GPS time, Real, Imag */
+  if( (fpout = fopen(pulsar->outputfile, "w")) == NULL ){
+    fprintf(stderr, "Error... can't open output file %s!\n", pulsar->outputfile);
+    exit(0);
+  }
 
-        if( ferror(fpout) || !rc ){
-          fprintf(stderr, "Error... problem writing out data to binary file!\n");
-          exit(1);
-        }
-      }
-      else{
-        if( inputParams.scaleFac > 1.0 ){
-          fprintf(fpout, "%lf\t%le\t%le\n", times->data[i],
-                  creal(resampData->data->data[i])/inputParams.scaleFac,
-                  cimag(resampData->data->data[i])/inputParams.scaleFac);
-        }
-        else{
-          fprintf(fpout, "%lf\t%le\t%le\n", times->data[i],
-            creal(resampData->data->data[i]), cimag(resampData->data->data[i]));
-        }
-      }
+  CHAR *headerinfo = XLALStringDuplicate("%% File created on ");
+  headerinfo = XLALStringAppend(headerinfo, LogTimeToString( XLALGetTimeOfDay() ));
+  headerinfo = XLALStringAppend(headerinfo, "\n");
+  headerinfo = XLALStringAppend(headerinfo, XLALVCSInfoString( lalPulsarVCSInfoList, 0, "%% " ) );
+  headerinfo = XLALStringAppend(headerinfo, "%% ");
+  for ( INT4 j=0; j<argc; j++ ) {
+    headerinfo = XLALStringAppend(headerinfo, argv[j]);
+    headerinfo = XLALStringAppend(headerinfo, " ");
+  }
+  CHAR dataline[] = "\n%% GPS time\tReal\tImag\n";
+  if ( strlen(headerinfo)+strlen(dataline) > HEADERSIZE ) {
+    fprintf(stderr, "Error... HEADERSIZE needs to be increased to accommodate information\n");
+    exit(0);
+  }
+  else{
+    /* fill in rest of string with whitespace */
+    for ( INT4 j=strlen(headerinfo); j<HEADERSIZE; j++ ){ headerinfo = XLALStringAppend(headerinfo, " "); }
+    memcpy(&headerinfo[HEADERSIZE-strlen(dataline)], &dataline[0], sizeof(CHAR)*strlen(dataline));
 
+    /* output the header to the file */
+    size_t rc = fwrite(&headerinfo[0], sizeof(CHAR), HEADERSIZE, fpout);
+    if ( ferror(fpout) || !rc ){
+      fprintf(stderr, "Error... problem writing out header data!\n");
+      exit(1);
     }
-    if( verbose ){ fprintf(stderr, "I've output the data.\n"); }
+  }
+  XLALFree( headerinfo );
+  fclose(fpout);
+}
 
-    fclose(fpout);
+/* function to heterodyne, filter, resample, calibrate and output a stretch of
+   data for one pulsar - the data and times are destroyed */
+void heterodyne_chunk(HeterodynePulsar *pulsar, COMPLEX16TimeSeries *data,
+  REAL8Vector *times, InputParams *inputParams, INT4Vector *starts,
+  INT4Vector *stops, FilterResponse *filtresp){
+  HeterodyneParams *hetParams = &pulsar->hetParams;
+  COMPLEX16TimeSeries *resampData=NULL; /* resampled data */
+  FILE *fpout=NULL;
+  INT4 i;
 
-    XLALDestroyCOMPLEX16TimeSeries( resampData );
+  XLALGPSSetREAL8(&data->epoch, hetParams->timestamp);
 
-    XLALDestroyREAL8Vector( times );
-  }while( count < numSegs && (inputParams.heterodyneflag==0 || inputParams.heterodyneflag==3) );
+  /* heterodyne data */
+  heterodyne_data(data, times, *hetParams, inputParams->freqfactor, filtresp);
+  if( verbose ){ fprintf(stderr, "I've heterodyned the data.\n"); }
 
-  /* check if any data has been read - if not exit with an error */
-  if ( nodata && (inputParams.heterodyneflag==0 || inputParams.heterodyneflag==3) ){
-    fprintf(stderr, "Error... no data was read in.\n");
-    exit(1);
+  /* filter data */
+  if( inputParams->filterknee > 0. ){/* filter if knee frequency is not zero */
+    filter_data(data, &pulsar->iirFilters);
+
+    if( verbose ){  fprintf(stderr, "I've low pass filtered the data at %.2lf Hz\n", inputParams->filterknee);  }
   }
 
-  /* check whether to gzip the output */
-  if ( !inputParams.binaryoutput && inputParams.gzipoutput ){
-    fprintf(stderr, "Outputing %s to gzipped file\n", outputfile);
-    if ( XLALGzipTextFile(outputfile) != XLAL_SUCCESS ){ // gzip it
-      XLALPrintError("Error... problem gzipping the output file.\n");
+  if( inputParams->heterodyneflag==0 || inputParams->heterodyneflag==3 )
+    if( (times = XLALCreateREAL8Vector( data->data->length )) == NULL )
+      XLALPrintError("Error creating vector of data times.\n");
+
+  /* resample data and data times */
+  resampData = resample_data(data, times, starts, stops,
+    inputParams->samplerate, inputParams->resamplerate,
+    inputParams->heterodyneflag);
+  if( verbose ){  fprintf(stderr, "I've resampled the data from %.2lf to %.4lf Hz\n", inputParams->samplerate, inputParams->resamplerate);  }
+
+  XLALDestroyCOMPLEX16TimeSeries( data );
+
+  /*perform outlier removal twice incase very large outliers skew the stddev*/
+  if( inputParams->stddevthresh != 0. ){
+    INT4 numOutliers=0;
+    numOutliers = remove_outliers(resampData, times,
+      inputParams->stddevthresh);
+    if( verbose ){
+      fprintf(stderr, "I've removed %lf%% of data above the threshold %.1lf sigma for 1st time.\n",
+        100.*(double)numOutliers/(double)resampData->data->length,
+        inputParams->stddevthresh);
     }
   }
 
-  #if TRACKMEMUSE
-    fprintf(stderr, "Memory usage after completion of main loop:\n"); printmemuse();
-  #endif
+  /* calibrate */
+  if( inputParams->calibrate ){
+    calibrate(resampData, times, inputParams->calibfiles,
+      inputParams->freqfactor*PulsarGetREAL8VectorParamIndividual( hetParams->het, "F0" ), inputParams->channel);
+    if( verbose ){ fprintf(stderr, "I've calibrated the data at %.1lf Hz\n", inputParams->freqfactor*PulsarGetREAL8VectorParamIndividual( hetParams->het, "F0" ));  }
+  }
 
-  fprintf(stderr, "Heterodyning complete.\n");
+  /* remove outliers above our threshold */
+  if( inputParams->stddevthresh != 0. ){
+    INT4 numOutliers = 0;
+    numOutliers = remove_outliers(resampData, times,
+      inputParams->stddevthresh);
+    if( verbose ){
+      fprintf(stderr, "I've removed %lf%% of data above the threshold %.1lf sigma for 2nd time.\n",
+        100.*(double)numOutliers/(double)resampData->data->length,
+        inputParams->stddevthresh);
+    }
+  }
 
-  XLALDestroyINT4Vector( stops );
-  XLALDestroyINT4Vector( starts );
+  /* output data */
+  if( inputParams->binaryoutput ){
+    if((fpout = fopen(pulsar->outputfile, "ab"))==NULL){
+      fprintf(stderr, "Error... can't open output file %s!\n", pulsar->outputfile);
+      exit(0);
+    }
+  }
+  else{
+    if( (fpout = fopen(pulsar->outputfile, "a")) == NULL ){
+      fprintf(stderr, "Error... can't open output file %s!\n", pulsar->outputfile);
+      exit(0);
+    }
+  }
+
+  /* buffer the output, so that file system is not thrashed when outputing */
+  /* buffer will be 1Mb */
+  if( setvbuf(fpout, NULL, _IOFBF, 0x100000) ){ fprintf(stderr, "Warning: Unable to set output file buffer!"); }
+
+  for( i=0;i<(INT4)resampData->data->length;i++ ){
+    /* if data has been scaled then undo scaling for output */
+
+    if( inputParams->binaryoutput ){
+      size_t rc = 0;
+      REAL8 tempreal, tempimag;
+
+      tempreal = creal(resampData->data->data[i]);
+      tempimag = cimag(resampData->data->data[i]);
+
+      /* binary output will be same as ASCII text - time real imag */
+      if( inputParams->scaleFac > 1.0 ){
+        tempreal /= inputParams->scaleFac;
+        tempimag /= inputParams->scaleFac;
+      }
+
+      rc = fwrite(&times->data[i], sizeof(REAL8), 1, fpout);
+      rc = fwrite(&tempreal, sizeof(REAL8), 1, fpout);
+      rc = fwrite(&tempimag, sizeof(REAL8), 1, fpout);
+
+      if( ferror(fpout) || !rc ){
+        fprintf(stderr, "Error... problem writing out data to binary file!\n");
+        exit(1);
+      }
+    }
+    else{
+      if( inputParams->scaleFac > 1.0 ){
+        fprintf(fpout, "%lf\t%le\t%le\n", times->data[i],
+                creal(resampData->data->data[i])/inputParams->scaleFac,
+                cimag(resampData->data->data[i])/inputParams->scaleFac);
+      }
+      else{
+        fprintf(fpout, "%lf\t%le\t%le\n", times->data[i],
+          creal(resampData->data->data[i]), cimag(resampData->data->data[i]));
+      }
+    }
 
-  if( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3){
-    XLALDestroyCache(cache);
   }
+  if( verbose ){ fprintf(stderr, "I've output the data.\n"); }
 
-  if( inputParams.filterknee > 0. ){
-    XLALDestroyREAL8IIRFilter( iirFilters.filter1Re );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter1Im );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter2Re );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter2Im );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter3Re );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter3Im );
+  fclose(fpout);
+
+  XLALDestroyCOMPLEX16TimeSeries( resampData );
+
+  XLALDestroyREAL8Vector( times );
+}
+
+/* read in a list of pulsars to heterodyne from the same data - each line of the
+   file contains a pulsar parameter file and an output file, and lines starting
+   with a # are comments - returns the number of pulsars */
+UINT4 get_pulsar_list(CHAR ***paramfiles, CHAR ***outputfiles, CHAR *pulsarlistfile){
+  FILE *fp=NULL;
+  CHAR linebuf[2*MAXSTRLENGTH];
+  UINT4 n=0;
 
-    if( verbose ){ fprintf(stderr, "I've destroyed all filters.\n"); }
+  if((fp=fopen(pulsarlistfile, "r"))==NULL){
+    fprintf(stderr, "Error... can't open pulsar list file %s.\n", pulsarlistfile);
+    exit(1);
   }
 
-  if ( filtresp != NULL ){ destroy_filter_response( filtresp ); }
+  *paramfiles = NULL;
+  *outputfiles = NULL;
 
-  PulsarFreeParams( hetParams.het );
-  if ( inputParams.heterodyneflag == 2 || inputParams.heterodyneflag == 4 ){ PulsarFreeParams( hetParams.hetUpdate ); }
+  while( fgets(linebuf, sizeof(linebuf), fp) != NULL ){
+    CHAR parfile[MAXSTRLENGTH], outfile[MAXSTRLENGTH];
+    INT4 nread = sscanf(linebuf, "%1023s%1023s", parfile, outfile);
 
-  #if TRACKMEMUSE
-    fprintf(stderr, "Memory use at the end of the code:\n"); printmemuse();
-  #endif
+    /* skip empty and comment lines */
+    if( nread < 1 || parfile[0] == '#' ) continue;
 
-  return 0;
+    if( nread != 2 ){
+      fprintf(stderr, "Error... pulsar list file %s should contain a parameter file and an output file on each line.\n", pulsarlistfile);
+      exit(1);
+    }
+
+    if( (*paramfiles = XLALRealloc(*paramfiles, (n+1)*sizeof(CHAR*))) == NULL ||
+        (*outputfiles = XLALRealloc(*outputfiles, (n+1)*sizeof(CHAR*))) == NULL )
+      {  XLALPrintError("Error resizing pulsar list.\n");  }
+
+    (*paramfiles)[n] = XLALStringDuplicate( parfile );
+    (*outputfiles)[n] = XLALStringDuplicate( outfile );
+    n++;
+  }
+
+  fclose(fp);
+
+  if( n == 0 ){
+    fprintf(stderr, "Error... pulsar list file %s contains no pulsars.\n", pulsarlistfile);
+    exit(1);
+  }
+
+  return n;
 }
 
 /* function to parse the input arguments */
@@ -781,10 +917,11 @@ void get_input_args(InputParams *inputParams, int argc, char *argv[]){
     { "legacy-input",             no_argument,     NULL, 'L' },
     { "verbose",                  no_argument,     NULL, 'v' },
     { "output-phase",             no_argument,     NULL, 'P' },
+    { "pulsar-list",              required_argument,  0, 'y' },
     { 0, 0, 0, 0 }
   };
 
-  char args[] = "hi:p:z:f:g:k:s:r:d:D:c:o:e:S:t:l:R:C:F:O:T:m:G:H:M:ABbZLvP";
+  char args[] = "hi:p:z:f:g:k:s:r:d:D:c:o:e:S:t:l:R:C:F:O:T:m:G:H:M:y:ABbZLvP";
   char *program = argv[0];
 
   /* set defaults */
@@ -819,6 +956,8 @@ the pulsar parameter file */
 
   inputParams->timeCorrFile = NULL;
 
+  inputParams->pulsarlist[0] = '\0'; /* default to a single pulsar */
+
   /* get input arguments */
   while(1){
     int option_index = 0;
@@ -1008,6 +1147,10 @@ the pulsar parameter file */
       case 'P':
         inputParams->outputPhase = 1;
         break;
+      case 'y': /* list of pulsars to heterodyne */
+        snprintf(inputParams->pulsarlist, sizeof(inputParams->pulsarlist), "%s",
+          LALoptarg);
+        break;
       case '?':
         fprintf(stderr, "unknown error while parsing options\n" );
 		break;
@@ -1057,6 +1200,21 @@ heterodyne!\n");
       exit(1);
     }
   }
+
+  /* check that a list of pulsars is only used when reading from frame data */
+  if( inputParams->pulsarlist[0] != '\0' ){
+    if( inputParams->heterodyneflag != 0 && inputParams->heterodyneflag != 3 ){
+      fprintf(stderr, "Error... a pulsar list can only be used for a coarse \
+heterodyne, or heterodyne flag 3!\n");
+      exit(1);
+    }
+
+    if( inputParams->outputPhase ){
+      fprintf(stderr, "Error... the phase evolution cannot be output when \
+using a pulsar list!\n");
+      exit(1);
+    }
+  }
 }
 
 /* heterodyne data function */
@@ -1067,8 +1225,8 @@ void heterodyne_data(COMPLEX16TimeSeries *data, REAL8Vector *times,
   REAL8 dtpos=0.; /* time between position epoch and data timestamp */
   INT4 i=0;
 
-  EphemerisData *edat=NULL;
-  TimeCorrectionData *tdat=NULL;
+  EphemerisData *edat=hetParams.edat;
+  TimeCorrectionData *tdat=hetParams.tdat;
   BarycenterInput baryinput, baryinput2;
   EarthState earth, earth2;
   EmissionTime  emit, emit2;
@@ -1111,12 +1269,14 @@ void heterodyne_data(COMPLEX16TimeSeries *data, REAL8Vector *times,
 
   T0 = pepoch;
 
-  /* set up ephemeris files */
+  /* set up ephemeris files (if not already read in and shared between calls) */
   if( hetParams.heterodyneflag > 0){
-    XLAL_CHECK_VOID( (edat = XLALInitBarycenter( hetParams.earthfile, hetParams.sunfile )) != NULL, XLAL_EFUNC );
+    if ( hetParams.edat == NULL ){
+      XLAL_CHECK_VOID( (edat = XLALInitBarycenter( hetParams.earthfile, hetParams.sunfile )) != NULL, XLAL_EFUNC );
+    }
 
     /* get files containing Einstein delay correction look-up table */
-    if ( hetParams.ttype != TIMECORRECTION_ORIGINAL ){
+    if ( hetParams.ttype != TIMECORRECTION_ORIGINAL && hetParams.tdat == NULL ){
       XLAL_CHECK_VOID( (tdat = XLALInitTimeCorrections(
         hetParams.timeCorrFile ) ) != NULL, XLAL_EFUNC );
     }
@@ -1491,14 +1651,16 @@ void heterodyne_data(COMPLEX16TimeSeries *data, REAL8Vector *times,
       fprintf(fpphase, "%.9lf\n", deltaphase);
     }
 
-    data->data->data[i] = (creal(dataTemp)*cos(-deltaphase) - cimag(dataTemp)*sin(-deltaphase)) +
-      I * (creal(dataTemp)*sin(-deltaphase) + cimag(dataTemp)*cos(-deltaphase));
+    /* rotate by the heterodyne phase (only calculating cos and sin once) */
+    REAL8 cosdp = cos(-deltaphase), sindp = sin(-deltaphase);
+    data->data->data[i] = (creal(dataTemp)*cosdp - cimag(dataTemp)*sindp) +
+      I * (creal(dataTemp)*sindp + cimag(dataTemp)*cosdp);
   }
 
   if(hetParams.heterodyneflag > 0){
-    XLALDestroyEphemerisData( edat );
+    if ( hetParams.edat == NULL ) XLALDestroyEphemerisData( edat );
 
-    if ( hetParams.ttype != TIMECORRECTION_ORIGINAL )
+    if ( hetParams.ttype != TIMECORRECTION_ORIGINAL && hetParams.tdat == NULL )
       XLALDestroyTimeCorrectionData( tdat );
   }
 
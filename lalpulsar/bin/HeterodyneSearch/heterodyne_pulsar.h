@@ -131,6 +131,13 @@ extern "C" {
                           if not this suffix will be appended\n"\
 " --output-phase (-P)      if set, output the phase evolution to a text file\n\
                           (for debugging purposes)\n"\
+" --pulsar-list (-y)       file containing a list of pulsars to heterodyne from\n\
+                          a single pass through the frame data (coarse\n\
+                          heterodyne, or heterodyne flag 3, only). Each line\n\
+                          contains a pulsar parameter file and the output file\n\
+                          for that pulsar, and lines starting with # are\n\
+                          ignored. This replaces --param-file and\n\
+                          --output-file\n"\
 "\n"
 
 #define MAXDATALENGTH 256   /* maximum length of data to be read from frames */
@@ -186,6 +193,7 @@ typedef struct tagInputParams{
 
   CHAR outputfile[256];
   CHAR segfile[256];
+  CHAR pulsarlist[256];
 
   INT4 calibrate;
   CalibrationFiles calibfiles;
@@ -221,6 +229,9 @@ typedef struct tagHeterodyneParams{
   CHAR *timeCorrFile;
   TimeCorrectionType ttype;
   INT4 outputPhase;
+
+  EphemerisData *edat; /* ephemeris data (read in by heterodyne_data if NULL) */
+  TimeCorrectionData *tdat; /* time correction data (read in by heterodyne_data if NULL) */
 }HeterodyneParams;
 
 typedef struct tagFilters{
@@ -232,6 +243,17 @@ typedef struct tagFilters{
   REAL8IIRFilter *filter3Im;
 }Filters;
 
+/* heterodyne parameters, filters and output file for each pulsar being
+   heterodyned from the same data */
+typedef struct tagHeterodynePulsar{
+  HeterodyneParams hetParams;
+  Filters iirFilters;
+
+  CHAR outputfile[256];
+  INT4 gzipoutput;
+  const CHAR *psrname;
+}HeterodynePulsar;
+
 typedef struct tagFilterResponse{
   REAL8Vector *freqResp;
   REAL8Vector *phaseResp;
@@ -246,6 +268,17 @@ void get_input_args(InputParams *inputParams, int argc, char *argv[]);
 void heterodyne_data(COMPLEX16TimeSeries *data, REAL8Vector *times, HeterodyneParams hetParams,
 REAL8 freqfactor, FilterResponse *filtResp);
 
+/* read in a pulsar parameter file and set up the heterodyne and output file for that pulsar */
+void set_pulsar(HeterodynePulsar *pulsar, InputParams *inputParams, const CHAR *paramfile,
+const CHAR *outputfile, int argc, char *argv[]);
+
+/* heterodyne, filter, resample, calibrate and output a stretch of data for one pulsar */
+void heterodyne_chunk(HeterodynePulsar *pulsar, COMPLEX16TimeSeries *data, REAL8Vector *times,
+InputParams *inputParams, INT4Vector *starts, INT4Vector *stops, FilterResponse *filtresp);
+
+/* read in a list of pulsar parameter files and output files - returns the number of pulsars */
+UINT4 get_pulsar_list(CHAR ***paramfiles, CHAR ***outputfiles, CHAR *pulsarlistfile);
+
 void set_filters(Filters *iirFilters, REAL8 filterKnee, REAL8 samplerate);
 
 void filter_data(COMPLEX16TimeSeries *data, Filters *iirFilters);
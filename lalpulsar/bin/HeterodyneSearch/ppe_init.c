@@ -293,6 +293,11 @@ void setup_lookup_tables( LALInferenceRunState *runState, LALSource *source ){
   REAL8 t0;
   LALDetAndSource detAndSource;
 
+  /* the previous data stream, and the lookup tables calculated for it */
+  LALInferenceIFOData *prevdata = NULL;
+  REAL8 prevt0 = 0., prevdt = 0.;
+  REAL8Vector *prevresp[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+
   ppt = LALInferenceGetProcParamVal( commandLine, "--time-bins" );
   INT4 timeBins;
   if( ppt ) { timeBins = atoi( ppt->value ); }
@@ -332,7 +337,29 @@ void setup_lookup_tables( LALInferenceRunState *runState, LALSource *source ){
 
     dt = LALInferenceGetREAL8Variable( ifo_model->params, "dt" );
 
-    response_lookup_table( t0, detAndSource, timeBins, dt, arespT, brespT, arespV, brespV, arespS, brespS );
+    /* the lookup tables only depend on the detector, the start time and the time step, so if these are the same
+     * as for the previous data stream (e.g. another frequency factor for the same detector) just copy its tables */
+    if ( prevdata != NULL && !strcmp( prevdata->detector->frDetector.prefix, data->detector->frDetector.prefix ) &&
+         !memcmp( prevdata->detector->response, data->detector->response, sizeof( data->detector->response ) ) &&
+         prevt0 == t0 && prevdt == dt ){
+      REAL8Vector *resp[6] = { arespT, brespT, arespV, brespV, arespS, brespS };
+      for ( i = 0; i < 6; i++ ){ memcpy( resp[i]->data, prevresp[i]->data, sizeof(REAL8)*timeBins ); }
+    }
+    else{
+      response_lookup_table( t0, detAndSource, timeBins, dt, arespT, brespT, arespV, brespV, arespS, brespS );
+    }
+
+    /* keep a copy of the tables for the next data stream (the vector and scalar tables may be freed below) */
+    {
+      REAL8Vector *resp[6] = { arespT, brespT, arespV, brespV, arespS, brespS };
+      for ( i = 0; i < 6; i++ ){
+        prevresp[i] = XLALResizeREAL8Vector( prevresp[i], timeBins );
+        memcpy( prevresp[i]->data, resp[i]->data, sizeof(REAL8)*timeBins );
+      }
+    }
+    prevdata = data;
+    prevt0 = t0;
+    prevdt = dt;
 
     LALInferenceAddVariable( ifo_model->params, "a_response_tensor", &arespT, LALINFERENCE_REAL8Vector_t, LALINFERENCE_PARAM_FIXED );
     LALInferenceAddVariable( ifo_model->params, "b_response_tensor", &brespT, LALINFERENCE_REAL8Vector_t, LALINFERENCE_PARAM_FIXED );
@@ -354,6 +381,8 @@ void setup_lookup_tables( LALInferenceRunState *runState, LALSource *source ){
     ifo_model = ifo_model->next;
   }
 
+  for ( UINT4 i = 0; i < 6; i++ ){ XLALDestroyREAL8Vector( prevresp[i] ); }
+
   return;
 }
 
@@ -681,6 +681,9 @@ void get_loudest_snr( LALInferenceRunState *runState ){
 
       ifo_model = ifo_model->next;
     }
+
+    /* the cached parts of the model were calculated at the interpolation nodes, so must be reset */
+    free_model_cache( runState->threads[0].model->ifo );
   }
 
   /* make sure that the signal model in runState->data is that of the loudest signal */
@@ -32,6 +32,19 @@
 
 #define SQUARE(x) ( (x) * (x) )
 
+/* classes of the (non-amplitude) model parameters, by the parts of the phase model that depend on them */
+enum { PARAM_SKY = 0, PARAM_TIMING, PARAM_GLITCH, PARAM_FREQ, NUM_PARAM_CLASSES, PARAM_AMPLITUDE };
+#define PARAM_CHANGED( c ) ( 1U << ( c ) )
+#define ALL_PARAMS_CHANGED ( PARAM_CHANGED( NUM_PARAM_CLASSES ) - 1U )
+
+static UINT4 update_parameter_keys( ModelCache *cache, PulsarParameters *params );
+static UINT4 check_phase_cache( ModelCache *cache, LALInferenceIFOModel *ifo );
+static void reset_phase_cache( ModelCache *cache );
+static void set_response_cache( ModelCache *cache, LALInferenceIFOModel *ifo, UINT4 nonGR );
+static ModelCacheVectorId get_vector_id( const REAL8Vector *vec );
+static ModelCacheVectorId get_times_id( const LIGOTimeGPSVector *times );
+static UINT4 equal_vector_ids( const ModelCacheVectorId *a, const ModelCacheVectorId *b );
+
 /******************************************************************************/
 /*                            MODEL FUNCTIONS                                 */
 /******************************************************************************/
@@ -422,26 +435,19 @@ void pulsar_model( PulsarParameters *params, LALInferenceIFOModel *ifo ){
 
     while ( ifomodel2 ){
       for( j = 0; j < freqFactors->length; j++ ){
-        REAL8Vector *dphi = NULL;
-        COMPLEX16 M = 0., expp = 0.;
+        const COMPLEX16Vector *expp = NULL;
 
         length = ifomodel2->compTimeSignal->data->length;
 
-        /* reheterodyne with the phase */
-        if ( (dphi = get_phase_model( params, ifomodel2, freqFactors->data[j] )) != NULL ){
-          for( i=0; i<length; i++ ){
-            /* phase factor by which to multiply the (almost) DC signal model. NOTE: this does not try to undo
-             * the signal modulation in the data, but instead replicates it in the model, hence the positive
-             * phase rather than a negative phase in the cexp function. */
-            expp = cexp( LAL_TWOPI * I * dphi->data[i] );
-
-            M = ifomodel2->compTimeSignal->data->data[i];
+        /* reheterodyne with the phase - the phase factors by which to multiply the (almost) DC signal model
+         * are cached, so are only recalculated if any of the phase parameters have changed. NOTE: this does
+         * not try to undo the signal modulation in the data, but instead replicates it in the model, hence
+         * the positive phase rather than a negative phase in the phase factors. */
+        if ( (expp = get_phase_factors( params, ifomodel2, freqFactors->data[j] )) != NULL ){
+          COMPLEX16 *M = ifomodel2->compTimeSignal->data->data;
 
-            /* heterodyne */
-            ifomodel2->compTimeSignal->data->data[i] = M * expp;
-          }
-
-          XLALDestroyREAL8Vector( dphi );
+          /* heterodyne */
+          for( i=0; i<length; i++ ){ M[i] *= expp->data[i]; }
         }
 
         ifomodel2 = ifomodel2->next;
@@ -477,7 +483,12 @@ void pulsar_model( PulsarParameters *params, LALInferenceIFOModel *ifo ){
  * In this function the time delay needed to correct to the solar system barycenter is only calculated if
  * required, i.e., if an update is required due to a change in the sky position.
  * The same is true for the binary system time delay, which is only calculated if it
- * needs updating due to a change in the binary system parameters.
+ * needs updating due to a change in the binary system parameters. These delays, the glitch phase, and the
+ * powers of \f$ t+\delta t_1 \f$ (and inner sums over \f$ \Delta t \f$) in the Taylor expansion are held in
+ * the \c ModelCache for the detector, and are only recalculated when the parameters they depend on change.
+ * If only the frequency parameters have changed the phase is therefore just a sum over the cached terms. If the
+ * sky position or binary system parameters change, the powers of \f$ t+\delta t_1 \f$ are kept and the inner
+ * sums are updated from them with a recurrence over the order of the expansion.
  *
  * \param params [in] A set of pulsar parameters
  * \param ifo [in] The ifo model structure containing the detector parameters and buffers
@@ -489,12 +500,14 @@ void pulsar_model( PulsarParameters *params, LALInferenceIFOModel *ifo ){
  * \sa get_bsb_delay
  */
 REAL8Vector *get_phase_model( PulsarParameters *params, LALInferenceIFOModel *ifo, REAL8 freqFactor ){
-  UINT4 i = 0, j = 0, k = 0, length = 0, isbinary = 0;
+  UINT4 i = 0, j = 0, length = 0, isbinary = 0, nfreqs = 0;
 
-  REAL8 DT = 0., deltat = 0., deltatpow = 0., deltatpowinner = 1., taylorcoeff = 1., Ddelay = 0., Ddelaypow = 0.;
+  REAL8 DT = 0., deltat = 0., deltatpow = 0., taylorcoeff = 1., Ddelay = 0.;
 
   REAL8Vector *phis = NULL, *dts = NULL, *fixdts = NULL, *bdts = NULL, *fixbdts = NULL, *glitchphase = NULL, *fixglitchphase = NULL;
   LIGOTimeGPSVector *datatimes = NULL;
+  ModelCache *cache = NULL;
+  UINT4 changed = 0, delayschanged = 0;
 
   REAL8 pepoch = PulsarGetREAL8ParamOrZero(params, "PEPOCH"); /* time of ephem info */
   REAL8 cgw = PulsarGetREAL8ParamOrZero(params, "CGW");
@@ -508,19 +521,35 @@ REAL8Vector *get_phase_model( PulsarParameters *params, LALInferenceIFOModel *if
 
   length = datatimes->length;
 
+  /* find which classes of parameters have changed since the cache was last updated */
+  cache = get_model_cache( ifo );
+  cache->changed |= check_phase_cache( cache, ifo ) | update_parameter_keys( cache, params );
+  changed = cache->changed;
+
   /* allocate memory for phases */
   phis = XLALCreateREAL8Vector( length );
 
   /* get time delays */
   fixdts = LALInferenceGetREAL8VectorVariable( ifo->params, "ssb_delays" );
   if( LALInferenceCheckVariable( ifo->params, "varyskypos" ) ){
-    dts = get_ssb_delay( params, datatimes, IFO_XTRA_DATA( ifo )->ephem, IFO_XTRA_DATA( ifo )->tdat, IFO_XTRA_DATA( ifo )->ttype, ifo->detector );
+    if ( changed & PARAM_CHANGED( PARAM_SKY ) ){
+      XLALDestroyREAL8Vector( cache->dts );
+      cache->dts = get_ssb_delay( params, datatimes, IFO_XTRA_DATA( ifo )->ephem, IFO_XTRA_DATA( ifo )->tdat, IFO_XTRA_DATA( ifo )->ttype, ifo->detector );
+      XLAL_CHECK_NULL( cache->dts != NULL, XLAL_EFUNC );
+      delayschanged = 1;
+    }
+    dts = cache->dts;
   }
 
   if( LALInferenceCheckVariable( ifo->params, "varybinary" ) ){
     /* get binary system time delays */
-    if ( dts != NULL ){ bdts = get_bsb_delay( params, datatimes, dts, IFO_XTRA_DATA( ifo )->ephem ); }
-    else{ bdts = get_bsb_delay( params, datatimes, fixdts, IFO_XTRA_DATA( ifo )->ephem ); }
+    if ( delayschanged || ( changed & PARAM_CHANGED( PARAM_TIMING ) ) ){
+      XLALDestroyREAL8Vector( cache->bdts );
+      if ( dts != NULL ){ cache->bdts = get_bsb_delay( params, datatimes, dts, IFO_XTRA_DATA( ifo )->ephem ); }
+      else{ cache->bdts = get_bsb_delay( params, datatimes, fixdts, IFO_XTRA_DATA( ifo )->ephem ); }
+      delayschanged = 1;
+    }
+    bdts = cache->bdts;
   }
   if( LALInferenceCheckVariable( ifo->params, "bsb_delays" ) ){
     fixbdts = LALInferenceGetREAL8VectorVariable( ifo->params, "bsb_delays" );
@@ -529,73 +558,118 @@ REAL8Vector *get_phase_model( PulsarParameters *params, LALInferenceIFOModel *if
   /* get vector of frequencies and frequency differences */
   const REAL8Vector *freqs = PulsarGetREAL8VectorParam( params, "F" );
   const REAL8Vector *deltafs = PulsarGetREAL8VectorParam( params, "DELTAF" );
+  nfreqs = freqs->length;
 
   if ( PulsarCheckParam( params, "BINARY" ) ){ isbinary = 1; } /* see if pulsar is in binary */
 
   if ( LALInferenceCheckVariable( ifo->params, "varyglitch" ) ){
     /* get the phase (in cycles due to glitch parameters */
-    if ( dts != NULL ){
-      if ( LALInferenceCheckVariable( ifo->params, "varybinary" ) ){
-        glitchphase = get_glitch_phase( params, datatimes, dts, bdts );
-      }
-      else{
-        glitchphase = get_glitch_phase( params, datatimes, dts, fixbdts );
-      }
-    }
-    else{
-      if ( LALInferenceCheckVariable( ifo->params, "varybinary" ) ){
-        glitchphase = get_glitch_phase( params, datatimes, fixdts, bdts );
+    if ( delayschanged || ( changed & ( PARAM_CHANGED( PARAM_SKY ) | PARAM_CHANGED( PARAM_TIMING ) | PARAM_CHANGED( PARAM_GLITCH ) ) ) ){
+      XLALDestroyREAL8Vector( cache->glitchphase );
+      if ( dts != NULL ){
+        if ( LALInferenceCheckVariable( ifo->params, "varybinary" ) ){
+          cache->glitchphase = get_glitch_phase( params, datatimes, dts, bdts );
+        }
+        else{
+          cache->glitchphase = get_glitch_phase( params, datatimes, dts, fixbdts );
+        }
       }
       else{
-        glitchphase = get_glitch_phase( params, datatimes, fixdts, fixbdts );
+        if ( LALInferenceCheckVariable( ifo->params, "varybinary" ) ){
+          cache->glitchphase = get_glitch_phase( params, datatimes, fixdts, bdts );
+        }
+        else{
+          cache->glitchphase = get_glitch_phase( params, datatimes, fixdts, fixbdts );
+        }
       }
     }
+    glitchphase = cache->glitchphase;
   }
   if ( LALInferenceCheckVariable( ifo->params, "glitch_phase" ) ){
     fixglitchphase = LALInferenceGetREAL8VectorVariable( ifo->params, "glitch_phase" );
   }
 
-  for( i=0; i<length; i++){
-    REAL8 deltaphi = 0., innerphi = 0.; /* change in phase */
-    Ddelay = 0.;                        /* change in SSB/BSB delay */
+  /* get the powers of the time since the epoch in the Taylor expansion of the phase. These depend only on the
+   * heterodyne barycentring delays, the epoch and the speed of gravitational waves, so are kept when the sky
+   * position or binary system parameters change */
+  if ( cache->deltatpows == NULL || cache->nfreqs != nfreqs || cache->pepoch != pepoch || cache->cgw != cgw ||
+       cache->isbinary != isbinary ){
+    cache->deltatpows = XLALResizeREAL8Vector( cache->deltatpows, nfreqs*length );
+    cache->nfreqs = nfreqs;
+    cache->pepoch = pepoch;
+    cache->cgw = cgw;
+    cache->isbinary = isbinary;
+    delayschanged = 1; /* the inner sums below depend on these */
+
+    for( i=0; i<length; i++){
+      REAL8 realT = XLALGPSGetREAL8( &datatimes->data[i] ); /* time of data */
+      DT = realT - T0; /* time diff between data and start of data */
 
-    REAL8 realT = XLALGPSGetREAL8( &datatimes->data[i] ); /* time of data */
-    DT = realT - T0; /* time diff between data and start of data */
+      deltat = DT + fixdts->data[i];
+      if ( isbinary ){ deltat += fixbdts->data[i]; }
 
-    /* get difference in solar system barycentring time delays */
-    if ( dts != NULL ){ Ddelay += ( dts->data[i] - fixdts->data[i] ); }
-    deltat = DT + fixdts->data[i];
+      /* correct for speed of GW compared to speed of light */
+      if ( cgw > 0.0 && cgw < 1. ) { deltat /= cgw; }
 
-    if ( isbinary ){
-      /* get difference in binary system barycentring time delays */
-      if ( bdts != NULL && fixbdts != NULL ) { Ddelay += ( bdts->data[i] - fixbdts->data[i] ); }
-      deltat += fixbdts->data[i];
+      deltatpow = deltat;
+      for ( j=0; j<nfreqs; j++ ){
+        cache->deltatpows->data[j*length + i] = deltatpow;
+        deltatpow *= deltat;
+      }
     }
+  }
 
-    /* correct for speed of GW compared to speed of light */
-    if ( cgw > 0.0 && cgw < 1. ) {
-      deltat /= cgw;
-      Ddelay /= cgw;
-    }
+  /* if the barycentring delays have changed from those used for the heterodyne, get the inner sums over powers
+   * of the change in delay, Ddelay, in the Taylor expansion, i.e. (deltat + Ddelay)^(j+1) - deltat^(j+1). These
+   * are updated from the cached powers of deltat using the recurrence
+   * s_j = (deltat + Ddelay) s_(j-1) + Ddelay deltat^j, with s_0 = Ddelay, which (unlike subtracting the two
+   * powers) keeps full precision for the small changes in delay made by the sampler */
+  if ( delayschanged || ( changed & ( PARAM_CHANGED( PARAM_SKY ) | PARAM_CHANGED( PARAM_TIMING ) ) ) ){
+    cache->innerphis = XLALResizeREAL8Vector( cache->innerphis, nfreqs*length );
+    cache->nonzeroDdelay = 0;
 
-    /* get the change in phase (compared to the heterodyned phase) */
-    deltatpow = deltat;
-    for ( j=0; j<freqs->length; j++ ){
-      taylorcoeff = gsl_sf_fact(j+1);
-      deltaphi += deltafs->data[j]*deltatpow/taylorcoeff;
-      if ( Ddelay != 0. ){
-        innerphi = 0.;
-        deltatpowinner = 1.; /* this starts as one as it is first raised to the power of zero */
-        Ddelaypow = pow(Ddelay, j+1);
-        for ( k=0; k<j+1; k++ ){
-          innerphi += gsl_sf_choose(j+1, k) * Ddelaypow * deltatpowinner;
-          deltatpowinner *= deltat; /* raise power */
-          Ddelaypow /= Ddelay;      /* reduce power */
-        }
-        deltaphi += innerphi*freqs->data[j]/taylorcoeff;
+    for( i=0; i<length; i++){
+      Ddelay = 0.; /* change in SSB/BSB delay */
+      deltat = cache->deltatpows->data[i];
+
+      /* get difference in solar system barycentring time delays */
+      if ( dts != NULL ){ Ddelay += ( dts->data[i] - fixdts->data[i] ); }
+
+      /* get difference in binary system barycentring time delays */
+      if ( isbinary && bdts != NULL && fixbdts != NULL ) { Ddelay += ( bdts->data[i] - fixbdts->data[i] ); }
+
+      /* correct for speed of GW compared to speed of light */
+      if ( cgw > 0.0 && cgw < 1. ) { Ddelay /= cgw; }
+
+      if ( Ddelay != 0. ){ cache->nonzeroDdelay = 1; }
+
+      REAL8 innerphi = Ddelay;
+      cache->innerphis->data[i] = innerphi;
+      for ( j=1; j<nfreqs; j++ ){
+        innerphi = ( deltat + Ddelay )*innerphi + Ddelay*cache->deltatpows->data[(j-1)*length + i];
+        cache->innerphis->data[j*length + i] = innerphi;
       }
-      deltatpow *= deltat;
     }
+  }
+
+  /* get the change in phase (compared to the heterodyned phase) */
+  memset( phis->data, 0, sizeof(REAL8)*length );
+  for ( j=0; j<nfreqs; j++ ){
+    const REAL8 *tpow = &cache->deltatpows->data[j*length];
+    REAL8 deltaf = deltafs->data[j];
+    taylorcoeff = gsl_sf_fact(j+1);
+
+    for( i=0; i<length; i++ ){ phis->data[i] += deltaf*tpow[i]/taylorcoeff; }
+
+    if ( cache->nonzeroDdelay ){
+      const REAL8 *inner = &cache->innerphis->data[j*length];
+      REAL8 freq = freqs->data[j];
+      for( i=0; i<length; i++ ){ phis->data[i] += inner[i]*freq/taylorcoeff; }
+    }
+  }
+
+  for( i=0; i<length; i++){
+    REAL8 deltaphi = phis->data[i];
 
     /* get the differences for glitch phases */
     if ( glitchphase !=  NULL ){
@@ -606,15 +680,54 @@ REAL8Vector *get_phase_model( PulsarParameters *params, LALInferenceIFOModel *if
     phis->data[i] = deltaphi - floor(deltaphi); /* only need to keep the fractional part of the phase */
   }
 
-  /* free memory */
-  if ( dts != NULL ){ XLALDestroyREAL8Vector( dts ); }
-  if ( bdts != NULL ){ XLALDestroyREAL8Vector( bdts ); }
-  if ( glitchphase != NULL ){ XLALDestroyREAL8Vector( glitchphase ); }
+  cache->changed = 0;
 
   return phis;
 }
 
 
+/**
+ * \brief The phase factors for the signal model of a source
+ *
+ * This function returns the factors \f$ e^{2\pi i \Delta\phi(t)} \f$ by which the (almost) DC signal model is
+ * multiplied, where \f$ \Delta\phi(t) \f$ is given by \c get_phase_model. The factors are held in the
+ * \c ModelCache for the detector, and are only recalculated if any parameters other than the amplitude
+ * parameters have changed since they were last calculated. Most iterations of the sampler when searching
+ * over phase parameters as well as amplitude parameters will therefore not need to recalculate them.
+ *
+ * \param params [in] A set of pulsar parameters
+ * \param ifo [in] The ifo model structure containing the detector parameters and buffers
+ * \param freqFactor [in] the multiplicative factor on the pulsar frequency for a particular model
+ *
+ * \return A vector of phase factors (owned by the cache, so must not be freed), or NULL if there is no
+ * ephemeris data
+ *
+ * \sa get_phase_model
+ */
+const COMPLEX16Vector *get_phase_factors( PulsarParameters *params, LALInferenceIFOModel *ifo, REAL8 freqFactor ){
+  ModelCache *cache = get_model_cache( ifo );
+  REAL8Vector *dphi = NULL;
+
+  /* check whether any of the phase parameters have changed */
+  cache->changed |= check_phase_cache( cache, ifo ) | update_parameter_keys( cache, params );
+
+  if ( !cache->changed && cache->expphase != NULL && cache->freqFactor == freqFactor ){ return cache->expphase; }
+
+  if ( (dphi = get_phase_model( params, ifo, freqFactor )) == NULL ){ return NULL; }
+
+  if ( cache->expphase == NULL || cache->expphase->length != dphi->length ){
+    cache->expphase = XLALResizeCOMPLEX16Vector( cache->expphase, dphi->length );
+  }
+
+  for( UINT4 i=0; i<dphi->length; i++ ){ cache->expphase->data[i] = cexp( LAL_TWOPI * I * dphi->data[i] ); }
+  cache->freqFactor = freqFactor;
+
+  XLALDestroyREAL8Vector( dphi );
+
+  return cache->expphase;
+}
+
+
 /**
  * \brief Computes the delay between a GPS time at Earth and the solar system barycentre
  *
@@ -885,7 +998,7 @@ REAL8Vector *get_glitch_phase( PulsarParameters *pars, LIGOTimeGPSVector *datati
 void get_amplitude_model( PulsarParameters *pars, LALInferenceIFOModel *ifo ){
   UINT4 i = 0, j = 0, length;
 
-  REAL8 T, twopsi;
+  REAL8 twopsi;
   REAL8 cosiota = PulsarGetREAL8ParamOrZero( pars, "COSIOTA" );
   REAL8 siniota = sin(acos(cosiota));
   REAL8 s2psi = 0., c2psi = 0., spsi = 0., cpsi = 0.;
@@ -980,85 +1093,42 @@ void get_amplitude_model( PulsarParameters *pars, LALInferenceIFOModel *ifo ){
       }
 
       if ( varyphase || roq ){ /* have to compute the full time domain signal */
-        REAL8Vector *sidDayFrac = NULL;
-        REAL8 tsv, tsteps;
+        ModelCache *cache = get_model_cache( ifo );
+        const REAL8 *plus = NULL, *cross = NULL;
+        COMPLEX16 *sig = ifo->compTimeSignal->data->data;
 
-        REAL8Vector *LUfplus = NULL, *LUfcross = NULL, *LUfx = NULL, *LUfy = NULL, *LUfb = NULL, *LUfl = NULL;
+        /* get the antenna responses interpolated from the lookup tables to the data times (these do not
+         * depend on the model parameters, so are only calculated once for each detector) */
+        set_response_cache( cache, ifo, nonGR );
+        XLAL_CHECK_VOID( cache->respPlus != NULL, XLAL_EFUNC );
 
-        /* set lookup table parameters */
-        tsteps = (REAL8)(*(INT4*)LALInferenceGetVariable( ifo->params, "timeSteps" ));
-        tsv = LAL_DAYSID_SI / tsteps;
+        length = cache->respPlus->length;
+        plus = cache->respPlus->data;
+        cross = cache->respCross->data;
 
-        LUfplus = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "a_response_tensor" );
-        LUfcross = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "b_response_tensor" );
+        /* create the complex signal amplitude model appropriate for the harmonic */
+        if ( !nonGR ){
+          for( i=0; i<length; i++ ){
+            REAL8 plusT = plus[i]*c2psi + cross[i]*s2psi;
+            REAL8 crossT = cross[i]*c2psi - plus[i]*s2psi;
 
-        if ( nonGR ){
-          LUfx = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "a_response_vector" );
-          LUfy = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "b_response_vector" );
-          LUfb = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "a_response_scalar" );
-          LUfl = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "b_response_scalar" );
+            sig[i] = ( Cplus * plusT ) + ( Ccross * crossT );
+          }
         }
+        else{
+          const REAL8 *x = cache->respX->data, *y = cache->respY->data, *b = cache->respB->data, *l = cache->respL->data;
 
-        /* get the sidereal time since the initial data point % sidereal day */
-        sidDayFrac = *(REAL8Vector**)LALInferenceGetVariable( ifo->params, "siderealDay" );
-
-        length = IFO_XTRA_DATA( ifo )->times->length;
-
-        for( i=0; i<length; i++ ){
-          REAL8 plus00, plus01, cross00, cross01, plus = 0., cross = 0.;
-          REAL8 x00, x01, y00, y01, b00, b01, l00, l01;
-          REAL8 timeScaled, timeMin, timeMax;
-          REAL8 plusT = 0., crossT = 0., x = 0., y = 0., xT = 0., yT = 0., b = 0., l = 0.;
-          INT4 timebinMin, timebinMax;
-
-          /* set the time bin for the lookup table */
-          /* sidereal day in secs*/
-          T = sidDayFrac->data[i];
-          timebinMin = (INT4)fmod( floor(T / tsv), tsteps );
-          timeMin = timebinMin*tsv;
-          timebinMax = (INT4)fmod( timebinMin + 1, tsteps );
-          timeMax = timeMin + tsv;
-
-          /* get values of matrix for linear interpolation */
-          plus00 = LUfplus->data[timebinMin];
-          plus01 = LUfplus->data[timebinMax];
-
-          cross00 = LUfcross->data[timebinMin];
-          cross01 = LUfcross->data[timebinMax];
-
-          /* rescale time for linear interpolation on a unit square */
-          timeScaled = (T - timeMin)/(timeMax - timeMin);
-
-          plus = plus00 + (plus01-plus00)*timeScaled;
-          cross = cross00 + (cross01-cross00)*timeScaled;
-
-          plusT = plus*c2psi + cross*s2psi;
-          crossT = cross*c2psi - plus*s2psi;
-
-          if ( nonGR ){
-            x00 = LUfx->data[timebinMin];
-            x01 = LUfx->data[timebinMax];
-            y00 = LUfy->data[timebinMin];
-            y01 = LUfy->data[timebinMax];
-            b00 = LUfb->data[timebinMin];
-            b01 = LUfb->data[timebinMax];
-            l00 = LUfl->data[timebinMin];
-            l01 = LUfl->data[timebinMax];
-
-            x = x00 + (x01-x00)*timeScaled;
-            y = y00 + (y01-y00)*timeScaled;
-            b = b00 + (b01-b00)*timeScaled;
-            l = l00 + (l01-l00)*timeScaled;
-
-            xT = x*cpsi + y*spsi;
-            yT = y*cpsi - x*spsi;
-          }
+          for( i=0; i<length; i++ ){
+            REAL8 plusT = plus[i]*c2psi + cross[i]*s2psi;
+            REAL8 crossT = cross[i]*c2psi - plus[i]*s2psi;
+            REAL8 xT = x[i]*cpsi + y[i]*spsi;
+            REAL8 yT = y[i]*cpsi - x[i]*spsi;
 
-          /* create the complex signal amplitude model appropriate for the harmonic */
-          ifo->compTimeSignal->data->data[i] = ( Cplus * plusT ) + ( Ccross * crossT );
+            sig[i] = ( Cplus * plusT ) + ( Ccross * crossT );
 
-          /* add non-GR components if required */
-          if ( nonGR ){ ifo->compTimeSignal->data->data[i] += ( Cx*xT ) + ( Cy*yT ) + Cb*b + Cl*l; }
+            /* add non-GR components */
+            sig[i] += ( Cx*xT ) + ( Cy*yT ) + Cb*b[i] + Cl*l[i];
+          }
         }
       }
       else{ /* just have to calculate the values to multiply the pre-summed data */
@@ -1369,3 +1439,388 @@ void invert_source_params( PulsarParameters *params ){
     PulsarAddREAL8Param( params, "PHI21", phi21 );
   }
 }
+
+
+/**
+ * \brief Get the model cache for a detector
+ *
+ * This returns the \c ModelCache holding the parts of the signal model for the given detector (and frequency
+ * factor) data stream that do not need recalculating on each call. The cache is allocated the first time it is
+ * requested.
+ *
+ * \param ifo [in] The ifo model structure
+ *
+ * \return The model cache
+ */
+ModelCache *get_model_cache( LALInferenceIFOModel *ifo ){
+  XLAL_CHECK_NULL( ifo != NULL && IFO_XTRA_DATA( ifo ) != NULL, XLAL_EFAULT );
+
+  if ( IFO_XTRA_DATA( ifo )->cache == NULL ){
+    IFO_XTRA_DATA( ifo )->cache = XLALCalloc( 1, sizeof(ModelCache) );
+    XLAL_CHECK_NULL( IFO_XTRA_DATA( ifo )->cache != NULL, XLAL_ENOMEM );
+    IFO_XTRA_DATA( ifo )->cache->changed = ALL_PARAMS_CHANGED;
+  }
+
+  return IFO_XTRA_DATA( ifo )->cache;
+}
+
+
+/**
+ * \brief Free the model caches for a set of detectors
+ *
+ * This frees the \c ModelCache for each detector in the linked list of ifo models. The vectors the caches were
+ * calculated from (e.g. the time stamps, the heterodyne barycentring delays or the response lookup tables) are
+ * identified by their address, length and first and last values, so replacing them with vectors that differ in
+ * any of these is detected. This must be called if they are altered in place, or replaced by vectors that match
+ * in all of these, so that the caches are recalculated when the model is next called.
+ *
+ * \param ifo [in] The ifo model structure
+ */
+void free_model_cache( LALInferenceIFOModel *ifo ){
+  while ( ifo ){
+    ModelCache *cache = NULL;
+
+    if ( IFO_XTRA_DATA( ifo ) != NULL && ( cache = IFO_XTRA_DATA( ifo )->cache ) != NULL ){
+      reset_phase_cache( cache );
+
+      XLALDestroyREAL8Vector( cache->respPlus );
+      XLALDestroyREAL8Vector( cache->respCross );
+      XLALDestroyREAL8Vector( cache->respX );
+      XLALDestroyREAL8Vector( cache->respY );
+      XLALDestroyREAL8Vector( cache->respB );
+      XLALDestroyREAL8Vector( cache->respL );
+
+      XLALFree( cache );
+      IFO_XTRA_DATA( ifo )->cache = NULL;
+    }
+
+    ifo = ifo->next;
+  }
+}
+
+
+/* reset the phase parts of a model cache, so that they will be recalculated */
+static void reset_phase_cache( ModelCache *cache ){
+  XLALFree( cache->keys );
+  XLALDestroyREAL8Vector( cache->keyvalues );
+  XLALDestroyREAL8Vector( cache->dts );
+  XLALDestroyREAL8Vector( cache->bdts );
+  XLALDestroyREAL8Vector( cache->glitchphase );
+  XLALDestroyREAL8Vector( cache->deltatpows );
+  XLALDestroyREAL8Vector( cache->innerphis );
+  XLALDestroyCOMPLEX16Vector( cache->expphase );
+
+  cache->nkeys = 0;
+  cache->keys = NULL;
+  cache->keyvalues = NULL;
+  cache->dts = cache->bdts = cache->glitchphase = NULL;
+  cache->deltatpows = cache->innerphis = NULL;
+  cache->expphase = NULL;
+  cache->nfreqs = 0;
+  cache->nonzeroDdelay = 0;
+  cache->changed = ALL_PARAMS_CHANGED;
+}
+
+
+/* get the identity of a (possibly NULL) fixed input vector of the model cache */
+static ModelCacheVectorId get_vector_id( const REAL8Vector *vec ){
+  ModelCacheVectorId id = { NULL, 0, 0., 0. };
+
+  if ( vec != NULL ){
+    id.data = vec;
+    id.length = vec->length;
+    if ( vec->length > 0 ){
+      id.first = vec->data[0];
+      id.last = vec->data[vec->length-1];
+    }
+  }
+
+  return id;
+}
+
+
+/* get the identity of the (possibly NULL) time stamps of the model cache */
+static ModelCacheVectorId get_times_id( const LIGOTimeGPSVector *times ){
+  ModelCacheVectorId id = { NULL, 0, 0., 0. };
+
+  if ( times != NULL ){
+    id.data = times;
+    id.length = times->length;
+    if ( times->length > 0 ){
+      id.first = XLALGPSGetREAL8( &times->data[0] );
+      id.last = XLALGPSGetREAL8( &times->data[times->length-1] );
+    }
+  }
+
+  return id;
+}
+
+
+/* check if two fixed input vectors of the model cache are the same (compare the values bitwise, so that NaNs
+ * compare equal) */
+static UINT4 equal_vector_ids( const ModelCacheVectorId *a, const ModelCacheVectorId *b ){
+  return ( a->data == b->data && a->length == b->length && !memcmp( &a->first, &b->first, sizeof(REAL8) ) &&
+           !memcmp( &a->last, &b->last, sizeof(REAL8) ) );
+}
+
+
+/* check that the fixed inputs to the phase model are those the cache was calculated for, and reset the phase
+ * parts of the cache if not (returning that all parameters have changed). The inputs are identified by their
+ * address, length and first and last values, so vectors replaced in ifo->params by ones of a different length
+ * or end values are detected even if allocated at the same address; vectors altered in place in any other
+ * way, or replaced by ones that match all of these, still require a call to free_model_cache() */
+static UINT4 check_phase_cache( ModelCache *cache, LALInferenceIFOModel *ifo ){
+  const REAL8Vector *fixdts = NULL, *fixbdts = NULL, *fixglitchphase = NULL;
+  UINT4 varyflags = 0;
+
+  if ( LALInferenceCheckVariable( ifo->params, "ssb_delays" ) ){
+    fixdts = LALInferenceGetREAL8VectorVariable( ifo->params, "ssb_delays" );
+  }
+  if ( LALInferenceCheckVariable( ifo->params, "bsb_delays" ) ){
+    fixbdts = LALInferenceGetREAL8VectorVariable( ifo->params, "bsb_delays" );
+  }
+  if ( LALInferenceCheckVariable( ifo->params, "glitch_phase" ) ){
+    fixglitchphase = LALInferenceGetREAL8VectorVariable( ifo->params, "glitch_phase" );
+  }
+  if ( LALInferenceCheckVariable( ifo->params, "varyskypos" ) ){ varyflags |= 1; }
+  if ( LALInferenceCheckVariable( ifo->params, "varybinary" ) ){ varyflags |= 2; }
+  if ( LALInferenceCheckVariable( ifo->params, "varyglitch" ) ){ varyflags |= 4; }
+
+  ModelCacheVectorId times = get_times_id( IFO_XTRA_DATA( ifo )->times );
+  ModelCacheVectorId dtsid = get_vector_id( fixdts ), bdtsid = get_vector_id( fixbdts );
+  ModelCacheVectorId glitchid = get_vector_id( fixglitchphase );
+
+  if ( equal_vector_ids( &cache->times, &times ) && equal_vector_ids( &cache->fixdts, &dtsid ) &&
+       equal_vector_ids( &cache->fixbdts, &bdtsid ) && equal_vector_ids( &cache->fixglitchphase, &glitchid ) &&
+       cache->varyflags == varyflags ){
+    return 0;
+  }
+
+  reset_phase_cache( cache );
+  cache->times = times;
+  cache->fixdts = dtsid;
+  cache->fixbdts = bdtsid;
+  cache->fixglitchphase = glitchid;
+  cache->varyflags = varyflags;
+
+  return ALL_PARAMS_CHANGED;
+}
+
+
+/* get the class of a parameter, i.e. the parts of the model that need recalculating when it changes */
+static INT4 classify_parameter( const CHAR *name ){
+  size_t len = strlen( name );
+  UINT4 i = 0;
+
+  /* amplitude parameters, including those for the l=2, m=1 harmonic with an "_F" suffix */
+  for ( i = 0; i < NUMAMPPARS; i++ ){
+    if ( !strcmp( name, amppars[i] ) ){ return PARAM_AMPLITUDE; }
+    if ( len > 2 && !strcmp( name + len - 2, "_F" ) && strlen( amppars[i] ) == len - 2 && !strncmp( name, amppars[i], len - 2 ) ){
+      return PARAM_AMPLITUDE;
+    }
+  }
+
+  for ( i = 0; i < NUMSKYPARS; i++ ){ if ( !strcmp( name, skypars[i] ) ){ return PARAM_SKY; } }
+  if ( !strcmp( name, "RAJ" ) || !strcmp( name, "DECJ" ) || !strcmp( name, "PEPOCH" ) ){ return PARAM_SKY; }
+
+  for ( i = 0; i < NUMGLITCHPARS; i++ ){ if ( !strcmp( name, glitchpars[i] ) ){ return PARAM_GLITCH; } }
+
+  if ( !strcmp( name, "F" ) || !strcmp( name, "DELTAF" ) ){ return PARAM_FREQ; }
+
+  /* anything else (binary system parameters, the speed of gravitational waves, etc.) is treated as a timing
+   * parameter, i.e. changing it requires all but the solar system barycentring delays to be recalculated */
+  return PARAM_TIMING;
+}
+
+
+/* get the number of values of a parameter held in its key, or zero if its values cannot be compared */
+static UINT4 parameter_key_length( const PulsarParam *item ){
+  switch ( item->type ){
+    case PULSARTYPE_REAL8_t:
+    case PULSARTYPE_UINT4_t:
+      return 1;
+    case PULSARTYPE_REAL8Vector_t:
+      return (*(REAL8Vector**)item->value)->length;
+    case PULSARTYPE_string_t:
+      return strlen( *(CHAR**)item->value ) + 1;
+    default:
+      return 0;
+  }
+}
+
+
+/* set the key values of a parameter, returning whether any of them have changed */
+static UINT4 update_key_values( REAL8 *values, const PulsarParam *item ){
+  const REAL8 *vec = NULL;
+  const CHAR *str = NULL;
+  UINT4 changed = 0, i = 0;
+
+  switch ( item->type ){
+    case PULSARTYPE_REAL8_t:
+      changed = ( values[0] != *(REAL8*)item->value );
+      values[0] = *(REAL8*)item->value;
+      break;
+    case PULSARTYPE_UINT4_t:
+      changed = ( values[0] != (REAL8)(*(UINT4*)item->value) );
+      values[0] = (REAL8)(*(UINT4*)item->value);
+      break;
+    case PULSARTYPE_REAL8Vector_t:
+      vec = (*(REAL8Vector**)item->value)->data;
+      for ( i = 0; i < (*(REAL8Vector**)item->value)->length; i++ ){
+        if ( values[i] != vec[i] ){ changed = 1; values[i] = vec[i]; }
+      }
+      break;
+    case PULSARTYPE_string_t:
+      str = *(CHAR**)item->value;
+      for ( i = 0; i == 0 || str[i-1] != '\0'; i++ ){
+        if ( values[i] != (REAL8)str[i] ){ changed = 1; values[i] = (REAL8)str[i]; }
+      }
+      break;
+    default:
+      changed = 1; /* values of other types cannot be compared, so always count as a change */
+      break;
+  }
+
+  return changed;
+}
+
+
+/* classify the parameters, and set up the keys holding the values of the non-amplitude parameters */
+static UINT4 set_parameter_keys( ModelCache *cache, PulsarParameters *params ){
+  ModelCacheKey *keys = NULL;
+  UINT4 k = 0, nvalues = 0;
+
+  cache->nkeys = 0;
+  if ( ( keys = XLALRealloc( cache->keys, sizeof(ModelCacheKey)*( params->nparams + 1 ) ) ) == NULL ){ return ALL_PARAMS_CHANGED; }
+  cache->keys = keys;
+
+  for ( PulsarParam *item = params->head; item != NULL; item = item->next, k++ ){
+    XLALStringCopy( keys[k].name, item->name, sizeof(keys[k].name) );
+    keys[k].type = item->type;
+    keys[k].paramclass = classify_parameter( item->name );
+    keys[k].offset = nvalues;
+    keys[k].nvalues = ( keys[k].paramclass == PARAM_AMPLITUDE ) ? 0 : parameter_key_length( item );
+    nvalues += keys[k].nvalues;
+  }
+
+  if ( nvalues > 0 ){
+    REAL8Vector *keyvalues = XLALResizeREAL8Vector( cache->keyvalues, nvalues );
+    if ( keyvalues == NULL ){ return ALL_PARAMS_CHANGED; }
+    cache->keyvalues = keyvalues;
+
+    k = 0;
+    for ( PulsarParam *item = params->head; item != NULL; item = item->next, k++ ){
+      if ( keys[k].nvalues > 0 ){ update_key_values( &keyvalues->data[keys[k].offset], item ); }
+    }
+  }
+
+  /* only use the keys once they are complete, so that a failure above just means they are set up again */
+  cache->nkeys = k;
+
+  return ALL_PARAMS_CHANGED;
+}
+
+
+/* compare the values of the non-amplitude parameters with those for which the cache was calculated, returning
+ * the classes of parameters that have changed. The parameters are only classified again if they are not the
+ * same, and in the same order, as those the keys were set up for. */
+static UINT4 update_parameter_keys( ModelCache *cache, PulsarParameters *params ){
+  const PulsarParam *item = NULL;
+  UINT4 changed = 0, k = 0;
+
+  for ( item = params->head; item != NULL && k < cache->nkeys; item = item->next, k++ ){
+    const ModelCacheKey *key = &cache->keys[k];
+
+    if ( key->type != item->type || strcmp( key->name, item->name ) ){ break; }
+    if ( key->paramclass == PARAM_AMPLITUDE ){ continue; }
+    if ( key->nvalues != parameter_key_length( item ) ){ break; }
+
+    if ( key->nvalues == 0 || update_key_values( &cache->keyvalues->data[key->offset], item ) ){
+      changed |= PARAM_CHANGED( key->paramclass );
+    }
+  }
+
+  if ( item != NULL || k != cache->nkeys ){ return set_parameter_keys( cache, params ); }
+
+  return changed;
+}
+
+
+/* linearly interpolate the antenna pattern lookup tables to the sidereal times of the data, if this has not
+ * already been done for the current tables and times */
+static void set_response_cache( ModelCache *cache, LALInferenceIFOModel *ifo, UINT4 nonGR ){
+  UINT4 i = 0, length = IFO_XTRA_DATA( ifo )->times->length;
+  REAL8 tsv, tsteps;
+
+  REAL8Vector *sidDayFrac = NULL;
+  REAL8Vector *LUfplus = NULL, *LUfcross = NULL, *LUfx = NULL, *LUfy = NULL, *LUfb = NULL, *LUfl = NULL;
+
+  LUfplus = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "a_response_tensor" );
+  LUfcross = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "b_response_tensor" );
+
+  if ( nonGR ){
+    LUfx = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "a_response_vector" );
+    LUfy = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "b_response_vector" );
+    LUfb = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "a_response_scalar" );
+    LUfl = *(REAL8Vector **)LALInferenceGetVariable( ifo->params, "b_response_scalar" );
+  }
+
+  /* identify the tables and sidereal times as for the phase inputs, see check_phase_cache() */
+  ModelCacheVectorId tables[6] = { get_vector_id( LUfplus ), get_vector_id( LUfcross ), get_vector_id( LUfx ),
+                                   get_vector_id( LUfy ), get_vector_id( LUfb ), get_vector_id( LUfl ) };
+
+  /* get the sidereal time since the initial data point % sidereal day */
+  sidDayFrac = *(REAL8Vector**)LALInferenceGetVariable( ifo->params, "siderealDay" );
+  ModelCacheVectorId sidDayFracId = get_vector_id( sidDayFrac );
+
+  UINT4 uptodate = ( cache->respPlus != NULL && cache->respPlus->length == length &&
+                     equal_vector_ids( &cache->sidDayFrac, &sidDayFracId ) );
+  for ( i = 0; uptodate && i < 6; i++ ){ uptodate = equal_vector_ids( &cache->respTables[i], &tables[i] ); }
+  if ( uptodate ){
+    return; /* already up to date */
+  }
+  cache->sidDayFrac = get_vector_id( NULL ); /* not up to date until the interpolation below is complete */
+
+  /* set lookup table parameters */
+  tsteps = (REAL8)(*(INT4*)LALInferenceGetVariable( ifo->params, "timeSteps" ));
+  tsv = LAL_DAYSID_SI / tsteps;
+
+  XLAL_CHECK_VOID( ( cache->respPlus = XLALResizeREAL8Vector( cache->respPlus, length ) ) != NULL, XLAL_EFUNC );
+  XLAL_CHECK_VOID( ( cache->respCross = XLALResizeREAL8Vector( cache->respCross, length ) ) != NULL, XLAL_EFUNC );
+
+  if ( nonGR ){
+    XLAL_CHECK_VOID( ( cache->respX = XLALResizeREAL8Vector( cache->respX, length ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_VOID( ( cache->respY = XLALResizeREAL8Vector( cache->respY, length ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_VOID( ( cache->respB = XLALResizeREAL8Vector( cache->respB, length ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_VOID( ( cache->respL = XLALResizeREAL8Vector( cache->respL, length ) ) != NULL, XLAL_EFUNC );
+  }
+
+  for( i=0; i<length; i++ ){
+    REAL8 T, timeScaled, timeMin, timeMax;
+    INT4 timebinMin, timebinMax;
+
+    /* set the time bin for the lookup table */
+    /* sidereal day in secs*/
+    T = sidDayFrac->data[i];
+    timebinMin = (INT4)fmod( floor(T / tsv), tsteps );
+    timeMin = timebinMin*tsv;
+    timebinMax = (INT4)fmod( timebinMin + 1, tsteps );
+    timeMax = timeMin + tsv;
+
+    /* rescale time for linear interpolation on a unit square */
+    timeScaled = (T - timeMin)/(timeMax - timeMin);
+
+    cache->respPlus->data[i] = LUfplus->data[timebinMin] + (LUfplus->data[timebinMax]-LUfplus->data[timebinMin])*timeScaled;
+    cache->respCross->data[i] = LUfcross->data[timebinMin] + (LUfcross->data[timebinMax]-LUfcross->data[timebinMin])*timeScaled;
+
+    if ( nonGR ){
+      cache->respX->data[i] = LUfx->data[timebinMin] + (LUfx->data[timebinMax]-LUfx->data[timebinMin])*timeScaled;
+      cache->respY->data[i] = LUfy->data[timebinMin] + (LUfy->data[timebinMax]-LUfy->data[timebinMin])*timeScaled;
+      cache->respB->data[i] = LUfb->data[timebinMin] + (LUfb->data[timebinMax]-LUfb->data[timebinMin])*timeScaled;
+      cache->respL->data[i] = LUfl->data[timebinMin] + (LUfl->data[timebinMax]-LUfl->data[timebinMin])*timeScaled;
+    }
+  }
+
+  cache->sidDayFrac = sidDayFracId;
+  memcpy( cache->respTables, tables, sizeof(tables) );
+}
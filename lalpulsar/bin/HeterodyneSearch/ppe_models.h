@@ -35,11 +35,72 @@ extern "C" {
 #define IFO_XTRA_DATA( ifo ) ( (IFOModelExtraData*) ( ifo )->extraData )
 
 /* types */
+
+/** A parameter in the order the phase model is given them, and where its values are held in the \c ModelCache */
+typedef struct tagModelCacheKey {
+  CHAR name[PULSAR_PARNAME_MAX];      /** Parameter name */
+  PulsarParamType type;               /** Parameter type */
+  INT4 paramclass;                    /** Class of parts of the model that depend on the parameter */
+  UINT4 offset;                       /** Index of the first of its values in the key values */
+  UINT4 nvalues;                      /** Number of values (none for amplitude parameters) */
+} ModelCacheKey;
+
+/** Identity of a fixed input vector of the model cache. The address alone is not enough, as a vector may be
+ * freed and another allocated at the same address, so the length and first and last values are also kept */
+typedef struct tagModelCacheVectorId {
+  const void *data;                   /** Address of the vector */
+  UINT4 length;                       /** Length of the vector */
+  REAL8 first;                        /** First value of the vector (GPS seconds for time stamps) */
+  REAL8 last;                         /** Last value of the vector (GPS seconds for time stamps) */
+} ModelCacheVectorId;
+
+/** Cached parts of the signal model for one detector/data stream. Each part is only recalculated when
+ * the parameters (or fixed input vectors) it depends on change, see \c get_model_cache */
+typedef struct tagModelCache {
+  /* fixed inputs that the phase parts of the cache were calculated for */
+  ModelCacheVectorId times;           /** Time stamps */
+  ModelCacheVectorId fixdts;          /** Solar system barycentring delays at the heterodyne parameters */
+  ModelCacheVectorId fixbdts;         /** Binary system barycentring delays at the heterodyne parameters */
+  ModelCacheVectorId fixglitchphase;  /** Glitch phase at the heterodyne parameters */
+  UINT4 varyflags;                    /** Which of the sky position, binary and glitch parameters vary */
+
+  /* the parameters, classified when the set of parameters changes, and their values that the phase parts of
+   * the cache were calculated for */
+  UINT4 nkeys;                        /** Number of parameters */
+  ModelCacheKey *keys;                /** Name, type, class and position of the values of each parameter */
+  REAL8Vector *keyvalues;             /** Values of the non-amplitude parameters */
+  UINT4 changed;                      /** Classes of parameters changed since the phase was last calculated */
+
+  REAL8Vector *dts;                   /** Solar system barycentring delays */
+  REAL8Vector *bdts;                  /** Binary system barycentring delays */
+  REAL8Vector *glitchphase;           /** Glitch phase */
+
+  /* parts of the Taylor expansion of the phase that do not depend on the frequency parameters */
+  UINT4 nfreqs;                       /** Number of frequency (derivative) terms */
+  REAL8 pepoch;                       /** Epoch of the frequency parameters */
+  REAL8 cgw;                          /** Speed of gravitational waves as a fraction of that of light */
+  UINT4 isbinary;                     /** Set if the heterodyne binary system delays are included */
+  UINT4 nonzeroDdelay;                /** Set if the barycentring delays differ from the heterodyne values */
+  REAL8Vector *deltatpows;            /** Powers of the time since the epoch (nfreqs x length) */
+  REAL8Vector *innerphis;             /** Terms multiplying the frequencies due to changed delays (nfreqs x length) */
+
+  REAL8 freqFactor;                   /** Frequency factor of the phase factors */
+  COMPLEX16Vector *expphase;          /** Phase factors exp(2 pi i dphi) */
+
+  /* antenna pattern lookup tables linearly interpolated to the data time stamps */
+  ModelCacheVectorId sidDayFrac;      /** Sidereal times the response was interpolated at */
+  ModelCacheVectorId respTables[6];   /** The tensor, vector and scalar lookup tables that were interpolated */
+  REAL8Vector *respPlus, *respCross;  /** Tensor responses */
+  REAL8Vector *respX, *respY;         /** Vector responses */
+  REAL8Vector *respB, *respL;         /** Scalar responses */
+} ModelCache;
+
 typedef struct tagIFOModelExtraData {
   LIGOTimeGPSVector  *times;   /** Vector of time stamps for time domain data */
   EphemerisData      *ephem;   /** Ephemeris data */
   TimeCorrectionData *tdat;    /** Einstein delay time correction data */
   TimeCorrectionType  ttype;   /** The time correction type e.g. TDB, TCB */
+  ModelCache         *cache;   /** Cached parts of the signal model */
 } IFOModelExtraData;
 
 /* global variables */
@@ -57,6 +118,12 @@ void set_nonGR_model_parameters( PulsarParameters *pars, char* nonGRmodel );
 
 REAL8Vector *get_phase_model( PulsarParameters *params, LALInferenceIFOModel *ifo, REAL8 freqFactor );
 
+const COMPLEX16Vector *get_phase_factors( PulsarParameters *params, LALInferenceIFOModel *ifo, REAL8 freqFactor );
+
+ModelCache *get_model_cache( LALInferenceIFOModel *ifo );
+
+void free_model_cache( LALInferenceIFOModel *ifo );
+
 REAL8Vector *get_ssb_delay( PulsarParameters *pars, LIGOTimeGPSVector *datatimes, EphemerisData *ephem,
                             TimeCorrectionData *tdat, TimeCorrectionType ttype, LALDetector *detector);
 
@@ -454,6 +454,7 @@ void generate_interpolant( LALInferenceRunState *runState ){
         XLALDestroyREAL8Array( RBquad );
 
         XLALDestroyREAL8Vector( deltas );
+        free_model_cache( ifotmp );
         XLALDestroyTimestampVector( IFO_XTRA_DATA( ifotmp )->times );
         XLALDestroyCOMPLEX16TimeSeries( ifotmp->compTimeSignal );
         LALInferenceClearVariables( ifotmp->params );
@@ -657,6 +658,9 @@ void generate_interpolant( LALInferenceRunState *runState ){
       LALInferenceAddVariable( ifo->params, "glitch_phase_full", &glitchphasecopy, LALINFERENCE_REAL8Vector_t, LALINFERENCE_PARAM_FIXED );
     }
 
+    /* the cached parts of the model were calculated at the full set of time stamps, so must be reset */
+    free_model_cache( ifo );
+
     ifo->compTimeSignal = XLALResizeCOMPLEX16TimeSeries( ifo->compTimeSignal, 0, dmlength+mmlength );
 
     if ( inputroq ){
@@ -506,4 +506,92 @@ void compare_likelihoods( LALInferenceRunState *rs ){
   XLALDestroyTokenList( paramNames );
 }
 
+
+/**
+ * \brief Check the cached parts of the signal model against recalculating them
+ *
+ * This function will be run if the \c check-model-cache command line argument is present. Starting from the
+ * parameters given in the par file, each parameter with a uniform prior in the prior file is moved in turn to a
+ * new value within its prior range, so that, for example, sky position, binary system, glitch, frequency and
+ * amplitude parameters change one at a time. After each change the signal model is calculated using the
+ * \c ModelCache kept from the previous call, and again after the caches have been freed, and the two models must
+ * be identical.
+ *
+ * \param runState [in] The analysis information structure
+ *
+ * \return XLAL_SUCCESS if the models agree for all parameters
+ */
+INT4 check_model_cache( LALInferenceRunState *runState ){
+  LALInferenceModel *model = runState->threads[0].model;
+  LALInferenceVariables *curparams = NULL;
+  LALInferenceIFOModel *ifo = NULL;
+  COMPLEX16Vector **cached = NULL;
+  UINT4 nifos = 0, nchecked = 0, n = 0, i = 0;
+  UINT4 verbose = LALInferenceCheckVariable( runState->algorithmParams, "verbose" );
+  INT4 errnum = XLAL_SUCCESS;
+
+  /* models for each data stream calculated using the caches */
+  for ( ifo = model->ifo; ifo != NULL; ifo = ifo->next ){ nifos++; }
+  cached = XLALCalloc( nifos, sizeof(COMPLEX16Vector*) );
+  XLAL_CHECK( cached != NULL, XLAL_ENOMEM );
+
+  curparams = XLALCalloc( 1, sizeof(LALInferenceVariables) );
+  LALInferenceCopyVariables( runState->threads[0].currentParams, curparams );
+
+  /* calculate the model at the initial parameters to fill the caches */
+  LALInferenceCopyVariables( curparams, model->params );
+  model->templt( model );
+
+  for ( LALInferenceVariableItem *item = curparams->head; item != NULL && errnum == XLAL_SUCCESS; item = item->next ){
+    REAL8 low = 0., high = 0., value = 0.;
+
+    if ( item->vary == LALINFERENCE_PARAM_FIXED || item->type != LALINFERENCE_REAL8_t ||
+         !LALInferenceCheckMinMaxPrior( runState->priorArgs, item->name ) ){ continue; }
+
+    /* move the parameter to a new value within its prior range */
+    LALInferenceGetMinMaxPrior( runState->priorArgs, item->name, &low, &high );
+    value = low + 0.3*( high - low );
+    LALInferenceSetVariable( curparams, item->name, &value );
+
+    /* get the model using the caches from the previous parameters */
+    LALInferenceCopyVariables( curparams, model->params );
+    model->templt( model );
+    for ( ifo = model->ifo, n = 0; ifo != NULL; ifo = ifo->next, n++ ){
+      cached[n] = XLALResizeCOMPLEX16Vector( cached[n], ifo->compTimeSignal->data->length );
+      memcpy( cached[n]->data, ifo->compTimeSignal->data->data, sizeof(COMPLEX16)*cached[n]->length );
+    }
+
+    /* get the model again from scratch, and compare */
+    free_model_cache( model->ifo );
+    model->templt( model );
+    for ( ifo = model->ifo, n = 0; ifo != NULL && errnum == XLAL_SUCCESS; ifo = ifo->next, n++ ){
+      for ( i = 0; i < cached[n]->length; i++ ){
+        if ( cached[n]->data[i] != ifo->compTimeSignal->data->data[i] ){
+          XLAL_PRINT_ERROR( "Model with cache differs from model without cache after changing %s, for data stream %u at sample %u: (%.16le, %.16le) != (%.16le, %.16le)",
+                            item->name, n, i, creal(cached[n]->data[i]), cimag(cached[n]->data[i]),
+                            creal(ifo->compTimeSignal->data->data[i]), cimag(ifo->compTimeSignal->data->data[i]) );
+          errnum = XLAL_EFAILED;
+          break;
+        }
+      }
+    }
+
+    if ( verbose && errnum == XLAL_SUCCESS ){ fprintf(stderr, "Model cache agrees after changing %s\n", item->name); }
+    nchecked++;
+  }
+
+  for ( n = 0; n < nifos; n++ ){ XLALDestroyCOMPLEX16Vector( cached[n] ); }
+  XLALFree( cached );
+  LALInferenceClearVariables( curparams );
+  XLALFree( curparams );
+  free_model_cache( model->ifo );
+
+  XLAL_CHECK( errnum == XLAL_SUCCESS, errnum );
+  XLAL_CHECK( nchecked > 0, XLAL_EINVAL, "No parameters with uniform priors to change" );
+
+  fprintf(stderr, "Model cache agrees for changes to %u parameters\n", nchecked);
+
+  return XLAL_SUCCESS;
+}
+
 /*----------------------- END OF TESTING FUNCTIONS ---------------------------*/
@@ -25,6 +25,7 @@
 #define _PPE_TESTING_H
 
 #include "pulsar_parameter_estimation_nested.h"
+#include "ppe_models.h"
 #include "ppe_utils.h"
 
 #include <gsl/gsl_roots.h>
@@ -63,6 +64,8 @@ void outputPriorSamples( LALInferenceRunState *runState );
 
 void compare_likelihoods( LALInferenceRunState *rs );
 
+INT4 check_model_cache( LALInferenceRunState *runState );
+
 #ifdef __cplusplus
 }
 #endif
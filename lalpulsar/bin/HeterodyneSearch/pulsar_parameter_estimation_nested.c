@@ -147,6 +147,7 @@ INT4 main( INT4 argc, CHAR *argv[] ){
   ProcessParamsTable *param_table, *testgausslike;
   LALInferenceRunState runState;
   REAL8 logZnoise = 0.;
+  INT4 retval = 0;
   struct timeval time1, time2;
   gettimeofday(&time1, NULL); /* time program */
 
@@ -224,56 +225,62 @@ INT4 main( INT4 argc, CHAR *argv[] ){
   /* Initialise the prior distribution given the command line arguments */
   initialise_prior( &runState );
 
-  /* create sum square of the data to speed up the likelihood calculation */
-  if( !testgausslike ){
-    sum_data( &runState );
+  /* check the cached parts of the signal model instead of running the search */
+  if( !testgausslike && LALInferenceGetProcParamVal(param_table, "--check-model-cache") ){
+    if ( check_model_cache( &runState ) != XLAL_SUCCESS ){ retval = 1; }
   }
+  else{
+    /* create sum square of the data to speed up the likelihood calculation */
+    if( !testgausslike ){
+      sum_data( &runState );
+    }
 
-  /* check whether using reduced order quadrature */
-  if( !testgausslike ){
-    generate_interpolant( &runState );
-  }
+    /* check whether using reduced order quadrature */
+    if( !testgausslike ){
+      generate_interpolant( &runState );
+    }
 
-  if( !testgausslike ){
-    gridOutput( &runState );
-  }
+    if( !testgausslike ){
+      gridOutput( &runState );
+    }
 
-  /* get noise likelihood and add as variable to runState */
-  if( !testgausslike ){
-    logZnoise = noise_only_likelihood( &runState );
-  }
-  else{ logZnoise = 0.; }
-  LALInferenceAddVariable( runState.algorithmParams, "logZnoise", &logZnoise, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_FIXED );
+    /* get noise likelihood and add as variable to runState */
+    if( !testgausslike ){
+      logZnoise = noise_only_likelihood( &runState );
+    }
+    else{ logZnoise = 0.; }
+    LALInferenceAddVariable( runState.algorithmParams, "logZnoise", &logZnoise, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_FIXED );
 
-  /* Create live points array and fill initial parameters */
-  if( !LALInferenceGetProcParamVal(param_table, "--compare-likelihoods") ){
-    setup_live_points_array_wrapper( &runState );
-  }
+    /* Create live points array and fill initial parameters */
+    if( !LALInferenceGetProcParamVal(param_table, "--compare-likelihoods") ){
+      setup_live_points_array_wrapper( &runState );
+    }
 
-  /* output the live points sampled from the prior */
-  outputPriorSamples( &runState );
+    /* output the live points sampled from the prior */
+    outputPriorSamples( &runState );
 
-  /* Initialise the MCMC proposal distribution */
-  initialise_proposal( &runState );
+    /* Initialise the MCMC proposal distribution */
+    initialise_proposal( &runState );
 
-  /* Set up threads */
-  initialise_threads( &runState, 1 );
+    /* Set up threads */
+    initialise_threads( &runState, 1 );
 
-  if( !LALInferenceGetProcParamVal(param_table, "--compare-likelihoods") ){
-    /* Call the nested sampling algorithm */
-    runState.algorithm( &runState );
-  }
-  else{
-    /* compare likelihoods from previous run */
-    compare_likelihoods( &runState );
-    return 0;
-  }
+    if( !LALInferenceGetProcParamVal(param_table, "--compare-likelihoods") ){
+      /* Call the nested sampling algorithm */
+      runState.algorithm( &runState );
+    }
+    else{
+      /* compare likelihoods from previous run */
+      compare_likelihoods( &runState );
+      return 0;
+    }
 
-  /* get SNR of highest likelihood point */
-  if( !testgausslike ){ get_loudest_snr( &runState ); }
+    /* get SNR of highest likelihood point */
+    if( !testgausslike ){ get_loudest_snr( &runState ); }
 
-  /* output log evidence and 95% upper limit of test Gaussian likelihood */
-  if ( testgausslike ){ test_gaussian_output( &runState ); }
+    /* output log evidence and 95% upper limit of test Gaussian likelihood */
+    if ( testgausslike ){ test_gaussian_output( &runState ); }
+  }
 
   /* close timing file */
   if ( LALInferenceCheckVariable( runState.algorithmParams, "timefile" ) ){
@@ -285,5 +292,5 @@ INT4 main( INT4 argc, CHAR *argv[] ){
     fclose(timefile);
   }
 
-  return 0;
+  return retval;
 }
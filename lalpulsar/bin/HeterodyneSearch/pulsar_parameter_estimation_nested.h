@@ -331,6 +331,11 @@ extern "C" {
                     \"_timings\" will contain the timings\n"\
 " --sampleprior      (UINT4) Set this to be a number of samples generated from\n\
                     the prior. The nested sampling will not be performed\n"\
+"\n"\
+" Testing:\n"\
+" --check-model-cache Change each parameter with a uniform prior in turn, check\n\
+                    that the signal model using the cached parts of the model\n\
+                    is identical to that recalculated without them, and exit\n"\
 "\n"
 
 /**
@@ -684,6 +684,91 @@ if [ "$fail3" = "1" ]; then
     exit 2
 fi
 
+################### MULTIPLE PULSARS #######################
+
+# heterodyne several pulsars from a single pass through the frame data with
+# --pulsar-list, using several OpenMP threads, and check that the output for
+# each pulsar is identical to that of a run for that pulsar alone
+
+# create parameter files for two more pulsars
+PSRNAMES="$PSRNAME J0100+1000 J2000-3000"
+
+echo PSR    J0100+1000 > J0100+1000.par
+echo F0     123.456789 >> J0100+1000.par
+echo F1     -1.0e-11 >> J0100+1000.par
+echo RAJ    01:00:00.0 >> J0100+1000.par
+echo DECJ   10:00:00.0 >> J0100+1000.par
+echo PEPOCH $PEPOCH >> J0100+1000.par
+echo UNITS  $UNITS >> J0100+1000.par
+
+echo PSR    J2000-3000 > J2000-3000.par
+echo F0     301.234567 >> J2000-3000.par
+echo F1     -3.0e-10 >> J2000-3000.par
+echo RAJ    20:00:00.0 >> J2000-3000.par
+echo DECJ   -30:00:00.0 >> J2000-3000.par
+echo PEPOCH $PEPOCH >> J2000-3000.par
+echo UNITS  $UNITS >> J2000-3000.par
+
+if [ $? != "0" ]; then
+  echo Error writing parameter file!
+  exit 2
+fi
+
+for HETFLAG in 0 3; do
+  if [ $HETFLAG = "0" ]; then
+    HETARGS="--heterodyne-flag 0 --sample-rate $SRATE1 --resample-rate $SRATE2 --filter-knee $FKNEE"
+  else
+    HETARGS="--ephem-earth-file $EEPHEM --ephem-sun-file $SEPHEM --ephem-time-file $TEPHEM --heterodyne-flag 3 --sample-rate $SRATE1 --resample-rate $SRATE3 --filter-knee $FKNEE --calibrate --response-file $RESPFILE --stddev-thresh 5"
+  fi
+  COMMONARGS="--ifo $DETECTOR --data-file $LOCATION/cachefile --seg-file $LOCATION/segfile --channel $CHANNEL --freq-factor 2"
+
+  # heterodyne each pulsar on its own
+  rm -f pulsarlist
+  for PSR in $PSRNAMES; do
+    echo Performing heterodyne - mode $HETFLAG - for pulsar $PSR alone
+    $CODENAME $HETARGS $COMMONARGS --pulsar $PSR --param-file $PSR.par --output-file $OUTDIR/single_${HETFLAG}_${PSR}
+
+    ret_code=$?
+    if [ $ret_code != "0" ]; then
+      echo lalpulsar_heterodyne exited with error $ret_code!
+      exit 2
+    fi
+
+    echo $PSR.par $OUTDIR/list_${HETFLAG}_${PSR} >> pulsarlist
+  done
+
+  # heterodyne all pulsars at once
+  echo Performing heterodyne - mode $HETFLAG - for pulsars in a list, with 4 OpenMP threads
+  OMP_NUM_THREADS=4 $CODENAME $HETARGS $COMMONARGS --pulsar-list pulsarlist
+
+  ret_code=$?
+  if [ $ret_code != "0" ]; then
+    echo lalpulsar_heterodyne exited with error $ret_code!
+    exit 2
+  fi
+
+  # compare outputs, ignoring the headers which contain the creation time and command line
+  for PSR in $PSRNAMES; do
+    if [ ! -f $OUTDIR/list_${HETFLAG}_${PSR} ]; then
+      echo Error! Code has not output a heterodyne file for pulsar $PSR from the pulsar list
+      exit 2
+    fi
+
+    grep -v '^%' $OUTDIR/single_${HETFLAG}_${PSR} > single.dat
+    grep -v '^%' $OUTDIR/list_${HETFLAG}_${PSR} > list.dat
+    if [ ! -s single.dat ]; then
+      echo Error! Heterodyne of pulsar $PSR alone - mode $HETFLAG - output no data
+      exit 2
+    fi
+    if ! cmp -s single.dat list.dat; then
+      echo Error! Heterodyne of pulsar $PSR from the pulsar list - mode $HETFLAG - differs from heterodyne of $PSR alone
+      exit 2
+    fi
+  done
+done
+
+rm -f pulsarlist single.dat list.dat J0100+1000.par J2000-3000.par
+
 ################### CLEAN UP ##########################
 echo Cleaning up directory.
 
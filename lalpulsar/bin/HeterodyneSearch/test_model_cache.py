@@ -0,0 +1,90 @@
+"""
+A script to run lalpulsar_parameter_estimation_nested with --check-model-cache for a pulsar in a binary system
+with a glitch, searching over sky position, binary system, glitch, frequency and amplitude parameters. The code
+changes each parameter in turn and checks that the signal model calculated using its cached parts is identical to
+the model calculated without them.
+"""
+
+import os
+import sys
+import numpy as np
+import subprocess as sp
+
+if os.environ['LALINFERENCE_ENABLED'] == 'false':
+  print('Skipping test: requires LALInference')
+  sys.exit(77)
+
+execu = './lalpulsar_parameter_estimation_nested' # executable
+
+# lalpulsar_parameter_estimation_nested runs much slower with memory debugging
+os.environ['LAL_DEBUG_LEVEL'] = os.environ['LAL_DEBUG_LEVEL'].replace('memdbg', '')
+print("Modified LAL_DEBUG_LEVEL='%s'" % os.environ['LAL_DEBUG_LEVEL'])
+
+# create files needed to run the code
+
+# par file
+parfile="\
+PSRJ J0000+0000\n\
+RAJ 00:00:00.0\n\
+DECJ 00:00:00.0\n\
+F0 100\n\
+F1 -1e-10\n\
+PEPOCH 54000\n\
+BINARY BT\n\
+A1 1.5\n\
+PB 0.5\n\
+T0 54466\n\
+ECC 0.01\n\
+OM 30\n\
+GLEP_1 54466.5\n\
+GLPH_1 0.1\n\
+GLF0_1 1e-7"
+
+parf = 'test_model_cache.par'
+f = open(parf, 'w')
+f.write(parfile)
+f.close()
+
+# prior file, with sky position, binary system, glitch, frequency and amplitude parameters
+priorfile="\
+H0 uniform 0 1e-21\n\
+PHI0 uniform 0 %f\n\
+COSIOTA uniform -1 1\n\
+PSI uniform 0 %f\n\
+RA uniform 0 1e-3\n\
+DEC uniform 0 1e-3\n\
+A1 uniform 1.4999 1.5001\n\
+ECC uniform 0.009 0.011\n\
+GLPH_1 uniform 0 1\n\
+GLF0_1 uniform 0 2e-7\n\
+F0 uniform 99.999999 100.000001" % (np.pi, np.pi/2.)
+
+priorf = 'test_model_cache.prior'
+f = open(priorf, 'w')
+f.write(priorfile)
+f.close()
+
+# data file
+datafile = 'test_model_cache_data.txt.gz'
+ds = np.zeros((1440,3))
+ds[:,0] = np.linspace(900000000., 900000000.+86400.-60., 1440) # time stamps
+ds[:,-2:] = 1.e-24*np.random.randn(1440,2)
+np.savetxt(datafile, ds, fmt='%.12e');
+
+outfile = 'test_model_cache.hdf'
+
+# run code
+commandline="\
+%s --detectors H1 --par-file %s --input-files %s --outfile %s --prior-file %s --Nlive 100 --check-model-cache --verbose" \
+% (execu, parf, datafile, outfile, priorf)
+
+exit_code = sp.call(commandline, shell=True)
+if exit_code != 0:
+  print("The signal model using the model cache differs from that calculated without it")
+
+# clean up temporary files
+for fs in (priorf, parf, datafile, outfile):
+  if os.path.exists(fs):
+    os.remove(fs)
+
+sys.exit(exit_code)
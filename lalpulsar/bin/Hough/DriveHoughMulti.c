@@ -195,30 +195,6 @@ void DuplicateBestStuff(LALStatus *status, BestVariables *out, BestVariables *in
 void GetToplistFromHoughmap(LALStatus *status, toplist_t *list, HOUGHMapTotal *ht, HOUGHPatchGrid *patch, HOUGHDemodPar *parDem, REAL8 mean, REAL8 sigma);
 
 
-void LALHOUGHCreateLUTVector(LALStatus           *status,
-                             HOUGHptfLUTVector   *lutV,
-                             UINT4               length);
-
-void LALHOUGHCreateLUTs(LALStatus           *status,
-                        HOUGHptfLUTVector   *lutV,
-                        UINT2               maxNBins,
-                        UINT2               maxNBorders,
-                        UINT2               ySide);
-
-void LALHOUGHCreatePHMDVS(LALStatus           *status,
-                          PHMDVectorSequence  *phmdVS,
-                          UINT4               length,
-                          UINT4               nfSize);
-
-void LALHOUGHCreatePHMDs(LALStatus           *status,
-                         PHMDVectorSequence  *phmdVS,
-                         UINT2               maxNBins,
-                         UINT2               maxNBorders,
-                         UINT2               ySide);
-
-void LALHOUGHDestroyPHMDs(LALStatus           *status,
-                          PHMDVectorSequence  *phmdVS);
-
 void LALHOUGHCreateHT(LALStatus             *status,
                       HOUGHMapTotal         *ht,
                       UINT2                 xSide,
@@ -229,10 +205,6 @@ void LALHOUGHCreateFreqIndVector(LALStatus                 *status,
                                  UINT4                     length,
                                  REAL8                     deltaF);
 
-
-void LALHOUGHDestroyLUTs(LALStatus           *status,
-                         HOUGHptfLUTVector   *lut);
-
 /******************************************/
 
 int main(int argc, char *argv[]){
@@ -267,17 +239,17 @@ int main(int argc, char *argv[]){
     static BestVariables best;
     
     /* hough structures */
-    static HOUGHptfLUTVector   lutV; /* the Look Up Table vector*/
+    HOUGHptfLUTVector   *lutV = NULL; /* the Look Up Table vector*/
     static HOUGHPeakGramVector pgV;  /* vector of peakgrams */
     static UCHARPeakGramVector upgV;  /* vector of expanded peakgrams */
-    static PHMDVectorSequence  phmdVS;  /* the partial Hough map derivatives */
-    static UINT8FrequencyIndexVector freqInd; /* for trajectory in time-freq plane */
+    PHMDVectorSequence  *phmdVS = NULL;  /* the partial Hough map derivatives */
+    static UINT8FrequencyIndexVectorSequence freqIndVS; /* for trajectories in time-freq plane, one per spin-down */
     static HOUGHResolutionPar parRes;   /* patch grid information */
     static HOUGHPatchGrid  patch;   /* Patch description */
-    static HOUGHParamPLUT  parLut;  /* parameters needed to build lut  */
+    HOUGHParamPLUT  *parLut = NULL;  /* parameters needed to build luts, one per time stamp */
     static HOUGHDemodPar   parDem;  /* demodulation parameters or  */
     static HOUGHSizePar    parSize;
-    static HOUGHMapTotal   ht;   /* the total Hough map */
+    static HOUGHMapTotalVector htV;   /* the total Hough maps, one per spin-down */
     static UINT8Vector     *hist; /* histogram of number counts for a single map */
     static UINT8Vector     *histTotal; /* number count histogram for all maps */
     static HoughStats      stats;  /* statistical information about a Hough map */
@@ -299,7 +271,7 @@ int main(int argc, char *argv[]){
     static HoughSignificantEventVector nStarEventVec;
     
     /* miscellaneous */
-    INT4   iHmap, nSpin1Max ;
+    INT4   iHmap, nSpin1Max, nSpinUpMax, nSpinDownMax;
     UINT4  mObsCoh, mObsCohBest;
     INT8   f0Bin, fLastBin, fBin;
     REAL8  alpha, delta, timeBase, deltaF, f1jump;
@@ -823,12 +795,23 @@ int main(int argc, char *argv[]){
         
         /****  general parameter settings and 1st memory allocation ****/
         
-        LAL_CALL ( LALHOUGHCreateLUTVector( &status, &lutV, mObsCohBest), &status);
-        
-        LAL_CALL( LALHOUGHCreatePHMDVS( &status, &phmdVS, mObsCohBest, uvar_nfSizeCylinder), &status);
-        phmdVS.deltaF  = deltaF;
-        
-        LAL_CALL( LALHOUGHCreateFreqIndVector( &status, &freqInd, mObsCohBest, deltaF), &status);
+        /* ***** for spin-down case ****/
+        nSpin1Max = uvar_nfSizeCylinder - 1 - uvar_nSpinUp;
+        /* nSpin1Max = floor(uvar_nfSizeCylinder/2.0) ;*/
+        nSpinUpMax = floor(uvar_nSpinUp/uvar_spindownJump);
+        nSpinDownMax = floor(nSpin1Max/uvar_spindownJump);
+        
+        parLut = (HOUGHParamPLUT *)LALCalloc(mObsCohBest, sizeof(HOUGHParamPLUT));
+        
+        /* one trajectory and Hough map per spin-down value */
+        freqIndVS.length = nSpinUpMax + nSpinDownMax + 1;
+        freqIndVS.vectorLength = mObsCohBest;
+        freqIndVS.freqIndV = (UINT8FrequencyIndexVector *)LALCalloc(freqIndVS.length, sizeof(UINT8FrequencyIndexVector));
+        htV.length = freqIndVS.length;
+        htV.ht = (HOUGHMapTotal *)LALCalloc(htV.length, sizeof(HOUGHMapTotal));
+        for (k = 0; k < freqIndVS.length; k++) {
+            LAL_CALL( LALHOUGHCreateFreqIndVector( &status, &freqIndVS.freqIndV[k], mObsCohBest, deltaF), &status);
+        }
         
         /* allocating histogram of the number-counts in the Hough maps */
         if ( uvar_EnableExtraInfo ) {
@@ -869,10 +852,6 @@ int main(int argc, char *argv[]){
         fBin= f0Bin;
         iHmap = 0;
         
-        /* ***** for spin-down case ****/
-        nSpin1Max = uvar_nfSizeCylinder - 1 - uvar_nSpinUp;
-        /* nSpin1Max = floor(uvar_nfSizeCylinder/2.0) ;*/
-        
         
         if ( XLALUserVarWasSet( &uvar_deltaF1dot ) )
         {
@@ -916,37 +895,40 @@ int main(int argc, char *argv[]){
             
             /*************** other memory allocation and settings************ */
             
-            LAL_CALL( LALHOUGHCreateLUTs( &status, &lutV, maxNBins, maxNBorders, ySide), &status);
+            XLAL_CHECK_MAIN( (lutV = XLALHOUGHCreateLUTVector( mObsCohBest, maxNBins, maxNBorders, ySide)) != NULL, XLAL_EFUNC);
             
-            LAL_CALL( LALHOUGHCreatePHMDs( &status, &phmdVS, maxNBins, maxNBorders, ySide), &status);
+            XLAL_CHECK_MAIN( (phmdVS = XLALHOUGHCreatePHMDVectorSequence( mObsCohBest, uvar_nfSizeCylinder, maxNBorders, ySide)) != NULL, XLAL_EFUNC);
             
             
             /* ************* create all the LUTs at fBin ********************  */
-            for (j = 0; j < mObsCohBest; ++j){  /* create all the LUTs */
+            for (j = 0; j < mObsCohBest; ++j){  /* parameters of all the LUTs */
                 parDem.veloC.x = best.velV->data[j].x;
                 parDem.veloC.y = best.velV->data[j].y;
                 parDem.veloC.z = best.velV->data[j].z;
                 /* calculate parameters needed for buiding the LUT */
-                LAL_CALL( LALNDHOUGHParamPLUT( &status, &parLut, &parSize, &parDem),&status );
-                /* build the LUT */
-                LAL_CALL( LALHOUGHConstructPLUT( &status, &(lutV.lut[j]), &patch, &parLut ),
-                         &status );
+                LAL_CALL( LALNDHOUGHParamPLUT( &status, &parLut[j], &parSize, &parDem),&status );
             }
+            /* build the LUTs */
+            XLAL_CHECK_MAIN( XLALHOUGHConstructPLUTVector( lutV, &patch, parLut ) == XLAL_SUCCESS, XLAL_EFUNC);
             
             /************* build the set of  PHMD centered around fBin***********/
-            phmdVS.fBinMin = fBin - uvar_nfSizeCylinder + 1 + uvar_nSpinUp;
-            /*phmdVS.fBinMin = fBin - floor( uvar_nfSizeCylinder/2.) ;*/
+            phmdVS->fBinMin = fBin - uvar_nfSizeCylinder + 1 + uvar_nSpinUp;
+            /*phmdVS->fBinMin = fBin - floor( uvar_nfSizeCylinder/2.) ;*/
             
-            LAL_CALL( LALHOUGHConstructSpacePHMD(&status, &phmdVS, best.pgV, &lutV), &status );
+            XLAL_CHECK_MAIN( XLALHOUGHConstructSpacePHMD( phmdVS, best.pgV, lutV ) == XLAL_SUCCESS, XLAL_EFUNC);
             if (uvar_weighAM || uvar_weighNoise) {
-                LAL_CALL( LALHOUGHWeighSpacePHMD(&status, &phmdVS, best.weightsV), &status);
+                XLAL_CHECK_MAIN( XLALHOUGHWeighSpacePHMD( phmdVS, best.weightsV ) == XLAL_SUCCESS, XLAL_EFUNC);
             }
             
             /* ************ initializing the Total Hough map space *********** */
             
-            LAL_CALL( LALHOUGHCreateHT( &status, &ht, xSide, ySide), &status);
-            ht.mObsCoh = mObsCohBest;
-            ht.deltaF = deltaF;
+            for (j = 0; j < htV.length; ++j){
+                LAL_CALL( LALHOUGHCreateHT( &status, &htV.ht[j], xSide, ySide), &status);
+                htV.ht[j].mObsCoh = mObsCohBest;
+                htV.ht[j].deltaF = deltaF;
+                htV.ht[j].spinRes.length = 1;
+                htV.ht[j].spinRes.data = (REAL8 *)LALCalloc(htV.ht[j].spinRes.length, sizeof(REAL8));
+            }
             
             
             /*  Search frequency interval possible using the same LUTs */
@@ -960,46 +942,44 @@ int main(int argc, char *argv[]){
             while ( (fBinSearch <= fLastBin) && (fBinSearch < fBinSearchMax) )
             {
                 
-                /**** study 1 spin-down. at  fBinSearch ****/
+                /**** study all spin-downs at fBinSearch ****/
                 
                 INT4   n;
                 REAL8  f1dis;
+                UINT4  iSpin;
                 
-                ht.f0Bin = fBinSearch;
-                ht.spinRes.length = 1;
-                ht.spinRes.data = NULL;
-                ht.spinRes.data = (REAL8 *)LALCalloc(ht.spinRes.length, sizeof(REAL8));
-                for ( n = floor(uvar_nSpinUp/uvar_spindownJump); n >= - floor(nSpin1Max/uvar_spindownJump); --n) {
+                /* construct paths in time-freq plane for all spindown values */
+                for ( n = nSpinUpMax, iSpin = 0; n >= - nSpinDownMax; --n, ++iSpin) {
                     /*for ( n = 0; n <= floor(nSpin1Max/uvar_spindownJump); ++n) {*/
                     /* f1dis = - n * f1jump; */
-                    /*loop over all spindown values */
                     
                     f1dis = + n * f1jump;
-                    ht.spinRes.data[0] =  f1dis * deltaF;
+                    htV.ht[iSpin].f0Bin = fBinSearch;
+                    htV.ht[iSpin].spinRes.data[0] =  f1dis * deltaF;
                     
-                    /* construct path in time-freq plane */
                     for (j = 0 ; j < mObsCohBest; ++j){
-                        freqInd.data[j] = fBinSearch + floor(best.timeDiffV->data[j]*f1dis + 0.5);
-                    }
-                    
-                    if (uvar_weighAM || uvar_weighNoise) {
-                        LAL_CALL( LALHOUGHConstructHMT_W( &status, &ht, &freqInd, &phmdVS ), &status );
-                    }
-                    else {
-                        LAL_CALL( LALHOUGHConstructHMT( &status, &ht, &freqInd, &phmdVS ), &status );
+                        freqIndVS.freqIndV[iSpin].data[j] = fBinSearch + floor(best.timeDiffV->data[j]*f1dis + 0.5);
                     }
+                }
+                
+                /* build the Hough maps for all spindown values; the phmd weights are one if unweighted */
+                XLAL_CHECK_MAIN( XLALHOUGHConstructHMTVector_W( &htV, &freqIndVS, phmdVS ) == XLAL_SUCCESS, XLAL_EFUNC);
+                
+                for ( iSpin = 0; iSpin < htV.length; ++iSpin) {
+                    /*loop over all spindown values */
                     
+                    HOUGHMapTotal *ht = &htV.ht[iSpin];
                     
                     /* ********************* perfom stat. analysis on the maps ****************** */
                     
                     if ( uvar_EnableExtraInfo ) {
                         
-                        LAL_CALL( LALHoughStatistics ( &status, &stats, &ht), &status );
+                        LAL_CALL( LALHoughStatistics ( &status, &stats, ht), &status );
                         LAL_CALL( LALStereo2SkyLocation (&status, &sourceLocation,
                                                          stats.maxIndex[0], stats.maxIndex[1], &patch, &parDem), &status);
                         
-                        /*LAL_CALL( LALHoughHistogram ( &status, &hist, &ht), &status);*/
-                        LAL_CALL( LALHoughHistogramSignificance ( &status, hist, &ht, meanN, sigmaN,
+                        /*LAL_CALL( LALHoughHistogram ( &status, &hist, ht), &status);*/
+                        LAL_CALL( LALHoughHistogramSignificance ( &status, hist, ht, meanN, sigmaN,
                                                                  minSignificance, maxSignificance), &status);
                         
                         for(j = 0; j < histTotal->length; j++){
@@ -1008,30 +988,28 @@ int main(int argc, char *argv[]){
                     }
                     
                     /* select candidates from hough maps */
-                    LAL_CALL( GetToplistFromHoughmap( &status, toplist, &ht, &patch, &parDem, meanN, sigmaN), &status);
+                    LAL_CALL( GetToplistFromHoughmap( &status, toplist, ht, &patch, &parDem, meanN, sigmaN), &status);
                     
                     
                     /* ***** print results *********************** */
                     
                     if( uvar_EnableExtraInfo )
                     {
-                        if( PrintExtraInfo( fileMaps, &fp1, iHmap, &ht, &sourceLocation, &stats, fBinSearch, deltaF))
+                        if( PrintExtraInfo( fileMaps, &fp1, iHmap, ht, &sourceLocation, &stats, fBinSearch, deltaF))
                             return DRIVEHOUGHCOLOR_EFILE;
                     }
                     
                     ++iHmap;
                 } /* end loop over spindown values */
                 
-                LALFree(ht.spinRes.data);
-                
                 
                 /***** shift the search freq. & PHMD structure 1 freq.bin ****** */
                 ++fBinSearch;
                 
-                LAL_CALL( LALHOUGHupdateSpacePHMDup(&status, &phmdVS, best.pgV, &lutV), &status );
+                XLAL_CHECK_MAIN( XLALHOUGHupdateSpacePHMDup( phmdVS, best.pgV, lutV ) == XLAL_SUCCESS, XLAL_EFUNC);
                 
                 if (uvar_weighAM || uvar_weighNoise) {
-                    LAL_CALL( LALHOUGHWeighSpacePHMD( &status, &phmdVS, best.weightsV), &status);
+                    XLAL_CHECK_MAIN( XLALHOUGHWeighSpacePHMD( phmdVS, best.weightsV ) == XLAL_SUCCESS, XLAL_EFUNC);
                 }
                 
             }   /*closing second while */
@@ -1041,11 +1019,16 @@ int main(int argc, char *argv[]){
             /* ********************  Free partial memory ******************* */
             LALFree(patch.xCoor);
             LALFree(patch.yCoor);
-            LALFree(ht.map);
+            for (j = 0; j < htV.length; ++j){
+                LALFree(htV.ht[j].map);
+                LALFree(htV.ht[j].spinRes.data);
+            }
             
-            LALHOUGHDestroyLUTs( &status, &lutV);
+            XLALHOUGHDestroyLUTVector( lutV );
+            lutV = NULL;
             
-            LALHOUGHDestroyPHMDs( &status, &phmdVS);
+            XLALHOUGHDestroyPHMDVectorSequence( phmdVS );
+            phmdVS = NULL;
             
             
         } /* closing while */
@@ -1072,14 +1055,17 @@ int main(int argc, char *argv[]){
         if (uvar_EnableExtraInfo) fclose(fp1);
         
         /* Free memory allocated inside skypatches loop */
-        LALFree(lutV.lut);
-        lutV.lut = NULL;
+        LALFree(parLut);
+        parLut = NULL;
         
-        LALFree(phmdVS.phmd);
-        phmdVS.phmd = NULL;
+        for (k = 0; k < freqIndVS.length; k++) {
+            LALFree(freqIndVS.freqIndV[k].data);
+        }
+        LALFree(freqIndVS.freqIndV);
+        freqIndVS.freqIndV = NULL;
         
-        LALFree(freqInd.data);
-        freqInd.data = NULL;
+        LALFree(htV.ht);
+        htV.ht = NULL;
         
         if ( uvar_EnableExtraInfo ) {
             XLALDestroyUINT8Vector (hist);
@@ -2078,244 +2064,6 @@ void DuplicateBestStuff(LALStatus      *status,
 
 
 
-/** helper function for creating LUT vector */
-void LALHOUGHCreateLUTVector(LALStatus           *status,
-                             HOUGHptfLUTVector   *lutV,
-                             UINT4               length)
-{
-    
-    INITSTATUS(status);
-    ATTATCHSTATUSPTR (status);
-    
-    /* check input pars are ok */
-    if (lutV == NULL) {
-        ABORT (status, DRIVEHOUGHCOLOR_ENONULL, DRIVEHOUGHCOLOR_MSGENONULL);
-    }
-    
-    if (lutV->lut != NULL) {
-        ABORT (status, DRIVEHOUGHCOLOR_ENULL, DRIVEHOUGHCOLOR_MSGENULL);
-    }
-    
-    if (length <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    /* allocate memory */
-    lutV->length = length;
-    lutV->lut = (HOUGHptfLUT *)LALCalloc(lutV->length, sizeof(HOUGHptfLUT));
-    
-    DETATCHSTATUSPTR (status);
-    
-    /* normal exit */
-    RETURN (status);
-    
-}
-
-
-void LALHOUGHCreateLUTs(LALStatus           *status,
-                        HOUGHptfLUTVector   *lutV,
-                        UINT2               maxNBins,
-                        UINT2               maxNBorders,
-                        UINT2               ySide)
-{
-    
-    UINT4 j,i;
-    
-    INITSTATUS(status);
-    ATTATCHSTATUSPTR (status);
-    
-    /* check input pars are ok */
-    if (lutV == NULL) {
-        ABORT (status, DRIVEHOUGHCOLOR_ENULL, DRIVEHOUGHCOLOR_MSGENULL);
-    }
-    
-    if (lutV->lut == NULL) {
-        ABORT (status, DRIVEHOUGHCOLOR_ENULL, DRIVEHOUGHCOLOR_MSGENULL);
-    }
-
-    if (maxNBins <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    if (maxNBorders <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    if (ySide <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    
-    /* loop over luts and allocate memory */
-    for(j = 0; j < lutV->length; j++){
-        lutV->lut[j].maxNBins = maxNBins;
-        lutV->lut[j].maxNBorders = maxNBorders;
-        lutV->lut[j].border = (HOUGHBorder *)LALCalloc(maxNBorders, sizeof(HOUGHBorder));
-        lutV->lut[j].bin = (HOUGHBin2Border *)LALCalloc(maxNBins, sizeof(HOUGHBin2Border));
-        
-        for (i = 0; i < maxNBorders; i++){
-            lutV->lut[j].border[i].ySide = ySide;
-            lutV->lut[j].border[i].xPixel = (COORType *)LALCalloc(ySide, sizeof(COORType));
-        }
-        
-    }
-    
-    DETATCHSTATUSPTR (status);
-    
-    /* normal exit */
-    RETURN (status);
-    
-}
-
-
-void LALHOUGHDestroyLUTs(LALStatus           *status,
-                         HOUGHptfLUTVector   *lutV)
-{
-    
-    UINT4 j,i;
-    
-    INITSTATUS(status);
-    ATTATCHSTATUSPTR (status);
-    
-    for (j = 0; j < lutV->length ; ++j){
-        for (i = 0; i < lutV->lut[j].maxNBorders; ++i){
-            
-            if (lutV->lut[j].border[i].xPixel) {
-                LALFree( lutV->lut[j].border[i].xPixel);
-            }
-        }
-        
-        if (lutV->lut[j].border) {
-            LALFree( lutV->lut[j].border);
-        }
-        
-        if (lutV->lut[j].bin) {
-            LALFree( lutV->lut[j].bin);
-        }
-    }
-    
-    DETATCHSTATUSPTR (status);
-    
-    /* normal exit */
-    RETURN (status);
-    
-}
-
-
-void LALHOUGHCreatePHMDVS(LALStatus           *status,
-                          PHMDVectorSequence  *phmdVS,
-                          UINT4               length,
-                          UINT4               nfSize)
-{
-    
-    INITSTATUS(status);
-    ATTATCHSTATUSPTR (status);
-    
-    /* check input pars are ok */
-    if (phmdVS == NULL) {
-        ABORT (status, DRIVEHOUGHCOLOR_ENULL, DRIVEHOUGHCOLOR_MSGENULL);
-    }
-    
-    if (phmdVS->phmd != NULL) {
-        ABORT (status, DRIVEHOUGHCOLOR_ENONULL, DRIVEHOUGHCOLOR_MSGENONULL);
-    }
-    
-    if (length <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    if (nfSize <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    phmdVS->length  = length;
-    phmdVS->nfSize  = nfSize;
-    phmdVS->deltaF  = 0; /* initialization */
-    
-    phmdVS->phmd=(HOUGHphmd *)LALCalloc(1, length*nfSize*sizeof(HOUGHphmd));
-    
-    DETATCHSTATUSPTR (status);
-    
-    /* normal exit */
-    RETURN (status);
-    
-}
-
-
-
-void LALHOUGHCreatePHMDs(LALStatus           *status,
-                         PHMDVectorSequence  *phmdVS,
-                         UINT2               maxNBins,
-                         UINT2               maxNBorders,
-                         UINT2               ySide)
-{
-    
-    UINT4 j;
-    
-    INITSTATUS(status);
-    ATTATCHSTATUSPTR (status);
-    
-    /* check input pars are ok */
-    if (phmdVS == NULL) {
-        ABORT (status, DRIVEHOUGHCOLOR_ENULL, DRIVEHOUGHCOLOR_MSGENULL);
-    }
-    
-    if ( phmdVS->phmd == NULL) {
-        ABORT (status, DRIVEHOUGHCOLOR_ENULL, DRIVEHOUGHCOLOR_MSGENULL);
-    }
-
-    if (maxNBins <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    if (maxNBorders <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    if (ySide <= 0) {
-        ABORT (status, DRIVEHOUGHCOLOR_EBAD, DRIVEHOUGHCOLOR_MSGEBAD);
-    }
-    
-    for(j = 0; j < phmdVS->length * phmdVS->nfSize; j++){
-        phmdVS->phmd[j].maxNBorders = maxNBorders;
-        phmdVS->phmd[j].leftBorderP = (HOUGHBorder **)LALCalloc(maxNBorders, sizeof(HOUGHBorder *));
-        phmdVS->phmd[j].rightBorderP = (HOUGHBorder **)LALCalloc(maxNBorders, sizeof(HOUGHBorder *));
-        
-        phmdVS->phmd[j].ySide = ySide;
-        phmdVS->phmd[j].firstColumn = (UCHAR *)LALCalloc(ySide, sizeof(UCHAR));
-    }
-    
-    
-    DETATCHSTATUSPTR (status);
-    
-    /* normal exit */
-    RETURN (status);
-    
-}
-
-
-void LALHOUGHDestroyPHMDs(LALStatus           *status,
-                          PHMDVectorSequence  *phmdVS)
-{
-    UINT4 j;
-    
-    INITSTATUS(status);
-    ATTATCHSTATUSPTR (status);
-    
-    for(j = 0; j < phmdVS->length * phmdVS->nfSize; j++){
-            LALFree( phmdVS->phmd[j].leftBorderP);
-            LALFree( phmdVS->phmd[j].rightBorderP);
-            LALFree( phmdVS->phmd[j].firstColumn);
-    }
-    
-    DETATCHSTATUSPTR (status);
-    
-    /* normal exit */
-    RETURN (status);
-    
-}
-
-
 void LALHOUGHCreateHT(LALStatus             *status,
                       HOUGHMapTotal         *ht,
                       UINT2                 xSide,
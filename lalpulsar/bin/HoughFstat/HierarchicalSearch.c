@@ -1495,19 +1495,20 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
 {
 
   /* hough structures */
-  HOUGHMapTotal ht;
-  HOUGHptfLUTVector   lutV; /* the Look Up Table vector*/
-  PHMDVectorSequence  phmdVS;  /* the partial Hough map derivatives */
-  UINT8FrequencyIndexVector freqInd; /* for trajectory in time-freq plane */
+  HOUGHMapTotalVector htV; /* the Hough maps for all residual spindowns */
+  HOUGHptfLUTVector   *lutV = NULL; /* the Look Up Table vector*/
+  PHMDVectorSequence  *phmdVS = NULL;  /* the partial Hough map derivatives */
+  UINT8FrequencyIndexVectorSequence freqIndVS; /* for trajectories in time-freq plane */
   HOUGHResolutionPar parRes;   /* patch grid information */
   HOUGHPatchGrid  patch;   /* Patch description */
-  HOUGHParamPLUT  parLut;  /* parameters needed to build lut  */
+  HOUGHParamPLUT  *parLut = NULL;  /* parameters needed to build each lut  */
   HOUGHDemodPar   parDem;  /* demodulation parameters */
   HOUGHSizePar    parSize;
 
   UINT2  xSide, ySide, maxNBins, maxNBorders;
   INT8  fBinIni, fBinFin, fBin;
-  INT4  iHmap, nfdot;
+  INT4  iHmap, nfdot, nfdotBy2;
+  UINT4 nfSize;
   UINT4 k, nStacks ;
   REAL8 deltaF, dfdot, alpha, delta;
   REAL8 patchSizeX, patchSizeY;
@@ -1591,18 +1592,14 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
 
 
   /*--------------- first memory allocation --------------*/
-  /* look up table vector */
-  lutV.length = nStacks;
-  lutV.lut = LALCalloc(1, alloc_len = nStacks*sizeof(HOUGHptfLUT));
-  if ( lutV.lut == NULL ) {
+  /* parameters of the look up tables; the tables themselves, and the partial hough
+     map derivatives, are created for each patch grid below */
+  parLut = LALCalloc(1, alloc_len = nStacks*sizeof(HOUGHParamPLUT));
+  if ( parLut == NULL ) {
     XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
     ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
   }
 
-
-  /* partial hough map derivative vector */
-  phmdVS.length  = nStacks;
-
   {
     REAL8 maxTimeDiff, startTimeDiff, endTimeDiff;
 
@@ -1612,48 +1609,56 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
 
     /* set number of freq. bins for which LUTs will be calculated */
     /* this sets the range of residual spindowns values */
-    /* phmdVS.nfSize  = 2*nfdotBy2 + 1; */
-    phmdVS.nfSize  = 2 * floor((nfdot-1) * (REAL4)(dfdot * maxTimeDiff / deltaF) + 0.5f) + 1;
-  }
-
-  phmdVS.deltaF  = deltaF;
-  phmdVS.phmd = LALCalloc( 1, alloc_len = phmdVS.length * phmdVS.nfSize *sizeof(HOUGHphmd));
-  if ( phmdVS.phmd == NULL ) {
+    /* nfSize  = 2*nfdotBy2 + 1; */
+    nfSize  = 2 * floor((nfdot-1) * (REAL4)(dfdot * maxTimeDiff / deltaF) + 0.5f) + 1;
+  }
+
+  /* residual spindown trajectories, and the hough maps along them; all the maps
+     at a search frequency are constructed at once */
+  nfdotBy2 = nfdot/2;
+  freqIndVS.length = 2*nfdotBy2 + 1;
+  freqIndVS.vectorLength = nStacks;
+  freqIndVS.freqIndV = LALCalloc(1, alloc_len = freqIndVS.length*sizeof(UINT8FrequencyIndexVector));
+  htV.length = freqIndVS.length;
+  htV.ht = LALCalloc(1, alloc_len = htV.length*sizeof(HOUGHMapTotal));
+  if ( freqIndVS.freqIndV == NULL || htV.ht == NULL ) {
     XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
     ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
   }
+  for (k=0; k<htV.length; k++) {
+    HOUGHMapTotal *ht = &htV.ht[k];
 
-  /* residual spindown trajectory */
-  freqInd.deltaF = deltaF;
-  freqInd.length = nStacks;
-  freqInd.data = LALCalloc(1, alloc_len = nStacks*sizeof(UINT8));
-  if ( freqInd.data == NULL ) {
-    XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
-    ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-  }
+    freqIndVS.freqIndV[k].deltaF = deltaF;
+    freqIndVS.freqIndV[k].length = nStacks;
+    freqIndVS.freqIndV[k].data = LALCalloc(1, alloc_len = nStacks*sizeof(UINT8));
+    if ( freqIndVS.freqIndV[k].data == NULL ) {
+      XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
+      ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
+    }
 
-  /* resolution in space of residual spindowns */
-  ht.dFdot.length = 1;
-  ht.dFdot.data = LALCalloc( 1, alloc_len = ht.dFdot.length * sizeof(REAL8));
-  if ( ht.dFdot.data == NULL ) {
-    XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
-    ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-  }
+    /* resolution in space of residual spindowns */
+    ht->dFdot.length = 1;
+    ht->dFdot.data = LALCalloc( 1, alloc_len = ht->dFdot.length * sizeof(REAL8));
+    if ( ht->dFdot.data == NULL ) {
+      XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
+      ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
+    }
 
-  /* the residual spindowns */
-  ht.spinRes.length = 1;
-  ht.spinRes.data = LALCalloc( 1, alloc_len = ht.spinRes.length*sizeof(REAL8));
-  if ( ht.spinRes.data == NULL ) {
-    XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
-    ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-  }
+    /* the residual spindowns */
+    ht->spinRes.length = 1;
+    ht->spinRes.data = LALCalloc( 1, alloc_len = ht->spinRes.length*sizeof(REAL8));
+    if ( ht->spinRes.data == NULL ) {
+      XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
+      ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
+    }
 
-  /* the residual spindowns */
-  ht.spinDem.length = 1;
-  ht.spinDem.data = LALCalloc( 1, alloc_len = ht.spinRes.length*sizeof(REAL8));
-  if ( ht.spinDem.data == NULL ) {
-    XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
-    ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
+    /* the residual spindowns */
+    ht->spinDem.length = 1;
+    ht->spinDem.data = LALCalloc( 1, alloc_len = ht->spinRes.length*sizeof(REAL8));
+    if ( ht->spinDem.data == NULL ) {
+      XLALPrintError ("Failed to LALCalloc(1,%d)\n", alloc_len );
+      ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
+    }
   }
 
   /* the demodulation params */
@@ -1740,7 +1745,7 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
   }
   else {
     /* if no toplist then use number of hough maps */
-    INT4 numHmaps = (fBinFin - fBinIni + 1)*phmdVS.nfSize;
+    INT4 numHmaps = (fBinFin - fBinIni + 1)*nfSize;
     if (out->length != numHmaps) {
       out->length = numHmaps;
       out->list = LALRealloc( out->list, alloc_len = out->length * sizeof(SemiCohCandidate));
@@ -1759,7 +1764,7 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
 
   while( fBin <= fBinFin ){
     INT8 fBinSearch, fBinSearchMax;
-    UINT4 i,j;
+    UINT4 j;
     REAL8UnitPolarCoor sourceLocation;
 
     parRes.f0Bin =  fBin;
@@ -1789,56 +1794,11 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
     TRY( LALHOUGHFillPatchGrid( status->statusPtr, &patch, &parSize ), status );
 
     /*------------- other memory allocation and settings----------------- */
-    for(j=0; j<lutV.length; ++j){
-      lutV.lut[j].maxNBins = maxNBins;
-      lutV.lut[j].maxNBorders = maxNBorders;
-      lutV.lut[j].border = LALCalloc(1, alloc_len = maxNBorders*sizeof(HOUGHBorder));
-      if ( lutV.lut[j].border == NULL ) {
-        XLALPrintError ("Failed to LALCalloc( 1, %d)\n", alloc_len );
-	ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-      }
-
-      lutV.lut[j].bin =	LALCalloc(1, alloc_len = maxNBins*sizeof(HOUGHBin2Border));
-      if ( lutV.lut[j].bin == NULL ) {
-        XLALPrintError ("Failed to LALCalloc( 1, %d)\n", alloc_len );
-	ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-      }
-
-      for (i=0; i<maxNBorders; ++i){
-	lutV.lut[j].border[i].ySide = ySide;
-	lutV.lut[j].border[i].xPixel = LALCalloc(1, alloc_len = ySide*sizeof(COORType));
-	if ( lutV.lut[j].border[i].xPixel == NULL ) {
-          XLALPrintError ("Failed to LALCalloc( 1, %d)\n", alloc_len );
-	  ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-	}
-      }
-    }
-
-    for(j = 0; j < phmdVS.length * phmdVS.nfSize; ++j){
-      phmdVS.phmd[j].maxNBorders = maxNBorders;
-      phmdVS.phmd[j].leftBorderP = LALCalloc(1, alloc_len = maxNBorders*sizeof(HOUGHBorder *));
-      if ( phmdVS.phmd[j].leftBorderP == NULL ) {
-        XLALPrintError ("Failed to LALCalloc( 1, %d)\n", alloc_len );
-	ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-      }
-
-      phmdVS.phmd[j].rightBorderP = LALCalloc(1, alloc_len = maxNBorders*sizeof(HOUGHBorder *));
-      if ( phmdVS.phmd[j].rightBorderP == NULL ) {
-        XLALPrintError ("Failed to LALCalloc( 1, %d)\n", alloc_len );
-	ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-      }
-
-      phmdVS.phmd[j].ySide = ySide;
-      phmdVS.phmd[j].firstColumn = NULL;
-      phmdVS.phmd[j].firstColumn = LALCalloc(1, alloc_len = ySide*sizeof(UCHAR));
-      if ( phmdVS.phmd[j].firstColumn == NULL ) {
-        XLALPrintError ("Failed to LALCalloc( 1, %d)\n", alloc_len );
-	ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
-      }
-    }
+    XLAL_CHECK_LAL( status, ( lutV = XLALHOUGHCreateLUTVector( nStacks, maxNBins, maxNBorders, ySide ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_LAL( status, ( phmdVS = XLALHOUGHCreatePHMDVectorSequence( nStacks, nfSize, maxNBorders, ySide ) ) != NULL, XLAL_EFUNC );
 
     /*------------------- create all the LUTs at fBin ---------------------*/
-    for (j=0; j < (UINT4)nStacks; j++){  /* create all the LUTs */
+    for (j=0; j < (UINT4)nStacks; j++){  /* parameters of all the LUTs */
       parDem.veloC.x = vel->data[3*j];
       parDem.veloC.y = vel->data[3*j + 1];
       parDem.veloC.z = vel->data[3*j + 2];
@@ -1848,51 +1808,54 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
       parDem.timeDiff = timeDiffV->data[j];
 
       /* calculate parameters needed for buiding the LUT */
-      TRY( LALHOUGHCalcParamPLUT( status->statusPtr, &parLut, &parSize, &parDem), status);
+      TRY( LALHOUGHCalcParamPLUT( status->statusPtr, &parLut[j], &parSize, &parDem), status);
+    }
 
-      /* build the LUT */
-      TRY( LALHOUGHConstructPLUT( status->statusPtr, &(lutV.lut[j]), &patch, &parLut ), status);
+    /* build the LUTs */
+    XLAL_CHECK_LAL( status, XLALHOUGHConstructPLUTVector( lutV, &patch, parLut ) == XLAL_SUCCESS, XLAL_EFUNC );
 
+    for (j=0; j < (UINT4)nStacks; j++){
 
       /* for debugging
-	 fprintf(stdout,"%d\n", lutV.lut[j].nBin);
+	 fprintf(stdout,"%d\n", lutV->lut[j].nBin);
       */
 
       /* for debugging */
       if ( uvar_validateLUT) {
-	TRY( ValidateHoughLUT( status->statusPtr, &(lutV.lut[j]), &patch, params->outBaseName, j, alpha, delta, params->weightsV->data[j]), status);
+	TRY( ValidateHoughLUT( status->statusPtr, &(lutV->lut[j]), &patch, params->outBaseName, j, alpha, delta, params->weightsV->data[j]), status);
       }
 
       /* for debugging */
       if ( uvar_dumpLUT) {
-	TRY( DumpLUT2file( status->statusPtr, &(lutV.lut[j]), &patch, params->outBaseName, j), status);
+	TRY( DumpLUT2file( status->statusPtr, &(lutV->lut[j]), &patch, params->outBaseName, j), status);
       }
     }
 
     /*--------- build the set of  PHMD centered around fBin -------------*/
-    phmdVS.fBinMin = fBin - phmdVS.nfSize/2;
-    TRY( LALHOUGHConstructSpacePHMD(status->statusPtr, &phmdVS, pgV, &lutV), status );
-    TRY( LALHOUGHWeighSpacePHMD(status->statusPtr, &phmdVS, params->weightsV), status);
+    phmdVS->fBinMin = fBin - nfSize/2;
+    XLAL_CHECK_LAL( status, XLALHOUGHConstructSpacePHMD( phmdVS, pgV, lutV ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_LAL( status, XLALHOUGHWeighSpacePHMD( phmdVS, params->weightsV ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     /*-------------- initializing the Total Hough map space ------------*/
-    ht.xSide = xSide;
-    ht.ySide = ySide;
-    ht.skyPatch.alpha = alpha;
-    ht.skyPatch.delta = delta;
-    ht.mObsCoh = nStacks;
-    ht.deltaF = deltaF;
-    ht.spinDem.data[0] = fdot;
-    ht.patchSizeX = patchSizeX;
-    ht.patchSizeY = patchSizeY;
-    ht.dFdot.data[0] = dfdot;
-    ht.map   = LALCalloc(1, alloc_len = xSide*ySide*sizeof(HoughTT));
-    if ( ht.map == NULL ) {
-      XLALPrintError ("Failed to LALCalloc( 1, %d)\n", alloc_len );
-      ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
+    for (j=0; j < htV.length; j++) {
+      HOUGHMapTotal *ht = &htV.ht[j];
+      ht->xSide = xSide;
+      ht->ySide = ySide;
+      ht->skyPatch.alpha = alpha;
+      ht->skyPatch.delta = delta;
+      ht->mObsCoh = nStacks;
+      ht->deltaF = deltaF;
+      ht->spinDem.data[0] = fdot;
+      ht->patchSizeX = patchSizeX;
+      ht->patchSizeY = patchSizeY;
+      ht->dFdot.data[0] = dfdot;
+      ht->map   = LALCalloc(1, alloc_len = xSide*ySide*sizeof(HoughTT));
+      if ( ht->map == NULL ) {
+        XLALPrintError ("Failed to LALCalloc( 1, %d)\n", alloc_len );
+        ABORT ( status, HIERARCHICALSEARCH_EMEM, HIERARCHICALSEARCH_MSGEMEM );
+      }
     }
 
-    TRY( LALHOUGHInitializeHT( status->statusPtr, &ht, &patch), status); /*not needed */
-
     /*  Search frequency interval possible using the same LUTs */
     fBinSearch = fBin;
     fBinSearchMax = fBin + parSize.nFreqValid - 1;
@@ -1902,50 +1865,56 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
 
       /* finally we can construct the hough maps and select candidates */
       {
-	INT4   n, nfdotBy2;
+	INT4   n;
+	UINT4  iSpin;
 
-	nfdotBy2 = nfdot/2;
-	ht.f0Bin = fBinSearch;
-
-	/*loop over all values of residual spindown */
+	/* trajectories for all values of residual spindown */
 	/* check limits of loop */
-	for( n = -nfdotBy2; n <= nfdotBy2 ; n++ ){
+	for( n = -nfdotBy2, iSpin = 0; n <= nfdotBy2 ; n++, iSpin++ ){
 
-	  ht.spinRes.data[0] =  n*dfdot;
+	  htV.ht[iSpin].f0Bin = fBinSearch;
+	  htV.ht[iSpin].spinRes.data[0] =  n*dfdot;
 
 	  for (j=0; j < (UINT4)nStacks; j++) {
-	    freqInd.data[j] = fBinSearch + floor( (REAL4)(timeDiffV->data[j]*n*dfdot/deltaF) + 0.5f);
+	    freqIndVS.freqIndV[iSpin].data[j] = fBinSearch + floor( (REAL4)(timeDiffV->data[j]*n*dfdot/deltaF) + 0.5f);
 	  }
+	}
+
+	/* build the hough maps for all values of residual spindown */
+	XLAL_CHECK_LAL( status, XLALHOUGHConstructHMTVector_W( &htV, &freqIndVS, phmdVS ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+	/*loop over all values of residual spindown */
+	for( iSpin = 0; iSpin < htV.length; iSpin++ ){
 
-	  TRY( LALHOUGHConstructHMT_W(status->statusPtr, &ht, &freqInd, &phmdVS),status );
+	  HOUGHMapTotal *ht = &htV.ht[iSpin];
 
 	  /* get candidates */
 	  if ( params->useToplist ) {
-	    TRY(GetHoughCandidates_toplist( status->statusPtr, houghToplist, &ht, &patch, &parDem), status);
+	    TRY(GetHoughCandidates_toplist( status->statusPtr, houghToplist, ht, &patch, &parDem), status);
 	  }
 	  else {
-	    TRY(GetHoughCandidates_threshold( status->statusPtr, out, &ht, &patch, &parDem, params->threshold), status);
+	    TRY(GetHoughCandidates_threshold( status->statusPtr, out, ht, &patch, &parDem, params->threshold), status);
 	  }
 
 	  /* calculate statistics and histogram */
 	  if ( uvar_printStats && (fpStats != NULL) ) {
-	    TRY( LALHoughStatistics ( status->statusPtr, &stats, &ht), status );
+	    TRY( LALHoughStatistics ( status->statusPtr, &stats, ht), status );
 	    TRY( LALStereo2SkyLocation ( status->statusPtr, &sourceLocation,
 					stats.maxIndex[0], stats.maxIndex[1],
 					&patch, &parDem), status);
 
 	    fprintf(fpStats, "%d %f %f %f %f %f %f %f %g \n", iHmap, sourceLocation.alpha, sourceLocation.delta,
 		    (REAL4)stats.maxCount, (REAL4)stats.minCount, (REAL4)stats.avgCount, (REAL4)stats.stdDev,
-		    fBinSearch*deltaF,  ht.spinRes.data[0] );
+		    fBinSearch*deltaF,  ht->spinRes.data[0] );
 
-	    TRY( LALHoughHistogram ( status->statusPtr, &hist, &ht), status);
+	    TRY( LALHoughHistogram ( status->statusPtr, &hist, ht), status);
 	    for(j=0; j< histTotal.length; ++j)
 	      histTotal.data[j]+=hist.data[j];
 	  }
 
 	  /* print hough map */
 	  if ( uvar_printMaps ) {
-	    TRY( PrintHmap2file( status->statusPtr, &ht, params->outBaseName, iHmap), status);
+	    TRY( PrintHmap2file( status->statusPtr, ht, params->outBaseName, iHmap), status);
 	  }
 
 	  if ( uvar_printGrid ) {
@@ -1965,8 +1934,8 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
 
       /*------ shift the search freq. & PHMD structure 1 freq.bin -------*/
       ++fBinSearch;
-      TRY( LALHOUGHupdateSpacePHMDup(status->statusPtr, &phmdVS, pgV, &lutV), status );
-      TRY( LALHOUGHWeighSpacePHMD(status->statusPtr, &phmdVS, params->weightsV), status);
+      XLAL_CHECK_LAL( status, XLALHOUGHupdateSpacePHMDup( phmdVS, pgV, lutV ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_LAL( status, XLALHOUGHWeighSpacePHMD( phmdVS, params->weightsV ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     }   /* closing while loop over fBinSearch */
 
@@ -1980,31 +1949,28 @@ void ComputeFstatHoughMap(LALStatus *status,		/**< pointer to LALStatus structur
     /*--------------  Free partial memory -----------------*/
     LALFree(patch.xCoor);
     LALFree(patch.yCoor);
-    LALFree(ht.map);
-
-    for (j=0; j<lutV.length ; ++j){
-      for (i=0; i<maxNBorders; ++i){
-	LALFree( lutV.lut[j].border[i].xPixel);
-      }
-      LALFree( lutV.lut[j].border);
-      LALFree( lutV.lut[j].bin);
-    }
-    for(j=0; j<phmdVS.length * phmdVS.nfSize; ++j){
-      LALFree( phmdVS.phmd[j].leftBorderP);
-      LALFree( phmdVS.phmd[j].rightBorderP);
-      LALFree( phmdVS.phmd[j].firstColumn);
+    for (j=0; j < htV.length; j++) {
+      LALFree(htV.ht[j].map);
     }
 
+    XLALHOUGHDestroyLUTVector( lutV );
+    lutV = NULL;
+    XLALHOUGHDestroyPHMDVectorSequence( phmdVS );
+    phmdVS = NULL;
+
   } /* closing first while */
 
 
   /* free remaining memory */
-  LALFree(ht.spinRes.data);
-  LALFree(ht.spinDem.data);
-  LALFree(ht.dFdot.data);
-  LALFree(lutV.lut);
-  LALFree(phmdVS.phmd);
-  LALFree(freqInd.data);
+  for (k=0; k<htV.length; k++) {
+    LALFree(htV.ht[k].spinRes.data);
+    LALFree(htV.ht[k].spinDem.data);
+    LALFree(htV.ht[k].dFdot.data);
+    LALFree(freqIndVS.freqIndV[k].data);
+  }
+  LALFree(htV.ht);
+  LALFree(freqIndVS.freqIndV);
+  LALFree(parLut);
   LALFree(parDem.spin.data);
 
   TRY( LALDDestroyVector( status->statusPtr, &timeDiffV), status);
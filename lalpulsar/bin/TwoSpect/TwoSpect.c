@@ -430,9 +430,11 @@ int main(int argc, char *argv[])
 
    //If necessary, read in template bank file
    TwoSpectTemplateVector *templateVec = NULL;
+   TwoSpectTemplatePool *templatePool = NULL;
    if (XLALUserVarWasSet(&(uvar.templatebankfile))) {
       XLAL_CHECK( (templateVec = readTwoSpectTemplateVector(uvar.templatebankfile)) != NULL, XLAL_EFUNC );
       XLAL_CHECK( templateVec->Tsft==uvar.Tsft && templateVec->SFToverlap==uvar.SFToverlap && templateVec->Tobs==uvar.Tobs, XLAL_EINVAL, "Template bank %s doesn't match input parameters\n", uvar.templatebankfile );
+      XLAL_CHECK( (templatePool = createTwoSpectTemplatePool(templateVec, 10)) != NULL, XLAL_EFUNC );
    }
 
    //Initialize candidate vectors and upper limits
@@ -795,7 +797,7 @@ int main(int argc, char *argv[])
          candidateVector *candVec = NULL, *subsetVec = NULL;
          XLAL_CHECK( (candVec = createcandidateVector(50)) != NULL, XLAL_EFUNC );
          XLAL_CHECK( (subsetVec = createcandidateVector(10)) != NULL, XLAL_EFUNC );
-         XLAL_CHECK( testTwoSpectTemplateVector(candVec, templateVec, ffdata, aveNoise, aveTFnoisePerFbinRatio, skypos, &uvar, rng, 10) == XLAL_SUCCESS, XLAL_EFUNC );
+         XLAL_CHECK( testTwoSpectTemplateVector(candVec, templateVec, templatePool, ffdata, aveNoise, aveTFnoisePerFbinRatio, skypos, &uvar, rng, 10) == XLAL_SUCCESS, XLAL_EFUNC );
          XLAL_CHECK( analyzeCandidatesTemplateFromVector(subsetVec, candVec, templateVec, ffdata, aveNoise, aveTFnoisePerFbinRatio, &uvar, rng, 500) == XLAL_SUCCESS, XLAL_EFUNC );
          for (ii=0; ii<(INT4)subsetVec->length; ii++) {
             if (exactCandidates2->numofcandidates==exactCandidates2->length) {
@@ -1001,7 +1003,10 @@ int main(int argc, char *argv[])
          XLALDestroyINT4Vector(indexValuesOfExistingSFTs);
       }
    }
-   if (XLALUserVarWasSet(&(uvar.templatebankfile))) destroyTwoSpectTemplateVector(templateVec);
+   if (XLALUserVarWasSet(&(uvar.templatebankfile))) {
+      destroyTwoSpectTemplateVector(templateVec);
+      destroyTwoSpectTemplatePool(templatePool);
+   }
    XLALFree(detectors);
    gsl_rng_free(rng);
    XLALDestroyREAL4VectorAligned(background);
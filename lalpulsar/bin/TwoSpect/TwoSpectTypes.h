@@ -263,5 +263,16 @@ typedef struct
    REAL8 Tobs;
 } TwoSpectTemplateVector;
 
+typedef struct
+{
+   UINT4 length;                //number of templates
+   UINT4 *offsets;              //pixels of template ii are offsets[ii] to offsets[ii+1]-1
+   INT4 *firstfreqbins;         //1st FFT frequency bin of each pixel relative to the central bin, before shifting to a specific frequency bin
+   UINT4 *secfreqbins;          //2nd FFT frequency bin of each pixel
+   REAL8 *weights;              //weights divided by the sum of squared weights of the template
+   INT4 minfirstfreqbin;        //smallest 1st FFT frequency bin of any pixel
+   INT4 maxfirstfreqbin;        //largest 1st FFT frequency bin of any pixel
+} TwoSpectTemplatePool;
+
 #endif
 
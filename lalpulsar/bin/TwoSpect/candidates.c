@@ -23,6 +23,7 @@
 #include "candidates.h"
 #include "falsealarm.h"
 #include "templates.h"
+#include "vectormath.h"
 
 /**
  * Allocate a candidateVector
@@ -1085,8 +1086,15 @@ INT4 testIHScandidates(candidateVector **output, const candidateVector *ihsCandi
 /**
  * Test each of the templates in a TwoSpectTemplateVector and keep the top 10
  * This will not check the false alarm probability of any R value less than 0.
+ *
+ * The R values of all the templates are computed from the flat TwoSpectTemplatePool copy of the templates, in blocks of
+ * consecutive frequency bins, using calculateRForTemplatePool(). The false alarm probabilities are then computed, and the
+ * candidates kept, in the same order as testing one template for one frequency bin at a time. The R values agree with those of
+ * calculateR() only to within single-precision rounding, so R values very close to 0, and candidates with very close false
+ * alarm probabilities, may be treated differently.
  * \param [out] output                 Pointer to pointer of a candidateVector storing a list of all candidates
  * \param [in]  templateVec            Pointer to a TwoSpectTemplateVector containing all the templates to be searched
+ * \param [in]  templatePool           Pointer to a TwoSpectTemplatePool made from templateVec with createTwoSpectTemplatePool()
  * \param [in]  ffdata                 Pointer to ffdataStruct
  * \param [in]  aveNoise               Pointer to REAL4VectorAligned of 2nd FFT background powers
  * \param [in]  aveTFnoisePerFbinRatio Pointer to REAL4VectorAligned of normalized SFT background spectra
@@ -1096,10 +1104,11 @@ INT4 testIHScandidates(candidateVector **output, const candidateVector *ihsCandi
  * \param [in]  templateLen            Maximum length of a template
  * \return Status value
  */
-INT4 testTwoSpectTemplateVector(candidateVector *output, const TwoSpectTemplateVector *templateVec, const ffdataStruct *ffdata, const REAL4VectorAligned *aveNoise, const REAL4VectorAligned *aveTFnoisePerFbinRatio, const SkyPosition skypos, const UserInput_t *params, const gsl_rng *rng, const UINT4 templateLen)
+INT4 testTwoSpectTemplateVector(candidateVector *output, const TwoSpectTemplateVector *templateVec, const TwoSpectTemplatePool *templatePool, const ffdataStruct *ffdata, const REAL4VectorAligned *aveNoise, const REAL4VectorAligned *aveTFnoisePerFbinRatio, const SkyPosition skypos, const UserInput_t *params, const gsl_rng *rng, const UINT4 templateLen)
 {
 
-   XLAL_CHECK( output!=NULL && templateVec!=NULL && ffdata!=NULL && aveNoise!=NULL && aveTFnoisePerFbinRatio!=NULL && params!=NULL && rng!=NULL, XLAL_EINVAL );
+   XLAL_CHECK( output!=NULL && templateVec!=NULL && templatePool!=NULL && ffdata!=NULL && aveNoise!=NULL && aveTFnoisePerFbinRatio!=NULL && params!=NULL && rng!=NULL, XLAL_EINVAL );
+   XLAL_CHECK( templatePool->length <= templateVec->length, XLAL_EINVAL );
 
    fprintf(stderr, "Testing TwoSpectTemplateVector... ");
    
@@ -1110,36 +1119,60 @@ INT4 testTwoSpectTemplateVector(candidateVector *output, const TwoSpectTemplateV
 
    FILE *RVALS = NULL;
    if (XLALUserVarWasSet(&params->saveRvalues)) XLAL_CHECK( (RVALS = fopen(params->saveRvalues, "w")) != NULL, XLAL_EIO, "Couldn't open %s for writing", params->saveRvalues );
-   
+
+   //Excess power above the noise, arranged for computing the R values of many frequency bins at once
+   REAL4VectorAligned *excessplane = NULL;
+   XLAL_CHECK( (excessplane = calculateRExcessPlane(ffdata, aveNoise, aveTFnoisePerFbinRatio)) != NULL, XLAL_EFUNC );
+
    UINT4 numfbins = (UINT4)round(params->fspan*params->Tsft);
-   for (UINT4 ii=0; ii<numfbins; ii++) {
-      REAL8 freq = params->fmin + ii/params->Tsft;
-      for (UINT4 jj=0; jj<templateVec->length; jj++) {
-         if (templateVec->data[jj]->templatedata->data[0] == 0.0) break;
-         
-         XLAL_CHECK( convertTemplateForSpecificFbin(template, templateVec->data[jj], freq, params) == XLAL_SUCCESS, XLAL_EFUNC );
-         
-         REAL8 R = calculateR(ffdata->ffdata, template, aveNoise, aveTFnoisePerFbinRatio);
-         XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
-         REAL8 prob = 0.0, h0 = 0.0;
-         if ( R > 0.0 ) {
-            prob = probR(template, aveNoise, aveTFnoisePerFbinRatio, R, params, rng, &proberrcode);
-            XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
-            h0 = 2.7426*pow(R/(params->Tsft*params->Tobs),0.25);
-         }
+   INT4 ffdatabin0 = (INT4)round((params->fmin-params->dfmax)*params->Tsft) - 6;
+
+   //Limit the R values held at once to ~32 MB
+   UINT4 maxblocklen = 4194304 / (templatePool->length > 0 ? templatePool->length : 1);
+   if (maxblocklen==0) maxblocklen = 1;
+   else if (maxblocklen>numfbins) maxblocklen = numfbins;
+   REAL8 *Rvals = NULL;
+   XLAL_CHECK( (Rvals = XLALMalloc(sizeof(*Rvals)*maxblocklen*(templatePool->length > 0 ? templatePool->length : 1))) != NULL, XLAL_ENOMEM );
+
+   UINT4 ii = 0;
+   while (ii<numfbins) {
+      //Block of frequency bins whose signal bins are consecutive
+      INT4 sigbin0 = (INT4)round((params->fmin + ii/params->Tsft)*params->Tsft) - ffdatabin0;
+      UINT4 blocklen = 1;
+      while (blocklen<maxblocklen && ii+blocklen<numfbins && (INT4)round((params->fmin + (ii+blocklen)/params->Tsft)*params->Tsft) - ffdatabin0 == sigbin0 + (INT4)blocklen) blocklen++;
+
+      XLAL_CHECK( calculateRForTemplatePool(Rvals, templatePool, excessplane, ffdata->numfbins, sigbin0, blocklen, params->vectorMath) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      for (UINT4 kk=0; kk<blocklen; kk++, ii++) {
+         REAL8 freq = params->fmin + ii/params->Tsft;
+         for (UINT4 jj=0; jj<templatePool->length; jj++) {
+            REAL8 R = Rvals[jj*blocklen + kk];
+            REAL8 prob = 0.0, h0 = 0.0;
+            BOOLEAN converted = 0;
+            if ( R > 0.0 ) {
+               XLAL_CHECK( convertTemplateForSpecificFbin(template, templateVec->data[jj], freq, params) == XLAL_SUCCESS, XLAL_EFUNC );
+               converted = 1;
+               prob = probR(template, aveNoise, aveTFnoisePerFbinRatio, R, params, rng, &proberrcode);
+               XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
+               h0 = 2.7426*pow(R/(params->Tsft*params->Tobs),0.25);
+            }
 
-         if (XLALUserVarWasSet(&params->saveRvalues)) fprintf(RVALS, "%g\n", R);
+            if (XLALUserVarWasSet(&params->saveRvalues)) fprintf(RVALS, "%g\n", R);
 
-         if (prob < output->data[output->length-1].prob) {
-            UINT4 insertionPoint = output->length - 1;
-            while(insertionPoint>0 && prob<output->data[insertionPoint - 1].prob) insertionPoint--;
-            for (INT4 kk=(INT4)output->length-2; kk>=(INT4)insertionPoint; kk--) loadCandidateData(&(output->data[kk+1]), output->data[kk].fsig, output->data[kk].period, output->data[kk].moddepth, output->data[kk].ra, output->data[kk].dec, output->data[kk].stat, output->data[kk].h0, output->data[kk].prob, output->data[kk].proberrcode, output->data[kk].normalization, output->data[kk].templateVectorIndex, output->data[kk].lineContamination);
-            loadCandidateData(&(output->data[insertionPoint]), template->f0, template->period, template->moddepth, skypos.longitude, skypos.latitude, R, h0, prob, proberrcode, ffdata->tfnormalization, jj, 0);
-            if (output->numofcandidates<output->length) output->numofcandidates++;
+            if (prob < output->data[output->length-1].prob) {
+               if (!converted) XLAL_CHECK( convertTemplateForSpecificFbin(template, templateVec->data[jj], freq, params) == XLAL_SUCCESS, XLAL_EFUNC );
+               UINT4 insertionPoint = output->length - 1;
+               while(insertionPoint>0 && prob<output->data[insertionPoint - 1].prob) insertionPoint--;
+               for (INT4 ll=(INT4)output->length-2; ll>=(INT4)insertionPoint; ll--) loadCandidateData(&(output->data[ll+1]), output->data[ll].fsig, output->data[ll].period, output->data[ll].moddepth, output->data[ll].ra, output->data[ll].dec, output->data[ll].stat, output->data[ll].h0, output->data[ll].prob, output->data[ll].proberrcode, output->data[ll].normalization, output->data[ll].templateVectorIndex, output->data[ll].lineContamination);
+               loadCandidateData(&(output->data[insertionPoint]), template->f0, template->period, template->moddepth, skypos.longitude, skypos.latitude, R, h0, prob, proberrcode, ffdata->tfnormalization, jj, 0);
+               if (output->numofcandidates<output->length) output->numofcandidates++;
+            }
          }
       }
    }
 
+   XLALFree(Rvals);
+   XLALDestroyREAL4VectorAligned(excessplane);
    destroyTwoSpectTemplate(template);
 
    if (XLALUserVarWasSet(&params->saveRvalues)) fclose(RVALS);
@@ -1243,6 +1276,81 @@ REAL8 calculateR(const REAL4VectorAligned *ffdata, const TwoSpectTemplate *templ
 
 } /* calculateR() */
 
+/**
+ * Compute the excess power of the 2nd FFT data above the background, transposed so that
+ * each row holds one 2nd FFT frequency bin for all 1st FFT frequency bins
+ *
+ * The R statistic of a template (see calculateR()) is the weighted sum of the excess power of its pixels. Shifting a template
+ * in frequency moves its pixels along the rows of this plane, so the R values of a template at many consecutive frequency bins
+ * are computed from contiguous parts of the rows, see calculateRForTemplatePool().
+ * \param [in] ffdata        Pointer to ffdataStruct
+ * \param [in] noise         Pointer to the REAL4VectorAligned containing the background 2nd FFT powers
+ * \param [in] fbinaveratios Pointer to the REAL4VectorAligned of normalized SFT background powers
+ * \return Pointer to newly allocated REAL4VectorAligned of length noise->length*ffdata->numfbins
+ */
+REAL4VectorAligned * calculateRExcessPlane(const ffdataStruct *ffdata, const REAL4VectorAligned *noise, const REAL4VectorAligned *fbinaveratios)
+{
+
+   XLAL_CHECK_NULL( ffdata != NULL && noise != NULL && fbinaveratios != NULL, XLAL_EINVAL );
+
+   UINT4 numfprbins = noise->length;
+   UINT4 numfbins = ffdata->numfbins;
+   XLAL_CHECK_NULL( ffdata->ffdata->length >= numfbins*numfprbins && fbinaveratios->length >= numfbins, XLAL_EBADLEN );
+
+   REAL4VectorAligned *excessplane = NULL;
+   XLAL_CHECK_NULL( (excessplane = XLALCreateREAL4VectorAligned(numfbins*numfprbins, 32)) != NULL, XLAL_EFUNC );
+
+   for (UINT4 ii=0; ii<numfbins; ii++) {
+      for (UINT4 jj=0; jj<numfprbins; jj++) {
+         excessplane->data[jj*numfbins + ii] = ffdata->ffdata->data[ii*numfprbins + jj] - noise->data[jj]*fbinaveratios->data[ii];
+      }
+   }
+
+   return excessplane;
+
+} /* calculateRExcessPlane() */
+
+
+/**
+ * Calculate the R statistic of every template of a TwoSpectTemplatePool for a block of consecutive frequency bins
+ *
+ * The R value of template jj, with its pixels shifted by sigbin0+kk 1st FFT frequency bins, is stored in output[jj*numsigbins + kk].
+ * Each pixel of a template adds its weight times a contiguous part of a row of the excess power plane to the R values of the
+ * whole block, which is done with vector math; the templates are divided between threads if OpenMP is enabled. The products
+ * are computed in double precision and summed in the order of the pool pixels, whereas calculateR() rounds them to single
+ * precision and sums them in template order, so the two agree to within a few single-precision roundings of the terms.
+ * \param [out] output      Pointer to an array of pool->length*numsigbins R values
+ * \param [in]  pool        Pointer to the TwoSpectTemplatePool
+ * \param [in]  excessplane Pointer to the REAL4VectorAligned computed by calculateRExcessPlane()
+ * \param [in]  numfbins    Number of 1st FFT frequency bins in the excess power plane
+ * \param [in]  sigbin0     Shift of the templates for the first frequency bin of the block
+ * \param [in]  numsigbins  Number of frequency bins in the block
+ * \param [in]  vectorMath  Flag indicating to use vector math: 0 = none, 1 = SSE2, 2 = AVX
+ * \return Status value
+ */
+INT4 calculateRForTemplatePool(REAL8 *output, const TwoSpectTemplatePool *pool, const REAL4VectorAligned *excessplane, const UINT4 numfbins, const INT4 sigbin0, const UINT4 numsigbins, const INT4 vectorMath)
+{
+
+   XLAL_CHECK( output != NULL && pool != NULL && excessplane != NULL && numfbins > 0 && numsigbins > 0, XLAL_EINVAL );
+   if (pool->length==0) return XLAL_SUCCESS;
+   XLAL_CHECK( pool->minfirstfreqbin + sigbin0 >= 0 && pool->maxfirstfreqbin + sigbin0 + (INT4)numsigbins <= (INT4)numfbins, XLAL_EDOM, "Templates shifted by %d to %d bins lie outside the 2nd FFT data\n", sigbin0, sigbin0 + (INT4)numsigbins - 1 );
+
+   INT4 failed = 0;
+#pragma omp parallel for schedule(dynamic, 16) reduction(|:failed)
+   for (INT4 jj=0; jj<(INT4)pool->length; jj++) {
+      REAL8 *R = &(output[jj*numsigbins]);
+      memset(R, 0, sizeof(REAL8)*numsigbins);
+      for (UINT4 ii=pool->offsets[jj]; ii<pool->offsets[jj+1]; ii++) {
+         const REAL4 *row = &(excessplane->data[pool->secfreqbins[ii]*numfbins + (UINT4)(pool->firstfreqbins[ii] + sigbin0)]);
+         if (VectorScaleAccumulateREAL4(R, row, pool->weights[ii], numsigbins, vectorMath) != XLAL_SUCCESS) failed |= 1;
+      }
+   }
+   XLAL_CHECK( !failed, XLAL_EFUNC );
+
+   return XLAL_SUCCESS;
+
+} /* calculateRForTemplatePool() */
+
 INT4 writeCandidateVector2File(const CHAR *outputfile, const candidateVector *input)
 {
    XLAL_CHECK( outputfile != NULL && input != NULL, XLAL_EINVAL );
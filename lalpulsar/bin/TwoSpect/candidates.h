@@ -118,6 +118,7 @@ INT4 testIHScandidates(candidateVector **output,
                        const gsl_rng *rng);
 INT4 testTwoSpectTemplateVector(candidateVector *output,
                                 const TwoSpectTemplateVector *templateVec,
+                                const TwoSpectTemplatePool *templatePool,
                                 const ffdataStruct *ffdata,
                                 const REAL4VectorAligned *aveNoise,
                                 const REAL4VectorAligned *aveTFnoisePerFbinRatio,
@@ -140,6 +141,8 @@ INT4 writeCandidateVector2File(const CHAR *outputfile, const candidateVector *in
 REAL8 maxModDepth(const REAL8 period, const REAL8 cohtime);
 REAL8 minPeriod(const REAL8 moddepth, const REAL8 cohtime);
 REAL8 calculateR(const REAL4VectorAligned *ffdata, const TwoSpectTemplate *template, const REAL4VectorAligned *noise, const REAL4VectorAligned *fbinaveratios);
+REAL4VectorAligned * calculateRExcessPlane(const ffdataStruct *ffdata, const REAL4VectorAligned *noise, const REAL4VectorAligned *fbinaveratios);
+INT4 calculateRForTemplatePool(REAL8 *output, const TwoSpectTemplatePool *pool, const REAL4VectorAligned *excessplane, const UINT4 numfbins, const INT4 sigbin0, const UINT4 numsigbins, const INT4 vectorMath);
 
 #endif
 
@@ -0,0 +1,159 @@
+/*
+*  Copyright (C) 2026 LIGO Scientific Collaboration
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/*
+ * Compare the R values of calculateRForTemplatePool() with those of calculateR(), for a template bank made by
+ * generateTwoSpectTemplateVector() and random 2nd FFT data, at every frequency bin of a search band.
+ *
+ * calculateR() rounds the product of each excess power and template weight to single precision, and sums the pixels
+ * in template order; calculateRForTemplatePool() multiplies the excess power by the normalised weight in double
+ * precision, and sums the pixels in order of 2nd and 1st FFT frequency bin. The excess powers themselves are computed
+ * in single precision by both, but the compiler may contract them into fused multiply-adds differently. The difference
+ * of the two R values is therefore bounded by a few single-precision roundings of the sum over pixels of
+ * (|data| + |background|)*|weight|, and the test requires that it be less than R_TOLERANCE times that sum.
+ */
+
+#include <math.h>
+#include <float.h>
+
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+#include <lal/LALStdlib.h>
+
+#include "../candidates.h"
+#include "../templates.h"
+#include "../vectormath.h"
+
+//Allowed difference of the R values, relative to the scale of the rounding errors of the terms of R
+#define R_TOLERANCE (4.0*FLT_EPSILON)
+
+FILE *LOG = NULL;
+
+int main(void)
+{
+
+   UserInput_t XLAL_INIT_DECL(params);
+   params.Tsft = 1800.0;
+   params.SFToverlap = 900.0;
+   params.Tobs = 20.0*86400.0;
+   params.fmin = 100.0;
+   params.fspan = 0.25;
+   params.Pmin = 7200.0;
+   params.Pmax = 0.2*params.Tobs;
+   params.dfmin = 0.005;
+   params.dfmax = 0.02;
+
+   //Template bank
+   TwoSpectTemplateVector *templateVec = NULL;
+   XLAL_CHECK_MAIN( (templateVec = generateTwoSpectTemplateVector(params.Pmin, params.Pmax, params.dfmin, params.dfmax, params.Tsft, params.SFToverlap, params.Tobs, 200, 1, 500, 0, 0)) != NULL, XLAL_EFUNC );
+
+   //Random 2nd FFT data and background, with the layout made by TwoSpect
+   ffdataStruct ffdata;
+   ffdata.numfbins = (INT4)(round(params.fspan*params.Tsft + 2.0*params.dfmax*params.Tsft)+12+1);
+   ffdata.numffts = (INT4)floor(params.Tobs/(params.Tsft-params.SFToverlap)-1);
+   ffdata.numfprbins = (INT4)floorf(ffdata.numffts*0.5) + 1;
+   ffdata.tfnormalization = ffdata.ffnormalization = 1.0;
+   XLAL_CHECK_MAIN( (ffdata.ffdata = XLALCreateREAL4VectorAligned(ffdata.numfbins*ffdata.numfprbins, 32)) != NULL, XLAL_EFUNC );
+   REAL4VectorAligned *aveNoise = NULL, *aveTFnoisePerFbinRatio = NULL;
+   XLAL_CHECK_MAIN( (aveNoise = XLALCreateREAL4VectorAligned(ffdata.numfprbins, 32)) != NULL, XLAL_EFUNC );
+   XLAL_CHECK_MAIN( (aveTFnoisePerFbinRatio = XLALCreateREAL4VectorAligned(ffdata.numfbins, 32)) != NULL, XLAL_EFUNC );
+
+   gsl_rng *rng = NULL;
+   XLAL_CHECK_MAIN( (rng = gsl_rng_alloc(gsl_rng_mt19937)) != NULL, XLAL_ENOMEM );
+   gsl_rng_set(rng, 1234);
+   for (UINT4 ii=0; ii<aveNoise->length; ii++) aveNoise->data[ii] = 1.0 + 100.0*exp(-0.02*ii);
+   for (UINT4 ii=0; ii<aveTFnoisePerFbinRatio->length; ii++) aveTFnoisePerFbinRatio->data[ii] = 0.5 + gsl_rng_uniform(rng);
+   for (INT4 ii=0; ii<ffdata.numfbins; ii++) {
+      for (INT4 jj=0; jj<ffdata.numfprbins; jj++) ffdata.ffdata->data[ii*ffdata.numfprbins + jj] = gsl_ran_exponential(rng, aveNoise->data[jj]*aveTFnoisePerFbinRatio->data[ii]);
+   }
+
+   REAL4VectorAligned *excessplane = NULL;
+   XLAL_CHECK_MAIN( (excessplane = calculateRExcessPlane(&ffdata, aveNoise, aveTFnoisePerFbinRatio)) != NULL, XLAL_EFUNC );
+
+   UINT4 numfbins = (UINT4)round(params.fspan*params.Tsft);
+   INT4 ffdatabin0 = (INT4)round((params.fmin-params.dfmax)*params.Tsft) - 6;
+   INT4 sigbin0 = (INT4)round(params.fmin*params.Tsft) - ffdatabin0;
+
+   //Templates of the length used by TwoSpect, and longer templates
+   const UINT4 templateLens[] = {10, 100};
+   const INT4 vectorMaths[] = {0,
+#ifdef __SSE2__
+      1,
+#endif
+#ifdef __AVX__
+      2,
+#endif
+   };
+
+   for (UINT4 ll=0; ll<XLAL_NUM_ELEM(templateLens); ll++) {
+      TwoSpectTemplatePool *templatePool = NULL;
+      XLAL_CHECK_MAIN( (templatePool = createTwoSpectTemplatePool(templateVec, templateLens[ll])) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( templatePool->length > 0, XLAL_EFAILED );
+      TwoSpectTemplate *template = NULL;
+      XLAL_CHECK_MAIN( (template = createTwoSpectTemplate(templateLens[ll])) != NULL, XLAL_EFUNC );
+      REAL8 *Rvals = NULL;
+      XLAL_CHECK_MAIN( (Rvals = XLALMalloc(sizeof(*Rvals)*numfbins*templatePool->length)) != NULL, XLAL_ENOMEM );
+
+      for (UINT4 vv=0; vv<XLAL_NUM_ELEM(vectorMaths); vv++) {
+         XLAL_CHECK_MAIN( calculateRForTemplatePool(Rvals, templatePool, excessplane, ffdata.numfbins, sigbin0, numfbins, vectorMaths[vv]) == XLAL_SUCCESS, XLAL_EFUNC );
+
+         REAL8 maxrelerr = 0.0;
+         for (UINT4 jj=0; jj<templatePool->length; jj++) {
+            for (UINT4 kk=0; kk<numfbins; kk++) {
+               REAL8 freq = params.fmin + kk/params.Tsft;
+               XLAL_CHECK_MAIN( convertTemplateForSpecificFbin(template, templateVec->data[jj], freq, &params) == XLAL_SUCCESS, XLAL_EFUNC );
+               REAL8 R = calculateR(ffdata.ffdata, template, aveNoise, aveTFnoisePerFbinRatio);
+               XLAL_CHECK_MAIN( xlalErrno == 0, XLAL_EFUNC );
+
+               //Scale of the rounding errors of the terms of R
+               REAL8 sumofsqweights = 0.0, sumofabsterms = 0.0;
+               for (UINT4 ii=0; ii<template->templatedata->length; ii++) sumofsqweights += template->templatedata->data[ii]*template->templatedata->data[ii];
+               for (UINT4 ii=0; ii<template->templatedata->length; ii++) {
+                  if (template->templatedata->data[ii]==0.0) continue;
+                  UINT4 firstfreqbin = template->pixellocations->data[ii]/ffdata.numfprbins;
+                  UINT4 secfreqbin = template->pixellocations->data[ii] - firstfreqbin*ffdata.numfprbins;
+                  sumofabsterms += (fabs(ffdata.ffdata->data[template->pixellocations->data[ii]]) + fabs(aveNoise->data[secfreqbin]*aveTFnoisePerFbinRatio->data[firstfreqbin]))*fabs(template->templatedata->data[ii])/sumofsqweights;
+               }
+
+               REAL8 relerr = fabs(Rvals[jj*numfbins + kk] - R)/sumofabsterms;
+               XLAL_CHECK_MAIN( relerr <= R_TOLERANCE, XLAL_ETOL, "Template %u of length %u at bin %u with vectorMath=%d: R = %.17g, calculateR() = %.17g, relative error %g > %g\n", jj, templateLens[ll], kk, vectorMaths[vv], Rvals[jj*numfbins + kk], R, relerr, R_TOLERANCE );
+               if (relerr>maxrelerr) maxrelerr = relerr;
+            }
+         }
+         fprintf(stderr, "%u templates of length %u, %u bins, vectorMath=%d: maximum relative error %g <= %g\n", templatePool->length, templateLens[ll], numfbins, vectorMaths[vv], maxrelerr, R_TOLERANCE);
+      }
+
+      XLALFree(Rvals);
+      destroyTwoSpectTemplate(template);
+      destroyTwoSpectTemplatePool(templatePool);
+   }
+
+   XLALDestroyREAL4VectorAligned(excessplane);
+   gsl_rng_free(rng);
+   XLALDestroyREAL4VectorAligned(aveTFnoisePerFbinRatio);
+   XLALDestroyREAL4VectorAligned(aveNoise);
+   XLALDestroyREAL4VectorAligned(ffdata.ffdata);
+   destroyTwoSpectTemplateVector(templateVec);
+
+   LALCheckMemoryLeaks();
+
+   return 0;
+
+}
@@ -129,6 +129,96 @@ void destroyTwoSpectTemplateVector(TwoSpectTemplateVector *vector)
 }
 
 
+/**
+ * Create a TwoSpectTemplatePool, a flat copy of the non-zero pixels of the templates in a TwoSpectTemplateVector
+ *
+ * Each template keeps at most templateLength pixels (as when using convertTemplateForSpecificFbin() with a template of this length),
+ * and its weights are divided by the sum of its squared weights, as in calculateR(). The 1st FFT frequency bins of the pixels are
+ * relative to the central bin of the template, and may be negative. The pixels of each template are sorted by 2nd and then
+ * 1st FFT frequency bin, so that calculateRForTemplatePool() reads the excess power plane in memory order.
+ * \param [in] vector         Pointer to the TwoSpectTemplateVector
+ * \param [in] templateLength The maximum number of pixels of a template to keep
+ * \return Pointer to a TwoSpectTemplatePool
+ */
+TwoSpectTemplatePool * createTwoSpectTemplatePool(const TwoSpectTemplateVector *vector, const UINT4 templateLength)
+{
+   XLAL_CHECK_NULL( vector != NULL && templateLength > 0, XLAL_EINVAL );
+
+   UINT4 numffts = (UINT4)floor(vector->Tobs/(vector->Tsft-vector->SFToverlap)-1);
+   UINT4 numfprbins = (UINT4)floorf(0.5*numffts) + 1;
+
+   //Templates in the vector are used up to the first empty template
+   UINT4 numtemplates = 0, numpixels = 0;
+   while (numtemplates<vector->length && vector->data[numtemplates]->templatedata->data[0] != 0.0) {
+      const REAL4VectorAligned *weights = vector->data[numtemplates]->templatedata;
+      for (UINT4 ii=0; ii<weights->length && ii<templateLength; ii++) if (weights->data[ii]!=0.0) numpixels++;
+      numtemplates++;
+   }
+
+   TwoSpectTemplatePool *pool = NULL;
+   XLAL_CHECK_NULL( (pool = XLALCalloc(1, sizeof(*pool))) != NULL, XLAL_ENOMEM );
+   pool->length = numtemplates;
+   XLAL_CHECK_NULL( (pool->offsets = XLALMalloc((numtemplates+1)*sizeof(*pool->offsets))) != NULL, XLAL_ENOMEM );
+   if (numpixels>0) {
+      XLAL_CHECK_NULL( (pool->firstfreqbins = XLALMalloc(numpixels*sizeof(*pool->firstfreqbins))) != NULL, XLAL_ENOMEM );
+      XLAL_CHECK_NULL( (pool->secfreqbins = XLALMalloc(numpixels*sizeof(*pool->secfreqbins))) != NULL, XLAL_ENOMEM );
+      XLAL_CHECK_NULL( (pool->weights = XLALMalloc(numpixels*sizeof(*pool->weights))) != NULL, XLAL_ENOMEM );
+   }
+
+   UINT4 kk = 0;
+   for (UINT4 ii=0; ii<numtemplates; ii++) {
+      const TwoSpectTemplate *template = vector->data[ii];
+      pool->offsets[ii] = kk;
+
+      REAL8 sumofsqweights = 0.0;
+      for (UINT4 jj=0; jj<template->templatedata->length && jj<templateLength; jj++) sumofsqweights += template->templatedata->data[jj]*template->templatedata->data[jj];
+      XLAL_CHECK_NULL( sumofsqweights != 0.0, XLAL_EFPDIV0 );
+
+      for (UINT4 jj=0; jj<template->templatedata->length && jj<templateLength; jj++) {
+         if (template->templatedata->data[jj]==0.0) continue;
+         //Pixels left of the central bin have negative locations, so round the 1st FFT frequency bin down
+         INT4 firstfreqbin = (INT4)floor((REAL8)template->pixellocations->data[jj]/numfprbins);
+         UINT4 secfreqbin = (UINT4)(template->pixellocations->data[jj] - firstfreqbin*(INT4)numfprbins);
+         REAL8 weight = template->templatedata->data[jj]/sumofsqweights;
+
+         //Insertion sort by 2nd FFT frequency bin, then 1st FFT frequency bin
+         UINT4 insertionPoint = kk;
+         while (insertionPoint>pool->offsets[ii] && (pool->secfreqbins[insertionPoint-1]>secfreqbin || (pool->secfreqbins[insertionPoint-1]==secfreqbin && pool->firstfreqbins[insertionPoint-1]>firstfreqbin))) {
+            pool->firstfreqbins[insertionPoint] = pool->firstfreqbins[insertionPoint-1];
+            pool->secfreqbins[insertionPoint] = pool->secfreqbins[insertionPoint-1];
+            pool->weights[insertionPoint] = pool->weights[insertionPoint-1];
+            insertionPoint--;
+         }
+         pool->firstfreqbins[insertionPoint] = firstfreqbin;
+         pool->secfreqbins[insertionPoint] = secfreqbin;
+         pool->weights[insertionPoint] = weight;
+         if (kk==0 || firstfreqbin<pool->minfirstfreqbin) pool->minfirstfreqbin = firstfreqbin;
+         if (kk==0 || firstfreqbin>pool->maxfirstfreqbin) pool->maxfirstfreqbin = firstfreqbin;
+         kk++;
+      }
+   }
+   pool->offsets[numtemplates] = kk;
+
+   return pool;
+}
+
+
+/**
+ * Free a TwoSpectTemplatePool
+ * \param [in] pool Pointer to the TwoSpectTemplatePool
+ */
+void destroyTwoSpectTemplatePool(TwoSpectTemplatePool *pool)
+{
+   if (pool==NULL) return;
+   XLALFree(pool->offsets);
+   XLALFree(pool->firstfreqbins);
+   XLALFree(pool->secfreqbins);
+   XLALFree(pool->weights);
+   XLALFree(pool);
+   return;
+}
+
+
 /**
  * Generate a TwoSpectTemplateVector containing the template data
  * \param [in] Pmin              Minimum orbital period (s)
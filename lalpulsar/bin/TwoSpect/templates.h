@@ -28,6 +28,8 @@ void resetTwoSpectTemplate(TwoSpectTemplate *template);
 void destroyTwoSpectTemplate(TwoSpectTemplate *template);
 TwoSpectTemplateVector * createTwoSpectTemplateVector(const UINT4 numTemplates, const UINT4 templateLength);
 void destroyTwoSpectTemplateVector(TwoSpectTemplateVector *vector);
+TwoSpectTemplatePool * createTwoSpectTemplatePool(const TwoSpectTemplateVector *vector, const UINT4 templateLength);
+void destroyTwoSpectTemplatePool(TwoSpectTemplatePool *pool);
 TwoSpectTemplateVector * generateTwoSpectTemplateVector(const REAL8 Pmin, const REAL8 Pmax, const REAL8 dfmin, const REAL8 dfmax, const REAL8 Tsft, const REAL8 SFToverlap, const REAL8 Tobs, const UINT4 maxvectorlength, const UINT4 minTemplateLength, const UINT4 maxTemplateLength, const UINT4 vectormathflag, const BOOLEAN exactflag);
 INT4 writeTwoSpectTemplateVector(const TwoSpectTemplateVector *vector, const CHAR *filename);
 TwoSpectTemplateVector * readTwoSpectTemplateVector(const CHAR *filename);
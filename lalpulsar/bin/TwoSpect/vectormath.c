@@ -560,6 +560,66 @@ INT4 VectorCabsCOMPLEX8(alignedREAL8Vector *output, COMPLEX8Vector *input, INT4
    return XLAL_SUCCESS;
 }
 
+/**
+ * Accumulate a scaled REAL4 array into a REAL8 array, output[ii] += scale*input[ii]
+ *
+ * The arrays need not be aligned, so that they may be rows or parts of rows of a larger array
+ * \param [in,out] output     Pointer to REAL8 array
+ * \param [in]     input      Pointer to REAL4 array
+ * \param [in]     scale      Scale factor
+ * \param [in]     length     Number of elements
+ * \param [in]     vectorMath Flag indicating to use vector math: 0 = none, 1 = SSE2, 2 = AVX
+ * \return Status value
+ */
+INT4 VectorScaleAccumulateREAL4(REAL8 *output, const REAL4 *input, const REAL8 scale, const UINT4 length, INT4 vectorMath)
+{
+   XLAL_CHECK( output!=NULL && input!=NULL, XLAL_EINVAL );
+   if (vectorMath==2) {
+#ifdef __AVX__
+      _mm256_zeroupper();
+      INT4 roundedvectorlength = (INT4)length / 4;
+      __m256d scalevec = _mm256_set1_pd(scale);
+      for (INT4 ii=0; ii<roundedvectorlength; ii++) {
+         __m256d in = _mm256_cvtps_pd(_mm_loadu_ps(&(input[4*ii])));
+         __m256d out = _mm256_loadu_pd(&(output[4*ii]));
+         _mm256_storeu_pd(&(output[4*ii]), _mm256_add_pd(out, _mm256_mul_pd(in, scalevec)));
+      }
+      _mm256_zeroupper();
+      for (UINT4 ii=4*roundedvectorlength; ii<length; ii++) output[ii] += scale*input[ii];
+#else
+      (void)output;
+      (void)input;
+      (void)scale;
+      (void)length;
+      fprintf(stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__);
+      XLAL_ERROR(XLAL_EFAILED);
+#endif
+   } else if (vectorMath==1) {
+#ifdef __SSE2__
+      INT4 roundedvectorlength = (INT4)length / 4;
+      __m128d scalevec = _mm_set1_pd(scale);
+      for (INT4 ii=0; ii<roundedvectorlength; ii++) {
+         __m128 in = _mm_loadu_ps(&(input[4*ii]));
+         __m128d inlo = _mm_cvtps_pd(in);
+         __m128d inhi = _mm_cvtps_pd(_mm_movehl_ps(in, in));
+         __m128d outlo = _mm_loadu_pd(&(output[4*ii]));
+         __m128d outhi = _mm_loadu_pd(&(output[4*ii+2]));
+         _mm_storeu_pd(&(output[4*ii]), _mm_add_pd(outlo, _mm_mul_pd(inlo, scalevec)));
+         _mm_storeu_pd(&(output[4*ii+2]), _mm_add_pd(outhi, _mm_mul_pd(inhi, scalevec)));
+      }
+      for (UINT4 ii=4*roundedvectorlength; ii<length; ii++) output[ii] += scale*input[ii];
+#else
+      (void)output;
+      (void)input;
+      (void)scale;
+      (void)length;
+      fprintf(stderr, "%s: Failed because SSE2 is not supported, possibly because -msse2 flag wasn't used for compiling.\n", __func__);
+      XLAL_ERROR(XLAL_EFAILED);
+#endif
+   } else for (UINT4 ii=0; ii<length; ii++) output[ii] += scale*input[ii];
+   return XLAL_SUCCESS;
+}
+
 /**
  * Sum two alignedREAL8Vector using SSE2
  * \param [out] output Pointer to a alignedREAL8Vector
@@ -56,6 +56,7 @@ INT4 VectorAbsREAL4(REAL4VectorAligned *output, REAL4VectorAligned *input, INT4
 INT4 VectorAbsREAL8(alignedREAL8Vector *output, alignedREAL8Vector *input, INT4 vectorMath);
 INT4 VectorCabsfCOMPLEX8(REAL4VectorAligned *output, COMPLEX8Vector *input, INT4 vectorMath);
 INT4 VectorCabsCOMPLEX8(alignedREAL8Vector *output, COMPLEX8Vector *input, INT4 vectorMath);
+INT4 VectorScaleAccumulateREAL4(REAL8 *output, const REAL4 *input, const REAL8 scale, const UINT4 length, INT4 vectorMath);
 
 INT4 sseSSVectorSubtract(REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2);
 INT4 avxSSVectorSubtract(REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2);
@@ -24,9 +24,13 @@
 
 #include "CacheResults.h"
 
+#include <limits.h>
+#include <unistd.h>
+
 #include <lal/LALHeap.h>
 #include <lal/LALHashTbl.h>
 #include <lal/LALBitset.h>
+#include <lal/LogPrintf.h>
 
 // Compare two quantities, and return a sort order value if they are unequal
 #define COMPARE_BY( x, y ) do { if ( (x) < (y) ) return -1; if ( (x) > (y) ) return +1; } while(0)
@@ -45,6 +49,18 @@ typedef struct {
   WeaveCohResults *coh_res;
 } cache_item;
 
+///
+/// Item spilled from the cache to file
+///
+typedef struct {
+  /// Generation, used to find items in spill file
+  UINT4 generation;
+  /// Coherent locator index, used to find items in spill file
+  UINT8 coh_index;
+  /// Offset of coherent results in spill file
+  long offset;
+} spill_item;
+
 ///
 /// Container for a series of cache queries
 ///
@@ -135,6 +151,31 @@ struct tagWeaveCache {
   BOOLEAN all_gc;
   /// Save an no-longer-used cache item for re-use
   cache_item *saved_item;
+  /// Cache item returned by the last retrieval, whose coherent results are yet to be returned
+  cache_item *retrieved_item;
+  /// Whether coherent results of the retrieved cache item must be computed
+  BOOLEAN retrieved_compute;
+  /// Offset in spill file from which to restore coherent results of the retrieved cache item, or -1 to compute them
+  long retrieved_spill_offset;
+  /// File to which items removed from the cache, which may still be required, are spilled
+  FILE *spill_file;
+  /// Offset of the end of data in spill file
+  long spill_end;
+  /// Size in bytes which the spill file may reach before no more items are spilled to it, or zero for no limit
+  long spill_max_size;
+  /// Hash table which looks up items in spill file by generation and locator index
+  LALHashTbl *spill_hash;
+  /// Wall time taken to compute coherent results, and number of items computed
+  double compute_wall;
+  UINT8 compute_nitems;
+  /// Wall time taken to spill coherent results, and number of items spilled
+  double spill_wall;
+  UINT8 spill_nitems;
+  /// Number of bytes written to spill file
+  UINT8 spill_nbytes;
+  /// Wall time taken to restore coherent results, and number of items restored
+  double restore_wall;
+  UINT8 restore_nitems;
 };
 
 ///
@@ -148,6 +189,12 @@ static UINT8 cache_item_hash( const void *x );
 static int cache_item_compare_by_coh_index( const void *x, const void *y );
 static int cache_item_compare_by_relevance( const void *x, const void *y );
 static void cache_item_destroy( void *x );
+static UINT8 spill_item_hash( const void *x );
+static int spill_item_compare_by_coh_index( const void *x, const void *y );
+static BOOLEAN cache_restore_is_cheaper( const WeaveCache *cache );
+static BOOLEAN cache_spill_is_cheaper( const WeaveCache *cache );
+static BOOLEAN cache_spill_has_room( const WeaveCache *cache );
+static int cache_spill_item( WeaveCache *cache, const cache_item *item );
 
 /// @}
 
@@ -209,6 +256,107 @@ UINT8 cache_item_hash(
   return hval;
 }
 
+///
+/// Compare spilled items by generation, then locator index
+///
+int spill_item_compare_by_coh_index(
+  const void *x,
+  const void *y
+)
+{
+  const spill_item *ix = ( const spill_item * ) x;
+  const spill_item *iy = ( const spill_item * ) y;
+  COMPARE_BY( ix->generation, iy->generation );   // Compare in ascending order
+  COMPARE_BY( ix->coh_index, iy->coh_index );   // Compare in ascending order
+  return 0;
+}
+
+///
+/// Hash spilled items by generation and locator index
+///
+UINT8 spill_item_hash(
+  const void *x
+)
+{
+  const spill_item *ix = ( const spill_item * ) x;
+  UINT4 hval = 0;
+  XLALPearsonHash( &hval, sizeof( hval ), &ix->generation, sizeof( ix->generation ) );
+  XLALPearsonHash( &hval, sizeof( hval ), &ix->coh_index, sizeof( ix->coh_index ) );
+  return hval;
+}
+
+///
+/// Whether restoring coherent results from the spill file is estimated to be faster than recomputing them.
+/// Until restoring has been timed, it is assumed to be faster.
+///
+BOOLEAN cache_restore_is_cheaper(
+  const WeaveCache *cache
+)
+{
+  if ( cache->compute_nitems == 0 || cache->restore_nitems == 0 ) {
+    return 1;
+  }
+  return cache->restore_wall / cache->restore_nitems < cache->compute_wall / cache->compute_nitems;
+}
+
+///
+/// Whether spilling coherent results to file, and later restoring them, is estimated to be faster than
+/// recomputing them. Until spilling and restoring have been timed, they are assumed to be faster.
+///
+BOOLEAN cache_spill_is_cheaper(
+  const WeaveCache *cache
+)
+{
+  if ( cache->compute_nitems == 0 || cache->spill_nitems == 0 || cache->restore_nitems == 0 ) {
+    return 1;
+  }
+  return cache->spill_wall / cache->spill_nitems + cache->restore_wall / cache->restore_nitems < cache->compute_wall / cache->compute_nitems;
+}
+
+///
+/// Whether the spill file has not yet reached its maximum size
+///
+BOOLEAN cache_spill_has_room(
+  const WeaveCache *cache
+)
+{
+  return cache->spill_max_size == 0 || cache->spill_end < cache->spill_max_size;
+}
+
+///
+/// Spill the coherent results of an item removed from the cache to the end of the spill file
+///
+int cache_spill_item(
+  WeaveCache *cache,
+  const cache_item *item
+)
+{
+
+  const double wall_start = XLALGetTimeOfDay();
+
+  // Write coherent results to end of spill file
+  XLAL_CHECK( fseek( cache->spill_file, cache->spill_end, SEEK_SET ) == 0, XLAL_EIO );
+  UINT8 nbytes = 0;
+  XLAL_CHECK( XLALWeaveCohResultsWrite( cache->spill_file, item->coh_res, &nbytes ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Add item to spill file hash table
+  spill_item *new_item = XLALCalloc( 1, sizeof( *new_item ) );
+  XLAL_CHECK( new_item != NULL, XLAL_ENOMEM );
+  new_item->generation = item->generation;
+  new_item->coh_index = item->coh_index;
+  new_item->offset = cache->spill_end;
+  XLAL_CHECK( XLALHashTblAdd( cache->spill_hash, new_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Update end of spill file and spill timings
+  cache->spill_end += nbytes;
+  cache->spill_nbytes += nbytes;
+  cache->spill_wall += XLALGetTimeOfDay() - wall_start;
+  ++cache->spill_nitems;
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Sample points on surface of coherent bounding box, convert to semicoherent supersky
 /// coordinates, and record maximum value of semicoherent coordinate in dimension 'dim0'
@@ -773,10 +921,63 @@ void XLALWeaveCacheDestroy(
     XLALHashTblDestroy( cache->coh_index_hash );
     cache_item_destroy( cache->saved_item );
     XLALBitsetDestroy( cache->coh_computed_bitset );
+    if ( cache->spill_file != NULL ) {
+      fclose( cache->spill_file );
+    }
+    XLALHashTblDestroy( cache->spill_hash );
     XLALFree( cache );
   }
 }
 
+///
+/// Spill items removed from the cache, which may still be required, to a file in the given directory.
+/// Spilled items are restored instead of being recomputed if this is estimated to be faster, based on
+/// timings of previous computations, spills, and restores. The file is deleted when it is closed.
+///
+/// The file is overwritten from the beginning whenever the cache is expired. If 'max_size' is not zero,
+/// no more items are spilled once the file has reached 'max_size' bytes, until the cache is next expired;
+/// the file therefore exceeds 'max_size' by at most the size of one item.
+///
+int XLALWeaveCacheSetSpillDirectory(
+  WeaveCache *cache,
+  const char *spill_dir,
+  const UINT8 max_size
+)
+{
+
+  // Check input
+  XLAL_CHECK( cache != NULL, XLAL_EFAULT );
+  XLAL_CHECK( cache->spill_file == NULL, XLAL_EINVAL, "Cache is already spilling to file" );
+  XLAL_CHECK( spill_dir != NULL, XLAL_EFAULT );
+  XLAL_CHECK( max_size <= LONG_MAX, XLAL_EINVAL, "Maximum size of spill file is too large" );
+
+  // Create a unique spill file, and unlink it so that it is deleted when closed
+  char *spill_path = XLALStringAppendFmt( NULL, "%s/WeaveCache-XXXXXX", spill_dir );
+  XLAL_CHECK( spill_path != NULL, XLAL_EFUNC );
+  const int fd = mkstemp( spill_path );
+  if ( fd < 0 ) {
+    XLALPrintError( "%s: could not create spill file '%s'\n", __func__, spill_path );
+    XLALFree( spill_path );
+    XLAL_ERROR( XLAL_EIO );
+  }
+  unlink( spill_path );
+  XLALFree( spill_path );
+  cache->spill_file = fdopen( fd, "w+b" );
+  if ( cache->spill_file == NULL ) {
+    close( fd );
+    XLAL_ERROR( XLAL_EIO, "Could not open spill file" );
+  }
+  cache->spill_end = 0;
+  cache->spill_max_size = max_size;
+
+  // Create a hash table which looks up items in spill file by generation and locator index
+  cache->spill_hash = XLALHashTblCreate( XLALFree, spill_item_hash, spill_item_compare_by_coh_index );
+  XLAL_CHECK( cache->spill_hash != NULL, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Determine the mean maximum size obtained by caches
 ///
@@ -823,6 +1024,19 @@ int XLALWeaveCacheWriteInfo(
   XLAL_CHECK( XLALWeaveGetCacheMeanMaxSize( &cache_mean_max_size, ncache, cache ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( XLALFITSHeaderWriteREAL4( file, "cachemmx", cache_mean_max_size, "Mean maximum size obtained by cache" ) == XLAL_SUCCESS, XLAL_EFUNC );
 
+  // Write the total number of spilled and restored items, and the size of the spill files, if any
+  if ( cache[0]->spill_file != NULL ) {
+    UINT8 spill_nitems = 0, restore_nitems = 0, spill_nbytes = 0;
+    for ( size_t i = 0; i < ncache; ++i ) {
+      spill_nitems += cache[i]->spill_nitems;
+      restore_nitems += cache[i]->restore_nitems;
+      spill_nbytes += cache[i]->spill_nbytes;
+    }
+    XLAL_CHECK( XLALFITSHeaderWriteUINT8( file, "cachespl", spill_nitems, "number of items spilled from cache" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteUINT8( file, "cacherst", restore_nitems, "number of items restored to cache" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteREAL4( file, "cachesmb", spill_nbytes / 1048576.0, "total data written to cache spill files in MB" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
   return XLAL_SUCCESS;
 
 }
@@ -842,6 +1056,12 @@ int XLALWeaveCacheExpire(
   // - Existing items will no longer be accessible, but are still kept for reuse
   ++cache->generation;
 
+  // Spilled items will also no longer be accessible, so overwrite spill file from the beginning
+  if ( cache->spill_file != NULL ) {
+    XLAL_CHECK( XLALHashTblClear( cache->spill_hash ) == XLAL_SUCCESS, XLAL_EFUNC );
+    cache->spill_end = 0;
+  }
+
   return XLAL_SUCCESS;
 
 }
@@ -861,6 +1081,12 @@ int XLALWeaveCacheClear(
   XLAL_CHECK( XLALHeapClear( cache->relevance_heap ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( XLALHashTblClear( cache->coh_index_hash ) == XLAL_SUCCESS, XLAL_EFUNC );
 
+  // Clear items in the spill file
+  if ( cache->spill_file != NULL ) {
+    XLAL_CHECK( XLALHashTblClear( cache->spill_hash ) == XLAL_SUCCESS, XLAL_EFUNC );
+    cache->spill_end = 0;
+  }
+
   // Reset current generation of cache items
   cache->generation = 0;
 
@@ -890,12 +1116,63 @@ int XLALWeaveCacheRetrieve(
   XLAL_CHECK( coh_offset != NULL, XLAL_EFAULT );
   XLAL_CHECK( tim != NULL, XLAL_EFAULT );
 
+  // Look up coherent results in the cache, and compute them immediately if not found
+  BOOLEAN compute = 0;
+  XLAL_CHECK( XLALWeaveCacheRetrieveDeferred( cache, queries, query_index, coh_index, coh_offset, &compute ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALWeaveCacheRetrieveCompute( cache, queries, query_index, coh_res, tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Retrieve coherent results for a given query, deferring the computation of new coherent results if not found.
+///
+/// All bookkeeping of the cache (i.e. lookup, insertion, and garbage collection) is performed here, so that the
+/// contents and size of the cache are the same as for XLALWeaveCacheRetrieve(). The coherent results themselves
+/// must then be obtained from XLALWeaveCacheRetrieveCompute() before this cache is next queried; \p compute is
+/// set to indicate whether that call will compute new coherent results, or restore them from the spill file.
+///
+int XLALWeaveCacheRetrieveDeferred(
+  WeaveCache *cache,
+  const WeaveCacheQueries *queries,
+  const UINT4 query_index,
+  UINT8 *coh_index,
+  UINT4 *coh_offset,
+  BOOLEAN *compute
+)
+{
+
+  // Check input
+  XLAL_CHECK( cache != NULL, XLAL_EFAULT );
+  XLAL_CHECK( cache->retrieved_item == NULL, XLAL_EINVAL, "Coherent results from previous retrieval have not been computed" );
+  XLAL_CHECK( queries != NULL, XLAL_EFAULT );
+  XLAL_CHECK( query_index < queries->nqueries, XLAL_EINVAL );
+  XLAL_CHECK( coh_index != NULL, XLAL_EFAULT );
+  XLAL_CHECK( coh_offset != NULL, XLAL_EFAULT );
+  XLAL_CHECK( compute != NULL, XLAL_EFAULT );
+
   // See if coherent results are already cached
   const cache_item find_key = { .generation = cache->generation, .coh_index = queries->coh_index[query_index] };
   const cache_item *find_item = NULL;
   XLAL_CHECK( XLALHashTblFind( cache->coh_index_hash, &find_key, ( const void ** ) &find_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+  *compute = ( find_item == NULL );
+  long restore_offset = -1;
   if ( find_item == NULL ) {
 
+    // See if coherent results were spilled to file; if so, restore them if that is estimated to be faster than recomputing them
+    if ( cache->spill_file != NULL ) {
+      const spill_item find_spill_key = { .generation = find_key.generation, .coh_index = find_key.coh_index };
+      spill_item *find_spill_item = NULL;
+      XLAL_CHECK( XLALHashTblExtract( cache->spill_hash, &find_spill_key, ( void ** ) &find_spill_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( find_spill_item != NULL ) {
+        if ( cache_restore_is_cheaper( cache ) ) {
+          restore_offset = find_spill_item->offset;
+        }
+        XLALFree( find_spill_item );
+      }
+    }
+
     // Reuse 'saved_item' if possible, otherwise allocate memory for a new cache item
     if ( cache->saved_item == NULL ) {
       cache->saved_item = XLALCalloc( 1, sizeof( *cache->saved_item ) );
@@ -914,9 +1191,6 @@ int XLALWeaveCacheRetrieve(
     // Determine the number of points in the coherent frequency block
     const UINT4 coh_nfreqs = queries->coh_right[query_index] - queries->coh_left[query_index] + 1;
 
-    // Compute coherent results for the new cache item
-    XLAL_CHECK( XLALWeaveCohResultsCompute( &new_item->coh_res, cache->coh_input, &queries->coh_phys[query_index], coh_nfreqs, tim ) == XLAL_SUCCESS, XLAL_EFUNC );
-
     // Add new cache item to the index hash table
     XLAL_CHECK( XLALHashTblAdd( cache->coh_index_hash, new_item ) == XLAL_SUCCESS, XLAL_EFUNC );
 
@@ -969,6 +1243,13 @@ int XLALWeaveCacheRetrieve(
       // If 'saved_item' contains an item removed from the heap, also remove it from the index hash table
       if ( cache->saved_item != NULL ) {
         XLAL_CHECK( XLALHashTblRemove( cache->coh_index_hash, cache->saved_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+        // If the removed item may still be required, spill it to file if that is estimated to be faster than recomputing it,
+        // and the spill file has not reached its maximum size
+        if ( cache->spill_file != NULL && cache->saved_item != new_item && cache->saved_item->coh_res != NULL && cache_item_compare_by_relevance( cache->saved_item, &relevance_threshold ) >= 0 && cache_spill_is_cheaper( cache ) && cache_spill_has_room( cache ) ) {
+          XLAL_CHECK( cache_spill_item( cache, cache->saved_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+        }
+
       }
 
     }
@@ -979,8 +1260,10 @@ int XLALWeaveCacheRetrieve(
       cache->heap_max_size = heap_size;
     }
 
-    // Increment number of computed coherent results
-    queries->coh_nres[query_index] += coh_nfreqs;
+    // Increment number of computed coherent results, unless they are restored from the spill file
+    if ( restore_offset < 0 ) {
+      queries->coh_nres[query_index] += coh_nfreqs;
+    }
 
     // Check if coherent results have been computed previously
     const UINT8 coh_bitset_index = queries->freq_partition_index * cache->coh_max_index + find_key.coh_index;
@@ -998,8 +1281,11 @@ int XLALWeaveCacheRetrieve(
 
   }
 
-  // Return coherent results from cache
-  *coh_res = find_item->coh_res;
+  // Save retrieved item, and whether its coherent results must be computed
+  // - The item is not freed before the cache is next queried, even if it has already been removed from the cache
+  cache->retrieved_item = ( cache_item * ) find_item;
+  cache->retrieved_compute = *compute;
+  cache->retrieved_spill_offset = restore_offset;
 
   // Return index of coherent result
   *coh_index = find_item->coh_index;
@@ -1011,6 +1297,60 @@ int XLALWeaveCacheRetrieve(
 
 }
 
+///
+/// Return coherent results retrieved by XLALWeaveCacheRetrieveDeferred(), computing them first if required.
+///
+/// Different caches may call this function concurrently, provided that their coherent input data do not share
+/// F-statistic workspaces, and that \p tim is \c NULL.
+///
+int XLALWeaveCacheRetrieveCompute(
+  WeaveCache *cache,
+  const WeaveCacheQueries *queries,
+  const UINT4 query_index,
+  const WeaveCohResults **coh_res,
+  WeaveSearchTiming *tim
+)
+{
+
+  // Check input
+  XLAL_CHECK( cache != NULL, XLAL_EFAULT );
+  XLAL_CHECK( cache->retrieved_item != NULL, XLAL_EINVAL, "No coherent results have been retrieved" );
+  XLAL_CHECK( queries != NULL, XLAL_EFAULT );
+  XLAL_CHECK( query_index < queries->nqueries, XLAL_EINVAL );
+  XLAL_CHECK( coh_res != NULL, XLAL_EFAULT );
+
+  cache_item *item = cache->retrieved_item;
+  cache->retrieved_item = NULL;
+
+  if ( cache->retrieved_compute && cache->retrieved_spill_offset >= 0 ) {
+
+    // Restore coherent results for the new cache item from the spill file
+    const double wall_start = XLALGetTimeOfDay();
+    XLAL_CHECK( fseek( cache->spill_file, cache->retrieved_spill_offset, SEEK_SET ) == 0, XLAL_EIO );
+    XLAL_CHECK( XLALWeaveCohResultsRead( cache->spill_file, &item->coh_res ) == XLAL_SUCCESS, XLAL_EFUNC );
+    cache->restore_wall += XLALGetTimeOfDay() - wall_start;
+    ++cache->restore_nitems;
+
+  } else if ( cache->retrieved_compute ) {
+
+    // Determine the number of points in the coherent frequency block
+    const UINT4 coh_nfreqs = queries->coh_right[query_index] - queries->coh_left[query_index] + 1;
+
+    // Compute coherent results for the new cache item
+    const double wall_start = XLALGetTimeOfDay();
+    XLAL_CHECK( XLALWeaveCohResultsCompute( &item->coh_res, cache->coh_input, &queries->coh_phys[query_index], coh_nfreqs, tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+    cache->compute_wall += XLALGetTimeOfDay() - wall_start;
+    ++cache->compute_nitems;
+
+  }
+
+  // Return coherent results from cache
+  *coh_res = item->coh_res;
+
+  return XLAL_SUCCESS;
+
+}
+
 // Local Variables:
 // c-file-style: "linux"
 // c-basic-offset: 2
@@ -83,6 +83,11 @@ WeaveCache *XLALWeaveCacheCreate(
 void XLALWeaveCacheDestroy(
   WeaveCache *cache
 );
+int XLALWeaveCacheSetSpillDirectory(
+  WeaveCache *cache,
+  const char *spill_dir,
+  const UINT8 max_size
+);
 int XLALWeaveGetCacheMeanMaxSize(
   REAL4 *cache_mean_max_size,
   const size_t ncache,
@@ -108,6 +113,21 @@ int XLALWeaveCacheRetrieve(
   UINT4 *coh_offset,
   WeaveSearchTiming *tim
 );
+int XLALWeaveCacheRetrieveDeferred(
+  WeaveCache *cache,
+  const WeaveCacheQueries *queries,
+  const UINT4 query_index,
+  UINT8 *coh_index,
+  UINT4 *coh_offset,
+  BOOLEAN *compute
+);
+int XLALWeaveCacheRetrieveCompute(
+  WeaveCache *cache,
+  const WeaveCacheQueries *queries,
+  const UINT4 query_index,
+  const WeaveCohResults **coh_res,
+  WeaveSearchTiming *tim
+);
 
 #ifdef __cplusplus
 }
@@ -34,6 +34,8 @@
 #include <lal/UserInputPrint.h>
 #include <lal/ExtrapolatePulsarSpins.h>
 
+#include <zlib.h>
+
 #define XLAL_CHECK_CUDA_CALL(...) do { \
   cudaError_t retn; \
   XLAL_CHECK ( ( retn = (__VA_ARGS__) ) == cudaSuccess, XLAL_EERR, "%s failed with return code %i", #__VA_ARGS__, retn ); \
@@ -113,9 +115,95 @@ struct tagWeaveCohResults {
 int XLALVectorsMaxREAL4CUDA( REAL4 *max, const REAL4 **vec, const size_t nvec, const size_t nbin );
 int XLALVectorsAddREAL4CUDA( REAL4 *sum, const REAL4 **vec, const size_t nvec, const size_t nbin );
 #endif
+static int coh_res_write_vector( FILE *file, const REAL4Vector *vec, const UINT4 nfreqs, Bytef *buf, UINT8 *nbytes );
+static int coh_res_read_vector( FILE *file, REAL4Vector *vec, const UINT4 nfreqs, Bytef *buf );
 
 /// @}
 
+///
+/// Byte-shuffle and compress the first \p nfreqs elements of a vector of F-statistics, and write them to a file
+///
+int coh_res_write_vector(
+  FILE *file,
+  const REAL4Vector *vec,
+  const UINT4 nfreqs,
+  Bytef *buf,
+  UINT8 *nbytes
+)
+{
+
+  // Buffers for shuffled bytes and compressed bytes
+  const uLong raw_len = sizeof( vec->data[0] ) * nfreqs;
+  Bytef *shuf = buf;
+  Bytef *zbuf = buf + raw_len;
+  uLongf zlen = compressBound( raw_len );
+
+  // Group the bytes of each significance together, which makes the exponent bytes of the F-statistics compressible
+  const Bytef *raw = ( const Bytef * ) vec->data;
+  for ( size_t k = 0; k < nfreqs; ++k ) {
+    for ( size_t b = 0; b < sizeof( vec->data[0] ); ++b ) {
+      shuf[b * nfreqs + k] = raw[k * sizeof( vec->data[0] ) + b];
+    }
+  }
+
+  // Compress shuffled bytes, but store them uncompressed if that is not smaller
+  XLAL_CHECK( compress2( zbuf, &zlen, shuf, raw_len, Z_BEST_SPEED ) == Z_OK, XLAL_EFAILED, "Compression of F-statistics failed" );
+  const Bytef *out = zbuf;
+  if ( zlen >= raw_len ) {
+    out = shuf;
+    zlen = raw_len;
+  }
+
+  // Write length of stored bytes, followed by stored bytes
+  const UINT4 len = zlen;
+  XLAL_CHECK( fwrite( &len, sizeof( len ), 1, file ) == 1, XLAL_EIO );
+  XLAL_CHECK( fwrite( out, 1, len, file ) == len, XLAL_EIO );
+  *nbytes += sizeof( len ) + len;
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Read and uncompress a vector of F-statistics written by coh_res_write_vector()
+///
+int coh_res_read_vector(
+  FILE *file,
+  REAL4Vector *vec,
+  const UINT4 nfreqs,
+  Bytef *buf
+)
+{
+
+  // Buffers for shuffled bytes and compressed bytes
+  const uLong raw_len = sizeof( vec->data[0] ) * nfreqs;
+  Bytef *shuf = buf;
+  Bytef *zbuf = buf + raw_len;
+
+  // Read length of stored bytes, followed by stored bytes
+  UINT4 len = 0;
+  XLAL_CHECK( fread( &len, sizeof( len ), 1, file ) == 1, XLAL_EIO );
+  XLAL_CHECK( len <= compressBound( raw_len ), XLAL_EIO, "Invalid length of stored F-statistics" );
+  if ( len == raw_len ) {
+    XLAL_CHECK( fread( shuf, 1, len, file ) == len, XLAL_EIO );
+  } else {
+    XLAL_CHECK( fread( zbuf, 1, len, file ) == len, XLAL_EIO );
+    uLongf shuf_len = raw_len;
+    XLAL_CHECK( uncompress( shuf, &shuf_len, zbuf, len ) == Z_OK && shuf_len == raw_len, XLAL_EIO, "Decompression of F-statistics failed" );
+  }
+
+  // Undo byte shuffle
+  Bytef *raw = ( Bytef * ) vec->data;
+  for ( size_t k = 0; k < nfreqs; ++k ) {
+    for ( size_t b = 0; b < sizeof( vec->data[0] ); ++b ) {
+      raw[k * sizeof( vec->data[0] ) + b] = shuf[b * nfreqs + k];
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Create coherent input data
 ///
@@ -580,6 +668,125 @@ void XLALWeaveCohResultsDestroy(
   }
 }
 
+///
+/// Write coherent results to the current position of a file, compressing the F-statistics losslessly.
+/// The number of bytes written is returned in \p nbytes.
+///
+int XLALWeaveCohResultsWrite(
+  FILE *file,
+  const WeaveCohResults *coh_res,
+  UINT8 *nbytes
+)
+{
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( coh_res != NULL, XLAL_EFAULT );
+  XLAL_CHECK( coh_res->coh2F_CUDA.data == NULL, XLAL_EINVAL, "Coherent results in CUDA device memory cannot be written" );
+  XLAL_CHECK( nbytes != NULL, XLAL_EFAULT );
+
+  // Record which vectors of F-statistics are present: bit 0 for multi-detector, bit 1 + i for detector i
+  UINT4 present = 0;
+  if ( coh_res->coh2F != NULL ) {
+    present |= 1;
+  }
+  for ( size_t i = 0; i < PULSAR_MAX_DETECTORS; ++i ) {
+    if ( coh_res->coh2F_det[i] != NULL ) {
+      present |= 1u << ( i + 1 );
+    }
+  }
+
+  // Write coherent template parameters, number of frequencies, and present vectors
+  XLAL_CHECK( fwrite( &coh_res->coh_phys, sizeof( coh_res->coh_phys ), 1, file ) == 1, XLAL_EIO );
+  XLAL_CHECK( fwrite( &coh_res->nfreqs, sizeof( coh_res->nfreqs ), 1, file ) == 1, XLAL_EIO );
+  XLAL_CHECK( fwrite( &present, sizeof( present ), 1, file ) == 1, XLAL_EIO );
+  *nbytes = sizeof( coh_res->coh_phys ) + sizeof( coh_res->nfreqs ) + sizeof( present );
+
+  // Allocate buffer for shuffled and compressed bytes
+  const uLong raw_len = sizeof( REAL4 ) * coh_res->nfreqs;
+  Bytef *buf = XLALMalloc( raw_len + compressBound( raw_len ) );
+  XLAL_CHECK( buf != NULL, XLAL_ENOMEM );
+
+  // Write vectors of F-statistics
+  int retn = XLAL_SUCCESS;
+  if ( coh_res->coh2F != NULL ) {
+    retn = coh_res_write_vector( file, coh_res->coh2F, coh_res->nfreqs, buf, nbytes );
+  }
+  for ( size_t i = 0; retn == XLAL_SUCCESS && i < PULSAR_MAX_DETECTORS; ++i ) {
+    if ( coh_res->coh2F_det[i] != NULL ) {
+      retn = coh_res_write_vector( file, coh_res->coh2F_det[i], coh_res->nfreqs, buf, nbytes );
+    }
+  }
+  XLALFree( buf );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Read coherent results written by XLALWeaveCohResultsWrite() from the current position of a file
+///
+int XLALWeaveCohResultsRead(
+  FILE *file,
+  WeaveCohResults **coh_res
+)
+{
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( coh_res != NULL, XLAL_EFAULT );
+
+  // Allocate results struct if required
+  if ( *coh_res == NULL ) {
+    *coh_res = XLALCalloc( 1, sizeof( **coh_res ) );
+    XLAL_CHECK( *coh_res != NULL, XLAL_ENOMEM );
+  }
+
+  // Read coherent template parameters, number of frequencies, and present vectors
+  UINT4 present = 0;
+  XLAL_CHECK( fread( &( *coh_res )->coh_phys, sizeof( ( *coh_res )->coh_phys ), 1, file ) == 1, XLAL_EIO );
+  XLAL_CHECK( fread( &( *coh_res )->nfreqs, sizeof( ( *coh_res )->nfreqs ), 1, file ) == 1, XLAL_EIO );
+  XLAL_CHECK( fread( &present, sizeof( present ), 1, file ) == 1, XLAL_EIO );
+  XLAL_CHECK( ( *coh_res )->nfreqs > 0, XLAL_EIO );
+
+  // Reallocate present vectors of F-statistics, and destroy absent vectors
+  REAL4Vector **vecs[1 + PULSAR_MAX_DETECTORS];
+  vecs[0] = &( *coh_res )->coh2F;
+  for ( size_t i = 0; i < PULSAR_MAX_DETECTORS; ++i ) {
+    vecs[1 + i] = &( *coh_res )->coh2F_det[i];
+  }
+  for ( size_t j = 0; j < XLAL_NUM_ELEM( vecs ); ++j ) {
+    if ( present & ( 1u << j ) ) {
+      if ( *vecs[j] == NULL || ( *vecs[j] )->length < ( *coh_res )->nfreqs ) {
+        *vecs[j] = XLALResizeREAL4Vector( *vecs[j], ( *coh_res )->nfreqs );
+        XLAL_CHECK( *vecs[j] != NULL, XLAL_ENOMEM );
+      }
+    } else {
+      XLALDestroyREAL4Vector( *vecs[j] );
+      *vecs[j] = NULL;
+    }
+  }
+
+  // Allocate buffer for shuffled and compressed bytes
+  const uLong raw_len = sizeof( REAL4 ) * ( *coh_res )->nfreqs;
+  Bytef *buf = XLALMalloc( raw_len + compressBound( raw_len ) );
+  XLAL_CHECK( buf != NULL, XLAL_ENOMEM );
+
+  // Read vectors of F-statistics
+  int retn = XLAL_SUCCESS;
+  for ( size_t j = 0; retn == XLAL_SUCCESS && j < XLAL_NUM_ELEM( vecs ); ++j ) {
+    if ( present & ( 1u << j ) ) {
+      retn = coh_res_read_vector( file, *vecs[j], ( *coh_res )->nfreqs, buf );
+    }
+  }
+  XLALFree( buf );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Create and initialise semicoherent results
 ///
@@ -773,6 +980,10 @@ int XLALWeaveSemiResultsInit(
 ///
 /// Add a new set of coherent results to the semicoherent results
 ///
+/// Coherent results may be added incrementally: each call adds the coherent results from segments
+/// <tt>semi_res->ncoh_res</tt> up to <tt>nsegments - 1</tt>, in segment order, so that adding all segments in
+/// one call or over several calls gives identical semicoherent results.
+///
 int XLALWeaveSemiResultsComputeSegs(
   WeaveSemiResults *semi_res,
   const UINT4 nsegments,
@@ -787,9 +998,9 @@ int XLALWeaveSemiResultsComputeSegs(
   XLAL_CHECK( semi_res != NULL, XLAL_EFAULT );
   XLAL_CHECK( semi_res->ncoh_res < semi_res->nsegments, XLAL_EINVAL );
   XLAL_CHECK( semi_res->statistics_params != NULL, XLAL_EFAULT );
-  XLAL_CHECK( nsegments > 0, XLAL_EINVAL );
+  XLAL_CHECK( semi_res->ncoh_res < nsegments && nsegments <= semi_res->nsegments, XLAL_EINVAL );
   XLAL_CHECK( coh_res != NULL, XLAL_EFAULT );
-  for ( size_t j = 0; j < nsegments; ++j ) {
+  for ( size_t j = semi_res->ncoh_res; j < nsegments; ++j ) {
     XLAL_CHECK( coh_res[j] != NULL, XLAL_EFAULT );
   }
   XLAL_CHECK( coh_index != NULL, XLAL_EFAULT );
@@ -798,10 +1009,11 @@ int XLALWeaveSemiResultsComputeSegs(
 
   WeaveStatisticType mainloop_stats = semi_res->statistics_params->mainloop_statistics;
 
-  // Set number of processed coherent results
+  // Set range of coherent results to process, and number of processed coherent results
+  const size_t j0 = semi_res->ncoh_res;
   semi_res->ncoh_res = nsegments;
 
-  for ( size_t j = 0; j < nsegments; ++j ) {
+  for ( size_t j = j0; j < nsegments; ++j ) {
 
     // Check that offset does not overrun coherent results arrays
     XLAL_CHECK( coh_offset[j] + semi_res->nfreqs <= coh_res[j]->nfreqs, XLAL_EFAILED, "Coherent offset (%u) + number of semicoherent frequency bins (%u) > number of coherent frequency bins (%u)", coh_offset[j], semi_res->nfreqs, coh_res[j]->nfreqs );
@@ -820,6 +1032,9 @@ int XLALWeaveSemiResultsComputeSegs(
     return XLAL_SUCCESS;
   }
 
+  // Coherent results on a CUDA device can only be added all at once
+  XLAL_CHECK( semi_res->coh2F_CUDA == NULL || ( j0 == 0 && nsegments == semi_res->nsegments ), XLAL_EINVAL, "CUDA coherent results cannot be added incrementally" );
+
   // Store per-segment F-statistics per frequency
   if ( mainloop_stats & WEAVE_STATISTIC_COH2F ) {
     if ( semi_res->coh2F_CUDA != NULL ) {
@@ -828,7 +1043,7 @@ int XLALWeaveSemiResultsComputeSegs(
         semi_res->coh2F_CUDA[j] = coh_res[j]->coh2F_CUDA.data + coh_offset[j];
       }
     } else {
-      for ( size_t j = 0; j < nsegments; ++j ) {
+      for ( size_t j = j0; j < nsegments; ++j ) {
         XLAL_CHECK( coh_res[j]->coh2F->data != NULL, XLAL_EFAULT );
         semi_res->coh2F[j] = coh_res[j]->coh2F->data + coh_offset[j];
       }
@@ -838,7 +1053,7 @@ int XLALWeaveSemiResultsComputeSegs(
   // Store per-segment per-detector F-statistics per frequency
   if ( mainloop_stats & WEAVE_STATISTIC_COH2F_DET ) {
     for ( size_t i = 0; i < semi_res->ndetectors; ++i ) {
-      for ( size_t j = 0; j < nsegments; ++j ) {
+      for ( size_t j = j0; j < nsegments; ++j ) {
         semi_res->coh2F_det[i][j] = ( coh_res[j]->coh2F_det[i] != NULL ) ? coh_res[j]->coh2F_det[i]->data + coh_offset[j] : NULL;
       }
     }
@@ -861,8 +1076,10 @@ int XLALWeaveSemiResultsComputeSegs(
     } else {
 
       // Generic implementation
-      memcpy( semi_res->max2F->data, semi_res->coh2F[0], sizeof( semi_res->max2F->data[0] ) * semi_res->nfreqs );
-      for ( size_t j = 1; j < nsegments; ++j ) {
+      if ( j0 == 0 ) {
+        memcpy( semi_res->max2F->data, semi_res->coh2F[0], sizeof( semi_res->max2F->data[0] ) * semi_res->nfreqs );
+      }
+      for ( size_t j = ( j0 > 0 ) ? j0 : 1; j < nsegments; ++j ) {
         XLAL_CHECK( XLALVectorMaxREAL4( semi_res->max2F->data, semi_res->max2F->data, semi_res->coh2F[j], semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
       }
 
@@ -875,8 +1092,10 @@ int XLALWeaveSemiResultsComputeSegs(
   // Add to max-over-segments per-detector F-statistics per frequency
   if ( mainloop_stats & WEAVE_STATISTIC_MAX2F_DET ) {
     for ( size_t i = 0; i < semi_res->ndetectors; ++i ) {
-      memset( semi_res->max2F_det[i]->data, 0, sizeof( semi_res->max2F_det[i]->data[0] ) * semi_res->nfreqs );
-      for ( size_t j = 0; j < nsegments; ++j ) {
+      if ( j0 == 0 ) {
+        memset( semi_res->max2F_det[i]->data, 0, sizeof( semi_res->max2F_det[i]->data[0] ) * semi_res->nfreqs );
+      }
+      for ( size_t j = j0; j < nsegments; ++j ) {
         if ( coh_res[j]->coh2F_det[i] != NULL ) {
           XLAL_CHECK( XLALVectorMaxREAL4( semi_res->max2F_det[i]->data, semi_res->max2F_det[i]->data, coh_res[j]->coh2F_det[i]->data + coh_offset[j], semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
         }
@@ -901,8 +1120,10 @@ int XLALWeaveSemiResultsComputeSegs(
     } else {
 
       // Generic implementation
-      memcpy( semi_res->sum2F->data, semi_res->coh2F[0], sizeof( semi_res->sum2F->data[0] ) * semi_res->nfreqs );
-      for ( size_t j = 1; j < nsegments; ++j ) {
+      if ( j0 == 0 ) {
+        memcpy( semi_res->sum2F->data, semi_res->coh2F[0], sizeof( semi_res->sum2F->data[0] ) * semi_res->nfreqs );
+      }
+      for ( size_t j = ( j0 > 0 ) ? j0 : 1; j < nsegments; ++j ) {
         XLAL_CHECK( XLALVectorAddREAL4( semi_res->sum2F->data, semi_res->sum2F->data, semi_res->coh2F[j], semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
       }
 
@@ -914,10 +1135,10 @@ int XLALWeaveSemiResultsComputeSegs(
 
   // Add to summed per-detector F-statistics per frequency, and increment number of additions thus far
   for ( size_t i = 0; i < semi_res->ndetectors; ++i ) {
-    if ( mainloop_stats & WEAVE_STATISTIC_SUM2F_DET ) {
+    if ( ( mainloop_stats & WEAVE_STATISTIC_SUM2F_DET ) && j0 == 0 ) {
       memset( semi_res->sum2F_det[i]->data, 0, sizeof( semi_res->sum2F_det[i]->data[0] ) * semi_res->nfreqs );
     }
-    for ( size_t j = 0; j < nsegments; ++j ) {
+    for ( size_t j = j0; j < nsegments; ++j ) {
       if ( coh_res[j]->coh2F_det[i] != NULL ) {
         if ( mainloop_stats & WEAVE_STATISTIC_SUM2F_DET ) {
           XLAL_CHECK( XLALVectorAddREAL4( semi_res->sum2F_det[i]->data, semi_res->sum2F_det[i]->data, coh_res[j]->coh2F_det[i]->data + coh_offset[j], semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
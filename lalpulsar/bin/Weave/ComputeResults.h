@@ -126,6 +126,15 @@ int XLALWeaveCohResultsCompute(
 void XLALWeaveCohResultsDestroy(
   WeaveCohResults *coh_res
 );
+int XLALWeaveCohResultsWrite(
+  FILE *file,
+  const WeaveCohResults *coh_res,
+  UINT8 *nbytes
+);
+int XLALWeaveCohResultsRead(
+  FILE *file,
+  WeaveCohResults **coh_res
+);
 int XLALWeaveSemiResultsInit(
   WeaveSemiResults **semi_res,
   const WeaveSimulationLevel simulation_level,
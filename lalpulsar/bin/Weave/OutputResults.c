@@ -80,6 +80,11 @@ struct tagWeaveOutputResults {
 ///
 /// @{
 
+static int output_results_write_header( FITSFile *file, const WeaveOutputResults *out );
+static int output_results_write_hgrm( FITSFile *file, const WeaveOutputResults *out );
+static int output_results_read_header( FITSFile *file, WeaveOutputResults **out, UINT4 toplist_limit );
+static int output_results_read_append_hgrm( FITSFile *file, WeaveOutputResults *out );
+
 /// @}
 
 ///
@@ -357,9 +362,9 @@ int XLALWeaveOutputResultsCompletionLoop(
 }
 
 ///
-/// Write output results to a FITS file
+/// Write output results header to a FITS file
 ///
-int XLALWeaveOutputResultsWrite(
+int output_results_write_header(
   FITSFile *file,
   const WeaveOutputResults *out
 )
@@ -414,10 +419,22 @@ int XLALWeaveOutputResultsWrite(
   // Write whether a histogram of mean multi-F-statistics will be written
   XLAL_CHECK( XLALFITSHeaderWriteBOOLEAN( file, "m2Fhgrm", out->mean2F_hgrm_bins != NULL, "mean 2F histogram?" ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-  // Write toplists
-  for ( size_t i = 0; i < out->ntoplists; ++i ) {
-    XLAL_CHECK( XLALWeaveResultsToplistWrite( file, out->toplists[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
-  }
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Write histogram of mean multi-F-statistics to a FITS file
+///
+int output_results_write_hgrm(
+  FITSFile *file,
+  const WeaveOutputResults *out
+)
+{
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( out != NULL, XLAL_EFAULT );
 
   // Write histogram of mean multi-F-statistics
   if ( out->mean2F_hgrm_bins != NULL ) {
@@ -460,9 +477,37 @@ int XLALWeaveOutputResultsWrite(
 }
 
 ///
-/// Read results from a FITS file and append to new/existing output results
+/// Write output results to a FITS file
 ///
-int XLALWeaveOutputResultsReadAppend(
+int XLALWeaveOutputResultsWrite(
+  FITSFile *file,
+  const WeaveOutputResults *out
+)
+{
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( out != NULL, XLAL_EFAULT );
+
+  // Write output results header
+  XLAL_CHECK( output_results_write_header( file, out ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Write toplists
+  for ( size_t i = 0; i < out->ntoplists; ++i ) {
+    XLAL_CHECK( XLALWeaveResultsToplistWrite( file, out->toplists[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Write histogram of mean multi-F-statistics
+  XLAL_CHECK( output_results_write_hgrm( file, out ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Read output results header from a FITS file, and create new or check existing output results
+///
+int output_results_read_header(
   FITSFile *file,
   WeaveOutputResults **out,
   UINT4 toplist_limit
@@ -588,13 +633,25 @@ int XLALWeaveOutputResultsReadAppend(
 
   }
 
-  // Read and append to toplists
-  for ( size_t i = 0; i < ( *out )->ntoplists; ++i ) {
-    XLAL_CHECK( XLALWeaveResultsToplistReadAppend( file, ( *out )->toplists[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
-  }
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Read histogram of mean multi-F-statistics from a FITS file and append to existing output results
+///
+int output_results_read_append_hgrm(
+  FITSFile *file,
+  WeaveOutputResults *out
+)
+{
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( out != NULL, XLAL_EFAULT );
 
   // Read and append histogram of mean multi-F-statistics
-  if ( ( *out )->mean2F_hgrm_bins != NULL ) {
+  if ( out->mean2F_hgrm_bins != NULL ) {
 
     // Open and describe FITS table for writing histogram bins
     UINT8 nrows = 0;
@@ -606,16 +663,16 @@ int XLALWeaveOutputResultsReadAppend(
 
     // Read histogram bins
     WeaveMean2FHistogramBin bin;
-    const REAL4 bin_upper_max = mean2F_hgrm_bin_width * ( *out )->mean2F_hgrm_bins->length;
+    const REAL4 bin_upper_max = mean2F_hgrm_bin_width * out->mean2F_hgrm_bins->length;
     while ( nrows > 0 ) {
       XLAL_CHECK( XLALFITSTableReadRow( file, &bin, &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
       if ( bin.lower < 0 ) {
-        ( *out )->mean2F_hgrm_underflow += bin.count;
+        out->mean2F_hgrm_underflow += bin.count;
       } else if ( bin.upper >= bin_upper_max ) {
-        ( *out )->mean2F_hgrm_overflow += bin.count;
+        out->mean2F_hgrm_overflow += bin.count;
       } else {
         const size_t j = bin.lower / mean2F_hgrm_bin_width;
-        ( *out )->mean2F_hgrm_bins->data[j] += bin.count;
+        out->mean2F_hgrm_bins->data[j] += bin.count;
       }
     }
 
@@ -625,6 +682,86 @@ int XLALWeaveOutputResultsReadAppend(
 
 }
 
+///
+/// Read results from a FITS file and append to new/existing output results
+///
+int XLALWeaveOutputResultsReadAppend(
+  FITSFile *file,
+  WeaveOutputResults **out,
+  UINT4 toplist_limit
+)
+{
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( out != NULL, XLAL_EFAULT );
+
+  // Read output results header
+  XLAL_CHECK( output_results_read_header( file, out, toplist_limit ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Read and append to toplists
+  for ( size_t i = 0; i < ( *out )->ntoplists; ++i ) {
+    XLAL_CHECK( XLALWeaveResultsToplistReadAppend( file, ( *out )->toplists[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Read and append histogram of mean multi-F-statistics
+  XLAL_CHECK( output_results_read_append_hgrm( file, *out ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Merge results read from several FITS files, and write the merged results to a FITS file
+///
+/// Unlike XLALWeaveOutputResultsReadAppend(), the toplists are merged directly from the input
+/// FITS files to the output FITS file using XLALWeaveResultsToplistMerge(), and so only
+/// 'chunk_size' toplist items from each input file are held in memory at any time.
+///
+int XLALWeaveOutputResultsMerge(
+  FITSFile *file,
+  const size_t ninputs,
+  FITSFile *const *inputs,
+  const UINT4 toplist_limit,
+  const size_t chunk_size
+)
+{
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( ninputs > 0, XLAL_EINVAL );
+  XLAL_CHECK( inputs != NULL, XLAL_EFAULT );
+  XLAL_CHECK( chunk_size > 0, XLAL_EINVAL );
+
+  // Read output results headers, and check that all input FITS files are consistent
+  WeaveOutputResults *out = NULL;
+  for ( size_t i = 0; i < ninputs; ++i ) {
+    XLAL_CHECK( inputs[i] != NULL, XLAL_EFAULT );
+    XLAL_CHECK( XLALFITSFileSeekPrimaryHDU( inputs[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( output_results_read_header( inputs[i], &out, toplist_limit ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Write output results header
+  XLAL_CHECK( output_results_write_header( file, out ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Merge toplists
+  for ( size_t i = 0; i < out->ntoplists; ++i ) {
+    XLAL_CHECK( XLALWeaveResultsToplistMerge( file, out->toplists[i], ninputs, inputs, chunk_size ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Read, append, and write histogram of mean multi-F-statistics
+  for ( size_t i = 0; i < ninputs; ++i ) {
+    XLAL_CHECK( output_results_read_append_hgrm( inputs[i], out ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  XLAL_CHECK( output_results_write_hgrm( file, out ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Cleanup memory
+  XLALWeaveOutputResultsDestroy( out );
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Compare two output results and return whether they are equal
 ///
@@ -71,6 +71,13 @@ int XLALWeaveOutputResultsReadAppend(
   WeaveOutputResults **out,
   UINT4 toplist_limit
 );
+int XLALWeaveOutputResultsMerge(
+  FITSFile *file,
+  const size_t ninputs,
+  FITSFile *const *inputs,
+  const UINT4 toplist_limit,
+  const size_t chunk_size
+);
 int XLALWeaveOutputResultsCompare(
   BOOLEAN *equal,
   const WeaveSetupData *setup,
@@ -60,6 +60,26 @@ struct tagWeaveResultsToplist {
   WeaveResultsToplistItem *saved_item;
 };
 
+///
+/// Cursor over a toplist FITS table which is being merged
+///
+typedef struct {
+  /// Index of input FITS file, used to break ties between items
+  size_t index;
+  /// Input FITS file
+  FITSFile *file;
+  /// Number of rows remaining to be read from FITS table
+  UINT8 nrows;
+  /// Buffer of toplist items read from FITS table
+  WeaveResultsToplistItem **items;
+  /// Number of toplist items in buffer
+  size_t nitems;
+  /// Index of current toplist item in buffer
+  size_t iitem;
+  /// Ranking statistic of last toplist item read, used to check that FITS table is sorted
+  REAL4 last_rank_stat;
+} merge_cursor;
+
 ///
 /// \name Internal functions
 ///
@@ -76,6 +96,8 @@ static int toplist_item_sort_by_serial( const void *x, const void *y );
 static void toplist_item_destroy( WeaveResultsToplistItem *item );
 static int toplist_item_compare( void *param, const void *x, const void *y );
 static int toplist_fill_completionloop_stats( void *param, void *x );
+static int merge_cursor_compare( void *param, const void *x, const void *y );
+static int merge_cursor_fill( merge_cursor *cursor, const WeaveResultsToplist *toplist, const char *name, const size_t chunk_size );
 
 /// @}
 
@@ -521,6 +543,64 @@ int toplist_item_sort_by_serial(
   return 0;
 }
 
+///
+/// Compare merge cursors by the ranking statistic of their current toplist items
+///
+int merge_cursor_compare(
+  void *param,
+  const void *x,
+  const void *y
+)
+{
+  WeaveResultsToplistItemGetRankStat item_get_rank_stat_fcn = ( WeaveResultsToplistItemGetRankStat ) param;
+  const merge_cursor *cx = ( const merge_cursor * ) x;
+  const merge_cursor *cy = ( const merge_cursor * ) y;
+  COMPARE_BY( item_get_rank_stat_fcn( cy->items[cy->iitem] ), item_get_rank_stat_fcn( cx->items[cx->iitem] ) );   // Compare in descending order
+  COMPARE_BY( cx->index, cy->index );   // Compare in ascending order
+  return 0;
+}
+
+///
+/// Refill the buffer of a merge cursor with the next chunk of toplist items from its FITS table
+///
+int merge_cursor_fill(
+  merge_cursor *cursor,
+  const WeaveResultsToplist *toplist,
+  const char *name,
+  const size_t chunk_size
+)
+{
+
+  // Check input
+  XLAL_CHECK( cursor != NULL, XLAL_EFAULT );
+  XLAL_CHECK( toplist != NULL, XLAL_EFAULT );
+
+  cursor->nitems = cursor->iitem = 0;
+  while ( cursor->nitems < chunk_size && cursor->nrows > 0 ) {
+
+    // Create a new toplist item if needed; items are re-used between chunks
+    WeaveResultsToplistItem **item = &cursor->items[cursor->nitems];
+    if ( *item == NULL ) {
+      *item = toplist_item_create( toplist );
+      XLAL_CHECK( *item != NULL, XLAL_ENOMEM );
+    }
+
+    // Read item from FITS table
+    XLAL_CHECK( XLALFITSTableReadRow( cursor->file, *item, &cursor->nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    // Check that FITS table is sorted in decreasing order of ranking statistic, as written by XLALWeaveResultsToplistWrite()
+    const REAL4 rank_stat = toplist->item_get_rank_stat_fcn( *item );
+    XLAL_CHECK( !( rank_stat > cursor->last_rank_stat ), XLAL_EIO, "FITS table '%s' in input file #%zu is not sorted by %s", name, cursor->index, toplist->stat_desc );
+    cursor->last_rank_stat = rank_stat;
+
+    ++cursor->nitems;
+
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Compute two template parameters
 ///
@@ -941,6 +1021,14 @@ int XLALWeaveResultsToplistReadAppend(
     // Read item from FITS table
     XLAL_CHECK( XLALFITSTableReadRow( file, toplist->saved_item, &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
 
+    // Since FITS tables are written in decreasing order of ranking statistic, once the heap is full and
+    // an item ranks below the heap root, no further items in the FITS table can be added to the heap
+    const int heap_full = XLALHeapIsFull( toplist->heap );
+    XLAL_CHECK( heap_full >= 0, XLAL_EFUNC );
+    if ( heap_full && toplist->item_get_rank_stat_fcn( toplist->saved_item ) < toplist->item_get_rank_stat_fcn( XLALHeapRoot( toplist->heap ) ) ) {
+      break;
+    }
+
     // Save highest serial in toplist
     if ( toplist->serial < toplist->saved_item->serial ) {
       toplist->serial = toplist->saved_item->serial;
@@ -958,6 +1046,125 @@ int XLALWeaveResultsToplistReadAppend(
 
 }
 
+///
+/// Merge results toplists read from several FITS files, and write the merged toplist to a FITS file
+///
+/// The toplists in the input FITS files must have been written by XLALWeaveResultsToplistWrite(),
+/// which writes items in decreasing order of ranking statistic. The input FITS tables are merged
+/// with a k-way merge, keeping only 'chunk_size' items from each input file in memory at any time,
+/// and merged items are written as they are found, up to the maximum size of 'toplist'. The items
+/// in 'toplist' itself are not changed.
+///
+int XLALWeaveResultsToplistMerge(
+  FITSFile *file,
+  const WeaveResultsToplist *toplist,
+  const size_t ninputs,
+  FITSFile *const *inputs,
+  const size_t chunk_size
+)
+{
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( toplist != NULL, XLAL_EFAULT );
+  XLAL_CHECK( ninputs > 0, XLAL_EINVAL );
+  XLAL_CHECK( inputs != NULL, XLAL_EFAULT );
+  XLAL_CHECK( chunk_size > 0, XLAL_EINVAL );
+
+  // Get maximum size of merged toplist
+  const int toplist_limit = XLALHeapMaxSize( toplist->heap );
+  XLAL_CHECK( toplist_limit >= 0, XLAL_EFUNC );
+
+  // Format name and description of statistic
+  char name[256];
+  snprintf( name, sizeof( name ), "%s_toplist", toplist->stat_name );
+  char desc[256];
+  snprintf( desc, sizeof( desc ), "toplist ranked by %s", toplist->stat_desc );
+
+  // Open FITS table for writing and initialise
+  XLAL_CHECK( XLALFITSTableOpenWrite( file, name, desc ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( toplist_fits_table_init( file, toplist ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Create heap which ranks merge cursors by their current toplist items
+  LALHeap *cursor_heap = XLALHeapCreate2( NULL, 0, -1, merge_cursor_compare, toplist->item_get_rank_stat_fcn );
+  XLAL_CHECK( cursor_heap != NULL, XLAL_EFUNC );
+
+  // Create a merge cursor for each input FITS file
+  merge_cursor *cursors = XLALCalloc( ninputs, sizeof( *cursors ) );
+  XLAL_CHECK( cursors != NULL, XLAL_ENOMEM );
+  UINT8 serial = 0;
+  for ( size_t i = 0; i < ninputs; ++i ) {
+    merge_cursor *cursor = &cursors[i];
+    cursor->index = i;
+    cursor->file = inputs[i];
+    cursor->last_rank_stat = GSL_POSINF;
+    cursor->items = XLALCalloc( chunk_size, sizeof( *cursor->items ) );
+    XLAL_CHECK( cursor->items != NULL, XLAL_ENOMEM );
+
+    // Open FITS table for reading and initialise
+    XLAL_CHECK( cursor->file != NULL, XLAL_EFAULT );
+    XLAL_CHECK( XLALFITSTableOpenRead( cursor->file, name, &cursor->nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( toplist_fits_table_init( cursor->file, toplist ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    // Save highest toplist item serial
+    UINT8 serial_i = 0;
+    XLAL_CHECK( XLALFITSHeaderReadUINT8( cursor->file, "serial", &serial_i ) == XLAL_SUCCESS, XLAL_EFUNC );
+    if ( serial < serial_i ) {
+      serial = serial_i;
+    }
+
+    // Read first chunk of items, and add cursor to heap if FITS table is not empty
+    XLAL_CHECK( merge_cursor_fill( cursor, toplist, name, chunk_size ) == XLAL_SUCCESS, XLAL_EFUNC );
+    if ( cursor->nitems > 0 ) {
+      void *x = cursor;
+      XLAL_CHECK( XLALHeapAdd( cursor_heap, &x ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+
+  }
+
+  // Write highest-ranked current item of all cursors, until all cursors are exhausted or toplist is full
+  UINT8 nitems = 0;
+  while ( XLALHeapSize( cursor_heap ) > 0 && ( toplist_limit == 0 || nitems < ( UINT8 ) toplist_limit ) ) {
+    merge_cursor *cursor = ( merge_cursor * ) XLALHeapRoot( cursor_heap );
+
+    // Write item to FITS table
+    XLAL_CHECK( XLALFITSTableWriteRow( file, cursor->items[cursor->iitem] ) == XLAL_SUCCESS, XLAL_EFUNC );
+    ++nitems;
+
+    // Advance cursor, reading next chunk of items if needed
+    if ( ++cursor->iitem == cursor->nitems ) {
+      XLAL_CHECK( merge_cursor_fill( cursor, toplist, name, chunk_size ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+
+    // Restore heap order, removing cursor from heap if it is exhausted
+    if ( cursor->nitems > 0 ) {
+      void *x = cursor;
+      XLAL_CHECK( XLALHeapExchangeRoot( cursor_heap, &x ) == XLAL_SUCCESS, XLAL_EFUNC );
+    } else {
+      XLAL_CHECK( XLALHeapExtractRoot( cursor_heap ) == cursor, XLAL_EFUNC );
+    }
+
+  }
+
+  // Write current toplist item serial
+  XLAL_CHECK( XLALFITSHeaderWriteUINT8( file, "serial", serial, "item serial" ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Cleanup memory
+  XLALHeapDestroy( cursor_heap );
+  for ( size_t i = 0; i < ninputs; ++i ) {
+    if ( cursors[i].items != NULL ) {
+      for ( size_t j = 0; j < chunk_size; ++j ) {
+        toplist_item_destroy( cursors[i].items[j] );
+      }
+      XLALFree( cursors[i].items );
+    }
+  }
+  XLALFree( cursors );
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Compare two results toplists and return whether they are equal
 ///
@@ -106,6 +106,13 @@ int XLALWeaveResultsToplistReadAppend(
   FITSFile *file,
   WeaveResultsToplist *toplist
 );
+int XLALWeaveResultsToplistMerge(
+  FITSFile *file,
+  const WeaveResultsToplist *toplist,
+  const size_t ninputs,
+  FITSFile *const *inputs,
+  const size_t chunk_size
+);
 int XLALWeaveResultsToplistCompare(
   BOOLEAN *equal,
   const WeaveSetupData *setup,
@@ -55,6 +55,14 @@ struct tagWeaveSearchTiming {
   WeaveStatisticType curr_statistic;
   /// CPU time for current statistic being timed
   double curr_statistic_cpu_time;
+  /// Number of threads used to pipeline coherent and per-segment semicoherent computations
+  int pipeline_threads;
+  /// Wall time taken by pipelined computations
+  double pipeline_wall_time;
+  /// Summed wall time taken by coherent computations within pipeline
+  double pipeline_coh_wall_time;
+  /// Summed wall time taken by per-segment semicoherent computations within pipeline
+  double pipeline_semiseg_wall_time;
 };
 
 ///
@@ -197,6 +205,10 @@ int XLALWeaveSearchTimingStart(
     tim->statistic_cpu_times[i] = 0;
     tim->statistic_section[i] = WEAVE_SEARCH_TIMING_MAX;
   }
+  tim->pipeline_threads = 0;
+  tim->pipeline_wall_time = 0;
+  tim->pipeline_coh_wall_time = 0;
+  tim->pipeline_semiseg_wall_time = 0;
 
   // Start timing next section
   tim->curr_section = WEAVE_SEARCH_TIMING_OTHER;
@@ -354,6 +366,38 @@ int XLALWeaveSearchTimingStatistic(
 
 }
 
+///
+/// Record wall times taken by pipelined coherent and per-segment semicoherent computations
+///
+int XLALWeaveSearchTimingPipeline(
+  WeaveSearchTiming *tim,
+  const int nthreads,
+  const double wall_pipeline,
+  const double wall_coh,
+  const double wall_semiseg
+)
+{
+
+  // Check input
+  XLAL_CHECK( tim != NULL, XLAL_EFAULT );
+  XLAL_CHECK( tim->curr_section < WEAVE_SEARCH_TIMING_MAX, XLAL_EINVAL );
+  XLAL_CHECK( nthreads > 0, XLAL_EINVAL );
+  XLAL_CHECK( wall_pipeline >= 0, XLAL_EINVAL );
+  XLAL_CHECK( wall_coh >= 0, XLAL_EINVAL );
+  XLAL_CHECK( wall_semiseg >= 0, XLAL_EINVAL );
+
+  // Accumulate pipeline wall times
+  if ( tim->pipeline_threads < nthreads ) {
+    tim->pipeline_threads = nthreads;
+  }
+  tim->pipeline_wall_time += wall_pipeline;
+  tim->pipeline_coh_wall_time += wall_coh;
+  tim->pipeline_semiseg_wall_time += wall_semiseg;
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Write information from search timing to a FITS file
 ///
@@ -473,6 +517,19 @@ int XLALWeaveSearchTimingWriteInfo(
 
   }
 
+  // Write wall times taken by pipelined computations, if any
+  if ( tim->pipeline_wall_time > 0 ) {
+    XLAL_CHECK( XLALFITSHeaderWriteUINT4( file, "pipe threads", tim->pipeline_threads, "number of pipeline threads" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteREAL8( file, "wall pipe", tim->pipeline_wall_time, "pipelined computations wall time" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteREAL8( file, "wall pipe coh", tim->pipeline_coh_wall_time, "pipelined coherent results wall time" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteREAL8( file, "wall pipe semiseg", tim->pipeline_semiseg_wall_time, "pipelined per-segment semicoherent results wall time" ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    // Overlap efficiency is the fraction of the available thread time spent computing results:
+    // 1/nthreads if coherent and semicoherent computations do not overlap at all, 1 if all threads are always busy
+    const double overlap_eff = ( tim->pipeline_coh_wall_time + tim->pipeline_semiseg_wall_time ) / ( tim->pipeline_threads * tim->pipeline_wall_time );
+    XLAL_CHECK( XLALFITSHeaderWriteREAL8( file, "pipe overlap eff", overlap_eff, "pipeline overlap efficiency" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
   return XLAL_SUCCESS;
 
 }
@@ -89,6 +89,13 @@ int XLALWeaveSearchTimingStatistic(
   const WeaveStatisticType prev_statistic,
   const WeaveStatisticType next_statistic
 );
+int XLALWeaveSearchTimingPipeline(
+  WeaveSearchTiming *tim,
+  const int nthreads,
+  const double wall_pipeline,
+  const double wall_coh,
+  const double wall_semiseg
+);
 int XLALWeaveSearchTimingWriteInfo(
   FITSFile *file,
   const WeaveSearchTiming *tim,
@@ -55,12 +55,12 @@ int main( int argc, char *argv[] )
   // Initialise user input variables
   struct uvar_type {
     BOOLEAN validate_sft_files, interpolation, lattice_rand_offset, mean2F_hgrm, segment_info, simulate_search, time_search, cache_all_gc, strict_spindown_bounds;
-    CHAR *setup_file, *sft_files, *output_file, *ckpt_output_file;
+    CHAR *setup_file, *sft_files, *output_file, *ckpt_output_file, *cache_spill_dir;
     LALStringVector *sft_timestamps_files, *sft_noise_sqrtSX, *injections, *Fstat_assume_sqrtSX, *lrs_oLGX;
-    REAL8 sft_timebase, semi_max_mismatch, coh_max_mismatch, ckpt_output_period, ckpt_output_exit, lrs_Fstar0sc, nc_2Fth;
+    REAL8 sft_timebase, semi_max_mismatch, coh_max_mismatch, ckpt_output_period, ckpt_output_exit, lrs_Fstar0sc, nc_2Fth, cache_spill_max_size;
     REAL8Range alpha, delta, freq, f1dot, f2dot, f3dot, f4dot;
     REAL8Vector *random_injection;
-    UINT4 sky_patch_count, sky_patch_index, freq_partitions, f1dot_partitions, Fstat_run_med_window, Fstat_Dterms, toplist_limit, rand_seed, cache_max_size;
+    UINT4 sky_patch_count, sky_patch_index, freq_partitions, f1dot_partitions, Fstat_run_med_window, Fstat_Dterms, toplist_limit, rand_seed, cache_max_size, pipeline_threads;
     int lattice, Fstat_method, Fstat_SSB_precision, toplists, extra_statistics, recalc_statistics;
   } uvar_struct = {
     .Fstat_Dterms = Fstat_opt_args.Dterms,
@@ -350,6 +350,25 @@ int main( int argc, char *argv[] )
     "If FALSE, whenever an item is added to the internal caches, at most one item that may no longer be required is removed. "
     "Has no effect when performing a fully-coherent single-segment search, or a non-interpolating search. "
   );
+  XLALRegisterUvarMember(
+    cache_spill_dir, STRING, 0, DEVELOPER,
+    "Directory, ideally on fast local storage, in which to create files to which items removed from the internal caches are spilled, if they may still be required. "
+    "Spilled items are compressed losslessly, and are restored instead of recomputed if this is estimated to be faster from timings of previous computations. "
+    "Only useful together with " UVAR_STR( cache_max_size ) ". "
+  );
+  XLALRegisterUvarMember(
+    cache_spill_max_size, REAL8, 0, DEVELOPER,
+    "Limit the size of the files created in " UVAR_STR( cache_spill_dir ) " to about this number of megabytes per segment. "
+    "Once a file reaches this size, items removed from its cache are discarded rather than spilled, until the cached items expire and the file is reused. "
+    "If zero, the files will grow in size to store all items that may still be required. "
+  );
+  XLALRegisterUvarMember(
+    pipeline_threads, UINT4, 0, DEVELOPER,
+    "If greater than one, compute new coherent results using this number of threads, while per-segment semicoherent results are computed from coherent results as they become available. "
+    "Search results are identical to those computed with the default serial pipeline, but each segment requires its own F-statistic workspace. "
+    "CPU times of coherent results are then included in those of per-segment semicoherent results. "
+    "Requires OpenMP support. "
+  );
 
   // Parse user input
   XLAL_CHECK_MAIN( xlalErrno == 0, XLAL_EFUNC, "A call to XLALRegisterUvarMember() failed" );
@@ -458,6 +477,20 @@ int main( int argc, char *argv[] )
   XLALUserVarCheck( &should_exit,
                     !UVAR_ALLSET2( time_search, ckpt_output_file ),
                     UVAR_STR2AND( time_search, ckpt_output_file ) " are mutually exclusive" );
+  XLALUserVarCheck( &should_exit,
+                    !UVAR_ALLSET2( cache_spill_dir, simulate_search ),
+                    UVAR_STR2AND( cache_spill_dir, simulate_search ) " are mutually exclusive" );
+  XLALUserVarCheck( &should_exit,
+                    UVAR_SET( cache_spill_dir ) || !UVAR_SET( cache_spill_max_size ),
+                    UVAR_STR( cache_spill_max_size ) " requires " UVAR_STR( cache_spill_dir ) );
+  XLALUserVarCheck( &should_exit,
+                    uvar->cache_spill_max_size >= 0,
+                    UVAR_STR( cache_spill_max_size ) " must be non-negative" );
+#ifndef _OPENMP
+  XLALUserVarCheck( &should_exit,
+                    uvar->pipeline_threads <= 1,
+                    UVAR_STR( pipeline_threads ) " > 1 requires OpenMP support" );
+#endif
 
   // Exit if required
   if ( should_exit ) {
@@ -884,6 +917,10 @@ int main( int argc, char *argv[] )
   for ( size_t i = 0; i < nsegments; ++i ) {
     statistics_params->coh_input[i] = XLALWeaveCohInputCreate( setup.detectors, simulation_level, sft_catalog, i, &setup.segments->segs[i], min_phys[i], max_phys[i], dfreq, setup.ephemerides, sft_noise_sqrtSX, Fstat_assume_sqrtSX, &Fstat_opt_args, statistics_params, 0 );
     XLAL_CHECK_MAIN( statistics_params->coh_input[i] != NULL, XLAL_EFUNC );
+    if ( uvar->pipeline_threads > 1 ) {
+      // Coherent results of different segments may be computed concurrently, so F-statistic workspaces cannot be shared
+      Fstat_opt_args.prevInput = NULL;
+    }
   }
   if ( !( simulation_level & WEAVE_SIMULATE_MIN_MEM ) && ( statistics_params->mainloop_statistics & WEAVE_STATISTIC_COH2F_DET ) ) {
     for ( size_t i = 0; i < ndetectors; ++i ) {
@@ -901,6 +938,10 @@ int main( int argc, char *argv[] )
     const BOOLEAN cache_all_gc = interpolation ? uvar->cache_all_gc : 0;
     coh_cache[i] = XLALWeaveCacheCreate( tiling[i], interpolation, rssky_transf[i], rssky_transf[isemi], statistics_params->coh_input[i], cache_max_size, cache_all_gc );
     XLAL_CHECK_MAIN( coh_cache[i] != NULL, XLAL_EFUNC );
+    if ( interpolation && UVAR_SET( cache_spill_dir ) ) {
+      const UINT8 spill_max_size = ( UINT8 ) ceil( uvar->cache_spill_max_size * 1048576.0 );
+      XLAL_CHECK_MAIN( XLALWeaveCacheSetSpillDirectory( coh_cache[i], uvar->cache_spill_dir, spill_max_size ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
   }
 
   ////////// Perform search //////////
@@ -980,6 +1021,9 @@ int main( int argc, char *argv[] )
   // Print initial progress
   LogPrintf( LOG_NORMAL, "Starting main loop at %.3g%% complete, peak memory %.1fMB\n", XLALWeaveSearchIteratorProgress( main_loop_itr ), XLALGetPeakHeapUsageMB() );
 
+  // Whether coherent results have yet to be computed with a pipeline
+  BOOLEAN pipeline_first = 1;
+
   // Begin main loop
   BOOLEAN search_complete = 0;
   while ( !search_complete ) {
@@ -1033,19 +1077,72 @@ int main( int argc, char *argv[] )
     const WeaveCohResults *XLAL_INIT_DECL( coh_res, [nsegments] );
     UINT8 XLAL_INIT_DECL( coh_index, [nsegments] );
     UINT4 XLAL_INIT_DECL( coh_offset, [nsegments] );
-    for ( size_t i = 0; i < nsegments; ++i ) {
-      XLAL_CHECK_MAIN( XLALWeaveCacheRetrieve( coh_cache[i], queries, i, &coh_res[i], &coh_index[i], &coh_offset[i], tim ) == XLAL_SUCCESS, XLAL_EFUNC );
-      XLAL_CHECK_MAIN( coh_res[i] != NULL, XLAL_EFUNC );
-    }
+    if ( uvar->pipeline_threads <= 1 ) {
 
-    // Switch timing section
-    XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_COH, WEAVE_SEARCH_TIMING_SEMISEG ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( size_t i = 0; i < nsegments; ++i ) {
+        XLAL_CHECK_MAIN( XLALWeaveCacheRetrieve( coh_cache[i], queries, i, &coh_res[i], &coh_index[i], &coh_offset[i], tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( coh_res[i] != NULL, XLAL_EFUNC );
+      }
 
-    // Initialise semicoherent results
-    XLAL_CHECK_MAIN( XLALWeaveSemiResultsInit( &semi_res, simulation_level, ndetectors, nsegments, semi_index, &semi_phys, dfreq, semi_nfreqs, statistics_params ) == XLAL_SUCCESS, XLAL_EFUNC );
+      // Switch timing section
+      XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_COH, WEAVE_SEARCH_TIMING_SEMISEG ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      // Initialise semicoherent results
+      XLAL_CHECK_MAIN( XLALWeaveSemiResultsInit( &semi_res, simulation_level, ndetectors, nsegments, semi_index, &semi_phys, dfreq, semi_nfreqs, statistics_params ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      // Add coherent results to semicoherent results
+      XLAL_CHECK_MAIN( XLALWeaveSemiResultsComputeSegs( semi_res, nsegments, coh_res, coh_index, coh_offset, tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    } else {
+
+      // Look up coherent results in the cache of each segment, deferring computation of any new coherent results
+      // - Caches are updated serially in segment order, so their contents and sizes are the same as above
+      for ( size_t i = 0; i < nsegments; ++i ) {
+        BOOLEAN compute = 0;
+        XLAL_CHECK_MAIN( XLALWeaveCacheRetrieveDeferred( coh_cache[i], queries, i, &coh_index[i], &coh_offset[i], &compute ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
+
+      // Switch timing section
+      XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_COH, WEAVE_SEARCH_TIMING_SEMISEG ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      // Initialise semicoherent results
+      XLAL_CHECK_MAIN( XLALWeaveSemiResultsInit( &semi_res, simulation_level, ndetectors, nsegments, semi_index, &semi_phys, dfreq, semi_nfreqs, statistics_params ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      // Compute new coherent results in parallel, and add coherent results to semicoherent results in segment order as they become available
+      // - The first iteration uses one thread, so that any F-statistic data which are initialised on first use are set up serially
+      const int pipeline_nthreads = pipeline_first ? 1 : ( int ) uvar->pipeline_threads;
+      const double wall_pipeline_start = XLALGetTimeOfDay();
+      double wall_coh = 0, wall_semiseg = 0;
+      int XLAL_INIT_DECL( pipeline_errnum, [nsegments] );
+      size_t pipeline_nsegments = 0;
+#pragma omp parallel for schedule(dynamic, 1) ordered num_threads(pipeline_nthreads) reduction(+:wall_coh, wall_semiseg)
+      for ( size_t i = 0; i < nsegments; ++i ) {
+        const double wall_coh_start = XLALGetTimeOfDay();
+        if ( XLALWeaveCacheRetrieveCompute( coh_cache[i], queries, i, &coh_res[i], NULL ) != XLAL_SUCCESS || coh_res[i] == NULL ) {
+          pipeline_errnum[i] = XLAL_EFUNC;
+        }
+        wall_coh += XLALGetTimeOfDay() - wall_coh_start;
+#pragma omp ordered
+        {
+          const double wall_semiseg_start = XLALGetTimeOfDay();
+          if ( pipeline_errnum[i] == 0 && pipeline_nsegments == i ) {
+            if ( XLALWeaveSemiResultsComputeSegs( semi_res, i + 1, coh_res, coh_index, coh_offset, tim ) == XLAL_SUCCESS ) {
+              pipeline_nsegments = i + 1;
+            } else {
+              pipeline_errnum[i] = XLAL_EFUNC;
+            }
+          }
+          wall_semiseg += XLALGetTimeOfDay() - wall_semiseg_start;
+        }
+      }
+      for ( size_t i = 0; i < nsegments; ++i ) {
+        XLAL_CHECK_MAIN( pipeline_errnum[i] == 0, pipeline_errnum[i], "Pipelined computation of results for segment %zu failed", i );
+      }
+      XLAL_CHECK_MAIN( pipeline_nsegments == nsegments, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( XLALWeaveSearchTimingPipeline( tim, pipeline_nthreads, XLALGetTimeOfDay() - wall_pipeline_start, wall_coh, wall_semiseg ) == XLAL_SUCCESS, XLAL_EFUNC );
+      pipeline_first = 0;
 
-    // Add coherent results to semicoherent results
-    XLAL_CHECK_MAIN( XLALWeaveSemiResultsComputeSegs( semi_res, nsegments, coh_res, coh_index, coh_offset, tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
 
     // Switch timing section
     XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_SEMISEG, WEAVE_SEARCH_TIMING_SEMI ) == XLAL_SUCCESS, XLAL_EFUNC );
@@ -1150,7 +1247,7 @@ int main( int argc, char *argv[] )
         XLAL_CHECK_MAIN( XLALWeaveSearchIteratorSave( main_loop_itr, file ) == XLAL_SUCCESS, XLAL_EFUNC );
 
         // Close output checkpoint file
-        XLALFITSFileClose( file );
+        XLAL_CHECK_MAIN( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC, "Could not write output checkpoint file '%s'", uvar->ckpt_output_file );
 
         // Print progress
         LogPrintf( LOG_NORMAL, "Wrote output checkpoint to file '%s' at %.3g%% complete, elapsed %.1f sec\n", uvar->ckpt_output_file, prog_per_cent, wall_elapsed );
@@ -1303,7 +1400,7 @@ int main( int argc, char *argv[] )
     }
 
     // Close output file
-    XLALFITSFileClose( file );
+    XLAL_CHECK_MAIN( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC, "Could not write output file '%s'", uvar->output_file );
     LogPrintf( LOG_NORMAL, "Closed output file '%s'\n", uvar->output_file );
 
   }
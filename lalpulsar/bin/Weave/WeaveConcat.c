@@ -27,8 +27,78 @@
 #include "OutputResults.h"
 
 #include <lal/LogPrintf.h>
+#include <lal/StringVector.h>
 #include <lal/UserInput.h>
 
+///
+/// Accumulated header fields of result files
+///
+typedef struct {
+  /// Number of computed coherent results
+  UINT8 coh_nres;
+  /// Number of coherent templates
+  UINT8 coh_ntmpl;
+  /// Number of semicoherent templates
+  UINT8 semi_ntmpl;
+  /// Total wall time
+  REAL8 wall_total;
+  /// Total CPU time
+  REAL8 cpu_total;
+} header_totals;
+
+///
+/// Merge input result files into an output result file, and write accumulated header fields if given
+///
+static int merge_result_files(
+  const char *output_file_name,
+  const size_t ninputs,
+  char *const *input_file_names,
+  const UINT4 toplist_limit,
+  const size_t chunk_size,
+  const header_totals *totals
+)
+{
+
+  // Check input
+  XLAL_CHECK( output_file_name != NULL, XLAL_EFAULT );
+  XLAL_CHECK( ninputs > 0, XLAL_EINVAL );
+  XLAL_CHECK( input_file_names != NULL, XLAL_EFAULT );
+
+  // Open input result files
+  FITSFile **inputs = XLALCalloc( ninputs, sizeof( *inputs ) );
+  XLAL_CHECK( inputs != NULL, XLAL_ENOMEM );
+  for ( size_t i = 0; i < ninputs; ++i ) {
+    inputs[i] = XLALFITSFileOpenRead( input_file_names[i] );
+    XLAL_CHECK( inputs[i] != NULL, XLAL_EFUNC, "Could not open input result file '%s'", input_file_names[i] );
+  }
+
+  // Open output result file
+  FITSFile *file = XLALFITSFileOpenWrite( output_file_name );
+  XLAL_CHECK( file != NULL, XLAL_EFUNC, "Could not open output result file '%s'", output_file_name );
+
+  // Write accumulated header fields
+  if ( totals != NULL ) {
+    XLAL_CHECK( XLALFITSHeaderWriteUINT8( file, "ncohres", totals->coh_nres, "number of computed coherent results" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteUINT8( file, "ncohtpl", totals->coh_ntmpl, "number of coherent templates" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteUINT8( file, "nsemitpl", totals->semi_ntmpl, "number of semicoherent templates" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteREAL8( file, "wall total", totals->wall_total, "total wall time" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSHeaderWriteREAL8( file, "cpu total", totals->cpu_total, "total CPU time" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Merge output results
+  XLAL_CHECK( XLALWeaveOutputResultsMerge( file, ninputs, inputs, toplist_limit, chunk_size ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Close result files
+  XLAL_CHECK( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC, "Could not write output result file '%s'", output_file_name );
+  for ( size_t i = 0; i < ninputs; ++i ) {
+    XLALFITSFileClose( inputs[i] );
+  }
+  XLALFree( inputs );
+
+  return XLAL_SUCCESS;
+
+}
+
 int main( int argc, char *argv[] )
 {
 
@@ -42,8 +112,14 @@ int main( int argc, char *argv[] )
     CHAR *output_result_file;
     LALStringVector *input_result_files;
     UINT4 toplist_limit;
+    UINT4 merge_fan_in;
+    UINT4 merge_chunk_size;
+    UINT4 merge_threads;
   } uvar_struct = {
     .toplist_limit = 0,
+    .merge_fan_in = 256,
+    .merge_chunk_size = 1024,
+    .merge_threads = 1,
   };
   struct uvar_type *const uvar = &uvar_struct;
 
@@ -63,6 +139,22 @@ int main( int argc, char *argv[] )
     toplist_limit, UINT4, 'n', OPTIONAL,
     "Maximum number of candidates to return in an output toplist; if 0, all candidates are returned. "
   );
+  //
+  // - Developer
+  //
+  XLALRegisterUvarMember(
+    merge_fan_in, UINT4, 0, DEVELOPER,
+    "Maximum number of result files to merge at once. "
+    "If more input result files are given, they are merged in a tree of intermediate result files, which are written alongside the output result file and removed once merged. "
+  );
+  XLALRegisterUvarMember(
+    merge_chunk_size, UINT4, 0, DEVELOPER,
+    "Number of toplist candidates to read at once from each result file being merged. "
+  );
+  XLALRegisterUvarMember(
+    merge_threads, UINT4, 0, DEVELOPER,
+    "Number of threads used to merge intermediate result files in parallel. "
+  );
 
   // Parse user input
   XLAL_CHECK_MAIN( xlalErrno == 0, XLAL_EFUNC, "A call to XLALRegisterUvarMember() failed" );
@@ -74,27 +166,42 @@ int main( int argc, char *argv[] )
   // - General
   //
 
+  //
+  // - Developer
+  //
+  XLALUserVarCheck( &should_exit,
+                    uvar->merge_fan_in >= 2,
+                    UVAR_STR( merge_fan_in ) " must be at least 2" );
+  XLALUserVarCheck( &should_exit,
+                    uvar->merge_chunk_size > 0,
+                    UVAR_STR( merge_chunk_size ) " must be strictly positive" );
+  XLALUserVarCheck( &should_exit,
+                    uvar->merge_threads > 0,
+                    UVAR_STR( merge_threads ) " must be strictly positive" );
+#ifndef _OPENMP
+  XLALUserVarCheck( &should_exit,
+                    uvar->merge_threads <= 1,
+                    UVAR_STR( merge_threads ) " > 1 requires OpenMP support" );
+#endif
+
   // Exit if required
   if ( should_exit ) {
     return EXIT_FAILURE;
   }
   LogPrintf( LOG_NORMAL, "Parsed user input successfully\n" );
 
-  ////////// Concatenate output results //////////
-
-  // Number of computed coherent results, and number of coherent and semicoherent templates
-  UINT8 coh_nres = 0;
-  UINT8 coh_ntmpl = 0;
-  UINT8 semi_ntmpl = 0;
+  // Merging result files in parallel accesses FITS files from several threads, which requires a reentrant CFITSIO library
+  if ( uvar->merge_threads > 1 && !XLALFITSIsReentrant() ) {
+    XLAL_PRINT_WARNING( "CFITSIO library is not reentrant; merging result files using 1 thread instead of %u", uvar->merge_threads );
+    uvar->merge_threads = 1;
+  }
 
-  // Total wall and CPU time
-  REAL8 wall_total = 0;
-  REAL8 cpu_total = 0;
+  ////////// Concatenate output results //////////
 
-  // Output results
-  WeaveOutputResults *out = NULL;
+  // Accumulated header fields of input result files
+  header_totals XLAL_INIT_DECL( totals );
 
-  // Concatenate input result files
+  // Read and accumulate header fields of input result files
   for ( size_t i = 0; i < uvar->input_result_files->length; ++i ) {
     LogPrintf( LOG_NORMAL, "Opening input result file '%s' for reading ...\n", uvar->input_result_files->data[i] );
     FITSFile *file = XLALFITSFileOpenRead( uvar->input_result_files->data[i] );
@@ -102,52 +209,86 @@ int main( int argc, char *argv[] )
     {
       UINT8 coh_nres_i = 0;
       XLAL_CHECK_MAIN( XLALFITSHeaderReadUINT8( file, "ncohres", &coh_nres_i ) == XLAL_SUCCESS, XLAL_EFUNC );
-      coh_nres += coh_nres_i;
+      totals.coh_nres += coh_nres_i;
     }
     {
       UINT8 coh_ntmpl_i = 0;
       XLAL_CHECK_MAIN( XLALFITSHeaderReadUINT8( file, "ncohtpl", &coh_ntmpl_i ) == XLAL_SUCCESS, XLAL_EFUNC );
-      coh_ntmpl += coh_ntmpl_i;
+      totals.coh_ntmpl += coh_ntmpl_i;
     }
     {
       UINT8 semi_ntmpl_i = 0;
       XLAL_CHECK_MAIN( XLALFITSHeaderReadUINT8( file, "nsemitpl", &semi_ntmpl_i ) == XLAL_SUCCESS, XLAL_EFUNC );
-      semi_ntmpl += semi_ntmpl_i;
+      totals.semi_ntmpl += semi_ntmpl_i;
     }
     {
       REAL8 wall_total_i = 0;
-      XLAL_CHECK( XLALFITSHeaderReadREAL8( file, "wall total", &wall_total_i ) == XLAL_SUCCESS, XLAL_EFUNC );
-      wall_total += wall_total_i;
+      XLAL_CHECK_MAIN( XLALFITSHeaderReadREAL8( file, "wall total", &wall_total_i ) == XLAL_SUCCESS, XLAL_EFUNC );
+      totals.wall_total += wall_total_i;
     }
     {
       REAL8 cpu_total_i = 0;
-      XLAL_CHECK( XLALFITSHeaderReadREAL8( file, "cpu total", &cpu_total_i ) == XLAL_SUCCESS, XLAL_EFUNC );
-      cpu_total += cpu_total_i;
+      XLAL_CHECK_MAIN( XLALFITSHeaderReadREAL8( file, "cpu total", &cpu_total_i ) == XLAL_SUCCESS, XLAL_EFUNC );
+      totals.cpu_total += cpu_total_i;
     }
-    XLAL_CHECK_MAIN( XLALWeaveOutputResultsReadAppend( file, &out, uvar->toplist_limit ) == XLAL_SUCCESS, XLAL_EFUNC );
     XLALFITSFileClose( file );
     LogPrintf( LOG_NORMAL, "Closed input result file '%s'\n", uvar->input_result_files->data[i] );
   }
 
-  // Write output concatenated result file
-  {
-    LogPrintf( LOG_NORMAL, "Opening output result file '%s' for writing ...\n", uvar->output_result_file );
-    FITSFile *file = XLALFITSFileOpenWrite( uvar->output_result_file );
-    XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC, "Could not open output result file '%s'", uvar->output_result_file );
-    XLAL_CHECK_MAIN( XLALFITSHeaderWriteUINT8( file, "ncohres", coh_nres, "number of computed coherent results" ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK_MAIN( XLALFITSHeaderWriteUINT8( file, "ncohtpl", coh_ntmpl, "number of coherent templates" ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK_MAIN( XLALFITSHeaderWriteUINT8( file, "nsemitpl", semi_ntmpl, "number of semicoherent templates" ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK( XLALFITSHeaderWriteREAL8( file, "wall total", wall_total, "total wall time" ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK( XLALFITSHeaderWriteREAL8( file, "cpu total", cpu_total, "total CPU time" ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK_MAIN( XLALWeaveOutputResultsWrite( file, out ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLALFITSFileClose( file );
-    LogPrintf( LOG_NORMAL, "Closed output result file '%s'\n", uvar->output_result_file );
+  // Merge input result files in a tree of intermediate result files, merging at most 'merge_fan_in' files at once
+  LALStringVector *merge_files = XLALCopyStringVector( uvar->input_result_files );
+  XLAL_CHECK_MAIN( merge_files != NULL, XLAL_EFUNC );
+  BOOLEAN merge_files_intermediate = 0;
+  for ( UINT4 level = 0; merge_files->length > uvar->merge_fan_in; ++level ) {
+    const size_t nmerges = ( merge_files->length + uvar->merge_fan_in - 1 ) / uvar->merge_fan_in;
+    LogPrintf( LOG_NORMAL, "Merging %u result files into %zu intermediate result files ...\n", merge_files->length, nmerges );
+
+    // Name intermediate result files after output result file
+    LALStringVector *merged_files = XLALCreateEmptyStringVector( nmerges );
+    XLAL_CHECK_MAIN( merged_files != NULL, XLAL_EFUNC );
+    for ( size_t m = 0; m < nmerges; ++m ) {
+      merged_files->data[m] = XLALStringAppendFmt( NULL, "%s.merge%u-%zu", uvar->output_result_file, level, m );
+      XLAL_CHECK_MAIN( merged_files->data[m] != NULL, XLAL_EFUNC );
+    }
+
+    // Merge groups of result files in parallel
+    int XLAL_INIT_DECL( merge_errnum, [nmerges] );
+#pragma omp parallel for schedule(dynamic, 1) num_threads(uvar->merge_threads)
+    for ( size_t m = 0; m < nmerges; ++m ) {
+      const size_t i0 = m * uvar->merge_fan_in;
+      const size_t n = GSL_MIN( uvar->merge_fan_in, merge_files->length - i0 );
+      if ( merge_result_files( merged_files->data[m], n, &merge_files->data[i0], uvar->toplist_limit, uvar->merge_chunk_size, NULL ) != XLAL_SUCCESS ) {
+        merge_errnum[m] = XLAL_EFUNC;
+      }
+    }
+    for ( size_t m = 0; m < nmerges; ++m ) {
+      XLAL_CHECK_MAIN( merge_errnum[m] == 0, merge_errnum[m], "Could not merge intermediate result file '%s'", merged_files->data[m] );
+    }
+
+    // Remove intermediate result files which have been merged
+    if ( merge_files_intermediate ) {
+      for ( size_t i = 0; i < merge_files->length; ++i ) {
+        XLAL_CHECK_MAIN( remove( merge_files->data[i] ) == 0, XLAL_ESYS, "Could not remove intermediate result file '%s'", merge_files->data[i] );
+      }
+    }
+    XLALDestroyStringVector( merge_files );
+    merge_files = merged_files;
+    merge_files_intermediate = 1;
+
   }
 
-  ////////// Cleanup memory and exit //////////
+  // Merge remaining result files into output result file
+  LogPrintf( LOG_NORMAL, "Merging %u result files into output result file '%s' ...\n", merge_files->length, uvar->output_result_file );
+  XLAL_CHECK_MAIN( merge_result_files( uvar->output_result_file, merge_files->length, merge_files->data, uvar->toplist_limit, uvar->merge_chunk_size, &totals ) == XLAL_SUCCESS, XLAL_EFUNC );
+  if ( merge_files_intermediate ) {
+    for ( size_t i = 0; i < merge_files->length; ++i ) {
+      XLAL_CHECK_MAIN( remove( merge_files->data[i] ) == 0, XLAL_ESYS, "Could not remove intermediate result file '%s'", merge_files->data[i] );
+    }
+  }
+  XLALDestroyStringVector( merge_files );
+  LogPrintf( LOG_NORMAL, "Closed output result file '%s'\n", uvar->output_result_file );
 
-  // Cleanup memory from output results
-  XLALWeaveOutputResultsDestroy( out );
+  ////////// Cleanup memory and exit //////////
 
   // Cleanup memory from user input
   XLALDestroyUserVars();
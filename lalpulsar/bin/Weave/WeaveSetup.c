@@ -303,7 +303,7 @@ int main( int argc, char *argv[] )
   XLAL_CHECK_MAIN( XLALWeaveSetupDataWrite( file, &setup ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Close output file
-  XLALFITSFileClose( file );
+  XLAL_CHECK_MAIN( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC, "Could not write output file '%s'", uvar->output_file );
   LogPrintf( LOG_NORMAL, "Closed output file '%s'\n", uvar->output_file );
 
   ////////// Cleanup memory and exit //////////
@@ -110,6 +110,85 @@ for setup in short long; do
             lalpulsar_WeaveCompare --setup-file=WeaveSetup.fits --result-file-1=WeaveOutNoMax.fits --result-file-2=WeaveOutMax.fits
             set +x
             echo
+
+            echo "=== Setup '${setup}': Perform interpolating search with a maximum cache size, spilling removed cache items to disk ==="
+            set -x
+            lalpulsar_Weave ${weave_cache_options} --cache-spill-dir=. --output-file=WeaveOutMaxSpill.fits \
+                --toplists=all --toplist-limit=2321 --segment-info --setup-file=WeaveSetup.fits \
+                ${weave_sft_options} ${weave_search_options}
+            lalpulsar_fits_overview WeaveOutMaxSpill.fits
+            set +x
+            echo
+
+            echo "=== Setup '${setup}': Check that spilling cache items to disk does not increase number of computed coherent results ==="
+            set -x
+            coh_nres_max_spill=`lalpulsar_fits_header_getval "WeaveOutMaxSpill.fits[0]" 'NCOHRES' | tr '\n\r' '  ' | awk 'NF == 1 {printf "%d", $1}'`
+            expr ${coh_nres_max_spill} '<=' ${coh_nres_max}
+            set +x
+            echo
+
+            echo "=== Setup '${setup}': Check that cache items were spilled to disk and restored ==="
+            set -x
+            cache_nspill=`lalpulsar_fits_header_getval "WeaveOutMaxSpill.fits[0]" 'CACHESPL' | tr '\n\r' '  ' | awk 'NF == 1 {printf "%d", $1}'`
+            cache_nrestore=`lalpulsar_fits_header_getval "WeaveOutMaxSpill.fits[0]" 'CACHERST' | tr '\n\r' '  ' | awk 'NF == 1 {printf "%d", $1}'`
+            expr ${cache_nspill} '>' 0
+            expr ${cache_nrestore} '>' 0
+            set +x
+            echo
+
+            echo "=== Setup '${setup}': Compare F-statistics from lalpulsar_Weave without/with spilling cache items to disk ==="
+            set -x
+            lalpulsar_WeaveCompare --setup-file=WeaveSetup.fits --result-file-1=WeaveOutMax.fits --result-file-2=WeaveOutMaxSpill.fits
+            set +x
+            echo
+
+            echo "=== Setup '${setup}': Perform interpolating search with a maximum cache size, spilling removed cache items to disk files of limited size ==="
+            set -x
+            lalpulsar_Weave ${weave_cache_options} --cache-spill-dir=. --cache-spill-max-size=0.001 --output-file=WeaveOutMaxSpillMax.fits \
+                --toplists=all --toplist-limit=2321 --segment-info --setup-file=WeaveSetup.fits \
+                ${weave_sft_options} ${weave_search_options}
+            lalpulsar_fits_overview WeaveOutMaxSpillMax.fits
+            set +x
+            echo
+
+            echo "=== Setup '${setup}': Check that limiting the size of spill files does not increase number of spilled items ==="
+            set -x
+            cache_nspill_max=`lalpulsar_fits_header_getval "WeaveOutMaxSpillMax.fits[0]" 'CACHESPL' | tr '\n\r' '  ' | awk 'NF == 1 {printf "%d", $1}'`
+            expr ${cache_nspill_max} '<=' ${cache_nspill}
+            set +x
+            echo
+
+            echo "=== Setup '${setup}': Compare F-statistics from lalpulsar_Weave without/with a limit on the size of spill files ==="
+            set -x
+            lalpulsar_WeaveCompare --setup-file=WeaveSetup.fits --result-file-1=WeaveOutMax.fits --result-file-2=WeaveOutMaxSpillMax.fits
+            set +x
+            echo
+
+            if test "${OPENMP_ENABLED}" = true; then
+
+                echo "=== Setup '${setup}': Perform pipelined interpolating search with a maximum cache size ==="
+                set -x
+                lalpulsar_Weave ${weave_cache_options} --pipeline-threads=3 --output-file=WeaveOutMaxPipe.fits \
+                    --toplists=all --toplist-limit=2321 --segment-info --setup-file=WeaveSetup.fits \
+                    ${weave_sft_options} ${weave_search_options}
+                lalpulsar_fits_overview WeaveOutMaxPipe.fits
+                set +x
+                echo
+
+                echo "=== Setup '${setup}': Check that number of computed coherent results are equal without/with pipelining ==="
+                set -x
+                coh_nres_max_pipe=`lalpulsar_fits_header_getval "WeaveOutMaxPipe.fits[0]" 'NCOHRES' | tr '\n\r' '  ' | awk 'NF == 1 {printf "%d", $1}'`
+                expr ${coh_nres_max} '=' ${coh_nres_max_pipe}
+                set +x
+                echo
+
+                echo "=== Setup '${setup}': Compare F-statistics from lalpulsar_Weave without/with pipelining ==="
+                set -x
+                lalpulsar_WeaveCompare --setup-file=WeaveSetup.fits --result-file-1=WeaveOutMax.fits --result-file-2=WeaveOutMaxPipe.fits
+                set +x
+                echo
+
+            fi
             ;;
 
         *)
@@ -87,6 +87,22 @@ diff mean_toplist_123.txt mean_toplist_CCC.txt
 set +x
 echo
 
+echo "=== Concatenate output files in a tree of intermediate files ==="
+if test "${OPENMP_ENABLED}" = true; then
+    merge_threads=2
+else
+    merge_threads=1
+fi
+set -x
+lalpulsar_WeaveConcat --output-result-file=WeaveOutT.fits --input-result-files=WeaveOut1.fits,WeaveOut2.fits,WeaveOut3.fits \
+    --merge-fan-in=2 --merge-chunk-size=3 --merge-threads=${merge_threads}
+lalpulsar_fits_overview WeaveOutT.fits
+ls WeaveOutT.fits.merge* && exit 1
+lalpulsar_fits_table_list 'WeaveOutT.fits[mean2F_toplist]' | grep -v '^#' | sort -n > mean_toplist_TTT.txt
+diff mean_toplist_CCC.txt mean_toplist_TTT.txt
+set +x
+echo
+
 echo "=== Check for consistent concatenated histograms ==="
 set -x
 lalpulsar_fits_table_list 'WeaveOut1.fits[mean2F_hgrm]' | grep -v '^#' > mean2F_hgrm_1.txt
@@ -34,6 +34,7 @@
 
 #include <lal/LALString.h>
 #include <lal/LALSIMD.h>
+#include <lal/LALProfile.h>
 #include <lal/NormalizeSFTRngMed.h>
 #include <lal/ExtrapolatePulsarSpins.h>
 #include <lal/VectorMath.h>
@@ -883,7 +884,10 @@ XLALComputeFstat ( FstatResults **Fstats,               ///< [in/out] Address of
   (*Fstats)->whatWasComputed = whatToCompute;
 
   // Call the appropriate method function to compute the F-statistic
-  XLAL_CHECK ( (input->method_funcs.compute_func) ( *Fstats, common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_PROFILE_BEGIN ( "XLALComputeFstat" );
+  const int retn = (input->method_funcs.compute_func) ( *Fstats, common, input->method_data );
+  XLAL_PROFILE_END ( "XLALComputeFstat" );
+  XLAL_CHECK ( retn == XLAL_SUCCESS, XLAL_EFUNC );
 
   (*Fstats)->doppler = (*doppler);
   // Record the internal reference time used, which is required to compute a correct global signal phase
@@ -224,6 +224,35 @@ void LALHOUGHConstructPLUT(LALStatus       *status,
 }
 
 
+/**
+ * XLAL version of LALHOUGHConstructPLUT(). The look-up-table is constructed only from
+ * the patch grid and the parameters \c par, so this function may be called for
+ * different look-up-tables from several threads at once.
+ */
+int XLALHOUGHConstructPLUT( HOUGHptfLUT *lut, HOUGHPatchGrid *patch, HOUGHParamPLUT *par )
+{
+
+  /* check input */
+  XLAL_CHECK( lut != NULL && lut->bin != NULL && lut->border != NULL, XLAL_EFAULT );
+  XLAL_CHECK( patch != NULL, XLAL_EFAULT );
+  XLAL_CHECK( par != NULL, XLAL_EFAULT );
+  XLAL_CHECK( fabs( (REAL4)par->deltaF - (REAL4)patch->deltaF ) <= 1.0e-6, XLAL_EINVAL, "patch and parameters have different frequency resolutions" );
+
+  lut->deltaF = par->deltaF;
+  lut->f0Bin  = par->f0Bin;
+  lut->nFreqValid = par->nFreqValid;
+
+  PLUTInitialize(lut);
+  FillPLUT(par, lut, patch);
+
+  /* make sure number of bins makes sense with the dimensions */
+  XLAL_CHECK( lut->nBin > 0 && lut->nBin <= lut->maxNBins, XLAL_ESIZE, "invalid number of bins %d (maximum %d)", lut->nBin, lut->maxNBins );
+
+  return XLAL_SUCCESS;
+
+}
+
+
 /* >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>><<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< */
 
 /* >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>><<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< */
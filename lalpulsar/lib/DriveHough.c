@@ -972,4 +972,406 @@ void LALComputeAM (LALStatus          *status,
 
 } /* LALComputeAM() */
 
+
+/**
+ * Create a vector of \c length look-up-tables, each with room for \c maxNBins bins and
+ * \c maxNBorders borders of \c ySide pixels. The borders, bins and pixels of all the
+ * look-up-tables are each stored contiguously. Free with XLALHOUGHDestroyLUTVector().
+ */
+HOUGHptfLUTVector *XLALHOUGHCreateLUTVector( UINT4 length, UINT2 maxNBins, UINT2 maxNBorders, UINT2 ySide )
+{
+
+  /* check input */
+  XLAL_CHECK_NULL( length > 0, XLAL_EINVAL );
+  XLAL_CHECK_NULL( maxNBins > 0 && maxNBorders > 0 && ySide > 0, XLAL_EINVAL );
+
+  /* allocate memory */
+  HOUGHptfLUTVector *lutV = XLALCalloc( 1, sizeof( *lutV ) );
+  XLAL_CHECK_NULL( lutV != NULL, XLAL_ENOMEM );
+  lutV->length = length;
+  lutV->lut = XLALCalloc( length, sizeof( lutV->lut[0] ) );
+  HOUGHBorder *border = XLALCalloc( (size_t)length * maxNBorders, sizeof( border[0] ) );
+  HOUGHBin2Border *bin = XLALCalloc( (size_t)length * maxNBins, sizeof( bin[0] ) );
+  COORType *xPixel = XLALCalloc( (size_t)length * maxNBorders * ySide, sizeof( xPixel[0] ) );
+  if ( lutV->lut == NULL || border == NULL || bin == NULL || xPixel == NULL ) {
+    XLALFree( border );
+    XLALFree( bin );
+    XLALFree( xPixel );
+    XLALFree( lutV->lut );
+    XLALFree( lutV );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+
+  /* point each look-up-table at its part of the storage */
+  for ( UINT4 j = 0; j < length; ++j ) {
+    HOUGHptfLUT *lut = &lutV->lut[j];
+    lut->maxNBins = maxNBins;
+    lut->maxNBorders = maxNBorders;
+    lut->border = &border[(size_t)j * maxNBorders];
+    lut->bin = &bin[(size_t)j * maxNBins];
+    for ( UINT4 i = 0; i < maxNBorders; ++i ) {
+      lut->border[i].ySide = ySide;
+      lut->border[i].xPixel = &xPixel[( (size_t)j * maxNBorders + i ) * ySide];
+    }
+  }
+
+  return lutV;
+
+}
+
+
+/**
+ * Free a vector of look-up-tables created by XLALHOUGHCreateLUTVector().
+ *
+ * Only vectors created by XLALHOUGHCreateLUTVector() may be passed to this function, since it
+ * frees the contiguous storage of all the look-up-tables through the first look-up-table. Vectors
+ * of look-up-tables allocated one at a time, e.g. by the LAL Hough codes, must be freed by the
+ * code that allocated them.
+ */
+void XLALHOUGHDestroyLUTVector( HOUGHptfLUTVector *lutV )
+{
+  if ( lutV == NULL ) {
+    return;
+  }
+  if ( lutV->lut != NULL ) {
+    XLALFree( lutV->lut[0].border[0].xPixel );
+    XLALFree( lutV->lut[0].border );
+    XLALFree( lutV->lut[0].bin );
+    XLALFree( lutV->lut );
+  }
+  XLALFree( lutV );
+}
+
+
+/**
+ * Construct all the look-up-tables in \c lutV for the patch \c patch, where \c parLut
+ * is an array of <tt>lutV->length</tt> sets of parameters, one for each look-up-table.
+ * The look-up-tables are constructed in parallel if OpenMP is enabled.
+ */
+int XLALHOUGHConstructPLUTVector( HOUGHptfLUTVector *lutV, HOUGHPatchGrid *patch, HOUGHParamPLUT *parLut )
+{
+
+  /* check input */
+  XLAL_CHECK( lutV != NULL && lutV->lut != NULL, XLAL_EFAULT );
+  XLAL_CHECK( patch != NULL, XLAL_EFAULT );
+  XLAL_CHECK( parLut != NULL, XLAL_EFAULT );
+
+  int failed = 0;
+#pragma omp parallel for schedule(dynamic)
+  for ( UINT4 j = 0; j < lutV->length; ++j ) {
+    if ( XLALHOUGHConstructPLUT( &lutV->lut[j], patch, &parLut[j] ) != XLAL_SUCCESS ) {
+#pragma omp atomic write
+      failed = 1;
+    }
+  }
+  XLAL_CHECK( !failed, XLAL_EFUNC, "failed to construct look-up-tables" );
+
+  return XLAL_SUCCESS;
+
+}
+
+
+/**
+ * Create a cylindrical buffer of \c length times \c nfSize partial Hough map derivatives,
+ * each with room for \c maxNBorders borders of each type and a first column of \c ySide
+ * pixels. The border pointers and first columns of all the \c phmd are each stored
+ * contiguously. The weights of the \c phmd are initialised to one, so that unweighted
+ * Hough maps are constructed unless XLALHOUGHWeighSpacePHMD() is called. Free with
+ * XLALHOUGHDestroyPHMDVectorSequence().
+ */
+PHMDVectorSequence *XLALHOUGHCreatePHMDVectorSequence( UINT4 length, UINT4 nfSize, UINT2 maxNBorders, UINT2 ySide )
+{
+
+  /* check input */
+  XLAL_CHECK_NULL( length > 0 && nfSize > 0, XLAL_EINVAL );
+  XLAL_CHECK_NULL( maxNBorders > 0 && ySide > 0, XLAL_EINVAL );
+
+  /* allocate memory */
+  const size_t numPHMD = (size_t)length * nfSize;
+  PHMDVectorSequence *phmdVS = XLALCalloc( 1, sizeof( *phmdVS ) );
+  XLAL_CHECK_NULL( phmdVS != NULL, XLAL_ENOMEM );
+  phmdVS->length = length;
+  phmdVS->nfSize = nfSize;
+  phmdVS->phmd = XLALCalloc( numPHMD, sizeof( phmdVS->phmd[0] ) );
+  HOUGHBorder **borderP = XLALCalloc( 2 * numPHMD * maxNBorders, sizeof( borderP[0] ) );
+  UCHAR *firstColumn = XLALCalloc( numPHMD * ySide, sizeof( firstColumn[0] ) );
+  if ( phmdVS->phmd == NULL || borderP == NULL || firstColumn == NULL ) {
+    XLALFree( borderP );
+    XLALFree( firstColumn );
+    XLALFree( phmdVS->phmd );
+    XLALFree( phmdVS );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+
+  /* point each phmd at its part of the storage */
+  for ( size_t j = 0; j < numPHMD; ++j ) {
+    HOUGHphmd *phmd = &phmdVS->phmd[j];
+    phmd->maxNBorders = maxNBorders;
+    phmd->leftBorderP = &borderP[2 * j * maxNBorders];
+    phmd->rightBorderP = &borderP[( 2 * j + 1 ) * maxNBorders];
+    phmd->ySide = ySide;
+    phmd->firstColumn = &firstColumn[j * ySide];
+    phmd->weight = 1.0;
+  }
+
+  return phmdVS;
+
+}
+
+
+/**
+ * Free a cylindrical buffer of partial Hough map derivatives created by
+ * XLALHOUGHCreatePHMDVectorSequence().
+ *
+ * Only buffers created by XLALHOUGHCreatePHMDVectorSequence() may be passed to this function,
+ * since it frees the contiguous border pointers and first columns of all the \c phmd through the
+ * first \c phmd. Buffers whose \c phmd were allocated one at a time must be freed by the code that
+ * allocated them.
+ */
+void XLALHOUGHDestroyPHMDVectorSequence( PHMDVectorSequence *phmdVS )
+{
+  if ( phmdVS == NULL ) {
+    return;
+  }
+  if ( phmdVS->phmd != NULL ) {
+    XLALFree( phmdVS->phmd[0].leftBorderP );
+    XLALFree( phmdVS->phmd[0].firstColumn );
+    XLALFree( phmdVS->phmd );
+  }
+  XLALFree( phmdVS );
+}
+
+
+/*
+ * Check that a set of peakgrams and look-up-tables are compatible with a cylindrical
+ * buffer of partial Hough map derivatives.
+ */
+static int CheckSpacePHMD( PHMDVectorSequence *phmdVS, HOUGHPeakGramVector *pgV, HOUGHptfLUTVector *lutV )
+{
+  XLAL_CHECK( phmdVS != NULL && phmdVS->phmd != NULL, XLAL_EFAULT );
+  XLAL_CHECK( pgV != NULL && pgV->pg != NULL, XLAL_EFAULT );
+  XLAL_CHECK( lutV != NULL && lutV->lut != NULL, XLAL_EFAULT );
+  XLAL_CHECK( pgV->length == lutV->length && pgV->length == phmdVS->length, XLAL_EBADLEN );
+  XLAL_CHECK( phmdVS->length > 0 && phmdVS->nfSize > 0, XLAL_ESIZE );
+  for ( UINT4 k = 0; k < lutV->length; ++k ) {
+    XLAL_CHECK( lutV->lut[k].deltaF == lutV->lut[0].deltaF, XLAL_EINVAL, "inconsistent frequency resolutions of look-up-tables" );
+  }
+  return XLAL_SUCCESS;
+}
+
+
+/**
+ * XLAL version of LALHOUGHConstructSpacePHMD(): constructs the cylindrical buffer of
+ * partial Hough map derivatives <tt>phmdVS</tt> from frequency bin <tt>phmdVS->fBinMin</tt>.
+ * The \c phmd are constructed in parallel if OpenMP is enabled.
+ */
+int XLALHOUGHConstructSpacePHMD( PHMDVectorSequence *phmdVS, HOUGHPeakGramVector *pgV, HOUGHptfLUTVector *lutV )
+{
+
+  /* check input */
+  XLAL_CHECK( CheckSpacePHMD( phmdVS, pgV, lutV ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* at the beginning, the fBinMin line corresponds to the first row */
+  phmdVS->breakLine = 0;
+  phmdVS->deltaF = lutV->lut[0].deltaF;
+
+  const UINT4 length = phmdVS->length;
+  const UINT4 numPHMD = length * phmdVS->nfSize;
+  const UINT8 fBinMin = phmdVS->fBinMin;
+
+  int failed = 0;
+#pragma omp parallel for schedule(dynamic, 16)
+  for ( UINT4 jk = 0; jk < numPHMD; ++jk ) {
+    const UINT4 j = jk / length, k = jk % length;
+    phmdVS->phmd[jk].fBin = fBinMin + j;
+    if ( XLALHOUGHPeak2PHMD( &phmdVS->phmd[jk], &lutV->lut[k], &pgV->pg[k] ) != XLAL_SUCCESS ) {
+#pragma omp atomic write
+      failed = 1;
+    }
+  }
+  XLAL_CHECK( !failed, XLAL_EFUNC, "failed to construct partial Hough map derivatives" );
+
+  return XLAL_SUCCESS;
+
+}
+
+
+/**
+ * XLAL version of LALHOUGHupdateSpacePHMDup(): updates the cylindrical buffer of partial
+ * Hough map derivatives, increasing the frequency <tt>phmdVS->fBinMin</tt> by one.
+ * The new \c phmd are constructed in parallel if OpenMP is enabled.
+ */
+int XLALHOUGHupdateSpacePHMDup( PHMDVectorSequence *phmdVS, HOUGHPeakGramVector *pgV, HOUGHptfLUTVector *lutV )
+{
+
+  /* check input */
+  XLAL_CHECK( CheckSpacePHMD( phmdVS, pgV, lutV ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( phmdVS->breakLine < phmdVS->nfSize, XLAL_EINVAL );
+  XLAL_CHECK( phmdVS->deltaF == lutV->lut[0].deltaF, XLAL_EINVAL, "inconsistent frequency resolutions of look-up-tables and phmd" );
+
+  const UINT4 length = phmdVS->length;
+  const UINT4 breakLine = phmdVS->breakLine;
+  const UINT8 fBin = phmdVS->fBinMin + phmdVS->nfSize;
+
+  /* replace the fBinMin line of the circular buffer with the new frequency bin */
+  int failed = 0;
+#pragma omp parallel for schedule(dynamic, 16)
+  for ( UINT4 k = 0; k < length; ++k ) {
+    HOUGHphmd *phmd = &phmdVS->phmd[breakLine * length + k];
+    phmd->fBin = fBin;
+    if ( XLALHOUGHPeak2PHMD( phmd, &lutV->lut[k], &pgV->pg[k] ) != XLAL_SUCCESS ) {
+#pragma omp atomic write
+      failed = 1;
+    }
+  }
+  XLAL_CHECK( !failed, XLAL_EFUNC, "failed to construct partial Hough map derivatives" );
+
+  /* shift fBinMin and its mark */
+  ++phmdVS->fBinMin;
+  phmdVS->breakLine = ( breakLine + 1 ) % phmdVS->nfSize;
+
+  return XLAL_SUCCESS;
+
+}
+
+
+/**
+ * XLAL version of LALHOUGHWeighSpacePHMD(): sets the weights of the partial Hough map
+ * derivatives from the vector of weights \c weightV, which has one element per time stamp.
+ */
+int XLALHOUGHWeighSpacePHMD( PHMDVectorSequence *phmdVS, REAL8Vector *weightV )
+{
+
+  /* check input */
+  XLAL_CHECK( phmdVS != NULL && phmdVS->phmd != NULL, XLAL_EFAULT );
+  XLAL_CHECK( weightV != NULL && weightV->data != NULL, XLAL_EFAULT );
+  XLAL_CHECK( weightV->length == phmdVS->length, XLAL_EBADLEN );
+
+  const UINT4 length = phmdVS->length;
+  for ( UINT4 j = 0; j < phmdVS->nfSize; ++j ) {
+    for ( UINT4 k = 0; k < length; ++k ) {
+      phmdVS->phmd[j * length + k].weight = (HoughDT)weightV->data[k];
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
+
+/*
+ * Construct a weighted total Hough map from a cylindrical buffer of partial Hough map
+ * derivatives, using the Hough map derivative hd (of the same size as ht) as workspace.
+ */
+static int ConstructHMT_W( HOUGHMapTotal *ht, HOUGHMapDeriv *hd, UINT8FrequencyIndexVector *freqInd, PHMDVectorSequence *phmdVS )
+{
+  XLAL_CHECK( freqInd != NULL && freqInd->data != NULL, XLAL_EFAULT );
+  XLAL_CHECK( freqInd->length == phmdVS->length, XLAL_EBADLEN );
+  XLAL_CHECK( freqInd->deltaF == phmdVS->deltaF, XLAL_EINVAL, "inconsistent frequency resolutions of trajectory and phmd" );
+
+  const UINT4 length = phmdVS->length;
+  const UINT4 nfSize = phmdVS->nfSize;
+
+  memset( hd->map, 0, (size_t)hd->ySide * ( hd->xSide + 1 ) * sizeof( hd->map[0] ) );
+
+  for ( UINT4 k = 0; k < length; ++k ) {
+
+    /* read the frequency index and make sure it is in the proper interval */
+    const INT8 fBin = freqInd->data[k] - phmdVS->fBinMin;
+    XLAL_CHECK( fBin >= 0 && fBin < nfSize, XLAL_EDOM, "frequency index %" LAL_UINT8_FORMAT " outside cylinder", freqInd->data[k] );
+
+    /* add the corresponding phmd to hd */
+    const UINT4 j = ( fBin + phmdVS->breakLine ) % nfSize;
+    XLAL_CHECK( XLALHOUGHAddPHMD2HD_W( hd, &phmdVS->phmd[j * length + k] ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  }
+
+  XLAL_CHECK( XLALHOUGHIntegrHD2HT( ht, hd ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+}
+
+
+/**
+ * XLAL version of LALHOUGHConstructHMT_W(): constructs the weighted total Hough map \c ht
+ * along the time-frequency trajectory \c freqInd.
+ */
+int XLALHOUGHConstructHMT_W( HOUGHMapTotal *ht, UINT8FrequencyIndexVector *freqInd, PHMDVectorSequence *phmdVS )
+{
+
+  /* check input */
+  XLAL_CHECK( ht != NULL && ht->map != NULL, XLAL_EFAULT );
+  XLAL_CHECK( phmdVS != NULL && phmdVS->phmd != NULL, XLAL_EFAULT );
+  XLAL_CHECK( ht->xSide > 0 && ht->ySide > 0, XLAL_ESIZE );
+  XLAL_CHECK( phmdVS->breakLine < phmdVS->nfSize, XLAL_EINVAL );
+
+  /* allocate the Hough map derivative */
+  HOUGHMapDeriv hd = { .xSide = ht->xSide, .ySide = ht->ySide };
+  hd.map = XLALMalloc( (size_t)hd.ySide * ( hd.xSide + 1 ) * sizeof( hd.map[0] ) );
+  XLAL_CHECK( hd.map != NULL, XLAL_ENOMEM );
+
+  const int retn = ConstructHMT_W( ht, &hd, freqInd, phmdVS );
+  XLALFree( hd.map );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+
+/**
+ * Constructs the weighted total Hough maps <tt>htV->ht[i]</tt> along the time-frequency
+ * trajectories <tt>freqIndVS->freqIndV[i]</tt>, e.g. for a set of spin-down values, from
+ * the same cylindrical buffer of partial Hough map derivatives. All the maps must be of the
+ * same size. The maps are constructed in parallel if OpenMP is enabled, with each thread
+ * using its own Hough map derivative.
+ */
+int XLALHOUGHConstructHMTVector_W( HOUGHMapTotalVector *htV, UINT8FrequencyIndexVectorSequence *freqIndVS, PHMDVectorSequence *phmdVS )
+{
+
+  /* check input */
+  XLAL_CHECK( htV != NULL && htV->ht != NULL, XLAL_EFAULT );
+  XLAL_CHECK( freqIndVS != NULL && freqIndVS->freqIndV != NULL, XLAL_EFAULT );
+  XLAL_CHECK( phmdVS != NULL && phmdVS->phmd != NULL, XLAL_EFAULT );
+  XLAL_CHECK( htV->length == freqIndVS->length, XLAL_EBADLEN );
+  XLAL_CHECK( phmdVS->breakLine < phmdVS->nfSize, XLAL_EINVAL );
+  if ( htV->length == 0 ) {
+    return XLAL_SUCCESS;
+  }
+  const UINT2 xSide = htV->ht[0].xSide, ySide = htV->ht[0].ySide;
+  XLAL_CHECK( xSide > 0 && ySide > 0, XLAL_ESIZE );
+  for ( UINT4 i = 0; i < htV->length; ++i ) {
+    XLAL_CHECK( htV->ht[i].map != NULL, XLAL_EFAULT );
+    XLAL_CHECK( htV->ht[i].xSide == xSide && htV->ht[i].ySide == ySide, XLAL_ESIZE, "Hough maps must all be of the same size" );
+  }
+
+  int failed = 0;
+#pragma omp parallel
+  {
+
+    /* thread-local Hough map derivative */
+    HOUGHMapDeriv hd = { .xSide = xSide, .ySide = ySide };
+    hd.map = XLALMalloc( (size_t)ySide * ( xSide + 1 ) * sizeof( hd.map[0] ) );
+    if ( hd.map == NULL ) {
+#pragma omp atomic write
+      failed = 1;
+    }
+
+#pragma omp for schedule(dynamic)
+    for ( UINT4 i = 0; i < htV->length; ++i ) {
+      if ( hd.map == NULL || ConstructHMT_W( &htV->ht[i], &hd, &freqIndVS->freqIndV[i], phmdVS ) != XLAL_SUCCESS ) {
+#pragma omp atomic write
+        failed = 1;
+      }
+    }
+
+    XLALFree( hd.map );
+
+  }
+  XLAL_CHECK( !failed, XLAL_EFUNC, "failed to construct Hough maps" );
+
+  return XLAL_SUCCESS;
+
+}
+
 /** @} */
@@ -115,9 +115,15 @@ struct tagFITSFile {
     LONGLONG nelements[FFIO_MAX];               // Number of elements in columns in table
     LONGLONG nrows;                             // Number of rows in table
     LONGLONG irow;                              // Index of current row in table
+    size_t record_size;                         // Size of table row record
+    LONGLONG buf_max_nrows;                     // Maximum number of rows in table row buffer
+    LONGLONG buf_irow;                          // Index of first row in table row buffer
+    LONGLONG buf_nrows;                         // Number of rows in table row buffer
   } table;
-  char *buf;                            // Buffer for reading/writing table columns
-  size_t buf_size;                      // Current length of the buffer
+  char *col_buf[FFIO_MAX];              // Buffers for reading/writing table columns over multiple rows
+  size_t col_buf_size[FFIO_MAX];        // Current lengths of the column buffers
+  char **str_buf;                       // Buffer of pointers for reading/writing string table columns over multiple rows
+  size_t str_buf_size;                  // Current length of the string pointer buffer
 };
 
 ///
@@ -240,22 +246,187 @@ XLAL_FAIL:
 
 }
 
+///
+/// Return the size of a row of a table column buffer; string columns require an extra byte for a terminating null
+///
+static size_t TableColumnBufferRowSize( const FITSFile *file, const int i )
+{
+  return ( file->table.datatype[i] == TSTRING ) ? file->table.field_size[i] + 1 : file->table.field_size[i];
+}
+
+///
+/// Resize the table column buffers to hold the optimal number of rows for reading/writing the current table
+///
+static int TableResizeColumnBuffers( FITSFile *file )
+{
+
+  int UNUSED status = 0;
+
+  // Get optimal number of rows to read/write at once
+  long nrows = 0;
+  CALL_FITS( fits_get_rowsize, file->ff, &nrows );
+  file->table.buf_max_nrows = ( nrows > 1 ) ? nrows : 1;
+
+  // Resize column buffers
+  // - Allow for an extra row to allow for buffer overruns in CFITSIO
+  for ( int i = 0; i < file->table.tfields; ++i ) {
+    const size_t req_buf_size = ( file->table.buf_max_nrows + 1 ) * TableColumnBufferRowSize( file, i );
+    if ( file->col_buf_size[i] < req_buf_size ) {
+      file->col_buf[i] = XLALRealloc( file->col_buf[i], req_buf_size );
+      XLAL_CHECK_FAIL( file->col_buf[i] != NULL, XLAL_ENOMEM );
+      file->col_buf_size[i] = req_buf_size;
+    }
+  }
+
+  // Resize string pointer buffer
+  if ( file->str_buf_size < ( size_t ) file->table.buf_max_nrows ) {
+    file->str_buf = XLALRealloc( file->str_buf, file->table.buf_max_nrows * sizeof( file->str_buf[0] ) );
+    XLAL_CHECK_FAIL( file->str_buf != NULL, XLAL_ENOMEM );
+    file->str_buf_size = file->table.buf_max_nrows;
+  }
+
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  return XLAL_FAILURE;
+
+}
+
+///
+/// Read or write all rows in the table column buffers from/to the current table, one column at a time
+///
+static int TableTransferColumnBuffers( FITSFile *file, const int write )
+{
+
+  int UNUSED status = 0;
+
+  const LONGLONG firstrow = 1 + file->table.buf_irow;
+  const LONGLONG nrows = file->table.buf_nrows;
+  for ( int i = 0; i < file->table.tfields; ++i ) {
+    if ( file->table.datatype[i] == TSTRING ) {
+      const size_t row_size = TableColumnBufferRowSize( file, i );
+      for ( LONGLONG r = 0; r < nrows; ++r ) {
+        file->str_buf[r] = file->col_buf[i] + r * row_size;
+      }
+      if ( write ) {
+        CALL_FITS( fits_write_col, file->ff, TSTRING, file->table.colnum[i], firstrow, 1, nrows, file->str_buf );
+      } else {
+        CALL_FITS( fits_read_col, file->ff, TSTRING, file->table.colnum[i], firstrow, 1, nrows, NULL, file->str_buf, NULL );
+      }
+    } else {
+      const LONGLONG nelements = file->table.nelements[i] * nrows;
+      if ( write ) {
+        CALL_FITS( fits_write_col, file->ff, file->table.datatype[i], file->table.colnum[i], firstrow, 1, nelements, file->col_buf[i] );
+      } else {
+        CALL_FITS( fits_read_col, file->ff, file->table.datatype[i], file->table.colnum[i], firstrow, 1, nelements, NULL, file->col_buf[i], NULL );
+      }
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  return XLAL_FAILURE;
+
+}
+
+///
+/// Write any table rows remaining in the table column buffers to the current table
+///
+static int TableFlushRows( FITSFile *file )
+{
+
+  int UNUSED status = 0;
+
+  if ( file->write && file->ff != NULL && file->hdutype == BINARY_TBL && file->table.buf_nrows > 0 ) {
+    XLAL_CHECK_FAIL( TableTransferColumnBuffers( file, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    file->table.buf_irow += file->table.buf_nrows;
+    file->table.buf_nrows = 0;
+  }
+
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+
+  // Delete FITS file on error
+  if ( file->ff != NULL ) {
+    fits_delete_file( file->ff, &status );
+    file->ff = NULL;
+  }
+
+  return XLAL_FAILURE;
+
+}
+
+///
+/// Return a pointer to the field of column 'i' in a table row record
+///
+static void *TableRecordField( const FITSFile *file, const int i, const void *record )
+{
+  union {
+    const void *cv;
+    void *v;
+  } bad_cast = { .cv = record };
+  void *value = bad_cast.v;
+  for ( size_t n = 0; n < file->table.noffsets[i]; ++n ) {
+    if ( n > 0 ) {
+      value = *( ( void ** ) value );
+    }
+    value = ( void * )( ( ( intptr_t ) value ) + file->table.offsets[i][n] );
+  }
+  return value;
+}
+
 #endif // defined(HAVE_LIBCFITSIO)
 
-void XLALFITSFileClose( FITSFile UNUSED *file )
+int XLALFITSIsReentrant( void )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  return 0;
+#else // defined(HAVE_LIBCFITSIO)
+  return fits_is_reentrant();
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
+int XLALFITSFileClose( FITSFile UNUSED *file )
 {
 #if !defined(HAVE_LIBCFITSIO)
-  XLAL_ERROR_VOID( XLAL_EFAILED, "CFITSIO is not available" );
+  XLAL_ERROR( XLAL_EFAILED, "CFITSIO is not available" );
 #else // defined(HAVE_LIBCFITSIO)
 
   int UNUSED status = 0;
+  int errnum = 0;
   if ( file != NULL ) {
+
+    // Write any buffered table rows; on error the file has already been deleted
+    if ( TableFlushRows( file ) != XLAL_SUCCESS ) {
+      errnum = XLAL_EFUNC;
+    }
+
+    // Close the file; errors writing the file may only be reported here
     if ( file->ff != NULL ) {
       fits_close_file( file->ff, &status );
+      if ( status != 0 ) {
+        CHAR buf[FLEN_STATUS + FLEN_ERRMSG];
+        fits_get_errstatus( status, buf );
+        XLAL_PRINT_ERROR( "fits_close_file() failed: %s", buf );
+        while ( fits_read_errmsg( buf ) > 0 ) {
+          XLAL_PRINT_ERROR( "fits_close_file() error: %s", buf );
+        }
+        errnum = XLAL_EIO;
+      }
+    }
+
+    for ( size_t i = 0; i < XLAL_NUM_ELEM( file->col_buf ); ++i ) {
+      XLALFree( file->col_buf[i] );
     }
-    XLALFree( file->buf );
+    XLALFree( file->str_buf );
     XLALFree( file );
+
   }
+  XLAL_CHECK( errnum == 0, errnum, "Failed to close FITS file" );
+
+  return XLAL_SUCCESS;
 
 #endif // !defined(HAVE_LIBCFITSIO)
 }
@@ -386,6 +557,9 @@ int XLALFITSFileSeekPrimaryHDU( FITSFile UNUSED *file )
   // Check input
   XLAL_CHECK_FAIL( file != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( TableFlushRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Seek primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
 
@@ -410,6 +584,9 @@ int XLALFITSFileSeekNamedHDU( FITSFile UNUSED *file, const CHAR UNUSED *name )
   XLAL_CHECK_FAIL( name != NULL, XLAL_EFAULT );
   XLAL_CHECK( strlen( name ) < FLEN_VALUE, XLAL_EINVAL, "HDU name '%s' is too long", name );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( TableFlushRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Set current HDU
   file->hdutype = ANY_HDU;
   strncpy( file->hduname, name, sizeof( file->hduname ) - 1 );
@@ -439,6 +616,9 @@ int XLALFITSFileWriteHistory( FITSFile UNUSED *file, const CHAR UNUSED *format,
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
   XLAL_CHECK_FAIL( format != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( TableFlushRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Seek primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
 
@@ -476,6 +656,9 @@ int XLALFITSFileWriteVCSInfo( FITSFile UNUSED *file, const LALVCSInfoList UNUSED
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
   XLAL_CHECK_FAIL( vcs_list != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( TableFlushRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Seek primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
 
@@ -518,6 +701,9 @@ int XLALFITSFileWriteUVarCmdLine( FITSFile UNUSED *file )
   XLAL_CHECK_FAIL( file != NULL, XLAL_EFAULT );
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( TableFlushRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Seek primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
 
@@ -1599,6 +1785,9 @@ int XLALFITSArrayOpenWrite( FITSFile UNUSED *file, const CHAR UNUSED *name, cons
   XLAL_CHECK_FAIL( ndim <= FFIO_MAX, XLAL_ESIZE );
   XLAL_CHECK_FAIL( dims != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( TableFlushRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Set current HDU
   file->hdutype = IMAGE_HDU;
   strncpy( file->hduname, name, sizeof( file->hduname ) - 1 );
@@ -2171,6 +2360,9 @@ int XLALFITSTableOpenWrite( FITSFile UNUSED *file, const CHAR UNUSED *name, cons
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
   XLAL_CHECK_FAIL( name != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( TableFlushRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Set current HDU
   file->hdutype = BINARY_TBL;
   strncpy( file->hduname, name, sizeof( file->hduname ) - 1 );
@@ -2264,7 +2456,10 @@ static int UNUSED XLALFITSTableColumnAdd( FITSFile UNUSED *file, const CHAR UNUS
   XLAL_CHECK_FAIL( file->table.tfields <= FFIO_MAX, XLAL_ESIZE );
   const int i = file->table.tfields++;
 
-  // Store field size
+  // Store record size, if field is not in a nested record, and field size
+  if ( noffsets == 1 ) {
+    file->table.record_size = record_size;
+  }
   file->table.field_size[i] = field_size;
 
   // Store field offsets
@@ -2572,33 +2767,26 @@ int XLALFITSTableWriteRow( FITSFile UNUSED *file, const void UNUSED *record )
     }
     CALL_FITS( fits_create_tbl, file->ff, file->hdutype, 0, file->table.tfields, ttype_ptr, tform_ptr, tunit_ptr, NULL );
     CALL_FITS( fits_write_key_str, file->ff, "HDUNAME", file->hduname, file->hducomment );
+    XLAL_CHECK_FAIL( TableResizeColumnBuffers( file ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
 
   // Advance to next row
   ++file->table.irow;
 
-  // Write next table row
+  // Copy data in record to table column buffers
   for ( int i = 0; i < file->table.tfields; ++i ) {
-
-    // Work out pointer to correct place in record
-    union {
-      const void *cv;
-      void *v;
-    } bad_cast = { .cv = record };
-    void *value = bad_cast.v;
-    for ( size_t n = 0; n < file->table.noffsets[i]; ++n ) {
-      if ( n > 0 ) {
-        value = *( ( void ** ) value );
-      }
-      value = ( void * )( ( ( intptr_t ) value ) + file->table.offsets[i][n] );
-    }
-
-    // Write data in record to table column
-    {
-      void *pvalue = ( file->table.datatype[i] == TSTRING ) ? ( void * ) &value : value;
-      CALL_FITS( fits_write_col, file->ff, file->table.datatype[i], file->table.colnum[i], file->table.irow, 1, file->table.nelements[i], pvalue );
+    const size_t row_size = TableColumnBufferRowSize( file, i );
+    char *buf = file->col_buf[i] + file->table.buf_nrows * row_size;
+    memcpy( buf, TableRecordField( file, i, record ), file->table.field_size[i] );
+    if ( file->table.datatype[i] == TSTRING ) {
+      buf[row_size - 1] = '\0';
     }
+  }
+  ++file->table.buf_nrows;
 
+  // Write table column buffers to table once they are full
+  if ( file->table.buf_nrows == file->table.buf_max_nrows ) {
+    XLAL_CHECK_FAIL( TableFlushRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
 
   return XLAL_SUCCESS;
@@ -2616,6 +2804,27 @@ XLAL_FAIL:
 #endif // !defined(HAVE_LIBCFITSIO)
 }
 
+int XLALFITSTableWriteRows( FITSFile UNUSED *file, const void UNUSED *records, const size_t UNUSED nrecords )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( records != NULL || nrecords == 0, XLAL_EFAULT );
+  XLAL_CHECK( file->table.record_size > 0, XLAL_EINVAL, "Table has no columns in top-level record" );
+
+  // Write table rows from contiguous array of records
+  for ( size_t j = 0; j < nrecords; ++j ) {
+    XLAL_CHECK( XLALFITSTableWriteRow( file, ( ( const char * ) records ) + j * file->table.record_size ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  return XLAL_SUCCESS;
+
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
 int XLALFITSTableReadRow( FITSFile UNUSED *file, void UNUSED *record, UINT8 UNUSED *rem_nrows )
 {
 #if !defined(HAVE_LIBCFITSIO)
@@ -2637,49 +2846,96 @@ int XLALFITSTableReadRow( FITSFile UNUSED *file, void UNUSED *record, UINT8 UNUS
     return XLAL_SUCCESS;
   }
 
+  // Read the next table rows into the table column buffers, if current row is not already buffered
+  if ( file->table.irow < file->table.buf_irow || file->table.buf_irow + file->table.buf_nrows <= file->table.irow ) {
+    if ( file->table.buf_max_nrows == 0 ) {
+      XLAL_CHECK_FAIL( TableResizeColumnBuffers( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    file->table.buf_irow = file->table.irow;
+    file->table.buf_nrows = file->table.nrows - file->table.irow;
+    if ( file->table.buf_nrows > file->table.buf_max_nrows ) {
+      file->table.buf_nrows = file->table.buf_max_nrows;
+    }
+    for ( int i = 0; i < file->table.tfields; ++i ) {
+      memset( file->col_buf[i], 0, file->col_buf_size[i] );
+    }
+    XLAL_CHECK_FAIL( TableTransferColumnBuffers( file, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Copy the required length of the table column buffers into the record
+  for ( int i = 0; i < file->table.tfields; ++i ) {
+    const size_t row_size = TableColumnBufferRowSize( file, i );
+    const char *buf = file->col_buf[i] + ( file->table.irow - file->table.buf_irow ) * row_size;
+    memcpy( TableRecordField( file, i, record ), buf, file->table.field_size[i] );
+  }
+
   // Advance to next row, and return number of remaining rows
   ++file->table.irow;
   if ( rem_nrows != NULL ) {
     *rem_nrows = file->table.nrows - file->table.irow;
   }
 
-  // Read next table row
-  for ( int i = 0; i < file->table.tfields; ++i ) {
+  return XLAL_SUCCESS;
 
-    // Resize temporary buffer, if required
-    // - Require double the field size to allow for buffer overruns in CFITSIO
-    const size_t req_buf_size = 2 * file->table.field_size[i];
-    if ( file->buf_size < req_buf_size ) {
-      file->buf = XLALRealloc( file->buf, req_buf_size );
-      XLAL_CHECK( file->buf != NULL, XLAL_ENOMEM );
-      file->buf_size = req_buf_size;
-    }
-    memset( file->buf, 0, req_buf_size );
+XLAL_FAIL:
+  return XLAL_FAILURE;
 
-    // Read data from table column into temporary buffer
-    {
-      void *pbuf = ( file->table.datatype[i] == TSTRING ) ? ( void * ) &file->buf : file->buf;
-      CALL_FITS( fits_read_col, file->ff, file->table.datatype[i], file->table.colnum[i], file->table.irow, 1, file->table.nelements[i], NULL, pbuf, NULL );
-    }
+#endif // !defined(HAVE_LIBCFITSIO)
+}
 
-    // Work out pointer to correct place in record
-    void *value = record;
-    for ( size_t n = 0; n < file->table.noffsets[i]; ++n ) {
-      if ( n > 0 ) {
-        value = *( ( void ** ) value );
-      }
-      value = ( void * )( ( ( intptr_t ) value ) + file->table.offsets[i][n] );
-    }
+int XLALFITSTableReadRows( FITSFile UNUSED *file, void UNUSED *records, const size_t UNUSED max_nrecords, size_t UNUSED *nrecords, UINT8 UNUSED *rem_nrows )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
 
-    // Copy the required length of the temporary buffer into the record
-    memcpy( value, file->buf, file->table.field_size[i] );
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( records != NULL || max_nrecords == 0, XLAL_EFAULT );
+  XLAL_CHECK( nrecords != NULL, XLAL_EFAULT );
 
+  // Check that we are at a table
+  XLAL_CHECK( file->hdutype == BINARY_TBL, XLAL_EIO, "Current FITS file HDU is not a table" );
+  XLAL_CHECK( file->table.record_size > 0, XLAL_EINVAL, "Table has no columns in top-level record" );
+
+  // Read table rows into contiguous array of records, until array is full or there are no more rows
+  *nrecords = 0;
+  while ( *nrecords < max_nrecords && file->table.irow < file->table.nrows ) {
+    XLAL_CHECK( XLALFITSTableReadRow( file, ( ( char * ) records ) + ( *nrecords ) * file->table.record_size, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+    ++( *nrecords );
+  }
+
+  // Return number of remaining rows
+  if ( rem_nrows != NULL ) {
+    *rem_nrows = file->table.nrows - file->table.irow;
   }
 
   return XLAL_SUCCESS;
 
-XLAL_FAIL:
-  return XLAL_FAILURE;
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
+int XLALFITSTableSeekRow( FITSFile UNUSED *file, const UINT8 UNUSED irow, UINT8 UNUSED *rem_nrows )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+  XLAL_CHECK( !file->write, XLAL_EINVAL, "FITS file is not open for reading" );
+
+  // Check that we are at a table
+  XLAL_CHECK( file->hdutype == BINARY_TBL, XLAL_EIO, "Current FITS file HDU is not a table" );
+  XLAL_CHECK( irow <= ( UINT8 ) file->table.nrows, XLAL_EINVAL, "Row %" LAL_UINT8_FORMAT " is beyond end of table", irow );
+
+  // Set next row to read, and return number of remaining rows
+  file->table.irow = irow;
+  if ( rem_nrows != NULL ) {
+    *rem_nrows = file->table.nrows - file->table.irow;
+  }
+
+  return XLAL_SUCCESS;
 
 #endif // !defined(HAVE_LIBCFITSIO)
 }
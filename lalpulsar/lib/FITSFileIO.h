@@ -53,6 +53,12 @@ extern "C" {
 ///
 typedef struct tagFITSFile FITSFile;
 
+///
+/// Return whether the CFITSIO library was built to be reentrant, i.e. whether different FITS files may
+/// be accessed concurrently from different threads. Returns false if CFITSIO is not available.
+///
+int XLALFITSIsReentrant( void );
+
 /// @}
 
 ///
@@ -63,8 +69,12 @@ typedef struct tagFITSFile FITSFile;
 /// named HDU or by returning to the primary (first) HDU. History information may also be written to
 /// the primary HDU.
 ///
+/// Table rows are buffered while writing, and may not be written to the file until it is closed,
+/// so the return value of XLALFITSFileClose() must be checked for files opened for writing; on
+/// error writing buffered rows the partially-written file is deleted.
+///
 /// @{
-void XLALFITSFileClose( FITSFile *file );
+int XLALFITSFileClose( FITSFile *file );
 FITSFile *XLALFITSFileOpenWrite( const CHAR *file_name );
 FITSFile *XLALFITSFileOpenRead( const CHAR *file_name );
 int XLALFITSFileSeekPrimaryHDU( FITSFile *file );
@@ -214,6 +224,15 @@ int XLALFITSArrayReadGSLMatrix( FITSFile *file, const size_t idx[], gsl_matrix *
 ///
 /// Finally, XLALFITSTableWriteRow() or XLALFITSTableReadRow() are called to write/read table rows;
 /// the latter returns the number of rows remaining in the table \p rem_nrows, if needed.
+/// XLALFITSTableWriteRows() and XLALFITSTableReadRows() write/read rows from/to a contiguous array
+/// of records, and XLALFITSTableSeekRow() sets the index of the next row to be read, so that a range
+/// of rows may be read. When reading, only the columns specified by the
+/// <tt>XLAL_FITS_TABLE_COLUMN_...()</tt> macros are read, so a subset of the table columns may be
+/// read by specifying only those columns.
+///
+/// Table rows are buffered, and written/read to/from the FITS file one column at a time, for as
+/// many rows at once as is optimal for CFITSIO. Buffered rows are written when the table is full,
+/// when another HDU is opened or sought, and when the FITS file is closed.
 ///
 /// @{
 int XLALFITSTableOpenWrite( FITSFile *file, const CHAR *name, const CHAR *comment );
@@ -286,6 +305,9 @@ int XLALFITSTableColumnAddGPSTime( FITSFile *file, const CHAR *col_name, const s
 
 int XLALFITSTableWriteRow( FITSFile *file, const void *record );
 int XLALFITSTableReadRow( FITSFile *file, void *record, UINT8 *rem_nrows );
+int XLALFITSTableWriteRows( FITSFile *file, const void *records, const size_t nrecords );
+int XLALFITSTableReadRows( FITSFile *file, void *records, const size_t max_nrecords, size_t *nrecords, UINT8 *rem_nrows );
+int XLALFITSTableSeekRow( FITSFile *file, const UINT8 irow, UINT8 *rem_nrows );
 /// @}
 
 /// @}
@@ -401,6 +401,110 @@ void LALHOUGHIntegrHD2HT (LALStatus       *status,
   RETURN (status);
 }
 
+/*
+ * Add the weight of one border of a partial Hough map derivative to a Hough map derivative.
+ * The x pixel indices of the border are checked in a separate pass, so that the accumulation
+ * loop itself contains no branches.
+ */
+static int AddBorder2HD( HOUGHMapDeriv *hd, const HOUGHBorder *border, HoughDT weight )
+{
+  const INT4 xSide1 = hd->xSide + 1;
+  const INT4 ySide = hd->ySide;
+  const COORType *xPixel = border->xPixel;
+  INT4 yLower = border->yLower;
+  INT4 yUpper = border->yUpper;
+
+  if ( yLower < 0 ) {
+    XLAL_PRINT_WARNING( "Fixing yLower (%d -> 0)", yLower );
+    yLower = 0;
+  }
+  if ( yUpper >= ySide ) {
+    XLAL_PRINT_WARNING( "Fixing yUpper (%d -> %d)", yUpper, ySide - 1 );
+    yUpper = ySide - 1;
+  }
+  if ( yUpper < yLower ) {
+    return XLAL_SUCCESS;
+  }
+
+  /* check the x pixel indices are within the map */
+  COORType xMin = xPixel[yLower], xMax = xPixel[yLower];
+  for ( INT4 j = yLower + 1; j <= yUpper; ++j ) {
+    xMin = ( xPixel[j] < xMin ) ? xPixel[j] : xMin;
+    xMax = ( xPixel[j] > xMax ) ? xPixel[j] : xMax;
+  }
+  XLAL_CHECK( xMin >= 0 && xMax < xSide1, XLAL_ESIZE, "map index out of bounds: x pixel in [%d,%d], map has %d columns", xMin, xMax, xSide1 );
+
+  /* add the weight at the border */
+  HoughDT *map = hd->map;
+  for ( INT4 j = yLower; j <= yUpper; ++j ) {
+    map[j * xSide1 + xPixel[j]] += weight;
+  }
+
+  return XLAL_SUCCESS;
+}
+
+/**
+ * XLAL version of LALHOUGHAddPHMD2HD_W(): adds a weighted partial Hough map
+ * derivative into a total Hough map derivative.
+ */
+int XLALHOUGHAddPHMD2HD_W( HOUGHMapDeriv *hd, HOUGHphmd *phmd )
+{
+
+  /* check input */
+  XLAL_CHECK( hd != NULL && hd->map != NULL, XLAL_EFAULT );
+  XLAL_CHECK( phmd != NULL, XLAL_EFAULT );
+  XLAL_CHECK( hd->xSide > 0 && hd->ySide > 0, XLAL_ESIZE );
+
+  const HoughDT weight = phmd->weight;
+  const UINT4 xSide1 = hd->xSide + 1;
+
+  /* first column correction */
+  for ( UINT4 k = 0; k < hd->ySide; ++k ) {
+    hd->map[k * xSide1] += phmd->firstColumn[k] * weight;
+  }
+
+  /* left borders => increase according to weight */
+  for ( UINT4 k = 0; k < phmd->lengthLeft; ++k ) {
+    XLAL_CHECK( AddBorder2HD( hd, phmd->leftBorderP[k], weight ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  /* right borders => decrease according to weight */
+  for ( UINT4 k = 0; k < phmd->lengthRight; ++k ) {
+    XLAL_CHECK( AddBorder2HD( hd, phmd->rightBorderP[k], -weight ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
+/**
+ * XLAL version of LALHOUGHIntegrHD2HT(): constructs a total Hough map from its
+ * derivative by integrating each row.
+ */
+int XLALHOUGHIntegrHD2HT( HOUGHMapTotal *ht, HOUGHMapDeriv *hd )
+{
+
+  /* check input */
+  XLAL_CHECK( hd != NULL && hd->map != NULL, XLAL_EFAULT );
+  XLAL_CHECK( ht != NULL && ht->map != NULL, XLAL_EFAULT );
+  XLAL_CHECK( hd->xSide > 0 && hd->ySide > 0, XLAL_ESIZE );
+  XLAL_CHECK( ht->xSide == hd->xSide && ht->ySide == hd->ySide, XLAL_ESIZE, "size mismatch between Hough map and its derivative" );
+
+  const UINT4 xSide = ht->xSide;
+
+  for ( UINT4 j = 0; j < ht->ySide; ++j ) {
+    const HoughDT *hdrow = &hd->map[j * ( xSide + 1 )];
+    HoughTT *htrow = &ht->map[j * xSide];
+    HoughTT accumulator = 0;
+    for ( UINT4 i = 0; i < xSide; ++i ) {
+      htrow[i] = ( accumulator += hdrow[i] );
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
 /**  Find source sky location given stereographic coordinates indexes */
 void LALStereo2SkyLocation (LALStatus  *status,
          REAL8UnitPolarCoor *sourceLocation, /* output*/
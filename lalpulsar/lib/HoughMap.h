@@ -170,6 +170,10 @@ void LALHOUGHIntegrHD2HT (LALStatus       *status,
 			  HOUGHMapDeriv   *hd /* the Hough map derivative */
 			  );
 
+int XLALHOUGHAddPHMD2HD_W( HOUGHMapDeriv *hd, HOUGHphmd *phmd );
+
+int XLALHOUGHIntegrHD2HT( HOUGHMapTotal *ht, HOUGHMapDeriv *hd );
+
 void LALHOUGHInitializeHT (LALStatus      *status,
 			  HOUGHMapTotal   *ht,     /* the total Hough map */
 			  HOUGHPatchGrid  *patch      /* patch information */
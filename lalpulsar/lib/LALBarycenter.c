@@ -522,7 +522,7 @@ XLALBarycenterEarthNew ( EarthState *earth,                /**< [out] the earth'
     REAL8 tdiffS;
     REAL8 tdiff2S;
 
-    static REAL8 scorr; /* SI second/metre correction factor */
+    REAL8 scorr; /* SI second/metre correction factor */
 
     INT4 j; /*dummy index */
 
@@ -1464,6 +1464,353 @@ XLALBarycenterOpt ( EmissionTime *emit, 		/**< [out] emission-time information *
 
 } /* XLALBarycenterOpt() */
 
+/// ---------- piecewise-polynomial model of the emission-time delay ----------
+struct tagBarycenterModel
+{
+  LIGOTimeGPS start;		/// start time of the modelled span
+  REAL8 span;			/// length of the modelled span in seconds
+  UINT4 numSegments;		/// number of polynomial segments
+  REAL8 *knots;			/// numSegments + 1 segment boundaries, in seconds from 'start'
+  REAL8 *coeffs;		/// 4 polynomial coefficients per segment, lowest order first
+  REAL8 maxError;		/// maximal error found at the check points of the segments
+}; // struct tagBarycenterModel
+
+/// compute exact emission-time delay and its derivative at 'start + dt'
+static int
+XLALBarycenterModelExact ( REAL8 *deltaT, REAL8 *tDot, BarycenterInput *baryinput, const LIGOTimeGPS *start, REAL8 dt,
+                           const EphemerisData *edat, const TimeCorrectionData *tdat, TimeCorrectionType ttype, BarycenterBuffer **buffer )
+{
+  EarthState earth;
+  EmissionTime emit;
+
+  baryinput->tgps = *start;
+  XLALGPSAdd ( &baryinput->tgps, dt );
+  if ( tdat != NULL ) {
+    XLAL_CHECK ( XLALBarycenterEarthNew ( &earth, &baryinput->tgps, edat, tdat, ttype ) == XLAL_SUCCESS, XLAL_EFUNC );
+  } else {
+    XLAL_CHECK ( XLALBarycenterEarth ( &earth, &baryinput->tgps, edat ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  XLAL_CHECK ( XLALBarycenterOpt ( &emit, baryinput, &earth, buffer ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  (*deltaT) = emit.deltaT;
+  (*tDot) = emit.tDot;
+
+  return XLAL_SUCCESS;
+
+} /* XLALBarycenterModelExact() */
+
+/// compare two REAL8s, for qsort()
+static int
+compareREAL8 ( const void *a, const void *b )
+{
+  const REAL8 x = *(const REAL8 *)a, y = *(const REAL8 *)b;
+  return ( x > y ) - ( x < y );
+} /* compareREAL8() */
+
+/**
+ * Return the sorted times within (0, span) of 'start' at which the exact emission-time delay, or its derivative, jumps:
+ * XLALBarycenterEarth() switches to the next Earth or Sun ephemeris entry at whole GPS seconds half-way between the
+ * entries, and XLALBarycenterEarthNew() linearly interpolates the time-correction table. The segments of the model
+ * must end at these times, otherwise the jumps spoil the interpolation.
+ */
+static REAL8 *
+XLALBarycenterModelBreaks ( UINT4 *numBreaks, const EphemerisData *edat, const TimeCorrectionData *tdat, const LIGOTimeGPS *start, REAL8 span )
+{
+  const REAL8 t0 = XLALGPSGetREAL8 ( start );
+  const REAL8 tinit[2] = { edat->ephemE[0].gps, edat->ephemS[0].gps };
+  const REAL8 dtable[2] = { edat->dtEtable, edat->dtStable };
+
+  // count breaks
+  UINT4 maxBreaks = 0;
+  for ( UINT4 n = 0; n < 2; n ++ ) {
+    maxBreaks += (UINT4) ceil ( span / dtable[n] ) + 1;
+  }
+  if ( tdat != NULL ) {
+    maxBreaks += (UINT4) ceil ( span / tdat->dtTtable ) + 1;
+  }
+
+  REAL8 *breaks = XLALMalloc ( ( maxBreaks > 0 ? maxBreaks : 1 ) * sizeof ( *breaks ) );
+  XLAL_CHECK_NULL ( breaks != NULL, XLAL_ENOMEM );
+
+  UINT4 num = 0;
+  for ( UINT4 n = 0; n < 2; n ++ )
+    {
+      // entry i is used from the first whole second at or after tinit + (i - 0.5) * dtable
+      for ( INT4 i = (INT4) floor ( ( t0 - tinit[n] ) / dtable[n] + 0.5 ); num < maxBreaks; i ++ )
+        {
+          REAL8 dt = ceil ( tinit[n] + ( i - 0.5 ) * dtable[n] ) - t0;
+          if ( dt >= span ) {
+            break;
+          }
+          if ( dt > 0 ) {
+            breaks[num++] = dt;
+          }
+        }
+    }
+  if ( tdat != NULL )
+    {
+      for ( INT4 i = (INT4) floor ( ( t0 - tdat->timeCorrStart ) / tdat->dtTtable ); num < maxBreaks; i ++ )
+        {
+          REAL8 dt = tdat->timeCorrStart + i * tdat->dtTtable - t0;
+          if ( dt >= span ) {
+            break;
+          }
+          if ( dt > 0 ) {
+            breaks[num++] = dt;
+          }
+        }
+    }
+
+  // sort and remove duplicates
+  qsort ( breaks, num, sizeof ( *breaks ), compareREAL8 );
+  UINT4 numUnique = 0;
+  for ( UINT4 i = 0; i < num; i ++ ) {
+    if ( numUnique == 0 || breaks[i] > breaks[numUnique - 1] ) {
+      breaks[numUnique++] = breaks[i];
+    }
+  }
+
+  (*numBreaks) = numUnique;
+  return breaks;
+
+} /* XLALBarycenterModelBreaks() */
+
+/**
+ * \brief Create a piecewise-polynomial model of the emission-time delay for a fixed source and detector.
+ *
+ * The delay \f$ \Delta T(t) = t_e - t_a \f$ returned as EmissionTime::deltaT by XLALBarycenter() is modelled over
+ * the span [start, start + span] by cubic Hermite polynomials, which match the exact values of \f$ \Delta T \f$ and
+ * of its derivative \f$ \dot{t}_e - 1 \f$ at both ends of each segment. Segments end wherever the exact delay is not
+ * smooth, i.e.\ where XLALBarycenterEarth() switches between ephemeris entries, and are otherwise of equal length.
+ *
+ * The interpolation error of a cubic Hermite polynomial is largest near the middle of each segment, so after
+ * building the model its error is measured against XLALBarycenterOpt() at the quarter-points and midpoint of every
+ * segment; if it exceeds half of \c tolerance anywhere, the segment length is halved and the model rebuilt. The factor
+ * of two leaves room for the error between the points where it is measured. The initial segment length is estimated
+ * from the fourth derivative of the Earth-rotation delay, which dominates the error, and is about 13 minutes for a
+ * tolerance of 1 ns.
+ *
+ * The model is evaluated with XLALBarycenterModelEvaluate(), at a cost of a few floating-point operations per sample.
+ *
+ * \note The detector location in <tt>baryinput->site</tt> must be given in units of seconds, as for XLALBarycenter();
+ * <tt>baryinput->tgps</tt> is ignored. If \c tdat is NULL, XLALBarycenterEarth() is used, otherwise
+ * XLALBarycenterEarthNew() with the given time-correction type.
+ */
+BarycenterModel *
+XLALCreateBarycenterModel ( const BarycenterInput *baryinput,	/**< [in] info about detector and source-location */
+                            const EphemerisData *edat,		/**< [in] ephemeris data */
+                            const TimeCorrectionData *tdat,	/**< [in] time-correction data (can be NULL) */
+                            TimeCorrectionType ttype,		/**< [in] time-correction type (ignored if tdat == NULL) */
+                            const LIGOTimeGPS *start,		/**< [in] start of the span to model */
+                            REAL8 span,				/**< [in] length of the span to model, in seconds */
+                            REAL8 tolerance			/**< [in] maximal allowed error in the emission-time delay, in seconds */
+                            )
+{
+  XLAL_CHECK_NULL ( baryinput != NULL, XLAL_EINVAL, "Invalid input: baryinput == NULL");
+  XLAL_CHECK_NULL ( edat != NULL && edat->ephemE != NULL && edat->ephemS != NULL, XLAL_EINVAL, "Invalid input: edat == NULL or has no ephemerides");
+  XLAL_CHECK_NULL ( start != NULL, XLAL_EINVAL, "Invalid input: start == NULL");
+  XLAL_CHECK_NULL ( span > 0, XLAL_EINVAL, "Invalid input: span = %g <= 0", span );
+  XLAL_CHECK_NULL ( tolerance > 0, XLAL_EINVAL, "Invalid input: tolerance = %g <= 0", tolerance );
+
+  // Earth-rotation delay amplitude (Earth radius in light seconds) and angular velocity
+  const REAL8 RE_C = 0.0213;
+  const REAL8 OMEGA = 7.29211510e-5;
+  // don't go to segments shorter than this; direct evaluation would then be cheaper
+  const REAL8 MIN_STEP = 1.0;
+  // ends of a segment are evaluated this far inside it, so that the exact delay is taken from the right ephemeris entry
+  const REAL8 EPS_STEP = 1e-3;
+  // the error is measured at these fractions of each segment, and must not exceed this fraction of the tolerance
+  const REAL8 CHECK_POINTS[] = { 0.25, 0.5, 0.75 };
+  const REAL8 CHECK_TOLERANCE = 0.5 * tolerance;
+
+  BarycenterModel *model = XLALCalloc ( 1, sizeof ( *model ) );
+  XLAL_CHECK_NULL ( model != NULL, XLAL_ENOMEM );
+  model->start = (*start);
+  model->span = span;
+
+  BarycenterInput input = (*baryinput);
+  BarycenterBuffer *buffer = NULL;
+  UINT4 numBreaks = 0;
+  REAL8 *breaks = NULL;
+
+  if ( ( breaks = XLALBarycenterModelBreaks ( &numBreaks, edat, tdat, start, span ) ) == NULL ) {
+    goto failed;
+  }
+
+  // initial segment length from the Hermite error bound: |error| <= step^4 / 384 * max|d^4 DeltaT / dt^4|
+  REAL8 maxStep = pow ( 384.0 * CHECK_TOLERANCE / ( RE_C * pow ( OMEGA, 4 ) ), 0.25 );
+
+  while ( 1 )
+    {
+      if ( maxStep < MIN_STEP ) {
+        XLALPrintError ( "%s: could not reach tolerance %g s with segments longer than %g s\n", __func__, tolerance, MIN_STEP );
+        goto failed;
+      }
+
+      // divide each interval between breaks into equal segments no longer than 'maxStep'
+      UINT4 numSegments = 0;
+      for ( UINT4 b = 0; b <= numBreaks; b ++ )
+        {
+          REAL8 lo = ( b == 0 ) ? 0 : breaks[b-1];
+          REAL8 hi = ( b == numBreaks ) ? span : breaks[b];
+          numSegments += (UINT4) ceil ( ( hi - lo ) / maxStep );
+        }
+      XLALFree ( model->knots );
+      XLALFree ( model->coeffs );
+      model->coeffs = NULL;
+      if ( ( model->knots = XLALMalloc ( ( numSegments + 1 ) * sizeof ( *model->knots ) ) ) == NULL ) {
+        goto failed;
+      }
+      if ( ( model->coeffs = XLALMalloc ( 4 * numSegments * sizeof ( *model->coeffs ) ) ) == NULL ) {
+        goto failed;
+      }
+      UINT4 k = 0;
+      for ( UINT4 b = 0; b <= numBreaks; b ++ )
+        {
+          REAL8 lo = ( b == 0 ) ? 0 : breaks[b-1];
+          REAL8 hi = ( b == numBreaks ) ? span : breaks[b];
+          UINT4 n = (UINT4) ceil ( ( hi - lo ) / maxStep );
+          for ( UINT4 j = 0; j < n; j ++ ) {
+            model->knots[k++] = lo + j * ( hi - lo ) / n;
+          }
+        }
+      model->knots[numSegments] = span;
+      model->numSegments = numSegments;
+
+      // cubic Hermite coefficients of each segment, in powers of (t - knots[k]), from exact values just inside its ends
+      for ( k = 0; k < numSegments; k ++ )
+        {
+          const REAL8 step = model->knots[k+1] - model->knots[k];
+          const REAL8 eps = fmin ( EPS_STEP, step / 4 );
+          REAL8 y0, d0, y1, d1;
+          if ( XLALBarycenterModelExact ( &y0, &d0, &input, start, model->knots[k] + eps, edat, tdat, ttype, &buffer ) != XLAL_SUCCESS ) {
+            goto failed;
+          }
+          if ( XLALBarycenterModelExact ( &y1, &d1, &input, start, model->knots[k+1] - eps, edat, tdat, ttype, &buffer ) != XLAL_SUCCESS ) {
+            goto failed;
+          }
+          d0 -= 1.0;
+          d1 -= 1.0;
+          y0 -= eps * d0;
+          y1 += eps * d1;
+          const REAL8 slope = ( y1 - y0 ) / step;
+          REAL8 *c = &model->coeffs[4*k];
+          c[0] = y0;
+          c[1] = d0;
+          c[2] = ( 3.0 * slope - 2.0 * d0 - d1 ) / step;
+          c[3] = ( d0 + d1 - 2.0 * slope ) / ( step * step );
+        }
+
+      // measure the error at the check points of each segment
+      model->maxError = 0;
+      for ( k = 0; k < numSegments; k ++ )
+        {
+          for ( UINT4 j = 0; j < XLAL_NUM_ELEM ( CHECK_POINTS ); j ++ )
+            {
+              REAL8 deltaT, tDot, model_deltaT;
+              REAL8 dt = model->knots[k] + CHECK_POINTS[j] * ( model->knots[k+1] - model->knots[k] );
+              if ( XLALBarycenterModelExact ( &deltaT, &tDot, &input, start, dt, edat, tdat, ttype, &buffer ) != XLAL_SUCCESS ) {
+                goto failed;
+              }
+              if ( XLALBarycenterModelEvaluate ( &model_deltaT, NULL, model, &dt, 1 ) != XLAL_SUCCESS ) {
+                goto failed;
+              }
+              model->maxError = fmax ( model->maxError, fabs ( model_deltaT - deltaT ) );
+            }
+        }
+
+      if ( model->maxError <= CHECK_TOLERANCE ) {
+        break;
+      }
+      maxStep /= 2;
+
+    } // while (1)
+
+  XLALFree ( breaks );
+  XLALFree ( buffer );
+
+  return model;
+
+ failed:
+  XLALFree ( breaks );
+  XLALFree ( buffer );
+  XLALDestroyBarycenterModel ( model );
+  XLAL_ERROR_NULL ( XLAL_EFUNC );
+
+} /* XLALCreateBarycenterModel() */
+
+/**
+ * Destroy a BarycenterModel created by XLALCreateBarycenterModel().
+ */
+void
+XLALDestroyBarycenterModel ( BarycenterModel *model )
+{
+  if ( model == NULL ) {
+    return;
+  }
+  XLALFree ( model->knots );
+  XLALFree ( model->coeffs );
+  XLALFree ( model );
+
+} /* XLALDestroyBarycenterModel() */
+
+/**
+ * Return the maximal error in the emission-time delay of a BarycenterModel,
+ * as measured by XLALCreateBarycenterModel() at the quarter-points and midpoints of its segments.
+ * This is at most half of the tolerance the model was built to.
+ */
+REAL8
+XLALBarycenterModelMaxError ( const BarycenterModel *model )
+{
+  XLAL_CHECK_REAL8 ( model != NULL, XLAL_EINVAL, "Invalid input: model == NULL");
+  return model->maxError;
+
+} /* XLALBarycenterModelMaxError() */
+
+/**
+ * Evaluate a BarycenterModel at \c length times \c dt[i] (in seconds, relative to the start of the modelled span),
+ * returning the emission-time delay EmissionTime::deltaT and, if \c tDot is not NULL, its derivative EmissionTime::tDot.
+ * The times must lie within the modelled span. The segment containing each time is searched for starting from the
+ * segment of the previous time, so evaluating a time-ordered series costs a few floating-point operations per sample.
+ */
+int
+XLALBarycenterModelEvaluate ( REAL8 *deltaT,			/**< [out] emission-time delays */
+                              REAL8 *tDot,			/**< [out] d(emission time)/d(arrival time) (can be NULL) */
+                              const BarycenterModel *model,	/**< [in] barycentring model */
+                              const REAL8 *dt,			/**< [in] times relative to the start of the model, in seconds */
+                              UINT4 length			/**< [in] number of times */
+                              )
+{
+  XLAL_CHECK ( deltaT != NULL, XLAL_EINVAL, "Invalid input: deltaT == NULL");
+  XLAL_CHECK ( model != NULL, XLAL_EINVAL, "Invalid input: model == NULL");
+  XLAL_CHECK ( length == 0 || dt != NULL, XLAL_EINVAL, "Invalid input: dt == NULL");
+
+  const REAL8 *knots = model->knots;
+  const REAL8 *coeffs = model->coeffs;
+  const UINT4 last = model->numSegments - 1;
+
+  UINT4 k = 0;
+  for ( UINT4 i = 0; i < length; i ++ )
+    {
+      XLAL_CHECK ( 0 <= dt[i] && dt[i] <= model->span, XLAL_EDOM, "Time dt[%u] = %g outside modelled span [0, %g]", i, dt[i], model->span );
+      while ( k > 0 && dt[i] < knots[k] ) {
+        k --;
+      }
+      while ( k < last && dt[i] >= knots[k+1] ) {
+        k ++;
+      }
+      const REAL8 x = dt[i] - knots[k];
+      const REAL8 *c = &coeffs[4*k];
+      deltaT[i] = c[0] + x * ( c[1] + x * ( c[2] + x * c[3] ) );
+      if ( tDot != NULL ) {
+        tDot[i] = 1.0 + c[1] + x * ( 2.0 * c[2] + x * 3.0 * c[3] );
+      }
+    }
+
+  return XLAL_SUCCESS;
+
+} /* XLALBarycenterModelEvaluate() */
+
 /**
  * Function to calculate the precession matrix give Earth nutation values
  * depsilon and dpsi for a given MJD time.
@@ -1545,9 +1892,9 @@ void observatoryEarth( REAL8 obsEarth[3],     /**< [out] The x, y, z coordinates
                        REAL8 dpsi,            /**< [in] dpsi for Earth nutation */
                        REAL8 deps             /**< [in] deps for Earth nutation */
                       ){
-  static REAL8 erad; /* observatory distance from Earth centre */
-  static REAL8 hlt;  /* observatory latitude */
-  static REAL8 alng; /* observatory longitude */
+  REAL8 erad; /* observatory distance from Earth centre */
+  REAL8 hlt;  /* observatory latitude */
+  REAL8 alng; /* observatory longitude */
   REAL8 tmjd = 44244. + ( XLALGPSGetREAL8( tgps ) + 51.184 )/86400.;
 
   INT4 j = 0;
@@ -1561,7 +1908,7 @@ void observatoryEarth( REAL8 obsEarth[3],     /**< [out] The x, y, z coordinates
 
   alng = atan2(-det.location[1], det.location[0]);
 
-  static REAL8 siteCoord[3];
+  REAL8 siteCoord[3];
   REAL8 eeq[3], prn[3][3];
 
   siteCoord[0] = erad * cos(hlt);
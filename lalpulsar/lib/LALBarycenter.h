@@ -265,6 +265,9 @@ EmissionTime;
 /// internal (opaque) buffer type for optimized Barycentering function
 typedef struct tagBarycenterBuffer BarycenterBuffer;
 
+/// internal (opaque) type for piecewise-polynomial model of the emission-time delay
+typedef struct tagBarycenterModel BarycenterModel;
+
 /* Function prototypes. */
 int XLALBarycenterEarth ( EarthState *earth, const LIGOTimeGPS *tGPS, const EphemerisData *edat);
 int XLALBarycenter ( EmissionTime *emit, const BarycenterInput *baryinput, const EarthState *earth);
@@ -277,6 +280,12 @@ int XLALBarycenterEarthNew ( EarthState *earth,
                              const TimeCorrectionData *tdat,
                              TimeCorrectionType ttype );
 
+/* Functions that model the emission-time delay with piecewise polynomials */
+BarycenterModel *XLALCreateBarycenterModel ( const BarycenterInput *baryinput, const EphemerisData *edat, const TimeCorrectionData *tdat, TimeCorrectionType ttype, const LIGOTimeGPS *start, REAL8 span, REAL8 tolerance );
+void XLALDestroyBarycenterModel ( BarycenterModel *model );
+REAL8 XLALBarycenterModelMaxError ( const BarycenterModel *model );
+int XLALBarycenterModelEvaluate ( REAL8 *deltaT, REAL8 *tDot, const BarycenterModel *model, const REAL8 *dt, UINT4 length );
+
 /** @} */
 
 #ifdef  __cplusplus
@@ -433,6 +433,179 @@ XLALComputeMultiAMCoeffs ( const MultiDetectorStateSeries *multiDetStates, 	/**<
 
 } /* XLALComputeMultiAMCoeffs() */
 
+/**
+ * Batched version of XLALComputeAMCoeffs(): compute the antenna-pattern functions \f$ a(t), b(t) \f$
+ * of one detector for \c numSkyPoints sky-positions at once.
+ *
+ * The functions are linear in the (time-dependent) detector-tensor components and quadratic in the
+ * (sky-dependent) vectors \f$ \xi, \eta \f$ , so they form a dense [sky x time] product.
+ * The detector tensors are copied once into contiguous per-component arrays, and each sky-position
+ * then needs only one pass over these arrays, which the compiler can vectorise.
+ * The expressions are the same as in XLALComputeAMCoeffs().
+ *
+ * \note The array \c coeffs must hold \c numSkyPoints pointers, which must be NULL on input; the
+ * AMCoeffs are allocated here, and must be freed with XLALDestroyAMCoeffs().
+ */
+int
+XLALComputeAMCoeffsBatch ( AMCoeffs **coeffs,				/**< [out] AM-coeffs for each sky-position */
+                           const DetectorStateSeries *DetectorStates,	/**< [in] timeseries of detector states */
+                           const SkyPosition *skypos,			/**< [in] {alpha,delta} of the sources */
+                           UINT4 numSkyPoints				/**< [in] number of sky-positions */
+                           )
+{
+  XLAL_CHECK ( coeffs != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( DetectorStates != NULL, XLAL_EINVAL, "Invalid NULL input 'DetectorStates'\n" );
+  XLAL_CHECK ( numSkyPoints == 0 || skypos != NULL, XLAL_EINVAL );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      XLAL_CHECK ( coeffs[s] == NULL, XLAL_EINVAL, "Output AMCoeffs coeffs[%d] must be NULL on input\n", s );
+      /* currently requires sky-pos to be in equatorial coordinates (FIXME) */
+      XLAL_CHECK ( skypos[s].system == COORDINATESYSTEM_EQUATORIAL, XLAL_EINVAL, "Only equatorial coordinates currently supported in 'skypos[%d]'\n", s );
+    }
+
+  /* copy the detector-tensor components into contiguous arrays */
+  UINT4 numSteps = DetectorStates->length;
+  REAL4 *detT = XLALMalloc ( 6 * numSteps * sizeof ( *detT ) );
+  XLAL_CHECK ( numSteps == 0 || detT != NULL, XLAL_ENOMEM );
+  REAL4 *d11 = detT, *d12 = d11 + numSteps, *d13 = d12 + numSteps;
+  REAL4 *d22 = d13 + numSteps, *d23 = d22 + numSteps, *d33 = d23 + numSteps;
+  for ( UINT4 i = 0; i < numSteps; i ++ )
+    {
+      const SymmTensor3 *d = &(DetectorStates->data[i].detT);
+      d11[i] = d->d11; d12[i] = d->d12; d13[i] = d->d13;
+      d22[i] = d->d22; d23[i] = d->d23; d33[i] = d->d33;
+    }
+
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      /*---------- We write components of xi and eta vectors in SSB-fixed coords */
+      REAL4 sin1delta, cos1delta;
+      REAL4 sin1alpha, cos1alpha;
+      if ( XLALSinCosLUT (&sin1delta, &cos1delta, skypos[s].latitude ) != XLAL_SUCCESS
+           || XLALSinCosLUT (&sin1alpha, &cos1alpha, skypos[s].longitude ) != XLAL_SUCCESS ) {
+        goto failed;
+      }
+
+      REAL4 xi1 = - sin1alpha;
+      REAL4 xi2 =  cos1alpha;
+      REAL4 eta1 = sin1delta * cos1alpha;
+      REAL4 eta2 = sin1delta * sin1alpha;
+      REAL4 eta3 = - cos1delta;
+
+      if ( ( coeffs[s] = XLALCreateAMCoeffs ( numSteps ) ) == NULL ) {
+        goto failed;
+      }
+      REAL4 *restrict a = coeffs[s]->a->data;
+      REAL4 *restrict b = coeffs[s]->b->data;
+
+      /*---------- Compute the a(t_i) and b(t_i) ---------- */
+      for ( UINT4 i = 0; i < numSteps; i++ )
+        {
+          a[i] =    d11[i] * ( xi1 * xi1 - eta1 * eta1 )
+            + 2 * d12[i] * ( xi1*xi2 - eta1*eta2 )
+            - 2 * d13[i] *             eta1 * eta3
+            +     d22[i] * ( xi2*xi2 - eta2*eta2 )
+            - 2 * d23[i] *             eta2 * eta3
+            -     d33[i] *             eta3*eta3;
+
+          b[i] =    d11[i] * 2 * xi1 * eta1
+            + 2 * d12[i] *   ( xi1 * eta2 + xi2 * eta1 )
+            + 2 * d13[i] *     xi1 * eta3
+            +     d22[i] * 2 * xi2 * eta2
+            + 2 * d23[i] *     xi2 * eta3;
+        } /* for i < numSteps */
+
+    } /* for s < numSkyPoints */
+
+  XLALFree ( detT );
+  return XLAL_SUCCESS;
+
+ failed:
+  XLALFree ( detT );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      XLALDestroyAMCoeffs ( coeffs[s] );
+      coeffs[s] = NULL;
+    }
+  XLAL_ERROR ( XLAL_EFUNC );
+
+} /* XLALComputeAMCoeffsBatch() */
+
+/**
+ * Batched version of XLALComputeMultiAMCoeffs(): compute the noise-weighted multi-IFO
+ * antenna-pattern functions and matrices for \c numSkyPoints sky-positions at once,
+ * using XLALComputeAMCoeffsBatch() for each detector.
+ *
+ * \note The array \c multiAMcoef must hold \c numSkyPoints pointers, which must be NULL on input;
+ * the MultiAMCoeffs are allocated here, and must be freed with XLALDestroyMultiAMCoeffs().
+ * An input of multiWeights = NULL corresponds to unit-weights.
+ */
+int
+XLALComputeMultiAMCoeffsBatch ( MultiAMCoeffs **multiAMcoef,			/**< [out] multi-IFO AM-coeffs for each sky-position */
+                                const MultiDetectorStateSeries *multiDetStates, /**< [in] detector-states at timestamps t_i */
+                                const MultiNoiseWeights *multiWeights,		/**< [in] noise-weigths at timestamps t_i (can be NULL) */
+                                const SkyPosition *skypos,			/**< [in] source sky-positions [in equatorial coords!] */
+                                UINT4 numSkyPoints				/**< [in] number of sky-positions */
+                                )
+{
+  XLAL_CHECK ( multiAMcoef != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( multiDetStates != NULL, XLAL_EINVAL, "Invalid NULL input argument 'multiDetStates'\n" );
+  XLAL_CHECK ( numSkyPoints == 0 || skypos != NULL, XLAL_EINVAL );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ ) {
+    XLAL_CHECK ( multiAMcoef[s] == NULL, XLAL_EINVAL, "Output MultiAMCoeffs multiAMcoef[%d] must be NULL on input\n", s );
+  }
+
+  UINT4 numDetectors = multiDetStates->length;
+
+  /* prepare output vectors */
+  AMCoeffs **coeffsX = XLALCalloc ( numSkyPoints > 0 ? numSkyPoints : 1, sizeof ( *coeffsX ) );
+  XLAL_CHECK ( coeffsX != NULL, XLAL_ENOMEM );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      if ( ( multiAMcoef[s] = XLALCalloc ( 1, sizeof ( *multiAMcoef[s] ) ) ) == NULL ) {
+        goto failed;
+      }
+      multiAMcoef[s]->length = numDetectors;
+      if ( ( multiAMcoef[s]->data = XLALCalloc ( numDetectors, sizeof ( *multiAMcoef[s]->data ) ) ) == NULL ) {
+        goto failed;
+      }
+    }
+
+  /* loop over detectors and generate AMCoeffs for all sky-positions */
+  for ( UINT4 X = 0; X < numDetectors; X ++ )
+    {
+      if ( XLALComputeAMCoeffsBatch ( coeffsX, multiDetStates->data[X], skypos, numSkyPoints ) != XLAL_SUCCESS ) {
+        goto failed;
+      }
+      for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+        {
+          multiAMcoef[s]->data[X] = coeffsX[s];
+          coeffsX[s] = NULL;
+        }
+    } /* for X < numDetectors */
+
+  /* apply noise-weights and compute antenna-pattern matrix {A,B,C} */
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      if ( XLALWeightMultiAMCoeffs ( multiAMcoef[s], multiWeights ) != XLAL_SUCCESS ) {
+        goto failed;
+      }
+    }
+
+  XLALFree ( coeffsX );
+  return XLAL_SUCCESS;
+
+ failed:
+  XLALFree ( coeffsX );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      XLALDestroyMultiAMCoeffs ( multiAMcoef[s] );
+      multiAMcoef[s] = NULL;
+    }
+  XLAL_ERROR ( XLAL_EFUNC );
+
+} /* XLALComputeMultiAMCoeffsBatch() */
+
 
 /* ---------- creators/destructors for AM-coeffs -------------------- */
 /**
@@ -153,6 +153,10 @@ int XLALWeightMultiAMCoeffs (  MultiAMCoeffs *multiAMcoef, const MultiNoiseWeigh
 
 AMCoeffs *XLALComputeAMCoeffs ( const DetectorStateSeries *DetectorStates, SkyPosition skypos );
 MultiAMCoeffs *XLALComputeMultiAMCoeffs ( const MultiDetectorStateSeries *multiDetStates, const MultiNoiseWeights *multiWeights, SkyPosition skypos );
+#ifndef SWIG // exclude from SWIG interface
+int XLALComputeAMCoeffsBatch ( AMCoeffs **coeffs, const DetectorStateSeries *DetectorStates, const SkyPosition *skypos, UINT4 numSkyPoints );
+int XLALComputeMultiAMCoeffsBatch ( MultiAMCoeffs **multiAMcoef, const MultiDetectorStateSeries *multiDetStates, const MultiNoiseWeights *multiWeights, const SkyPosition *skypos, UINT4 numSkyPoints );
+#endif
 
 AMCoeffs *XLALCreateAMCoeffs ( UINT4 numSteps );
 void XLALDestroyMultiAMCoeffs ( MultiAMCoeffs *multiAMcoef );
@@ -276,6 +276,26 @@ void LALHOUGHComputeMultiIFOAMWeights  (LALStatus          *status,
 					REAL8              delta
 					);
 
+HOUGHptfLUTVector *XLALHOUGHCreateLUTVector( UINT4 length, UINT2 maxNBins, UINT2 maxNBorders, UINT2 ySide );
+
+void XLALHOUGHDestroyLUTVector( HOUGHptfLUTVector *lutV );
+
+int XLALHOUGHConstructPLUTVector( HOUGHptfLUTVector *lutV, HOUGHPatchGrid *patch, HOUGHParamPLUT *parLut );
+
+PHMDVectorSequence *XLALHOUGHCreatePHMDVectorSequence( UINT4 length, UINT4 nfSize, UINT2 maxNBorders, UINT2 ySide );
+
+void XLALHOUGHDestroyPHMDVectorSequence( PHMDVectorSequence *phmdVS );
+
+int XLALHOUGHConstructSpacePHMD( PHMDVectorSequence *phmdVS, HOUGHPeakGramVector *pgV, HOUGHptfLUTVector *lutV );
+
+int XLALHOUGHupdateSpacePHMDup( PHMDVectorSequence *phmdVS, HOUGHPeakGramVector *pgV, HOUGHptfLUTVector *lutV );
+
+int XLALHOUGHWeighSpacePHMD( PHMDVectorSequence *phmdVS, REAL8Vector *weightV );
+
+int XLALHOUGHConstructHMT_W( HOUGHMapTotal *ht, UINT8FrequencyIndexVector *freqInd, PHMDVectorSequence *phmdVS );
+
+int XLALHOUGHConstructHMTVector_W( HOUGHMapTotalVector *htV, UINT8FrequencyIndexVectorSequence *freqIndVS, PHMDVectorSequence *phmdVS );
+
 
 /** @} */
 
@@ -436,6 +436,8 @@ void LALHOUGHConstructPLUT(LALStatus       *status,
 			   HOUGHParamPLUT  *par
 			   );
 
+int XLALHOUGHConstructPLUT( HOUGHptfLUT *lut, HOUGHPatchGrid *patch, HOUGHParamPLUT *par );
+
 /** @} */
 
 #ifdef  __cplusplus
@@ -43,6 +43,9 @@
 // Number of cached values which can be stored per dimension
 #define LT_CACHE_MAX_SIZE 6
 
+// Number of points processed together when locating nearest points
+#define LT_NEAREST_CHUNK_SIZE 64
+
 // Determine if parameter-space bound has strict padding
 #define STRICT_BOUND_PADDING( b ) \
   ( ( (b)->lower_bbox_pad == 0 ) && ( (b)->upper_bbox_pad == 0 ) && ( (b)->lower_intp_pad == 0 ) && ( (b)->upper_intp_pad == 0 ) )
@@ -511,19 +514,223 @@ static void LT_PrintIndexTrie(
 
 }
 
+///
+/// Find the nearest point in the An* lattice to the point \c y, which is embedded in <tt>tn+1</tt>
+/// dimensions. Return the <tt>tn+1</tt> generating integers of the nearest point in \c k.
+///
+static int LT_FindNearestAnstarPoint(
+  const size_t tn,                      ///< [in] Number of tiled dimensions
+  const double y[],                     ///< [in] Point in <tt>tn+1</tt> dimensions
+  INT4 k[]                              ///< [out] Generating integers of the nearest point
+)
+{
+
+  // Find the nearest point in An* to the point 'y', using the O(tn) Algorithm 2 given in:
+  //   McKilliam et.al., "A linear-time nearest point algorithm for the lattice An*"
+  //   in "International Symposium on Information Theory and Its Applications", ISITA2008,
+  //   Auckland, New Zealand, 7-10 Dec. 2008. DOI: 10.1109/ISITA.2008.4895596
+  // Notes:
+  //   * Since Algorithm 2 uses 1-based arrays, we have to translate, e.g.:
+  //       z_t in paper <---> z[tn-1] in C code
+  //   * Line 6 in Algorithm 2 as written in the paper is in error, see correction below.
+  //   * We are only interested in 'k', the generating integers of the nearest point
+  //     'x = Q * k', therefore line 26 in Algorithm 2 is not included.
+
+  // Lines 1--4, 20
+  double z[tn + 1], alpha = 0, beta = 0;
+  size_t bucket[tn + 1], link[tn + 1];
+  feclearexcept( FE_ALL_EXCEPT );
+  for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
+    k[ti - 1] = lround( y[ti - 1] ); // Line 20, moved here to avoid duplicate round
+    z[ti - 1] = y[ti - 1] - k[ti - 1];
+    alpha += z[ti - 1];
+    beta += z[ti - 1] * z[ti - 1];
+    bucket[ti - 1] = 0;
+  }
+  if ( fetestexcept( FE_INVALID ) != 0 ) {
+    XLALPrintError( "Rounding failed:" );
+    for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
+      XLALPrintError( " %0.2e", y[ti - 1] );
+    }
+    XLALPrintError( "\n" );
+    XLAL_ERROR( XLAL_EFAILED );
+  }
+
+  // Lines 5--8
+  // Notes:
+  //   * Correction to line 6, as as written in McKilliam et.al.:
+  //       ti = tn + 1 - (tn + 1)*floor(z_t + 0.5)
+  //     should instead read
+  //       ti = tn + 1 - floor((tn + 1)*(z_t + 0.5))
+  //   * We also convert the floor() operation into an lround():
+  //       ti = tn + 1 - lround((tn + 1)*(z_t + 0.5) - 0.5)
+  //     to avoid a casting operation. Rewriting the line as:
+  //       ti = lround((tn + 1)*(0.5 - z_t) + 0.5)
+  //     appears to improve numerical robustness in some cases.
+  //   * No floating-point exception checking needed for lround()
+  //     here since its argument will be of order 'tn'.
+  for ( size_t tt = 1; tt <= tn + 1; ++tt ) {
+    const INT4 ti = lround( ( tn + 1 ) * ( 0.5 - z[tt - 1] ) + 0.5 );
+    link[tt - 1] = bucket[ti - 1];
+    bucket[ti - 1] = tt;
+  }
+
+  // Lines 9--10
+  double D = beta - alpha * alpha / ( tn + 1 );
+  size_t tm = 0;
+
+  // Lines 11--19
+  for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
+    size_t tt = bucket[ti - 1];
+    while ( tt != 0 ) {
+      alpha = alpha - 1;
+      beta = beta - 2 * z[tt - 1] + 1;
+      tt = link[tt - 1];
+    }
+    double d = beta - alpha * alpha / ( tn + 1 );
+    if ( d < D ) {
+      D = d;
+      tm = ti;
+    }
+  }
+
+  // Lines 21--25
+  for ( size_t ti = 1; ti <= tm; ++ti ) {
+    size_t tt = bucket[ti - 1];
+    while ( tt != 0 ) {
+      k[tt - 1] = k[tt - 1] + 1;
+      tt = link[tt - 1];
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Find the generating integers of the nearest points in the lattice to the points in columns
+/// <tt>[j0, j0+nj)</tt> of 'points_int', which are in generating integers. The tiled dimensions
+/// of the nearest points are returned in rows of length 'nj' of 'nearest_int', i.e. the 'ti'th
+/// tiled dimension of point 'j0+j' is returned in <tt>nearest_int[ti*nj + j]</tt>.
+///
+static int LT_FindNearestLatticeInts(
+  const LatticeTiling *tiling,          ///< [in] Lattice tiling
+  const gsl_matrix *points_int,         ///< [in] Columns are set of points in generating integers
+  const size_t j0,                      ///< [in] Index of first point
+  const size_t nj,                      ///< [in] Number of points
+  INT4 *nearest_int                     ///< [out] Tiled dimensions of the nearest points in generating integers
+)
+{
+
+  const size_t tn = tiling->tiled_ndim;
+
+  switch ( tiling->lattice ) {
+
+  case TILING_LATTICE_CUBIC:    // Cubic ( \f$ Z_n \f$ ) lattice
+
+  {
+
+    // Round each dimension of each point to nearest integer to find the nearest point in Zn
+    // - Each row is contiguous in memory, so the rounding of each row can be vectorised
+    feclearexcept( FE_ALL_EXCEPT );
+    for ( size_t ti = 0; ti < tn; ++ti ) {
+      const size_t i = tiling->tiled_idx[ti];
+      const double *points_int_row = gsl_matrix_const_ptr( points_int, i, j0 );
+      INT4 *nearest_int_row = &nearest_int[ti * nj];
+      for ( size_t j = 0; j < nj; ++j ) {
+        nearest_int_row[j] = lround( points_int_row[j] );
+      }
+    }
+    if ( fetestexcept( FE_INVALID ) != 0 ) {
+
+      // Find the first point for which rounding failed
+      for ( size_t j = 0; j < nj; ++j ) {
+        feclearexcept( FE_ALL_EXCEPT );
+        for ( size_t ti = 0; ti < tn; ++ti ) {
+          const size_t i = tiling->tiled_idx[ti];
+          nearest_int[ti * nj + j] = lround( gsl_matrix_get( points_int, i, j0 + j ) );
+        }
+        if ( fetestexcept( FE_INVALID ) != 0 ) {
+          XLALPrintError( "Rounding failed while finding nearest point #%zu:", j0 + j );
+          for ( size_t ti = 0; ti < tn; ++ti ) {
+            const size_t i = tiling->tiled_idx[ti];
+            XLALPrintError( " %0.2e", gsl_matrix_get( points_int, i, j0 + j ) );
+          }
+          XLALPrintError( "\n" );
+          break;
+        }
+      }
+      XLAL_ERROR( XLAL_EFAILED );
+
+    }
+
+  }
+  break;
+
+  case TILING_LATTICE_ANSTAR:   // An-star ( \f$ A_n^* \f$ ) lattice
+
+  {
+
+    for ( size_t j = 0; j < nj; ++j ) {
+
+      // The nearest point algorithm used below embeds the An* lattice in tn+1 dimensions,
+      // however 'points_int[:,j0+j]' has only 'tn' tiled dimensional. The algorithm is only
+      // sensitive to the differences between the 'ti'th and 'ti+1'th dimension, so we can
+      // freely set one of the dimensions to a constant value. We choose to set the 0th
+      // dimension to zero, i.e. the (tn+1)-dimensional lattice point is
+      //   y = (0, tiled dimensions of 'points_int[:,j0+j]').
+      double y[tn + 1];
+      y[0] = 0;
+      for ( size_t ti = 0; ti < tn; ++ti ) {
+        const size_t i = tiling->tiled_idx[ti];
+        y[ti + 1] = gsl_matrix_get( points_int, i, j0 + j );
+      }
+
+      // Find the nearest point in An* to the point 'y'
+      INT4 k[tn + 1];
+      XLAL_CHECK( LT_FindNearestAnstarPoint( tn, y, k ) == XLAL_SUCCESS, XLAL_EFUNC, "Failed while finding nearest point #%zu", j0 + j );
+
+      // The nearest point in An* is the tn differences between k[1]...k[tn] and k[0]
+      for ( size_t ti = 0; ti < tn; ++ti ) {
+        nearest_int[ti * nj + j] = k[ti + 1] - k[0];
+      }
+
+    }
+
+  }
+  break;
+
+  default:
+    XLAL_ERROR( XLAL_EFAILED, "Invalid lattice" );
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Locate the nearest points in a lattice tiling to a given set of points. Return the nearest
 /// points in 'nearest_points', and optionally: unique sequential indexes to the nearest points in
-/// 'nearest_indexes', and indexes of the left/right-most points in the blocks of the nearest points
-/// relative to the nearest points in 'nearest_left' and 'nearest_right' respectively.
+/// 'nearest_indexes'; and, for the blocks of the nearest points in dimension 'block_dim', the
+/// unique sequential indexes of the nearest points in dimension 'block_dim-1' in 'nearest_block_index',
+/// and the indexes of the left/right-most points in the blocks relative to the nearest points in
+/// 'nearest_left' and 'nearest_right' respectively.
+///
+/// Points are processed in chunks of #LT_NEAREST_CHUNK_SIZE. The path through the index trie of
+/// each nearest point is kept, and is reused by the next nearest point for as many dimensions as
+/// their generating integers agree; nearby points, e.g. points sorted along the tiled dimensions,
+/// therefore share most of their trie walks. All state is local, so this function may be called
+/// concurrently with the same locator.
 ///
 static int LT_FindNearestPoints(
   const LatticeTilingLocator *loc,      ///< [in] Lattice tiling locator
   const gsl_matrix *points,             ///< [in] Columns are set of points for which to find nearest points
   gsl_matrix *nearest_points,           ///< [out] Columns are the corresponding nearest points
   UINT8VectorSequence *nearest_indexes, ///< [out] Vectors are unique sequential indexes of the nearest points
-  INT4VectorSequence *nearest_lefts,    ///< [out] Vectors are indexes of left-most points of blocks relative to nearest points
-  INT4VectorSequence *nearest_rights    ///< [out] Vectors are indexes of right-most points of blocks relative to nearest points
+  const size_t block_dim,               ///< [in] Dimension of the blocks for which to return the following outputs
+  UINT8 *nearest_block_index,           ///< [out] Unique sequential indexes of the nearest points in dimension 'block_dim-1'
+  INT4 *nearest_left,                   ///< [out] Indexes of left-most points of blocks relative to nearest points
+  INT4 *nearest_right                   ///< [out] Indexes of right-most points of blocks relative to nearest points
 )
 {
 
@@ -534,6 +741,7 @@ static int LT_FindNearestPoints(
   XLAL_CHECK( nearest_points != NULL, XLAL_EFAULT );
   XLAL_CHECK( nearest_points->size1 == loc->ndim, XLAL_EINVAL );
   XLAL_CHECK( nearest_points->size2 == points->size2, XLAL_EINVAL );
+  XLAL_CHECK( block_dim < loc->ndim, XLAL_EINVAL );
 
   const size_t n = loc->ndim;
   const size_t tn = loc->tiled_ndim;
@@ -550,157 +758,45 @@ static int LT_FindNearestPoints(
   }
   gsl_blas_dtrmm( CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, loc->tiling->int_from_phys, nearest_points );
 
-  // Find the nearest points in the lattice tiling to the points in 'nearest_points'
-  for ( size_t j = 0; j < num_points; ++j ) {
-
-    // If there are tiled dimensions:
-    INT4 nearest[n];
+  // Path through the index trie of the previous nearest point: 'trie_path[ti]' is the index trie
+  // in the 'ti'th tiled dimension, and 'trie_path_nearest' are the generating integers used to
+  // descend it; 'trie_path_len' is the number of tiled dimensions for which the path is valid
+  const LT_IndexTrie *trie_path[tn + 1];
+  INT4 trie_path_nearest[tn + 1];
+  size_t trie_path_len = 0;
+  trie_path[0] = loc->index_trie;
+
+  // Find the nearest points in the lattice tiling to the points in 'nearest_points', in chunks
+  for ( size_t j0 = 0; j0 < num_points; j0 += LT_NEAREST_CHUNK_SIZE ) {
+    const size_t nj = GSL_MIN( LT_NEAREST_CHUNK_SIZE, num_points - j0 );
+
+    // If there are tiled dimensions, find the nearest points to 'nearest_points[:,j0:j0+nj]',
+    // the tiled dimensions of which are generating integers
+    INT4 nearest_int[tn * nj + 1];
     if ( tn > 0 ) {
+      XLAL_CHECK( LT_FindNearestLatticeInts( loc->tiling, nearest_points, j0, nj, nearest_int ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
 
-      // Find the nearest point to 'nearest_points[:,j]', the tiled dimensions of which are generating integers
-      switch ( loc->tiling->lattice ) {
-
-      case TILING_LATTICE_CUBIC:    // Cubic ( \f$ Z_n \f$ ) lattice
-
-      {
-
-        // Round each dimension of 'nearest_points[:,j]' to nearest integer to find the nearest point in Zn
-        feclearexcept( FE_ALL_EXCEPT );
-        for ( size_t ti = 0; ti < tn; ++ti ) {
-          const size_t i = loc->tiling->tiled_idx[ti];
-          nearest[i] = lround( gsl_matrix_get( nearest_points, i, j ) );
-        }
-        if ( fetestexcept( FE_INVALID ) != 0 ) {
-          XLALPrintError( "Rounding failed while finding nearest point #%zu:", j );
-          for ( size_t ti = 0; ti < tn; ++ti ) {
-            const size_t i = loc->tiling->tiled_idx[ti];
-            XLALPrintError( " %0.2e", gsl_matrix_get( nearest_points, i, j ) );
-          }
-          XLALPrintError( "\n" );
-          XLAL_ERROR( XLAL_EFAILED );
-        }
-
-      }
-      break;
-
-      case TILING_LATTICE_ANSTAR:   // An-star ( \f$ A_n^* \f$ ) lattice
-
-      {
-
-        // The nearest point algorithm used below embeds the An* lattice in tn+1 dimensions,
-        // however 'nearest_points[:,j]' has only 'tn' tiled dimensional. The algorithm is only
-        // sensitive to the differences between the 'ti'th and 'ti+1'th dimension, so we can
-        // freely set one of the dimensions to a constant value. We choose to set the 0th
-        // dimension to zero, i.e. the (tn+1)-dimensional lattice point is
-        //   y = (0, tiled dimensions of 'nearest_points[:,j]').
-        double y[tn + 1];
-        y[0] = 0;
-        for ( size_t ti = 0; ti < tn; ++ti ) {
-          const size_t i = loc->tiling->tiled_idx[ti];
-          y[ti + 1] = gsl_matrix_get( nearest_points, i, j );
-        }
-
-        // Find the nearest point in An* to the point 'y', using the O(tn) Algorithm 2 given in:
-        //   McKilliam et.al., "A linear-time nearest point algorithm for the lattice An*"
-        //   in "International Symposium on Information Theory and Its Applications", ISITA2008,
-        //   Auckland, New Zealand, 7-10 Dec. 2008. DOI: 10.1109/ISITA.2008.4895596
-        // Notes:
-        //   * Since Algorithm 2 uses 1-based arrays, we have to translate, e.g.:
-        //       z_t in paper <---> z[tn-1] in C code
-        //   * Line 6 in Algorithm 2 as written in the paper is in error, see correction below.
-        //   * We are only interested in 'k', the generating integers of the nearest point
-        //     'x = Q * k', therefore line 26 in Algorithm 2 is not included.
-        INT4 k[tn + 1];
-        {
-
-          // Lines 1--4, 20
-          double z[tn + 1], alpha = 0, beta = 0;
-          size_t bucket[tn + 1], link[tn + 1];
-          feclearexcept( FE_ALL_EXCEPT );
-          for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
-            k[ti - 1] = lround( y[ti - 1] ); // Line 20, moved here to avoid duplicate round
-            z[ti - 1] = y[ti - 1] - k[ti - 1];
-            alpha += z[ti - 1];
-            beta += z[ti - 1] * z[ti - 1];
-            bucket[ti - 1] = 0;
-          }
-          if ( fetestexcept( FE_INVALID ) != 0 ) {
-            XLALPrintError( "Rounding failed while finding nearest point #%zu:", j );
-            for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
-              XLALPrintError( " %0.2e", y[ti - 1] );
-            }
-            XLALPrintError( "\n" );
-            XLAL_ERROR( XLAL_EFAILED );
-          }
-
-          // Lines 5--8
-          // Notes:
-          //   * Correction to line 6, as as written in McKilliam et.al.:
-          //       ti = tn + 1 - (tn + 1)*floor(z_t + 0.5)
-          //     should instead read
-          //       ti = tn + 1 - floor((tn + 1)*(z_t + 0.5))
-          //   * We also convert the floor() operation into an lround():
-          //       ti = tn + 1 - lround((tn + 1)*(z_t + 0.5) - 0.5)
-          //     to avoid a casting operation. Rewriting the line as:
-          //       ti = lround((tn + 1)*(0.5 - z_t) + 0.5)
-          //     appears to improve numerical robustness in some cases.
-          //   * No floating-point exception checking needed for lround()
-          //     here since its argument will be of order 'tn'.
-          for ( size_t tt = 1; tt <= tn + 1; ++tt ) {
-            const INT4 ti = lround( ( tn + 1 ) * ( 0.5 - z[tt - 1] ) + 0.5 );
-            link[tt - 1] = bucket[ti - 1];
-            bucket[ti - 1] = tt;
-          }
-
-          // Lines 9--10
-          double D = beta - alpha * alpha / ( tn + 1 );
-          size_t tm = 0;
-
-          // Lines 11--19
-          for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
-            size_t tt = bucket[ti - 1];
-            while ( tt != 0 ) {
-              alpha = alpha - 1;
-              beta = beta - 2 * z[tt - 1] + 1;
-              tt = link[tt - 1];
-            }
-            double d = beta - alpha * alpha / ( tn + 1 );
-            if ( d < D ) {
-              D = d;
-              tm = ti;
-            }
-          }
-
-          // Lines 21--25
-          for ( size_t ti = 1; ti <= tm; ++ti ) {
-            size_t tt = bucket[ti - 1];
-            while ( tt != 0 ) {
-              k[tt - 1] = k[tt - 1] + 1;
-              tt = link[tt - 1];
-            }
-          }
-
-        }
-
-        // The nearest point in An* is the tn differences between k[1]...k[tn] and k[0]
-        for ( size_t ti = 0; ti < tn; ++ti ) {
-          const size_t i = loc->tiling->tiled_idx[ti];
-          nearest[i] = k[ti + 1] - k[0];
-        }
+    for ( size_t jj = 0; jj < nj; ++jj ) {
+      const size_t j = j0 + jj;
 
+      // Gather the tiled dimensions of the nearest point
+      INT4 nearest[n];
+      for ( size_t ti = 0; ti < tn; ++ti ) {
+        const size_t i = loc->tiling->tiled_idx[ti];
+        nearest[i] = nearest_int[ti * nj + jj];
       }
-      break;
 
-      default:
-        XLAL_ERROR( XLAL_EFAILED, "Invalid lattice" );
-      }
-
-      // Bound generating integers
+      // Bound generating integers, reusing the index trie path of the previous nearest point
+      // in those dimensions where the generating integers agree
       {
-        const LT_IndexTrie *trie = loc->index_trie;
         size_t ti = 0;
+        while ( ti < trie_path_len && nearest[loc->tiling->tiled_idx[ti]] == trie_path_nearest[ti] ) {
+          ++ti;
+        }
         while ( ti < tn ) {
           const size_t i = loc->tiling->tiled_idx[ti];
+          const LT_IndexTrie *trie = trie_path[ti];
 
           // If 'nearest[i]' is outside parameter-space bounds:
           if ( nearest[i] < trie->int_lower || nearest[i] > trie->int_upper ) {
@@ -715,63 +811,67 @@ static int LT_FindNearestPoints(
             LT_PollIndexTrie( loc->tiling, loc->index_trie, 0, &point_int_view.vector, poll_nearest, &poll_min_distance, nearest );
             XLAL_CHECK( fetestexcept( FE_INVALID ) == 0, XLAL_EFAILED, "Rounding failed while calling LT_PollIndexTrie() for nearest point #%zu", j );
 
-            // Reset 'trie', given that 'nearest' may have changed in any dimension
-            trie = loc->index_trie;
+            // Restart from the base of the index trie, given that 'nearest' may have changed in any dimension
             ti = 0;
             continue;
 
           }
 
-          // If we are below the highest dimension, jump to the next dimension based on 'nearest[i]'
+          // Record 'nearest[i]' in the index trie path, and if we are below the highest dimension,
+          // jump to the next dimension based on 'nearest[i]'
+          trie_path_nearest[ti] = nearest[i];
           if ( ti + 1 < tn ) {
-            trie = &trie->next[nearest[i] - trie->int_lower];
+            trie_path[ti + 1] = &trie->next[nearest[i] - trie->int_lower];
           }
 
           ++ti;
 
         }
+        trie_path_len = tn;
       }
 
-    }
-
-    // Return various outputs
-    {
-      const LT_IndexTrie *trie = loc->index_trie;
-      UINT8 nearest_index = 0;
-      for ( size_t ti = 0, i = 0; i < n; ++i ) {
-        const bool is_tiled = loc->tiling->bounds[i].is_tiled;
-
-        // Return nearest point
-        if ( is_tiled ) {
-          gsl_matrix_set( nearest_points, i, j, nearest[i] );
-        }
+      // Return various outputs
+      {
+        UINT8 nearest_index = 0;
+        for ( size_t ti = 0, i = 0; i < n; ++i ) {
+          const bool is_tiled = loc->tiling->bounds[i].is_tiled;
+          const LT_IndexTrie *trie = is_tiled ? trie_path[ti] : NULL;
+
+          // Return nearest point
+          if ( is_tiled ) {
+            gsl_matrix_set( nearest_points, i, j, nearest[i] );
+          }
 
-        // Return sequential indexes of nearest point
-        // - Non-tiled dimensions inherit value of next-lowest dimension
-        if ( is_tiled ) {
-          nearest_index = trie->index + nearest[i] - trie->int_lower;
-        }
-        if ( nearest_indexes != NULL ) {
-          nearest_indexes->data[n * j + i] = nearest_index;
-        }
+          // Return sequential index of nearest point in dimension 'block_dim-1', and indexes of
+          // left/right-most points in block in dimension 'block_dim' relative to nearest point
+          if ( i == block_dim ) {
+            if ( nearest_block_index != NULL ) {
+              nearest_block_index[j] = nearest_index;
+            }
+            if ( nearest_left != NULL ) {
+              nearest_left[j] = is_tiled ? trie->int_lower - nearest[i] : 0;
+            }
+            if ( nearest_right != NULL ) {
+              nearest_right[j] = is_tiled ? trie->int_upper - nearest[i] : 0;
+            }
+          }
 
-        // Return indexes of left/right-most points in block relative to nearest point
-        if ( nearest_lefts != NULL ) {
-          nearest_lefts->data[n * j + i] = is_tiled ? trie->int_lower - nearest[i] : 0;
-        }
-        if ( nearest_rights != NULL ) {
-          nearest_rights->data[n * j + i] = is_tiled ? trie->int_upper - nearest[i] : 0;
-        }
+          // Return sequential indexes of nearest point
+          // - Non-tiled dimensions inherit value of next-lowest dimension
+          if ( is_tiled ) {
+            nearest_index = trie->index + nearest[i] - trie->int_lower;
+          }
+          if ( nearest_indexes != NULL ) {
+            nearest_indexes->data[n * j + i] = nearest_index;
+          }
 
-        // If we are below the highest dimension, jump to the next dimension based on 'nearest[i]'
-        if ( is_tiled ) {
-          if ( ti + 1 < tn ) {
-            trie = &trie->next[nearest[i] - trie->int_lower];
+          if ( is_tiled ) {
+            ++ti;
           }
-          ++ti;
-        }
 
+        }
       }
+
     }
 
   }
@@ -2547,7 +2647,7 @@ int XLALNearestLatticeTilingPoint(
 
   // Call LT_FindNearestPoints()
   gsl_vector_memcpy( local_point, point );
-  XLAL_CHECK( LT_FindNearestPoints( loc, local_points, local_nearest_points, nearest_indexes_ptr, NULL, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( LT_FindNearestPoints( loc, local_points, local_nearest_points, nearest_indexes_ptr, 0, NULL, NULL, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
   if ( nearest_point != NULL ) {
     gsl_vector_memcpy( nearest_point, local_nearest_point );
   }
@@ -2601,7 +2701,7 @@ int XLALNearestLatticeTilingPoints(
   UINT8VectorSequence *nearest_indexes_view = ( nearest_indexes != NULL ) ? *nearest_indexes : NULL;
 
   // Call LT_FindNearestPoints()
-  XLAL_CHECK( LT_FindNearestPoints( loc, points, &nearest_points_view.matrix, nearest_indexes_view, NULL, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( LT_FindNearestPoints( loc, points, &nearest_points_view.matrix, nearest_indexes_view, 0, NULL, NULL, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   return XLAL_SUCCESS;
 
@@ -2645,21 +2745,76 @@ int XLALNearestLatticeTilingBlock(
   gsl_vector *local_nearest_point = &local_nearest_point_vector.vector;
   gsl_matrix *local_nearest_points = &local_nearest_point_matrix.matrix;
 
-  // Create local vectors for sequential indexes and number of left/right points
-  UINT8 nearest_indexes_data[n];
-  UINT8VectorSequence nearest_indexes = { .length = 1, .vectorLength = n, .data = &nearest_indexes_data[0] };
-  INT4 nearest_lefts_data[n];
-  INT4VectorSequence nearest_lefts = { .length = 1, .vectorLength = n, .data = &nearest_lefts_data[0] };
-  INT4 nearest_rights_data[n];
-  INT4VectorSequence nearest_rights = { .length = 1, .vectorLength = n, .data = &nearest_rights_data[0] };
-
   // Call LT_FindNearestPoints()
   gsl_vector_memcpy( local_point, point );
-  XLAL_CHECK( LT_FindNearestPoints( loc, local_points, local_nearest_points, &nearest_indexes, &nearest_lefts, &nearest_rights ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( LT_FindNearestPoints( loc, local_points, local_nearest_points, NULL, dim, nearest_index, nearest_left, nearest_right ) == XLAL_SUCCESS, XLAL_EFUNC );
   gsl_vector_memcpy( nearest_point, local_nearest_point );
-  *nearest_index = ( dim > 0 ) ? nearest_indexes_data[dim - 1] : 0;
-  *nearest_left = nearest_lefts_data[dim];
-  *nearest_right = nearest_rights_data[dim];
+
+  return XLAL_SUCCESS;
+
+}
+
+int XLALNearestLatticeTilingBlocks(
+  const LatticeTilingLocator *loc,
+  const gsl_matrix *points,
+  const size_t dim,
+  gsl_matrix **nearest_points,
+  UINT8Vector **nearest_index,
+  INT4Vector **nearest_left,
+  INT4Vector **nearest_right
+)
+{
+
+  // Check input
+  XLAL_CHECK( loc != NULL, XLAL_EFAULT );
+  XLAL_CHECK( points != NULL, XLAL_EFAULT );
+  XLAL_CHECK( points->size1 == loc->ndim, XLAL_EINVAL );
+  XLAL_CHECK( dim < loc->ndim, XLAL_EINVAL );
+  XLAL_CHECK( nearest_points != NULL, XLAL_EFAULT );
+  XLAL_CHECK( nearest_index != NULL, XLAL_EFAULT );
+  XLAL_CHECK( nearest_left != NULL, XLAL_EFAULT );
+  XLAL_CHECK( nearest_right != NULL, XLAL_EFAULT );
+
+  const size_t n = loc->ndim;
+  const size_t num_points = points->size2;
+
+  // Return if there are no points; the vector outputs are resized to zero length, i.e. destroyed
+  if ( num_points == 0 ) {
+    XLALDestroyUINT8Vector( *nearest_index );
+    *nearest_index = NULL;
+    XLALDestroyINT4Vector( *nearest_left );
+    *nearest_left = NULL;
+    XLALDestroyINT4Vector( *nearest_right );
+    *nearest_right = NULL;
+    return XLAL_SUCCESS;
+  }
+
+  // Resize or allocate nearest points matrix, if required, and create view of correct size
+  if ( *nearest_points != NULL ) {
+    if ( ( *nearest_points )->size1 != n || ( *nearest_points )->size2 < num_points ) {
+      GFMAT( *nearest_points );
+      *nearest_points = NULL;
+    }
+  }
+  if ( *nearest_points == NULL ) {
+    GAMAT( *nearest_points, n, num_points );
+  }
+  gsl_matrix_view nearest_points_view = gsl_matrix_submatrix( *nearest_points, 0, 0, n, num_points );
+
+  // Resize or allocate nearest sequential index and left/right-most point vectors
+  // - On failure, the vectors are left with the caller, and remain valid to destroy
+  UINT8Vector *nearest_index_resized = XLALResizeUINT8Vector( *nearest_index, num_points );
+  XLAL_CHECK( nearest_index_resized != NULL, XLAL_ENOMEM );
+  *nearest_index = nearest_index_resized;
+  INT4Vector *nearest_left_resized = XLALResizeINT4Vector( *nearest_left, num_points );
+  XLAL_CHECK( nearest_left_resized != NULL, XLAL_ENOMEM );
+  *nearest_left = nearest_left_resized;
+  INT4Vector *nearest_right_resized = XLALResizeINT4Vector( *nearest_right, num_points );
+  XLAL_CHECK( nearest_right_resized != NULL, XLAL_ENOMEM );
+  *nearest_right = nearest_right_resized;
+
+  // Call LT_FindNearestPoints(), which fills the outputs directly
+  XLAL_CHECK( LT_FindNearestPoints( loc, points, &nearest_points_view.matrix, NULL, dim, ( *nearest_index )->data, ( *nearest_left )->data, ( *nearest_right )->data ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   return XLAL_SUCCESS;
 
@@ -470,6 +470,8 @@ int XLALRestoreLatticeTilingIterator(
 
 ///
 /// Create a new lattice tiling locator. If there are tiled dimensions, an index trie is internally built.
+/// The locator is not modified by XLALNearestLatticeTiling{Point|Points|Block|Blocks}(), which may
+/// therefore be called concurrently from multiple threads with the same locator.
 ///
 #ifdef SWIG // SWIG interface directives
 SWIGLAL( RETURN_OWNED_BY_1ST_ARG( int, XLALCreateLatticeTilingLocator ) );
@@ -529,6 +531,30 @@ int XLALNearestLatticeTilingBlock(
   INT4 *nearest_right                   ///< [out] Index of right-most point of block relative to nearest point
 );
 
+///
+/// Locate the nearest blocks in a lattice tiling to a given set of points. This is the batched
+/// equivalent of XLALNearestLatticeTilingBlock(): return the nearest points in \c nearest_points,
+/// and for each point the unique sequential index in dimension <tt>dim-1</tt> in \c nearest_index,
+/// and the indexes of the left-most \c nearest_left and right-most \c nearest_right points in the
+/// nearest block, relative to the nearest point. Outputs are dynamically resized as required; if
+/// \c points has no columns, the vector outputs are resized to zero length, i.e. destroyed.
+/// Locating many points in one call is faster, particularly if nearby points are adjacent.
+///
+#ifdef SWIG // SWIG interface directives
+SWIGLAL( INOUT_STRUCTS( gsl_matrix **, nearest_points ) );
+SWIGLAL( INOUT_STRUCTS( UINT8Vector **, nearest_index ) );
+SWIGLAL( INOUT_STRUCTS( INT4Vector **, nearest_left, nearest_right ) );
+#endif
+int XLALNearestLatticeTilingBlocks(
+  const LatticeTilingLocator *loc,      ///< [in] Lattice tiling locator
+  const gsl_matrix *points,             ///< [in] Columns are set of points for which to find nearest points
+  const size_t dim,                     ///< [in] Dimension for which to return indexes
+  gsl_matrix **nearest_points,          ///< [out] Columns are the corresponding nearest points
+  UINT8Vector **nearest_index,          ///< [out] Unique sequential indexes of the nearest points in <tt>dim-1</tt>
+  INT4Vector **nearest_left,            ///< [out] Indexes of left-most points of blocks relative to nearest points
+  INT4Vector **nearest_right            ///< [out] Indexes of right-most points of blocks relative to nearest points
+);
+
 ///
 /// Print the internal index trie of a lattice tiling locator to the given file pointer.
 ///
@@ -23,11 +23,14 @@
 #include <lal/UserInputParse.h>
 
 #include <lal/LineRobustStats.h>
+#include <lal/VectorMath.h>
 
 
 //---------- local DEFINES ----------
+#define BSGL_BLOCK_LEN 256	// number of bins processed per block by XLALVectorComputeBSGL()
 
 //----- Macros -----
+#define MYMIN(x,y) ( (x) < (y) ? (x) : (y) )
 
 // ---------- internal types ----------
 // ----- module-internal global variables ----------
@@ -182,6 +185,30 @@ XLALVectorComputeBSGL ( REAL4 *outBSGL,					//!< [out] pre-allocated output vect
 {
   XLAL_CHECK ( (outBSGL != NULL) && (twoF != NULL) && (twoFPerDet != NULL) && (setup != NULL) && (len >= 1), XLAL_EINVAL );
 
+  if ( !setup->useLogCorrection )
+    {
+      // without log-correction, BSGL = ( F - max(C, FX + ln(pLtL_X)) ) * log10(e) is computed
+      // blockwise with vector functions, to make use of SIMD instructions where available
+      REAL4 FpMax[BSGL_BLOCK_LEN], Xterm[BSGL_BLOCK_LEN];
+      for ( UINT4 i0 = 0; i0 < len; i0 += BSGL_BLOCK_LEN )
+        {
+          const UINT4 n = MYMIN ( BSGL_BLOCK_LEN, len - i0 );
+          for ( UINT4 i = 0; i < n; i ++ ) {
+            FpMax[i] = setup->C;
+          }
+          for ( UINT4 X = 0; X < setup->numDetectors; X ++ )
+            {
+              XLAL_CHECK ( XLALVectorScaleREAL4 ( Xterm, 0.5f, twoFPerDet[X] + i0, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+              XLAL_CHECK ( XLALVectorShiftREAL4 ( Xterm, setup->ln_pLtL_X[X], Xterm, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+              XLAL_CHECK ( XLALVectorMaxREAL4 ( FpMax, FpMax, Xterm, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+            }
+          XLAL_CHECK ( XLALVectorScaleREAL4 ( outBSGL + i0, 0.5f, twoF + i0, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK ( XLALVectorSubREAL4 ( outBSGL + i0, outBSGL + i0, FpMax, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK ( XLALVectorScaleREAL4 ( outBSGL + i0, (REAL4)LAL_LOG10E, outBSGL + i0, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+        } // for i0 < len
+      return XLAL_SUCCESS;
+    } // if !useLogCorrection
+
   for ( UINT4 i = 0; i < len; i ++ )
     {
       // --------------------------------------------------
@@ -166,6 +166,8 @@ void LALHOUGHPeak2PHMD (LALStatus    *status,
 			HOUGHPeakGram *pg
 			);
 
+int XLALHOUGHPeak2PHMD( HOUGHphmd *phmd, HOUGHptfLUT *lut, HOUGHPeakGram *pg );
+
 /** @} */
 #ifdef  __cplusplus
 }                /* Close C++ protection */
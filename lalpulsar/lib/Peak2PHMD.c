@@ -26,6 +26,7 @@
 */
 
 #include <lal/PHMD.h>
+#include <lal/LALStdio.h>
 
 
 /**
@@ -64,238 +65,145 @@ void LALHOUGHPeak2PHMD (LALStatus    *status,
 			HOUGHPeakGram *pg)  /* peakgram */
 {
 
-  INT2    i,j;
-  UCHAR   *column1P;
-  INT4    fBinDif,shiftPeak,minPeakBin,maxPeakBin,thisPeak;
-  INT2    relatIndex;
-  UINT4   lengthLeft,lengthRight,n, searchIndex;
-  UINT8   firstBin,lastBin,pgI,pgF;
+  INT4    fBinDif;
+  UINT8   firstBin,lastBin;
   /* --------------------------------------------- */
 
   INITSTATUS(status);
-  ATTATCHSTATUSPTR (status);
 
-/**
- * lots of error checking of arguments -- asserts have been
- * replaced by aborts
- */
+  /* the arguments are checked here, as well as by XLALHOUGHPeak2PHMD(), to keep the LAL error codes */
 
   /*   Make sure the arguments are not NULL: */
-  if (phmd == NULL) {
-    /* fprintf(stderr,"null pointer found [Peak2PHMD.c %d]\n", __LINE__); */
-    ABORT( status, PHMDH_ENULL, PHMDH_MSGENULL);
-  }
-  /* ASSERT (phmd, status, PHMDH_ENULL, PHMDH_MSGENULL); */
-
-  if (lut == NULL) {
-    /* fprintf(stderr,"null pointer found [Peak2PHMD.c %d]\n", __LINE__); */
+  if (phmd == NULL || lut == NULL || lut->border == NULL || pg == NULL || phmd->firstColumn == NULL) {
     ABORT( status, PHMDH_ENULL, PHMDH_MSGENULL);
   }
-  /* ASSERT (lut,  status, PHMDH_ENULL, PHMDH_MSGENULL); */
-
-  if (lut->border == NULL) {
-    ABORT( status, PHMDH_ENULL, PHMDH_MSGENULL);
-  }
-
-  if (pg == NULL) {
-    /* fprintf(stderr,"null pointer found [Peak2PHMD.c %d]\n", __LINE__); */
-    ABORT( status, PHMDH_ENULL, PHMDH_MSGENULL);
-  }
-  /* ASSERT (pg,   status, PHMDH_ENULL, PHMDH_MSGENULL); */
-
-  if (phmd->firstColumn == NULL) {
-    /* fprintf(stderr,"null pointer found [Peak2PHMD.c %d]\n", __LINE__); */
-    ABORT( status, PHMDH_ENULL, PHMDH_MSGENULL);
-  }
-  /* ASSERT (phmd->firstColumn, status, PHMDH_ENULL, PHMDH_MSGENULL); */
 
   /*  Make sure there are elements in firstColumn */
   if (phmd->ySide == 0) {
-    /* fprintf(stderr,"phmd->ySide should be non-zero [Peak2PHMD.c %d]\n", __LINE__); */
     ABORT( status, PHMDH_ESIZE, PHMDH_MSGESIZE);
   }
-  /* ASSERT (phmd->ySide, status, PHMDH_ESIZE, PHMDH_MSGESIZE); */
 
   /* Make sure peakgram and lut have same frequency discretization */
   if ( fabs((REAL4)lut->deltaF - (REAL4)pg->deltaF) > 1.0e-6) {
     ABORT( status, PHMDH_EVAL, PHMDH_MSGEVAL);
   }
-  /* ASSERT ( fabs((REAL4)lut->deltaF - (REAL4)pg->deltaF) < 1.0e-6,  status, PHMDH_EVAL, PHMDH_MSGEVAL); */
 
   /* Make sure phmd.fBin and lut are compatible */
   /* case to "long long" to be expected type for llabs() */
   fBinDif = llabs( (long long)( (phmd->fBin) - (lut->f0Bin) ));
   if ( fBinDif > lut->nFreqValid ) {
-    /* fprintf(stderr,"fBinDif > nFreqValid [Peak2PHMD.c %d]\n", __LINE__); */
     ABORT( status, PHMDH_EFREQ, PHMDH_MSGEFREQ);
   }
-  /* ASSERT (fBinDif < lut->nFreqValid, status, PHMDH_EFREQ, PHMDH_MSGEFREQ); */
-
 
-  pgI = pg->fBinIni;
-  pgF = pg->fBinFin;
-  /* bounds of interval to look at in the peakgram */
+  /* Make sure peakgram f-interval and phmd.fBin+lut are compatible */
   firstBin = (phmd->fBin) + (lut->iniBin) + (lut->offset);
   lastBin  = firstBin + (lut->nBin)-1;
-
-  /* Make sure peakgram f-interval and phmd.fBin+lut are compatible */
-  /*   ASSERT ( pgI <= firstBin, status, PHMDH_EINT, PHMDH_MSGEINT); */
-  /*   ASSERT ( pgF >= lastBin,  status, PHMDH_EINT, PHMDH_MSGEINT); */
-  if (  pgI > firstBin ) {
+  if ( pg->fBinIni > firstBin || pg->fBinFin < lastBin ) {
     ABORT( status, PHMDH_EINT, PHMDH_MSGEINT);
   }
-  if (  pgF < lastBin ) {
-    ABORT( status, PHMDH_EINT, PHMDH_MSGEINT);
-  }
-
 
-  /* -------------------------------------------------------------------   */
-  /* initialization */
-  /* -------------------------------------------------------------------   */
-  n= pg->length;
-
-  lengthLeft = 0;
-  lengthRight= 0;
-
-  column1P = &(phmd->firstColumn[0]);
-
-  for(i=0; i< phmd->ySide; ++i ){
-    *column1P = 0;
-    ++column1P;
+  if ( XLALHOUGHPeak2PHMD( phmd, lut, pg ) != XLAL_SUCCESS ) {
+    ABORTXLAL( status );
   }
 
-  minPeakBin = firstBin - pgI;
-  maxPeakBin =  lastBin - pgI;
-
- /* -------------------------------------------------------------------   */
-         /* -------------------------------------------   */
-  if(n){  /* only if there are peaks present */
-         /* -------------------------------------------   */
-    INT2   lb1,rb1,lb2,rb2;
-    INT2   max1,min1,max2,min2;
-    INT2   nBinPos;
-    UCHAR  test1;
+  /* normal exit */
+  RETURN (status);
+}
 
-    nBinPos = (lut->iniBin) + (lut->nBin) -1;
-    shiftPeak = pgI - (phmd->fBin) - (lut->offset);
 
-   /* -------------------------------------------------------------------   */
-   /* searching for the initial peak to look at */
-   /* -------------------------------------------------------------------   */
+/**
+ * \brief XLAL version of LALHOUGHPeak2PHMD().
+ * \ingroup PHMD_h
+ *
+ * Produces the \c phmd at frequency bin <tt>phmd->fBin</tt> for the given peak-gram and
+ * look-up-table; LALHOUGHPeak2PHMD() is a wrapper around this function. The function only reads
+ * \c lut and \c pg, so may be called for different \c phmd from several threads at once.
+ */
+int XLALHOUGHPeak2PHMD( HOUGHphmd *phmd, HOUGHptfLUT *lut, HOUGHPeakGram *pg )
+{
 
-    searchIndex = (n * minPeakBin ) /(pgF-pgI+1);
-    if (searchIndex >= n) { searchIndex = n-1;}
+  /* check input */
+  XLAL_CHECK( phmd != NULL, XLAL_EFAULT );
+  XLAL_CHECK( lut != NULL && lut->border != NULL, XLAL_EFAULT );
+  XLAL_CHECK( pg != NULL, XLAL_EFAULT );
+  XLAL_CHECK( phmd->firstColumn != NULL, XLAL_EFAULT );
+  XLAL_CHECK( phmd->ySide > 0, XLAL_EINVAL, "phmd->ySide should be non-zero" );
+  XLAL_CHECK( fabs( (REAL4)lut->deltaF - (REAL4)pg->deltaF ) <= 1.0e-6, XLAL_EINVAL, "peakgram and lut have different frequency resolutions" );
 
-    /* moving backwards */
-    /* -----------------*/
+  /* make sure phmd->fBin and lut are compatible */
+  const INT8 fBinDif = llabs( (long long)( phmd->fBin - lut->f0Bin ) );
+  XLAL_CHECK( fBinDif <= lut->nFreqValid, XLAL_EDOM, "frequency bin %" LAL_UINT8_FORMAT " outside validity of lut", phmd->fBin );
 
-    test1=1;
-    while (searchIndex >0 && test1) {
-      if ( pg->peak[searchIndex -1] >=  minPeakBin ) {
-        --searchIndex;
-      }
-      else {
-        test1=0;
-      }
+  /* bounds of interval to look at in the peakgram */
+  const UINT8 pgI = pg->fBinIni;
+  const UINT8 pgF = pg->fBinFin;
+  const UINT8 firstBin = phmd->fBin + lut->iniBin + lut->offset;
+  const UINT8 lastBin  = firstBin + lut->nBin - 1;
+  XLAL_CHECK( pgI <= firstBin && pgF >= lastBin, XLAL_EDOM, "peakgram does not cover the frequency interval of the phmd" );
+
+  const UINT4 n = pg->length;
+  const INT4 minPeakBin = firstBin - pgI;
+  const INT4 maxPeakBin = lastBin - pgI;
+  UINT4 lengthLeft = 0, lengthRight = 0;
+
+  memset( phmd->firstColumn, 0, phmd->ySide * sizeof( phmd->firstColumn[0] ) );
+
+  if ( n > 0 ) { /* only if there are peaks present */
+    const INT4 nBinPos = lut->iniBin + lut->nBin - 1;
+    const INT4 shiftPeak = pgI - phmd->fBin - lut->offset;
+
+    /* search for the initial peak to look at, first moving backwards and then forwards */
+    UINT4 searchIndex = ( n * minPeakBin ) / ( pgF - pgI + 1 );
+    if ( searchIndex >= n ) {
+      searchIndex = n - 1;
     }
-
-    /* moving forwards */
-    /* -----------------*/
-
-    test1=1;
-    while (searchIndex < n-1  && test1) {
-      if ( pg->peak[searchIndex] <  minPeakBin ) {
-        ++searchIndex;
-      }
-      else {
-        test1=0;
-      }
+    while ( searchIndex > 0 && pg->peak[searchIndex - 1] >= minPeakBin ) {
+      --searchIndex;
+    }
+    while ( searchIndex < n - 1 && pg->peak[searchIndex] < minPeakBin ) {
+      ++searchIndex;
     }
 
-    /* -------------------------------------------------------------------   */
     /* for all the interesting peaks (or none) */
-    /* -------------------------------------------------------------------   */
-
-    test1=1;
-
-    while (searchIndex < n  && test1) {
-      thisPeak = pg->peak[searchIndex];
-
-      if (thisPeak > maxPeakBin) {
-        test1=0;
-      } else {
-        if ( thisPeak >= minPeakBin) { /* we got a peak */
-	  /* relative Index */
-	  relatIndex = thisPeak + shiftPeak;
-
-	  i = relatIndex;
-	  if( relatIndex < 0 )  i =  nBinPos - relatIndex;
-
-
-	  if ( i >= lut->nBin ) {
-	    fprintf(stderr,"current index i=%d not lesser than nBin=%d\n [Peak2PHMD.c %d]\n", i,lut->nBin, __LINE__);
-	  }
-
-
-	  /* Reading the bin information */
-	  lb1 = lut->bin[i].leftB1;
-	  rb1 = lut->bin[i].rightB1;
-	  lb2 = lut->bin[i].leftB2;
-	  rb2 = lut->bin[i].rightB2;
-
-	  max1 = lut->bin[i].piece1max;
-	  min1 = lut->bin[i].piece1min;
-	  max2 = lut->bin[i].piece2max;
-	  min2 = lut->bin[i].piece2min;
-
-	  /* border selection from lut */
-
-	  if(lb1){
-	    phmd->leftBorderP[lengthLeft] = &( lut->border[lb1] );
-	    ++lengthLeft;
-	  }
-
-
-	  if(lb2){
-	    phmd->leftBorderP[lengthLeft] = &( lut->border[lb2] );
-	    ++lengthLeft;
-	  }
-
-	  if(rb1){
-	    phmd->rightBorderP[lengthRight] = &( lut->border[rb1] );
-	    ++lengthRight;
-	  }
-
-	  if(rb2){
-	    phmd->rightBorderP[lengthRight] = &( lut->border[rb2] );
-	    ++lengthRight;
-	  }
-
-	  /* correcting 1st column */
-	  for(j=min1; j<=max1; ++j) {
-	    phmd->firstColumn[j] = 1;
-	  }
+    for ( ; searchIndex < n && pg->peak[searchIndex] <= maxPeakBin; ++searchIndex ) {
+      const INT4 thisPeak = pg->peak[searchIndex];
+      if ( thisPeak < minPeakBin ) {
+        continue;
+      }
 
-	  for(j=min2; j<=max2; ++j) {
-	    phmd->firstColumn[j] = 1;
-	  }
+      /* relative index */
+      const INT4 relatIndex = thisPeak + shiftPeak;
+      const INT4 i = ( relatIndex < 0 ) ? nBinPos - relatIndex : relatIndex;
+      XLAL_CHECK( i < lut->nBin, XLAL_EFAILED, "current index i=%d not lesser than nBin=%d", i, lut->nBin );
 
-	}
-        ++searchIndex;
+      /* border selection from lut */
+      const HOUGHBin2Border *bin = &lut->bin[i];
+      if ( bin->leftB1 ) {
+        phmd->leftBorderP[lengthLeft++] = &lut->border[bin->leftB1];
+      }
+      if ( bin->leftB2 ) {
+        phmd->leftBorderP[lengthLeft++] = &lut->border[bin->leftB2];
+      }
+      if ( bin->rightB1 ) {
+        phmd->rightBorderP[lengthRight++] = &lut->border[bin->rightB1];
+      }
+      if ( bin->rightB2 ) {
+        phmd->rightBorderP[lengthRight++] = &lut->border[bin->rightB2];
       }
-      /* -------------------------------------------------------------------   */
 
+      /* correcting 1st column */
+      for ( INT4 j = bin->piece1min; j <= bin->piece1max; ++j ) {
+        phmd->firstColumn[j] = 1;
+      }
+      for ( INT4 j = bin->piece2min; j <= bin->piece2max; ++j ) {
+        phmd->firstColumn[j] = 1;
+      }
     }
   }
 
-  /* -------------------------------------------------------------------   */
-
   phmd->lengthLeft = lengthLeft;
-  phmd->lengthRight= lengthRight;
-  /* -------------------------------------------   */
+  phmd->lengthRight = lengthRight;
 
-  DETATCHSTATUSPTR (status);
+  return XLAL_SUCCESS;
 
-  /* normal exit */
-  RETURN (status);
 }
@@ -29,6 +29,7 @@
 #define USE_ALIGNED_MEMORY_ROUTINES
 #define TRUE (1==1)
 #define FALSE (1==0)
+#define CROSSCORR_PAIR_BLOCK 4096 /* number of SFT pairs summed per block in XLALCalculatePulsarCrossCorrStatistic() */
 
 
 // ----- local prototypes ----------
@@ -1075,81 +1076,113 @@ int XLALCalculatePulsarCrossCorrStatistic
     XLALPrintError("Lengths of pair-indexed lists don't match!");
     XLAL_ERROR(XLAL_EBADLEN );
   }
-  REAL8 nume = 0;
-  REAL8 curlyGSqr = 0;
   *ccStat = 0.0;
   *evSquared = 0.0;
+
+  /* The double sum over bins j, k of each pair alpha factorizes as
+   *   sum_{j,k} (-1)^(k1+j-k2-k) sinc1_j sinc2_k Re[ G_alpha conj(data1_j) data2_k ]
+   *     = (-1)^(k1-k2) Re[ G_alpha conj(A1) A2 ]
+   * with the per-SFT alternating sums A = sum_j (-1)^j sinc_j data_j, and likewise
+   * sum_{j,k} (sinc1_j sinc2_k)^2 = S1 S2 with S = sum_j sinc_j^2.  These are
+   * computed once per SFT, so that the loop over pairs only reads the compact
+   * per-SFT arrays instead of the SFT bins scattered across inputSFTs. */
+  COMPLEX16 *sftSum = XLALMalloc( numSFTs * sizeof( *sftSum ) );
+  REAL8 *sftSincSqr = XLALMalloc( numSFTs * sizeof( *sftSincSqr ) );
+  COMPLEX8 **sftData = XLALMalloc( numSFTs * sizeof( *sftData ) );
+  const UINT4 numBlocks = ( numPairs + CROSSCORR_PAIR_BLOCK - 1 ) / CROSSCORR_PAIR_BLOCK;
+  REAL8 *blockNume = XLALCalloc( numBlocks + 1, sizeof( *blockNume ) );
+  REAL8 *blockCurlyGSqr = XLALCalloc( numBlocks + 1, sizeof( *blockCurlyGSqr ) );
+  if ( sftSum == NULL || sftSincSqr == NULL || sftData == NULL || blockNume == NULL || blockCurlyGSqr == NULL ) {
+    XLALFree( sftSum );
+    XLALFree( sftSincSqr );
+    XLALFree( sftData );
+    XLALFree( blockNume );
+    XLALFree( blockCurlyGSqr );
+    XLAL_ERROR( XLAL_ENOMEM );
+  }
+
+  /* locate the bins of each SFT; SFTs whose bins are out of range are only an error if they are part of a pair */
+  for (UINT4 n = 0; n < numSFTs; n++) {
+    sftData[n] = NULL;
+    UINT4 detInd = sftIndices->data[n].detInd;
+    UINT4 sftInd = sftIndices->data[n].sftInd;
+    if ( detInd < inputSFTs->length && sftInd < inputSFTs->data[detInd]->length
+         && ( lowestBins->data[n] + numBins - 1 ) < inputSFTs->data[detInd]->data[sftInd].data->length ) {
+      sftData[n] = inputSFTs->data[detInd]->data[sftInd].data->data + lowestBins->data[n];
+    }
+  }
+
   for (UINT4 alpha = 0; alpha < numPairs; alpha++) {
     UINT4 sftNum1 = sftPairs->data[alpha].sftNum[0];
     UINT4 sftNum2 = sftPairs->data[alpha].sftNum[1];
-
-    XLAL_CHECK ( ( sftNum1 < numSFTs ) && ( sftNum2 < numSFTs ),
-		 XLAL_EINVAL,
-		 "SFT pair asked for SFT index off end of list:\n alpha=%"LAL_UINT4_FORMAT", sftNum1=%"LAL_UINT4_FORMAT", sftNum2=%"LAL_UINT4_FORMAT", numSFTs=%"LAL_UINT4_FORMAT"\n",
-		 alpha,  sftNum1, sftNum2, numSFTs );
-
-    UINT4 detInd1 = sftIndices->data[sftNum1].detInd;
-    UINT4 detInd2 = sftIndices->data[sftNum2].detInd;
-
-    XLAL_CHECK ( ( detInd1 < inputSFTs->length )
-		 && ( detInd2 < inputSFTs->length ),
-		 XLAL_EINVAL,
-		 "SFT asked for detector index off end of list:\n sftNum1=%"LAL_UINT4_FORMAT", sftNum2=%"LAL_UINT4_FORMAT", detInd1=%"LAL_UINT4_FORMAT", detInd2=%"LAL_UINT4_FORMAT", inputSFTs->length=%d\n",
-		 sftNum1, sftNum2, detInd1, detInd2, inputSFTs->length );
-
-    UINT4 sftInd1 = sftIndices->data[sftNum1].sftInd;
-    UINT4 sftInd2 = sftIndices->data[sftNum2].sftInd;
-
-    XLAL_CHECK ( ( sftInd1 < inputSFTs->data[detInd1]->length )
-		 && ( sftInd2 < inputSFTs->data[detInd2]->length ),
-		 XLAL_EINVAL,
-		 "SFT asked for SFT index off end of list:\n sftNum1=%"LAL_UINT4_FORMAT", sftNum2=%"LAL_UINT4_FORMAT", detInd1=%"LAL_UINT4_FORMAT", detInd2=%"LAL_UINT4_FORMAT", sftInd1=%"LAL_UINT4_FORMAT", sftInd2=%"LAL_UINT4_FORMAT", inputSFTs->data[detInd1]->length=%d, inputSFTs->data[detInd2]->length=%d\n",
-		 sftNum1, sftNum2, detInd1, detInd2, sftInd1, sftInd2,
-		 inputSFTs->data[detInd1]->length,
-		 inputSFTs->data[detInd2]->length );
-
-    COMPLEX8 *dataArray1 = inputSFTs->data[detInd1]->data[sftInd1].data->data;
-    COMPLEX8 *dataArray2 = inputSFTs->data[detInd2]->data[sftInd2].data->data;
-    UINT4 lenDataArray1 = inputSFTs->data[detInd1]->data[sftInd1].data->length;
-    UINT4 lenDataArray2 = inputSFTs->data[detInd2]->data[sftInd2].data->length;
-    COMPLEX8 GalphaCC = curlyGAmp->data[alpha]
-      * expSignalPhases->data[sftNum1]
-      * conj( expSignalPhases->data[sftNum2] );
-    INT4 baseCCSign = 1; /* Alternating sign is (-1)**(k1-k2) */
-    if ( ( (lowestBins->data[sftNum1]-lowestBins->data[sftNum2]) % 2) != 0 ) {
-      baseCCSign = -1;
+    if ( ( sftNum1 >= numSFTs ) || ( sftNum2 >= numSFTs ) ) {
+      XLALPrintError( "SFT pair asked for SFT index off end of list:\n alpha=%"LAL_UINT4_FORMAT", sftNum1=%"LAL_UINT4_FORMAT", sftNum2=%"LAL_UINT4_FORMAT", numSFTs=%"LAL_UINT4_FORMAT"\n",
+                      alpha,  sftNum1, sftNum2, numSFTs );
+      goto failed;
+    }
+    if ( sftData[sftNum1] == NULL || sftData[sftNum2] == NULL ) {
+      XLALPrintError( "SFT pair alpha=%"LAL_UINT4_FORMAT" (sftNum1=%"LAL_UINT4_FORMAT", sftNum2=%"LAL_UINT4_FORMAT") asked for detector, SFT or bin index off end of list (lowestBin1=%d, lowestBin2=%d, numBins=%d)\n",
+                      alpha, sftNum1, sftNum2, lowestBins->data[sftNum1], lowestBins->data[sftNum2], numBins );
+      goto failed;
     }
+  }
 
-    UINT4 lowestBin1 = lowestBins->data[sftNum1];
-    XLAL_CHECK ( ((lowestBin1 + numBins - 1) < lenDataArray1),
-		 XLAL_EINVAL,
-		 "Loop would run off end of array:\n lowestBin1=%d, numBins=%d, len(dataArray1)=%d\n",
-		 lowestBin1, numBins, lenDataArray1 );
-    for (UINT4 j = 0; j < numBins; j++) {
-      COMPLEX8 data1 = dataArray1[lowestBin1+j];
-
-      INT4 ccSign = baseCCSign;
-      UINT4 lowestBin2 = lowestBins->data[sftNum2];
-      XLAL_CHECK ( ((lowestBin2 + numBins - 1) < lenDataArray2),
-		   XLAL_EINVAL,
-		   "Loop would run off end of array:\n lowestBin2=%d, numBins=%d, len(dataArray2)=%d\n",
-		   lowestBin2, numBins, lenDataArray2 );
-      for (UINT4 k = 0; k < numBins; k++) {
-	COMPLEX8 data2 = dataArray2[lowestBins->data[sftNum2]+k];
-	REAL8 sincFactor =1;
-
-	sincFactor = sincList->data[sftNum1 * numBins + j] * sincList->data[sftNum2 * numBins + k];
-	nume +=  ccSign * sincFactor * creal(GalphaCC * conj(data1) * data2);
-	/*nume += creal ( GalphaCC * ccSign * sincFactor * conj(data1) * data2 );=> abs(GalphaCC)*abs(data1)*abs(data2) * cos(arg(GalphaCC)-arg(data1)+arg(data2))*/
-	/*multiWeights->data[detInd1]->data[sftNum1] *  multiWeights->data[detInd2]->data[sftNum2] **/
-	REAL8 GalphaAmp = curlyGAmp->data[alpha] * sincFactor ;
-	/** multiWeights->data[detInd1]->data[sftNum1] *  multiWeights->data[detInd2]->data[sftNum2]*/
-	curlyGSqr += SQUARE( GalphaAmp );
-	ccSign *= -1;
+  /* per-SFT sums over bins; each SFT is independent */
+#pragma omp parallel for schedule(static)
+  for (UINT4 n = 0; n < numSFTs; n++) {
+    COMPLEX16 sum = 0;
+    REAL8 sincSqr = 0;
+    if ( sftData[n] != NULL ) {
+      const REAL8 *sinc = sincList->data + n * numBins;
+      REAL8 sign = 1;
+      for (UINT4 j = 0; j < numBins; j++) {
+        sum += sign * sinc[j] * sftData[n][j];
+        sincSqr += SQUARE( sinc[j] );
+        sign = -sign;
       }
-      baseCCSign *= -1;
     }
+    sftSum[n] = sum;
+    sftSincSqr[n] = sincSqr;
+  }
+
+  /* sum over pairs in fixed blocks, whose partial sums are added up in order below,
+     so that the result does not depend on the number of threads */
+#pragma omp parallel for schedule(dynamic)
+  for (UINT4 b = 0; b < numBlocks; b++) {
+    const UINT4 alphaEnd = MYMIN( ( b + 1 ) * CROSSCORR_PAIR_BLOCK, numPairs );
+    REAL8 nume = 0;
+    REAL8 curlyGSqr = 0;
+    for (UINT4 alpha = b * CROSSCORR_PAIR_BLOCK; alpha < alphaEnd; alpha++) {
+      UINT4 sftNum1 = sftPairs->data[alpha].sftNum[0];
+      UINT4 sftNum2 = sftPairs->data[alpha].sftNum[1];
+      COMPLEX16 GalphaCC = curlyGAmp->data[alpha]
+        * expSignalPhases->data[sftNum1]
+        * conj( expSignalPhases->data[sftNum2] );
+      REAL8 term = creal( GalphaCC * conj( sftSum[sftNum1] ) * sftSum[sftNum2] );
+      /* Alternating sign is (-1)**(k1-k2) */
+      if ( ( (lowestBins->data[sftNum1]-lowestBins->data[sftNum2]) % 2) != 0 ) {
+        term = -term;
+      }
+      nume += term;
+      curlyGSqr += SQUARE( curlyGAmp->data[alpha] ) * sftSincSqr[sftNum1] * sftSincSqr[sftNum2];
+    }
+    blockNume[b] = nume;
+    blockCurlyGSqr[b] = curlyGSqr;
   }
+
+  REAL8 nume = 0;
+  REAL8 curlyGSqr = 0;
+  for (UINT4 b = 0; b < numBlocks; b++) {
+    nume += blockNume[b];
+    curlyGSqr += blockCurlyGSqr[b];
+  }
+
+  XLALFree( sftSum );
+  XLALFree( sftSincSqr );
+  XLALFree( sftData );
+  XLALFree( blockNume );
+  XLALFree( blockCurlyGSqr );
+
   if (curlyGSqr == 0.0)
     {
       *evSquared = 0.0;
@@ -1161,6 +1194,14 @@ int XLALCalculatePulsarCrossCorrStatistic
       *ccStat = 4 * multiWeights->Sinv_Tsft * nume / sqrt(*evSquared);
     }
   return XLAL_SUCCESS;
+
+failed:
+  XLALFree( sftSum );
+  XLALFree( sftSincSqr );
+  XLALFree( sftData );
+  XLALFree( blockNume );
+  XLALFree( blockCurlyGSqr );
+  XLAL_ERROR( XLAL_EINVAL );
 }
 
 /** Calculate multi-bin cross-correlation statistic using resampling */
@@ -702,6 +702,188 @@ XLALGetMultiSSBtimes ( const MultiDetectorStateSeries *multiDetStates, /**< [in]
 
 } /* XLALGetMultiSSBtimes() */
 
+/**
+ * Batched version of XLALGetSSBtimes(): compute the SSB timings of one detector for
+ * \c numSkyPoints sky-positions at once.
+ *
+ * For #SSBPREC_NEWTONIAN the time-delays and their derivatives are the scalar products of the
+ * (sky-dependent) source unit-vector with the (time-dependent) detector positions and velocities,
+ * so they form a dense [sky x time] product. The detector positions, velocities and timestamps are
+ * copied once into contiguous per-component arrays, and each sky-position then needs only one pass
+ * over these arrays, which the compiler can vectorise. The results are the same as those of
+ * XLALGetSSBtimes(). For #SSBPREC_DMOFF the timings do not depend on sky-position and are computed
+ * once. The relativistic timings are computed with XLALGetSSBtimes() for each sky-position.
+ *
+ * \note The array \c tSSB must hold \c numSkyPoints pointers, which must be NULL on input; the
+ * SSBtimes are allocated here, and must be freed with XLALDestroySSBtimes().
+ */
+int
+XLALGetSSBtimesBatch ( SSBtimes **tSSB,				/**< [out] SSB timings for each sky-position */
+                       const DetectorStateSeries *DetectorStates,	/**< [in] detector-states at timestamps t_i */
+                       const SkyPosition *skypos,			/**< [in] source sky-locations */
+                       UINT4 numSkyPoints,				/**< [in] number of sky-positions */
+                       LIGOTimeGPS refTime,				/**< [in] SSB reference-time T_0 of pulsar-parameters */
+                       SSBprecision precision				/**< [in] relativistic or Newtonian SSB transformation? */
+                       )
+{
+  XLAL_CHECK ( tSSB != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( DetectorStates != NULL, XLAL_EINVAL, "Invalid NULL input 'DetectorStates'\n" );
+  XLAL_CHECK ( numSkyPoints == 0 || skypos != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( precision < SSBPREC_LAST, XLAL_EDOM, "Invalid value precision=%d, allowed are [0, %d]\n", precision, SSBPREC_LAST -1 );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      XLAL_CHECK ( tSSB[s] == NULL, XLAL_EINVAL, "Output SSBtimes tSSB[%d] must be NULL on input\n", s );
+      XLAL_CHECK ( skypos[s].system == COORDINATESYSTEM_EQUATORIAL, XLAL_EDOM, "Only equatorial coordinate system (=%d) allowed, got %d\n", COORDINATESYSTEM_EQUATORIAL, skypos[s].system );
+    }
+
+  UINT4 numSteps = DetectorStates->length;		/* number of timestamps */
+  REAL8 *states = NULL;
+
+  switch ( precision )
+    {
+    case SSBPREC_NEWTONIAN:	/* dense product of source unit-vectors with detector positions and velocities */
+      {
+        /* copy the detector states into contiguous arrays */
+        states = XLALMalloc ( 7 * numSteps * sizeof ( *states ) );
+        XLAL_CHECK ( numSteps == 0 || states != NULL, XLAL_ENOMEM );
+        REAL8 *t  = states;
+        REAL8 *r0 = t  + numSteps, *r1 = r0 + numSteps, *r2 = r1 + numSteps;
+        REAL8 *v0 = r2 + numSteps, *v1 = v0 + numSteps, *v2 = v1 + numSteps;
+        for ( UINT4 i = 0; i < numSteps; i++ )
+          {
+            const DetectorState *state = &(DetectorStates->data[i]);
+            t[i] = XLALGPSGetREAL8 ( &state->tGPS );
+            r0[i] = state->rDetector[0]; r1[i] = state->rDetector[1]; r2[i] = state->rDetector[2];
+            v0[i] = state->vDetector[0]; v1[i] = state->vDetector[1]; v2[i] = state->vDetector[2];
+          }
+        REAL8 refTimeREAL8 = XLALGPSGetREAL8 ( &refTime );
+
+        for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+          {
+            /*----- get the cartesian source unit-vector */
+            REAL8 alpha = skypos[s].longitude;
+            REAL8 delta = skypos[s].latitude;
+            REAL8 vn0 = cos(alpha) * cos(delta);
+            REAL8 vn1 = sin(alpha) * cos(delta);
+            REAL8 vn2 = sin(delta);
+
+            if ( ( tSSB[s] = XLALCalloc ( 1, sizeof ( *tSSB[s] ) ) ) == NULL
+                 || ( tSSB[s]->DeltaT = XLALCreateREAL8Vector ( numSteps ) ) == NULL
+                 || ( tSSB[s]->Tdot = XLALCreateREAL8Vector ( numSteps ) ) == NULL ) {
+              goto failed;
+            }
+            tSSB[s]->refTime = refTime;
+            REAL8 *restrict DeltaT = tSSB[s]->DeltaT->data;
+            REAL8 *restrict Tdot = tSSB[s]->Tdot->data;
+
+            for ( UINT4 i = 0; i < numSteps; i++ )
+              {
+                DeltaT[i] = ( t[i] + ( vn0 * r0[i] + vn1 * r1[i] + vn2 * r2[i] ) ) - refTimeREAL8;
+                Tdot[i] = 1.0 + ( vn0 * v0[i] + vn1 * v1[i] + vn2 * v2[i] );
+              }
+          } /* for s < numSkyPoints */
+      }
+      break;
+
+    case SSBPREC_DMOFF:		/* independent of sky-position */
+      for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+        {
+          tSSB[s] = ( s == 0 ) ? XLALGetSSBtimes ( DetectorStates, skypos[s], refTime, precision ) : XLALDuplicateSSBtimes ( tSSB[0] );
+          if ( tSSB[s] == NULL ) {
+            goto failed;
+          }
+        }
+      break;
+
+    default:			/* relativistic timings */
+      for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+        {
+          if ( ( tSSB[s] = XLALGetSSBtimes ( DetectorStates, skypos[s], refTime, precision ) ) == NULL ) {
+            goto failed;
+          }
+        }
+      break;
+
+    } /* switch precision */
+
+  XLALFree ( states );
+  return XLAL_SUCCESS;
+
+ failed:
+  XLALFree ( states );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      XLALDestroySSBtimes ( tSSB[s] );
+      tSSB[s] = NULL;
+    }
+  XLAL_ERROR ( XLAL_EFUNC );
+
+} /* XLALGetSSBtimesBatch() */
+
+/** Batched version of XLALGetMultiSSBtimes(), using XLALGetSSBtimesBatch() for each detector.
+ *
+ * \note The array \c multiSSB must hold \c numSkyPoints pointers, which must be NULL on input; the
+ * MultiSSBtimes are allocated here, and must be freed with XLALDestroyMultiSSBtimes().
+ */
+int
+XLALGetMultiSSBtimesBatch ( MultiSSBtimes **multiSSB,				/**< [out] multi-IFO SSB timings for each sky-position */
+                            const MultiDetectorStateSeries *multiDetStates,	/**< [in] detector-states at timestamps t_i */
+                            const SkyPosition *skypos,				/**< [in] source sky-positions [in equatorial coords!] */
+                            UINT4 numSkyPoints,					/**< [in] number of sky-positions */
+                            LIGOTimeGPS refTime,				/**< [in] SSB reference-time T_0 for SSB-timing */
+                            SSBprecision precision				/**< [in] use relativistic or Newtonian SSB timing?  */
+                            )
+{
+  XLAL_CHECK ( multiSSB != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( multiDetStates != NULL, XLAL_EINVAL, "Invalid NULL input 'multiDetStates'\n");
+  XLAL_CHECK ( multiDetStates->length > 0, XLAL_EINVAL, "Invalid zero-length 'multiDetStates'\n");
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ ) {
+    XLAL_CHECK ( multiSSB[s] == NULL, XLAL_EINVAL, "Output MultiSSBtimes multiSSB[%d] must be NULL on input\n", s );
+  }
+
+  UINT4 numDetectors = multiDetStates->length;
+
+  // prepare return structs
+  SSBtimes **tSSBX = XLALCalloc ( numSkyPoints > 0 ? numSkyPoints : 1, sizeof ( *tSSBX ) );
+  XLAL_CHECK ( tSSBX != NULL, XLAL_ENOMEM );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      if ( ( multiSSB[s] = XLALCalloc ( 1, sizeof ( *multiSSB[s] ) ) ) == NULL ) {
+        goto failed;
+      }
+      multiSSB[s]->length = numDetectors;
+      if ( ( multiSSB[s]->data = XLALCalloc ( numDetectors, sizeof ( *multiSSB[s]->data ) ) ) == NULL ) {
+        goto failed;
+      }
+    }
+
+  // loop over detectors
+  for ( UINT4 X = 0; X < numDetectors; X ++ )
+    {
+      if ( XLALGetSSBtimesBatch ( tSSBX, multiDetStates->data[X], skypos, numSkyPoints, refTime, precision ) != XLAL_SUCCESS ) {
+        goto failed;
+      }
+      for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+        {
+          multiSSB[s]->data[X] = tSSBX[s];
+          tSSBX[s] = NULL;
+        }
+    } /* for X < numDet */
+
+  XLALFree ( tSSBX );
+  return XLAL_SUCCESS;
+
+ failed:
+  XLALFree ( tSSBX );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      XLALDestroyMultiSSBtimes ( multiSSB[s] );
+      multiSSB[s] = NULL;
+    }
+  XLAL_ERROR ( XLAL_EFUNC );
+
+} /* XLALGetMultiSSBtimesBatch() */
+
 /** Find the earliest timestamp in a multi-SSB data structure
  *
 */
@@ -79,6 +79,10 @@ MultiSSBtimes *XLALDuplicateMultiSSBtimes ( const MultiSSBtimes *multiSSB );
 
 SSBtimes *XLALGetSSBtimes ( const DetectorStateSeries *DetectorStates, SkyPosition pos, LIGOTimeGPS refTime, SSBprecision precision );
 MultiSSBtimes *XLALGetMultiSSBtimes ( const MultiDetectorStateSeries *multiDetStates, SkyPosition skypos, LIGOTimeGPS refTime, SSBprecision precision);
+#ifndef SWIG // exclude from SWIG interface
+int XLALGetSSBtimesBatch ( SSBtimes **tSSB, const DetectorStateSeries *DetectorStates, const SkyPosition *skypos, UINT4 numSkyPoints, LIGOTimeGPS refTime, SSBprecision precision );
+int XLALGetMultiSSBtimesBatch ( MultiSSBtimes **multiSSB, const MultiDetectorStateSeries *multiDetStates, const SkyPosition *skypos, UINT4 numSkyPoints, LIGOTimeGPS refTime, SSBprecision precision );
+#endif
 
 int XLALEarliestMultiSSBtime ( LIGOTimeGPS *out, const MultiSSBtimes *multiSSB, const REAL8 Tsft );
 int XLALLatestMultiSSBtime ( LIGOTimeGPS *out, const MultiSSBtimes *multiSSB,  const REAL8 Tsft );
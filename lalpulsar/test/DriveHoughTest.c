@@ -64,6 +64,10 @@
  * frequency using only one horizontal line set of \c phmd, and outputs the
  * result into a file.
  *
+ * The same \c luts, \c phmd and Hough maps, both unweighted and weighted, are
+ * then constructed with the XLAL functions, and the program checks that the
+ * resulting Hough maps are identical.
+ *
  * By default, running this program with no arguments simply tests the subroutines,
  * producing an output file called <tt>OutHough.asc</tt>.  All default parameters are set from
  * <tt>\#define</tt>d constants.
@@ -84,6 +88,16 @@
  * LALHOUGHupdateSpacePHMDup()
  * LALHOUGHInitializeHT()
  * LALHOUGHConstructHMT()
+ * LALHOUGHWeighSpacePHMD()
+ * LALHOUGHConstructHMT_W()
+ * XLALHOUGHCreateLUTVector()
+ * XLALHOUGHConstructPLUTVector()
+ * XLALHOUGHCreatePHMDVectorSequence()
+ * XLALHOUGHConstructSpacePHMD()
+ * XLALHOUGHupdateSpacePHMDup()
+ * XLALHOUGHWeighSpacePHMD()
+ * XLALHOUGHConstructHMT_W()
+ * XLALHOUGHConstructHMTVector_W()
  * LALPrintError()
  * LALMalloc()
  * LALFree()
@@ -160,6 +174,15 @@ do {                                                                 \
     return TESTDRIVEHOUGHC_ESUB;                                  \
   }                                                                  \
 } while (0)
+
+#define XLALSUB( func )                                              \
+do {                                                                 \
+  if ( (func) != XLAL_SUCCESS ) {                                    \
+    ERROR( TESTDRIVEHOUGHC_ESUB, TESTDRIVEHOUGHC_MSGESUB,            \
+           "Function call \"" #func "\" failed:" );                  \
+    return TESTDRIVEHOUGHC_ESUB;                                     \
+  }                                                                  \
+} while (0)
 /******************************************************************/
 
 /* >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>><<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< */
@@ -175,7 +198,7 @@ int main(int argc, char *argv[]){
   static HOUGHResolutionPar parRes;
   static HOUGHPatchGrid  patch;   /* Patch description */
 
-  static HOUGHParamPLUT  parLut;  /* parameters needed to build lut  */
+  static HOUGHParamPLUT  parLut[MOBSCOH];  /* parameters needed to build luts */
   static HOUGHDemodPar   parDem;  /* demodulation parameters */
   static HOUGHSizePar    parSize;
   static HOUGHMapTotal   ht;   /* the total Hough map */
@@ -407,10 +430,10 @@ int main(int argc, char *argv[]){
     alpha +=  STEPALPHA; /* shift alpha several degrees */
 
     /* calculate parameters needed for buiding the LUT */
-    SUB( LALHOUGHCalcParamPLUT( &status, &parLut, &parSize, &parDem ),  &status );
+    SUB( LALHOUGHCalcParamPLUT( &status, &parLut[j], &parSize, &parDem ),  &status );
 
     /* build the LUT */
-    SUB( LALHOUGHConstructPLUT( &status, &(lutV.lut[j]), &patch, &parLut ),
+    SUB( LALHOUGHConstructPLUT( &status, &(lutV.lut[j]), &patch, &parLut[j] ),
 	 &status );
   }
 
@@ -490,6 +513,71 @@ int main(int argc, char *argv[]){
   fclose( fp );
 
 
+  /******************************************************************/
+  /* compare with the Hough maps constructed by the XLAL functions  */
+  /******************************************************************/
+
+  {
+    HOUGHptfLUTVector *lutVX = NULL;
+    PHMDVectorSequence *phmdVSX = NULL;
+    REAL8Vector *weightV = NULL;
+    HOUGHMapTotal htX = ht;
+    HOUGHMapTotalVector htVX = { .length = 1, .ht = &htX };
+    UINT8FrequencyIndexVectorSequence freqIndVS = { .length = 1, .vectorLength = MOBSCOH, .freqIndV = &freqInd };
+    UINT4 w;
+
+    lutVX = XLALHOUGHCreateLUTVector( MOBSCOH, maxNBins, maxNBorders, ySide );
+    phmdVSX = XLALHOUGHCreatePHMDVectorSequence( MOBSCOH, NFSIZE, maxNBorders, ySide );
+    weightV = XLALCreateREAL8Vector( MOBSCOH );
+    htX.map = (HoughTT *)LALMalloc(xSide*ySide*sizeof(HoughTT));
+    if ( !lutVX || !phmdVSX || !weightV || !htX.map ) {
+      ERROR( TESTDRIVEHOUGHC_ESUB, TESTDRIVEHOUGHC_MSGESUB, 0 );
+      return TESTDRIVEHOUGHC_ESUB;
+    }
+
+    XLALSUB( XLALHOUGHConstructPLUTVector( lutVX, &patch, parLut ) );
+    phmdVSX->fBinMin = fBin;
+    XLALSUB( XLALHOUGHConstructSpacePHMD( phmdVSX, &pgV, lutVX ) );
+    XLALSUB( XLALHOUGHupdateSpacePHMDup( phmdVSX, &pgV, lutVX ) );
+
+    for (w=0; w<2; ++w){
+
+      if ( w > 0 ) {
+        /* weighted Hough maps */
+        for (j=0;j< MOBSCOH;++j){
+          weightV->data[j] = 0.5 + 0.25*j;
+        }
+        SUB( LALHOUGHWeighSpacePHMD( &status, &phmdVS, weightV ), &status );
+        SUB( LALHOUGHConstructHMT_W( &status, &ht, &freqInd, &phmdVS ), &status );
+        XLALSUB( XLALHOUGHWeighSpacePHMD( phmdVSX, weightV ) );
+      }
+
+      XLALSUB( XLALHOUGHConstructHMT_W( &htX, &freqInd, phmdVSX ) );
+      for(i=0; i<(UINT4)xSide*ySide; ++i){
+        if ( htX.map[i] != ht.map[i] ) {
+          ERROR( TESTDRIVEHOUGHC_EBAD, TESTDRIVEHOUGHC_MSGEBAD, "XLALHOUGHConstructHMT_W() differs:" );
+          return TESTDRIVEHOUGHC_EBAD;
+        }
+      }
+
+      memset( htX.map, 0, xSide*ySide*sizeof(HoughTT) );
+      XLALSUB( XLALHOUGHConstructHMTVector_W( &htVX, &freqIndVS, phmdVSX ) );
+      for(i=0; i<(UINT4)xSide*ySide; ++i){
+        if ( htX.map[i] != ht.map[i] ) {
+          ERROR( TESTDRIVEHOUGHC_EBAD, TESTDRIVEHOUGHC_MSGEBAD, "XLALHOUGHConstructHMTVector_W() differs:" );
+          return TESTDRIVEHOUGHC_EBAD;
+        }
+      }
+
+    }
+
+    XLALHOUGHDestroyLUTVector( lutVX );
+    XLALHOUGHDestroyPHMDVectorSequence( phmdVSX );
+    XLALDestroyREAL8Vector( weightV );
+    LALFree( htX.map );
+  }
+
+
   /******************************************************************/
   /* Free memory and exit */
   /******************************************************************/
@@ -98,6 +98,21 @@ const TestRecord testtable[3] = {
   },
 };
 
+typedef struct {
+  INT4 index;
+  REAL8 value;
+  CHAR name[8];
+} TestBigRecord;
+
+#define TEST_BIG_TABLE_NROWS 5000
+
+static void TestBigRecordSet( TestBigRecord *record, const size_t i )
+{
+  record->index = i;
+  record->value = LAL_PI * i - LAL_E;
+  snprintf( record->name, sizeof( record->name ), "r%zu", i );
+}
+
 int main( int argc, char *argv[] )
 {
 
@@ -259,6 +274,26 @@ int main( int argc, char *argv[] )
     }
     fprintf( stderr, "PASSED: wrote a table\n" );
 
+    XLAL_CHECK_MAIN( XLALFITSTableOpenWrite( file, "table2", "This is a big test table" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    {
+      XLAL_FITS_TABLE_COLUMN_BEGIN( TestBigRecord );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, INT4, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, REAL8, value ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_ARRAY( file, CHAR, name ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    {
+      TestBigRecord XLAL_INIT_DECL( records, [777] );
+      size_t i = 0;
+      while ( i < TEST_BIG_TABLE_NROWS ) {
+        size_t n = 0;
+        for ( ; n < XLAL_NUM_ELEM( records ) && i < TEST_BIG_TABLE_NROWS; ++n, ++i ) {
+          TestBigRecordSet( &records[n], i );
+        }
+        XLAL_CHECK_MAIN( XLALFITSTableWriteRows( file, records, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
+    }
+    fprintf( stderr, "PASSED: wrote a big table\n" );
+
     XLAL_CHECK_MAIN( XLALFITSHeaderWriteComment( file, "%s", "This is another test comment" ) == XLAL_SUCCESS, XLAL_EFUNC );
     XLAL_CHECK_MAIN( XLALFITSFileSeekNamedHDU( file, "table1" ) == XLAL_SUCCESS, XLAL_EFUNC );
     XLAL_CHECK_MAIN( XLALFITSFileSeekNamedHDU( file, "array4" ) == XLAL_SUCCESS, XLAL_EFUNC );
@@ -266,7 +301,7 @@ int main( int argc, char *argv[] )
     XLAL_CHECK_MAIN( XLALFITSFileWriteHistory( file, "%s\n%s", "This is a test history", longstring_ref ) == XLAL_SUCCESS, XLAL_EFUNC );
     fprintf( stderr, "PASSED: HDU seeking in write mode\n" );
 
-    XLALFITSFileClose( file );
+    XLAL_CHECK_MAIN( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC );
     fprintf( stderr, "PASSED: closed 'FITSFileIOTest.fits'\n" );
   }
   fprintf( stderr, "\n" );
@@ -368,6 +403,67 @@ int main( int argc, char *argv[] )
     }
     fprintf( stderr, "PASSED: read and verified a table\n" );
 
+    {
+      UINT8 nrows = 0;
+      XLAL_CHECK_MAIN( XLALFITSTableOpenRead( file, "table2", &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( nrows == TEST_BIG_TABLE_NROWS, XLAL_EFAILED );
+      {
+        XLAL_FITS_TABLE_COLUMN_BEGIN( TestBigRecord );
+        XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, INT4, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, REAL8, value ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_ARRAY( file, CHAR, name ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
+      TestBigRecord XLAL_INIT_DECL( records, [512] );
+      const UINT8 start = 1234, end = 4321;
+      XLAL_CHECK_MAIN( XLALFITSTableSeekRow( file, start, &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( nrows == TEST_BIG_TABLE_NROWS - start, XLAL_EFAILED );
+      size_t i = start;
+      while ( i < end ) {
+        const size_t max_n = ( end - i < XLAL_NUM_ELEM( records ) ) ? end - i : XLAL_NUM_ELEM( records );
+        size_t n = 0;
+        XLAL_CHECK_MAIN( XLALFITSTableReadRows( file, records, max_n, &n, &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( n == max_n, XLAL_EFAILED );
+        for ( size_t j = 0; j < n; ++j, ++i ) {
+          TestBigRecord record_ref;
+          TestBigRecordSet( &record_ref, i );
+          XLAL_CHECK_MAIN( records[j].index == record_ref.index, XLAL_EFAILED );
+          XLAL_CHECK_MAIN( records[j].value == record_ref.value, XLAL_EFAILED );
+          XLAL_CHECK_MAIN( strcmp( records[j].name, record_ref.name ) == 0, XLAL_EFAILED );
+        }
+        XLAL_CHECK_MAIN( nrows == TEST_BIG_TABLE_NROWS - i, XLAL_EFAILED );
+      }
+      XLAL_CHECK_MAIN( XLALFITSTableSeekRow( file, TEST_BIG_TABLE_NROWS, &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( nrows == 0, XLAL_EFAILED );
+      {
+        size_t n = 1;
+        XLAL_CHECK_MAIN( XLALFITSTableReadRows( file, records, XLAL_NUM_ELEM( records ), &n, &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( n == 0 && nrows == 0, XLAL_EFAILED );
+      }
+    }
+    fprintf( stderr, "PASSED: read and verified a range of rows of a big table\n" );
+
+    {
+      UINT8 nrows = 0;
+      XLAL_CHECK_MAIN( XLALFITSTableOpenRead( file, "table2", &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+      {
+        XLAL_FITS_TABLE_COLUMN_BEGIN( TestBigRecord );
+        XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, REAL8, value ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
+      size_t i = 0;
+      while ( nrows > 0 ) {
+        TestBigRecord XLAL_INIT_DECL( record );
+        XLAL_CHECK_MAIN( XLALFITSTableReadRow( file, &record, &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+        TestBigRecord record_ref;
+        TestBigRecordSet( &record_ref, i );
+        XLAL_CHECK_MAIN( record.index == 0, XLAL_EFAILED );
+        XLAL_CHECK_MAIN( record.value == record_ref.value, XLAL_EFAILED );
+        XLAL_CHECK_MAIN( record.name[0] == '\0', XLAL_EFAILED );
+        ++i;
+      }
+      XLAL_CHECK_MAIN( i == TEST_BIG_TABLE_NROWS, XLAL_EFAILED );
+    }
+    fprintf( stderr, "PASSED: read and verified a column of a big table\n" );
+
     {
       size_t m = 0, n = 0;
       XLAL_CHECK_MAIN( XLALFITSArrayOpenRead2( file, "array4", &m, &n ) == XLAL_SUCCESS, XLAL_EFUNC );
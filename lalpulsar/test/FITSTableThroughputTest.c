@@ -0,0 +1,163 @@
+//
+// Copyright (C) 2026 LIGO Scientific Collaboration
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA 02110-1301 USA
+//
+
+///
+/// \file
+/// \ingroup FITSFileIO_h
+/// \brief Throughput benchmark of buffered FITS table writing and reading
+///
+/// Writes a toplist-like table of <tt>--nrows</tt> rows one row at a time, as the Weave toplists
+/// are written, and reads it back in blocks with XLALFITSTableReadRows(), checking every row and
+/// printing the throughput of each. The table file is removed afterwards. The default of
+/// \f$10^4\f$ rows keeps the test run short; to measure throughput, run it by hand with e.g.
+/// <tt>--nrows=10000000</tt>.
+///
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <lal/FITSFileIO.h>
+#include <lal/LALConstants.h>
+#include <lal/LALPulsarVCSInfo.h>
+#include <lal/LogPrintf.h>
+#include <lal/UserInput.h>
+
+#if !defined(HAVE_LIBCFITSIO)
+
+int main( void )
+{
+  fprintf( stderr, "CFITSIO library is not available; skipping test\n" );
+  return 77;
+}
+
+#else // defined(HAVE_LIBCFITSIO)
+
+#define TABLE_FILE_NAME "FITSTableThroughputTest.fits"
+
+// Row of a toplist, similar in size and layout to the Weave toplist items
+typedef struct {
+  UINT8 serial;
+  REAL8 alpha;
+  REAL8 delta;
+  REAL8 freq;
+  REAL8 f1dot;
+  REAL4 mean2F;
+  REAL4 max2F;
+} ToplistRecord;
+
+static void ToplistRecordSet( ToplistRecord *record, const UINT8 i )
+{
+  record->serial = i;
+  record->alpha = LAL_TWOPI * ( i % 7919 ) / 7919.0;
+  record->delta = LAL_PI * ( i % 6271 ) / 6271.0 - LAL_PI_2;
+  record->freq = 50.0 + 1e-6 * i;
+  record->f1dot = -1e-10 * ( i % 101 );
+  record->mean2F = 4.0 + ( i % 1009 ) / 100.0;
+  record->max2F = record->mean2F + ( i % 13 );
+}
+
+static int ToplistColumnsAdd( FITSFile *file )
+{
+  XLAL_FITS_TABLE_COLUMN_BEGIN( ToplistRecord );
+  XLAL_CHECK( XLAL_FITS_TABLE_COLUMN_ADD( file, UINT8, serial ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLAL_FITS_TABLE_COLUMN_ADD_NAMED( file, REAL8, alpha, "alpha [rad]" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLAL_FITS_TABLE_COLUMN_ADD_NAMED( file, REAL8, delta, "delta [rad]" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLAL_FITS_TABLE_COLUMN_ADD_NAMED( file, REAL8, freq, "freq [Hz]" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLAL_FITS_TABLE_COLUMN_ADD_NAMED( file, REAL8, f1dot, "f1dot [Hz/s]" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLAL_FITS_TABLE_COLUMN_ADD( file, REAL4, mean2F ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLAL_FITS_TABLE_COLUMN_ADD( file, REAL4, max2F ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+int main( int argc, char *argv[] )
+{
+
+  // Parse user input
+  struct uvar_type { UINT8 nrows; } uvar_struct = { .nrows = 10000 };
+  struct uvar_type *const uvar = &uvar_struct;
+  XLAL_CHECK_MAIN( XLALRegisterUvarMember( nrows, UINT8, 'n', OPTIONAL, "Number of table rows to write and read" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  BOOLEAN should_exit = 0;
+  XLAL_CHECK_MAIN( XLALUserVarReadAllInput( &should_exit, argc, argv, lalPulsarVCSInfoList ) == XLAL_SUCCESS, XLAL_EFUNC );
+  if ( should_exit ) {
+    return EXIT_FAILURE;
+  }
+  XLAL_CHECK_MAIN( uvar->nrows > 0, XLAL_EINVAL );
+
+  // Write table one row at a time
+  {
+    const REAL8 t0 = XLALGetTimeOfDay();
+    FITSFile *file = XLALFITSFileOpenWrite( TABLE_FILE_NAME );
+    XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALFITSTableOpenWrite( file, "toplist", "toplist throughput benchmark" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( ToplistColumnsAdd( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( UINT8 i = 0; i < uvar->nrows; ++i ) {
+      ToplistRecord record;
+      ToplistRecordSet( &record, i );
+      XLAL_CHECK_MAIN( XLALFITSTableWriteRow( file, &record ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    XLAL_CHECK_MAIN( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const REAL8 dt = XLALGetTimeOfDay() - t0;
+    printf( "wrote %" LAL_UINT8_FORMAT " rows in %.2f sec: %.3g rows/sec, %.3g MB/sec\n",
+            uvar->nrows, dt, uvar->nrows / dt, uvar->nrows * sizeof( ToplistRecord ) / dt / 1048576.0 );
+  }
+
+  // Read table back in blocks and check every row
+  {
+    const REAL8 t0 = XLALGetTimeOfDay();
+    FITSFile *file = XLALFITSFileOpenRead( TABLE_FILE_NAME );
+    XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC );
+    UINT8 nrows = 0;
+    XLAL_CHECK_MAIN( XLALFITSTableOpenRead( file, "toplist", &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( nrows == uvar->nrows, XLAL_EFAILED, "%" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT, nrows, uvar->nrows );
+    XLAL_CHECK_MAIN( ToplistColumnsAdd( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+    static ToplistRecord records[4096];
+    UINT8 i = 0, rem_nrows = nrows;
+    while ( rem_nrows > 0 ) {
+      size_t n = 0;
+      XLAL_CHECK_MAIN( XLALFITSTableReadRows( file, records, XLAL_NUM_ELEM( records ), &n, &rem_nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( n > 0, XLAL_EFAILED, "read no rows with %" LAL_UINT8_FORMAT " remaining", rem_nrows );
+      for ( size_t j = 0; j < n; ++j, ++i ) {
+        ToplistRecord ref;
+        ToplistRecordSet( &ref, i );
+        XLAL_CHECK_MAIN( records[j].serial == ref.serial && records[j].alpha == ref.alpha && records[j].delta == ref.delta &&
+                         records[j].freq == ref.freq && records[j].f1dot == ref.f1dot && records[j].mean2F == ref.mean2F && records[j].max2F == ref.max2F,
+                         XLAL_EFAILED, "row %" LAL_UINT8_FORMAT " differs", i );
+      }
+    }
+    XLAL_CHECK_MAIN( i == nrows, XLAL_EFAILED );
+    XLAL_CHECK_MAIN( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const REAL8 dt = XLALGetTimeOfDay() - t0;
+    printf( "read %" LAL_UINT8_FORMAT " rows in %.2f sec: %.3g rows/sec, %.3g MB/sec\n",
+            nrows, dt, nrows / dt, nrows * sizeof( ToplistRecord ) / dt / 1048576.0 );
+  }
+
+  // Remove table file
+  XLAL_CHECK_MAIN( remove( TABLE_FILE_NAME ) == 0, XLAL_ESYS, "Could not remove '%s'", TABLE_FILE_NAME );
+
+  // Cleanup
+  XLALDestroyUserVars();
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+#endif // !defined(HAVE_LIBCFITSIO)
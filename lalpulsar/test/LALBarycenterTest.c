@@ -210,6 +210,53 @@ main( void )
   XLALPrintError ("XLALBarycenter() 	%g s\n", tau / counter );
   XLALPrintError ("XLALBarycenterOpt()	%g s (= %.1f %%)\n", tau_opt / counter,  - 100 * (tau - tau_opt ) / tau );
 
+  /* ===== test XLALCreateBarycenterModel() against XLALBarycenterOpt() ===== */
+  XLALPrintInfo("\n\nTesting XLALCreateBarycenterModel() ... ");
+  {
+    const REAL8 span = 2 * LAL_DAYSID_SI;
+    const UINT4 numTimes = 1000;
+    LIGOTimeGPS startGPS;
+    REAL8 dt[numTimes], modelDeltaT[numTimes], modelTDot[numTimes];
+    REAL8 maxModelErr = 0, maxModelTDotErr = 0;
+
+    baryinput.alpha = ( 1.0 * rand() / RAND_MAX ) * LAL_TWOPI;
+    baryinput.delta = ( 1.0 * rand() / RAND_MAX ) * LAL_PI - LAL_PI_2;
+    XLALGPSSetREAL8( &startGPS, t1998 + ( 1.0 * rand() / RAND_MAX ) * ( LAL_YRSID_SI - span ) );
+
+    BarycenterModel *model = XLALCreateBarycenterModel ( &baryinput, edat, NULL, TIMECORRECTION_ORIGINAL, &startGPS, span, tolerance );
+    XLAL_CHECK ( model != NULL, XLAL_EFUNC );
+    XLAL_CHECK ( XLALBarycenterModelMaxError ( model ) <= 0.5 * tolerance, XLAL_EFAILED );
+
+    for ( UINT4 i = 0; i < numTimes; i++ ) {
+      dt[i] = ( 1.0 * rand() / RAND_MAX ) * span;
+    }
+    XLAL_CHECK ( XLALBarycenterModelEvaluate ( modelDeltaT, modelTDot, model, dt, numTimes ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    for ( UINT4 i = 0; i < numTimes; i++ ) {
+      tGPS = startGPS;
+      XLALGPSAdd( &tGPS, dt[i] );
+      baryinput.tgps = tGPS;
+      XLAL_CHECK ( XLALBarycenterEarth ( &earth, &tGPS, edat ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK ( XLALBarycenterOpt ( &emit_opt, &baryinput, &earth, &buffer ) == XLAL_SUCCESS, XLAL_EFUNC );
+      maxModelErr = fmax ( maxModelErr, fabs ( modelDeltaT[i] - emit_opt.deltaT ) );
+      maxModelTDotErr = fmax ( maxModelTDotErr, fabs ( modelTDot[i] - emit_opt.tDot ) );
+    }
+    XLALFree ( buffer );
+    buffer = NULL;
+
+    XLALPrintInfo ( "Max error between XLALBarycenterModelEvaluate() and XLALBarycenterOpt() = %g s, tDot: %g\n", maxModelErr, maxModelTDotErr );
+    XLAL_CHECK ( maxModelErr <= tolerance, XLAL_EFAILED, "Max error of XLALBarycenterModelEvaluate() = %g s, exceeding tolerance of %g s\n", maxModelErr, tolerance );
+    XLAL_CHECK ( maxModelTDotErr < 1e-10, XLAL_EFAILED, "Max tDot error of XLALBarycenterModelEvaluate() = %g, exceeding tolerance of %g\n", maxModelTDotErr, 1e-10 );
+
+    XLAL_CHECK ( XLALBarycenterModelEvaluate ( modelDeltaT, NULL, model, &span, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    REAL8 dtBad = span + 1;
+    XLAL_CHECK ( XLALBarycenterModelEvaluate ( modelDeltaT, NULL, model, &dtBad, 1 ) == XLAL_FAILURE, XLAL_EFAILED, "Expected XLALBarycenterModelEvaluate() to fail!" );
+    XLALClearErrno();
+
+    XLALDestroyBarycenterModel ( model );
+  }
+  XLALPrintInfo("PASSED\n");
+
   /* ===== test XLALRestrictEphemerisData() ===== */
   XLALPrintInfo("\n\nTesting XLALRestrictEphemerisData() ... ");
   {
@@ -133,7 +133,7 @@ static int SerialisationTest(
         FITSFile *file = XLALFITSFileOpenWrite( "LatticeTilingTest.fits" );
         XLAL_CHECK( file != NULL, XLAL_EFUNC );
         XLAL_CHECK( XLALSaveLatticeTilingIterator( itr, file, "itr" ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLALFITSFileClose( file );
+        XLAL_CHECK( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC );
       }
 
       // Destroy and recreate lattice tiling iterator
@@ -336,6 +336,44 @@ static int BasicTest(
     }
     printf( " done\n" );
 
+    // Get nearest blocks to all templates at once, check for consistency with XLALNearestLatticeTilingBlock()
+    printf( "  Testing XLALNearestLatticeTilingBlocks() ..." );
+    {
+      gsl_matrix *nearest_points = NULL;
+      UINT8Vector *nearest_index_vec = NULL;
+      INT4Vector *nearest_left_vec = NULL, *nearest_right_vec = NULL;
+      XLAL_CHECK( XLALNearestLatticeTilingBlocks( loc, points, i, &nearest_points, &nearest_index_vec, &nearest_left_vec, &nearest_right_vec ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK( nearest_points->size2 >= total && nearest_index_vec->length == total, XLAL_EFAILED );
+      for ( UINT8 k = 0; k < total; ++k ) {
+        gsl_vector_const_view point_view = gsl_matrix_const_column( points, k );
+        gsl_vector_const_view nearest_points_view = gsl_matrix_const_column( nearest_points, k );
+        UINT8 nearest_index = 0;
+        INT4 nearest_left = 0, nearest_right = 0;
+        XLAL_CHECK( XLALNearestLatticeTilingBlock( loc, &point_view.vector, i, nearest, &nearest_index, &nearest_left, &nearest_right ) == XLAL_SUCCESS, XLAL_EFUNC );
+        gsl_vector_sub( nearest, &nearest_points_view.vector );
+        double err = gsl_blas_dasum( nearest ) / n;
+        XLAL_CHECK( err < 1e-6, XLAL_EFAILED, "err = %e < 1e-6", err );
+        XLAL_CHECK( nearest_index_vec->data[k] == nearest_index, XLAL_EFAILED, "nearest_index[%" LAL_UINT8_FORMAT "] = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT "\n", k, nearest_index_vec->data[k], nearest_index );
+        XLAL_CHECK( nearest_left_vec->data[k] == nearest_left, XLAL_EFAILED, "nearest_left[%" LAL_UINT8_FORMAT "] = %i != %i\n", k, nearest_left_vec->data[k], nearest_left );
+        XLAL_CHECK( nearest_right_vec->data[k] == nearest_right, XLAL_EFAILED, "nearest_right[%" LAL_UINT8_FORMAT "] = %i != %i\n", k, nearest_right_vec->data[k], nearest_right );
+      }
+      GFMAT( nearest_points );
+      XLALDestroyUINT8Vector( nearest_index_vec );
+      XLALDestroyINT4Vector( nearest_left_vec );
+      XLALDestroyINT4Vector( nearest_right_vec );
+    }
+    {
+      // An empty batch succeeds, and resizes the vector outputs to zero length
+      const gsl_matrix no_points = { .size1 = n, .size2 = 0, .tda = 1, .data = NULL, .block = NULL, .owner = 0 };
+      gsl_matrix *nearest_points = NULL;
+      UINT8Vector *nearest_index_vec = XLALCreateUINT8Vector( 1 );
+      XLAL_CHECK( nearest_index_vec != NULL, XLAL_ENOMEM );
+      INT4Vector *nearest_left_vec = NULL, *nearest_right_vec = NULL;
+      XLAL_CHECK( XLALNearestLatticeTilingBlocks( loc, &no_points, i, &nearest_points, &nearest_index_vec, &nearest_left_vec, &nearest_right_vec ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK( nearest_points == NULL && nearest_index_vec == NULL && nearest_left_vec == NULL && nearest_right_vec == NULL, XLAL_EFAILED );
+    }
+    printf( " done\n" );
+
     // Cleanup
     XLALDestroyLatticeTilingIterator( itr );
     GFMAT( points );
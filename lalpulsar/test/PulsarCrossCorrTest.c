@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <config.h>
+#include <math.h>
+
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/PulsarCrossCorr_v2.h>
+#include <lal/SFTfileIO.h>
+
+/**
+ * \file
+ * \ingroup PulsarCrossCorr_v2_h
+ * \brief Tests for XLALCalculatePulsarCrossCorrStatistic()
+ *
+ * The statistic is computed for random SFT data, signal phases, sinc factors and lowest bins,
+ * and compared with a direct evaluation of the double sum over the bins of each SFT pair. The
+ * direct sum is evaluated in double precision, so the two differ only by the reassociation of
+ * the sums, and must agree to a small multiple of the double-precision epsilon of the sum of the
+ * absolute values of the terms. There are more SFT pairs than are summed in one block, so that
+ * the addition of the block partial sums is also tested.
+ */
+
+// number of detectors, and number of SFTs per detector
+#define NUM_DETECTORS 2
+#define NUM_SFTS_PER_DET 100
+
+// number of frequency bins in each SFT
+#define SFT_LENGTH 16
+
+#define SQUARE(x) ( (x) * (x) )
+
+// allowed difference of rho and E[rho]^2, relative to the sum of the absolute values of their terms
+#define REL_TOLERANCE 1e-12
+
+/* direct evaluation of the double sum over bins, as the statistic was originally computed */
+static int
+direct_CrossCorrStatistic ( REAL8 *ccStat, REAL8 *evSquared, REAL8 *ccStatScale, REAL8 *evSquaredScale,
+                            const REAL8Vector *curlyGAmp, const COMPLEX8Vector *expSignalPhases, const UINT4Vector *lowestBins,
+                            const REAL8VectorSequence *sincList, const SFTPairIndexList *sftPairs, const SFTIndexList *sftIndices,
+                            const MultiSFTVector *inputSFTs, const MultiNoiseWeights *multiWeights, const UINT4 numBins )
+{
+  REAL8 nume = 0, numeAbs = 0, curlyGSqr = 0;
+  for ( UINT4 alpha = 0; alpha < sftPairs->length; alpha ++ )
+    {
+      const UINT4 sftNum1 = sftPairs->data[alpha].sftNum[0];
+      const UINT4 sftNum2 = sftPairs->data[alpha].sftNum[1];
+      const SFTIndex *idx1 = &sftIndices->data[sftNum1];
+      const SFTIndex *idx2 = &sftIndices->data[sftNum2];
+      const COMPLEX8 *dataArray1 = inputSFTs->data[idx1->detInd]->data[idx1->sftInd].data->data;
+      const COMPLEX8 *dataArray2 = inputSFTs->data[idx2->detInd]->data[idx2->sftInd].data->data;
+      const COMPLEX16 GalphaCC = curlyGAmp->data[alpha] * expSignalPhases->data[sftNum1] * conj ( expSignalPhases->data[sftNum2] );
+      INT4 baseCCSign = ( ( ( lowestBins->data[sftNum1] - lowestBins->data[sftNum2] ) % 2 ) != 0 ) ? -1 : 1;
+      for ( UINT4 j = 0; j < numBins; j ++ )
+        {
+          const COMPLEX16 data1 = dataArray1[lowestBins->data[sftNum1] + j];
+          INT4 ccSign = baseCCSign;
+          for ( UINT4 k = 0; k < numBins; k ++ )
+            {
+              const COMPLEX16 data2 = dataArray2[lowestBins->data[sftNum2] + k];
+              const REAL8 sincFactor = sincList->data[sftNum1 * numBins + j] * sincList->data[sftNum2 * numBins + k];
+              const REAL8 term = ccSign * sincFactor * creal ( GalphaCC * conj ( data1 ) * data2 );
+              nume += term;
+              numeAbs += fabs ( term );
+              curlyGSqr += SQUARE ( curlyGAmp->data[alpha] * sincFactor );
+              ccSign *= -1;
+            }
+          baseCCSign *= -1;
+        }
+    }
+  XLAL_CHECK ( curlyGSqr > 0, XLAL_EFAILED );
+  (*evSquared) = 8 * SQUARE ( multiWeights->Sinv_Tsft ) * curlyGSqr;
+  (*ccStat) = 4 * multiWeights->Sinv_Tsft * nume / sqrt ( *evSquared );
+  (*evSquaredScale) = (*evSquared);
+  (*ccStatScale) = 4 * multiWeights->Sinv_Tsft * numeAbs / sqrt ( *evSquared );
+  return XLAL_SUCCESS;
+} // direct_CrossCorrStatistic()
+
+int
+main ( void )
+{
+  const UINT4 numBinsList[] = { 1, 3, 4 };
+  const REAL8 Tsft = 1800;
+
+  gsl_rng *rng = gsl_rng_alloc ( gsl_rng_mt19937 );
+  XLAL_CHECK_MAIN ( rng != NULL, XLAL_ENOMEM );
+  gsl_rng_set ( rng, 2014 );
+
+  // ----- random SFT data
+  UINT4Vector *numSFTsX = XLALCreateUINT4Vector ( NUM_DETECTORS );
+  XLAL_CHECK_MAIN ( numSFTsX != NULL, XLAL_EFUNC );
+  for ( UINT4 X = 0; X < NUM_DETECTORS; X ++ ) {
+    numSFTsX->data[X] = NUM_SFTS_PER_DET;
+  }
+  MultiSFTVector *inputSFTs = XLALCreateMultiSFTVector ( SFT_LENGTH, numSFTsX );
+  XLAL_CHECK_MAIN ( inputSFTs != NULL, XLAL_EFUNC );
+  for ( UINT4 X = 0; X < NUM_DETECTORS; X ++ )
+    {
+      for ( UINT4 i = 0; i < NUM_SFTS_PER_DET; i ++ )
+        {
+          SFTtype *sft = &inputSFTs->data[X]->data[i];
+          sft->epoch.gpsSeconds = 827884814 + i * Tsft;
+          sft->epoch.gpsNanoSeconds = 0;
+          sft->f0 = 150.0;
+          sft->deltaF = 1.0 / Tsft;
+          for ( UINT4 k = 0; k < SFT_LENGTH; k ++ ) {
+            sft->data->data[k] = crectf ( gsl_ran_gaussian ( rng, 1.0 ), gsl_ran_gaussian ( rng, 1.0 ) );
+          }
+        }
+    }
+
+  // ----- all pairs of SFTs, including auto-correlations
+  SFTIndexList *sftIndices = NULL;
+  XLAL_CHECK_MAIN ( XLALCreateSFTIndexListFromMultiSFTVect ( &sftIndices, inputSFTs ) == XLAL_SUCCESS, XLAL_EFUNC );
+  SFTPairIndexList *sftPairs = NULL;
+  XLAL_CHECK_MAIN ( XLALCreateSFTPairIndexList ( &sftPairs, sftIndices, inputSFTs, LAL_REAL4_MAX, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const UINT4 numSFTs = sftIndices->length;
+  const UINT4 numPairs = sftPairs->length;
+  XLAL_CHECK_MAIN ( numPairs == numSFTs * ( numSFTs + 1 ) / 2, XLAL_EFAILED );
+
+  MultiNoiseWeights multiWeights = { .length = 0, .data = NULL, .Sinv_Tsft = 3.7, .isNotNormalized = 0 };
+
+  REAL8Vector *curlyGAmp = XLALCreateREAL8Vector ( numPairs );
+  XLAL_CHECK_MAIN ( curlyGAmp != NULL, XLAL_EFUNC );
+  for ( UINT4 alpha = 0; alpha < numPairs; alpha ++ ) {
+    curlyGAmp->data[alpha] = gsl_ran_flat ( rng, -1.0, 1.0 );
+  }
+  COMPLEX8Vector *expSignalPhases = XLALCreateCOMPLEX8Vector ( numSFTs );
+  XLAL_CHECK_MAIN ( expSignalPhases != NULL, XLAL_EFUNC );
+  for ( UINT4 n = 0; n < numSFTs; n ++ ) {
+    const REAL8 phi = gsl_ran_flat ( rng, 0, LAL_TWOPI );
+    expSignalPhases->data[n] = crectf ( cos ( phi ), sin ( phi ) );
+  }
+  UINT4Vector *lowestBins = XLALCreateUINT4Vector ( numSFTs );
+  XLAL_CHECK_MAIN ( lowestBins != NULL, XLAL_EFUNC );
+
+  for ( UINT4 b = 0; b < XLAL_NUM_ELEM ( numBinsList ); b ++ )
+    {
+      const UINT4 numBins = numBinsList[b];
+
+      // ----- random lowest bins, of both parities, and sinc factors
+      REAL8VectorSequence *sincList = XLALCreateREAL8VectorSequence ( numSFTs, numBins );
+      XLAL_CHECK_MAIN ( sincList != NULL, XLAL_EFUNC );
+      for ( UINT4 n = 0; n < numSFTs; n ++ )
+        {
+          lowestBins->data[n] = gsl_rng_uniform_int ( rng, SFT_LENGTH - numBins + 1 );
+          for ( UINT4 l = 0; l < numBins; l ++ ) {
+            sincList->data[n * numBins + l] = gsl_ran_flat ( rng, -0.5, 1.0 );
+          }
+        }
+
+      REAL8 ccStat = 0, evSquared = 0;
+      XLAL_CHECK_MAIN ( XLALCalculatePulsarCrossCorrStatistic ( &ccStat, &evSquared, curlyGAmp, expSignalPhases, lowestBins, sincList,
+                                                                sftPairs, sftIndices, inputSFTs, &multiWeights, numBins ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      REAL8 ccStatRef = 0, evSquaredRef = 0, ccStatScale = 0, evSquaredScale = 0;
+      XLAL_CHECK_MAIN ( direct_CrossCorrStatistic ( &ccStatRef, &evSquaredRef, &ccStatScale, &evSquaredScale, curlyGAmp, expSignalPhases, lowestBins, sincList,
+                                                    sftPairs, sftIndices, inputSFTs, &multiWeights, numBins ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      const REAL8 err_ccStat = fabs ( ccStat - ccStatRef ) / ccStatScale;
+      const REAL8 err_evSquared = fabs ( evSquared - evSquaredRef ) / evSquaredScale;
+      XLALPrintInfo ( "numBins=%u, numPairs=%u: rho = %.17g, direct rho = %.17g, err(rho) = %g, err(E[rho]^2) = %g\n",
+                      numBins, numPairs, ccStat, ccStatRef, err_ccStat, err_evSquared );
+      XLAL_CHECK_MAIN ( err_ccStat <= REL_TOLERANCE && err_evSquared <= REL_TOLERANCE, XLAL_ETOL,
+                        "numBins=%u: rho = %.17g, E[rho]^2 = %.17g differ from direct sum rho = %.17g, E[rho]^2 = %.17g (errors %g, %g > %g)\n",
+                        numBins, ccStat, evSquared, ccStatRef, evSquaredRef, err_ccStat, err_evSquared, REL_TOLERANCE );
+
+      XLALDestroyREAL8VectorSequence ( sincList );
+    }
+
+  XLALDestroyUINT4Vector ( lowestBins );
+  XLALDestroyCOMPLEX8Vector ( expSignalPhases );
+  XLALDestroyREAL8Vector ( curlyGAmp );
+  XLALDestroySFTPairIndexList ( sftPairs );
+  XLALDestroySFTIndexList ( sftIndices );
+  XLALDestroyMultiSFTVector ( inputSFTs );
+  XLALDestroyUINT4Vector ( numSFTsX );
+  gsl_rng_free ( rng );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+} // main()
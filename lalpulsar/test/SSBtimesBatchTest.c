@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <config.h>
+#include <math.h>
+#include <float.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALInitBarycenter.h>
+#include <lal/Random.h>
+#include <lal/SFTfileIO.h>
+#include <lal/SSBtimes.h>
+
+/**
+ * \file
+ * \ingroup SSBtimes_h
+ * \brief Tests for XLALGetSSBtimesBatch() and XLALGetMultiSSBtimesBatch()
+ *
+ * The batched timings of a set of sky-positions are compared with those computed by XLALGetSSBtimes()
+ * for each sky-position in turn, for every SSB precision. The Newtonian timings use the same
+ * operations in the same order, but the compiler may contract the vectorised loop into fused
+ * multiply-adds differently, so they are allowed to differ by a few units in the last place. The
+ * other precisions call XLALGetSSBtimes() and must agree exactly.
+ */
+
+// number of random sky-positions, in addition to the poles
+#define NUM_RANDOM_SKY 30
+
+// allowed difference of the Newtonian timings, in units of the double-precision epsilon
+#define NEWTONIAN_ULPS 4
+
+/* maximal differences in DeltaT and Tdot, relative to the GPS time (the largest intermediate of DeltaT) and Tdot */
+static int
+compare_SSBtimes ( REAL8 *err_DeltaT, REAL8 *err_Tdot, const SSBtimes *t1, const SSBtimes *t2 )
+{
+  XLAL_CHECK ( t1 != NULL && t2 != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( XLALGPSCmp ( &t1->refTime, &t2->refTime ) == 0, XLAL_EFAILED, "Reference times differ\n" );
+  XLAL_CHECK ( t1->DeltaT->length == t2->DeltaT->length && t1->Tdot->length == t2->Tdot->length, XLAL_EFAILED, "Lengths differ\n" );
+
+  REAL8 refTimeREAL8 = XLALGPSGetREAL8 ( &t2->refTime );
+  for ( UINT4 i = 0; i < t1->DeltaT->length; i ++ )
+    {
+      REAL8 scale = fabs ( refTimeREAL8 + t2->DeltaT->data[i] );
+      (*err_DeltaT) = fmax ( (*err_DeltaT), fabs ( t1->DeltaT->data[i] - t2->DeltaT->data[i] ) / scale );
+      (*err_Tdot) = fmax ( (*err_Tdot), fabs ( t1->Tdot->data[i] - t2->Tdot->data[i] ) / fabs ( t2->Tdot->data[i] ) );
+    }
+
+  return XLAL_SUCCESS;
+
+} // compare_SSBtimes()
+
+int
+main ( void )
+{
+  const char earthEphem[] = TEST_PKG_DATA_DIR "earth00-40-DE405.dat.gz";
+  const char sunEphem[]   = TEST_PKG_DATA_DIR "sun00-40-DE405.dat.gz";
+  const char *sites[] = { "H1", "L1", "V1" };
+  const SSBprecision precisions[] = { SSBPREC_NEWTONIAN, SSBPREC_RELATIVISTIC, SSBPREC_RELATIVISTICOPT, SSBPREC_DMOFF };
+  const UINT4 numDetectors = XLAL_NUM_ELEM ( sites );
+  const UINT4 numSkyPoints = NUM_RANDOM_SKY + 2;
+  const REAL8 Tsft = 1800;
+
+  LIGOTimeGPS startTime = { 714180733, 0 };
+  LIGOTimeGPS refTime = { 714270733, 0 };	// middle of the 50-hour observation
+
+  // ----- set up detectors, timestamps and detector states
+  MultiLALDetector multiIFO;
+  multiIFO.length = numDetectors;
+  for ( UINT4 X = 0; X < numDetectors; X ++ )
+    {
+      const LALDetector *det = XLALGetSiteInfo ( sites[X] );
+      XLAL_CHECK_MAIN ( det != NULL, XLAL_EFUNC, "XLALGetSiteInfo ('%s') failed for detector X=%d\n", sites[X], X );
+      multiIFO.sites[X] = (*det);	 // struct copy
+    }
+
+  EphemerisData *edat = XLALInitBarycenter ( earthEphem, sunEphem );
+  XLAL_CHECK_MAIN ( edat != NULL, XLAL_EFUNC, "XLALInitBarycenter('%s','%s') failed\n", earthEphem, sunEphem );
+
+  MultiLIGOTimeGPSVector *multiTS = XLALMakeMultiTimestamps ( startTime, 180000, Tsft, 0, numDetectors );
+  XLAL_CHECK_MAIN ( multiTS != NULL, XLAL_EFUNC );
+
+  MultiDetectorStateSeries *multiDetStates = XLALGetMultiDetectorStates ( multiTS, &multiIFO, edat, 0.5 * Tsft );
+  XLAL_CHECK_MAIN ( multiDetStates != NULL, XLAL_EFUNC );
+
+  // ----- sky-positions: both poles, and random positions isotropic on the sky
+  SkyPosition skypos[NUM_RANDOM_SKY + 2];
+  RandomParams *rng = XLALCreateRandomParams ( 4321 );
+  XLAL_CHECK_MAIN ( rng != NULL, XLAL_EFUNC );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      skypos[s].system = COORDINATESYSTEM_EQUATORIAL;
+      if ( s < 2 ) {
+        skypos[s].longitude = 0;
+        skypos[s].latitude = ( s == 0 ) ? LAL_PI_2 : -LAL_PI_2;
+      } else {
+        skypos[s].longitude = LAL_TWOPI * XLALUniformDeviate ( rng );
+        skypos[s].latitude = asin ( 2.0 * XLALUniformDeviate ( rng ) - 1.0 );
+      }
+    }
+  XLALDestroyRandomParams ( rng );
+
+  for ( UINT4 p = 0; p < XLAL_NUM_ELEM ( precisions ); p ++ )
+    {
+      const REAL8 tolerance = ( precisions[p] == SSBPREC_NEWTONIAN ) ? NEWTONIAN_ULPS * DBL_EPSILON : 0;
+      REAL8 err_DeltaT = 0, err_Tdot = 0;
+      REAL8 errMulti_DeltaT = 0, errMulti_Tdot = 0;
+
+      SSBtimes *tSSB[NUM_RANDOM_SKY + 2] = { NULL };
+      MultiSSBtimes *multiSSB[NUM_RANDOM_SKY + 2] = { NULL };
+      XLAL_CHECK_MAIN ( XLALGetMultiSSBtimesBatch ( multiSSB, multiDetStates, skypos, numSkyPoints, refTime, precisions[p] ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      for ( UINT4 X = 0; X < numDetectors; X ++ )
+        {
+          XLAL_CHECK_MAIN ( XLALGetSSBtimesBatch ( tSSB, multiDetStates->data[X], skypos, numSkyPoints, refTime, precisions[p] ) == XLAL_SUCCESS, XLAL_EFUNC );
+          for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+            {
+              SSBtimes *single = XLALGetSSBtimes ( multiDetStates->data[X], skypos[s], refTime, precisions[p] );
+              XLAL_CHECK_MAIN ( single != NULL, XLAL_EFUNC );
+              XLAL_CHECK_MAIN ( multiSSB[s]->length == numDetectors, XLAL_EFAILED );
+              XLAL_CHECK_MAIN ( compare_SSBtimes ( &err_DeltaT, &err_Tdot, tSSB[s], single ) == XLAL_SUCCESS, XLAL_EFUNC, "X=%d, s=%d", X, s );
+              XLAL_CHECK_MAIN ( compare_SSBtimes ( &errMulti_DeltaT, &errMulti_Tdot, multiSSB[s]->data[X], single ) == XLAL_SUCCESS, XLAL_EFUNC, "X=%d, s=%d", X, s );
+              XLALDestroySSBtimes ( single );
+              XLALDestroySSBtimes ( tSSB[s] );
+              tSSB[s] = NULL;
+            }
+        }
+
+      for ( UINT4 s = 0; s < numSkyPoints; s ++ ) {
+        XLALDestroyMultiSSBtimes ( multiSSB[s] );
+      }
+
+      XLALPrintInfo ( "precision %d: err(DeltaT) = %g, err(Tdot) = %g, multi: err(DeltaT) = %g, err(Tdot) = %g\n",
+                      precisions[p], err_DeltaT, err_Tdot, errMulti_DeltaT, errMulti_Tdot );
+      XLAL_CHECK_MAIN ( err_DeltaT <= tolerance && err_Tdot <= tolerance, XLAL_ETOL,
+                        "precision %d: XLALGetSSBtimesBatch() errors (DeltaT = %g, Tdot = %g) exceed tolerance %g\n",
+                        precisions[p], err_DeltaT, err_Tdot, tolerance );
+      XLAL_CHECK_MAIN ( errMulti_DeltaT <= tolerance && errMulti_Tdot <= tolerance, XLAL_ETOL,
+                        "precision %d: XLALGetMultiSSBtimesBatch() errors (DeltaT = %g, Tdot = %g) exceed tolerance %g\n",
+                        precisions[p], errMulti_DeltaT, errMulti_Tdot, tolerance );
+    }
+
+  // ----- an empty batch succeeds
+  {
+    SSBtimes *tSSB[1] = { NULL };
+    MultiSSBtimes *multiSSB[1] = { NULL };
+    XLAL_CHECK_MAIN ( XLALGetSSBtimesBatch ( tSSB, multiDetStates->data[0], NULL, 0, refTime, SSBPREC_NEWTONIAN ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( XLALGetMultiSSBtimesBatch ( multiSSB, multiDetStates, NULL, 0, refTime, SSBPREC_NEWTONIAN ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( tSSB[0] == NULL && multiSSB[0] == NULL, XLAL_EFAILED );
+  }
+
+  XLALDestroyMultiDetectorStateSeries ( multiDetStates );
+  XLALDestroyMultiTimestamps ( multiTS );
+  XLALDestroyEphemerisData ( edat );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+} // main()
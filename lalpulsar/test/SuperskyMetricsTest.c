@@ -414,7 +414,7 @@ int main( void )
     FITSFile *file = XLALFITSFileOpenWrite( "SuperskyMetricsTest.fits" );
     XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC );
     XLAL_CHECK_MAIN( XLALFITSWriteSuperskyMetrics( file, metrics ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLALFITSFileClose( file );
+    XLAL_CHECK_MAIN( XLALFITSFileClose( file ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
   {
     FITSFile *file = XLALFITSFileOpenRead( "SuperskyMetricsTest.fits" );
@@ -38,7 +38,8 @@
  * \ingroup LALComputeAM_h
  *
  * \brief Test for XLALComputeAMCoeffs() and XLALComputeMultiAMCoeffs() by
- * comparison with the old LAL functions old_LALGetAMCoeffs() and old_LALGetMultiAMCoeffs().
+ * comparison with the old LAL functions old_LALGetAMCoeffs() and old_LALGetMultiAMCoeffs(),
+ * and for XLALComputeMultiAMCoeffsBatch() by comparison with XLALComputeMultiAMCoeffs().
  *
  * Note, we run a comparison only for the 2-IFO multiAM functions XLALComputeMultiAMCoeffs()
  * comparing it to old_LALGetMultiAMCoeffs() [combined with XLALWeightMultiAMCoeffs()],
@@ -198,6 +199,30 @@ int main(int argc, char *argv[])
         return XLAL_EFAILED;
       }
 
+      /* ----- compute multiAM using batched XLAL function, for this and the antipodal sky-position ----- */
+      SkyPosition skyposBatch[2] = { skypos, skypos };
+      skyposBatch[1].longitude = fmod ( skypos.longitude + LAL_PI, LAL_TWOPI );
+      skyposBatch[1].latitude = - skypos.latitude;
+      MultiAMCoeffs *multiAM_batch[2] = { NULL, NULL };
+      if ( XLALComputeMultiAMCoeffsBatch ( multiAM_batch, multiDetStates, weights, skyposBatch, 2 ) != XLAL_SUCCESS ) {
+        XLALPrintError ("%s: XLALComputeMultiAMCoeffsBatch() failed with xlalErrno = %d\n", __func__, xlalErrno );
+        return XLAL_EFAILED;
+      }
+      for ( UINT4 s = 0; s < 2; s ++ )
+        {
+          MultiAMCoeffs *multiAM_single;
+          if ( ( multiAM_single = XLALComputeMultiAMCoeffs ( multiDetStates, weights, skyposBatch[s] )) == NULL ) {
+            XLALPrintError ("%s: XLALComputeMultiAMCoeffs() failed with xlalErrno = %d\n", __func__, xlalErrno );
+            return XLAL_EFAILED;
+          }
+          if ( XLALCompareMultiAMCoeffs ( multiAM_batch[s], multiAM_single, tolerance ) != XLAL_SUCCESS ) {
+            XLALPrintError ("%s: comparison between batched and single-sky multiAM_XLAL failed.\n", __func__ );
+            return XLAL_EFAILED;
+          }
+          XLALDestroyMultiAMCoeffs ( multiAM_single );
+          XLALDestroyMultiAMCoeffs ( multiAM_batch[s] );
+        }
+
       /* free memory created inside this loop */
       XLALDestroyMultiAMCoeffs ( multiAM_LAL );
       XLALDestroyMultiAMCoeffs ( multiAM_XLAL );
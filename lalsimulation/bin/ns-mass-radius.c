@@ -51,6 +51,7 @@ int main(int argc, char *argv[])
     double logpmin = 75.5;
     double logpmax;
     double dlogp;
+    LALSimNeutronStarTOVWorkspace *work;
     long i;
 
     XLALSetErrorHandler(XLALAbortErrorHandler);
@@ -72,19 +73,15 @@ int main(int argc, char *argv[])
     logpmax = log(XLALSimNeutronStarEOSMaxPressure(global_eos));
     dlogp = (logpmax - logpmin) / global_npts;
 
+    /* the same integrator memory is reused for every star */
+    work = XLALCreateSimNeutronStarTOVWorkspace(global_epsrel == 0 ? 1e-6 : global_epsrel);
+
     for (i = 0; i < global_npts; ++i) {
         double pc = exp(logpmin + (0.5 + i) * dlogp);
         double c, m, r, k2, I1, I2, I3, J1, J2, J3, w, z;
         if (global_virial == 0)
         {
-            if (global_epsrel == 0)
-            {
-                XLALSimNeutronStarTOVODEIntegrate(&r, &m, &k2, pc, global_eos);
-            }
-            else
-            {
-                XLALSimNeutronStarTOVODEIntegrateWithTolerance(&r, &m, &k2, pc, global_eos, global_epsrel);
-            }
+            XLALSimNeutronStarTOVODEIntegrateWithWorkspace(&r, &m, &k2, pc, global_eos, work);
             /* convert units */
             m /= LAL_MSUN_SI;       /* mass in solar masses */
             c = m * LAL_MRSUN_SI / r;       /* compactness (dimensionless) */
@@ -114,6 +111,7 @@ int main(int argc, char *argv[])
         }   
     }
 
+    XLALDestroySimNeutronStarTOVWorkspace(work);
     XLALDestroySimNeutronStarEOS(global_eos);
     LALCheckMemoryLeaks();
     return 0;
@@ -33,6 +33,7 @@
 #include <lal/LALConstants.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALString.h>
+#include <lal/LALProfile.h>
 #include <lal/Sequence.h>
 #include <lal/TimeSeries.h>
 #include <lal/FrequencySeries.h>
@@ -879,7 +880,9 @@ int XLALSimInspiralChooseFDWaveform(
     XLALSimInspiralWaveformParamsInsertFMax(params, f_max);
     XLALSimInspiralWaveformParamsInsertF22Ref(params, f_ref);
 
+    XLAL_PROFILE_BEGIN("XLALSimInspiralChooseFDWaveform");
     ret = XLALSimInspiralGenerateFDWaveform(hptilde, hctilde, params, generator);
+    XLAL_PROFILE_END("XLALSimInspiralChooseFDWaveform");
     XLALDestroyDict(params);
     XLALDestroySimInspiralGenerator(generator);
 
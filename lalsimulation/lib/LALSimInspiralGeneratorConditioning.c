@@ -1,4 +1,5 @@
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALConstants.h>
@@ -11,6 +12,7 @@
 #include <lal/Units.h>
 #include <lal/LALSimInspiral.h>
 #include <lal/LALSimInspiralWaveformParams.h>
+#include <lal/LALSimInspiralWaveformCache.h>
 #include "fix_reference_frequency_macro.h"
 #include "LALSimInspiralGenerator_private.h"
 
@@ -304,6 +306,486 @@ static int generate_conditioned_td_waveform_from_fd(REAL8TimeSeries **hplus, REA
     return 0;
 }
 
+/*
+ * Multibanded generation of frequency domain waveforms.
+ *
+ * If a positive ConditioningThresholdMband is set, approximants that can be
+ * evaluated on an arbitrary frequency sequence are computed on a sparse set
+ * of frequency nodes and interpolated onto the uniform frequency grid.  The
+ * amplitude and phase of each polarization are interpolated with cubic
+ * Hermite polynomials; the derivatives at a node come from a pair of closely
+ * spaced evaluations, which also fixes the phase unwrapping between nodes.
+ * The initial node spacing follows the leading-order stationary phase chirp;
+ * every interval is then checked at its midpoint and bisected until the error
+ * there is below the threshold relative to the local amplitude.  Intervals
+ * that cannot be refined further are evaluated directly on the uniform grid.
+ */
+
+#define MULTIBAND_DERIVATIVE_STEP 0.01 /* in units of deltaF */
+#define MULTIBAND_MIN_INTERVAL 4.0 /* in units of deltaF */
+#define MULTIBAND_MAX_RELATIVE_SPACING 0.03125
+#define MULTIBAND_AMPLITUDE_FLOOR 1e-9 /* relative to the peak amplitude */
+#define MULTIBAND_MAX_ITERATIONS 32
+
+struct multiband_source {
+    REAL8 m1, m2, S1x, S1y, S1z, S2x, S2y, S2z;
+    REAL8 distance, inclination, phiRef, f_ref;
+    REAL8 fstart;
+    LALDict *params;
+    Approximant approx;
+};
+
+struct multiband_nodes {
+    size_t length;
+    size_t max_length;
+    REAL8 *f;
+    REAL8 *amp[2];
+    REAL8 *damp[2];
+    REAL8 *phi[2];
+    REAL8 *dphi[2];
+};
+
+struct multiband_interval {
+    REAL8 fa, fb; /* end point frequencies */
+    size_t a, b; /* end point node indices */
+    size_t ka, kb; /* range of uniform frequency bins */
+    int direct;
+};
+
+/* approximants supported by XLALSimInspiralChooseFDWaveformSequence() */
+static int multiband_supported(int approx)
+{
+    switch (approx) {
+    case TaylorF2:
+    case SEOBNRv4_ROM:
+    case SEOBNRv4HM_ROM:
+    case SEOBNRv5_ROM:
+    case SEOBNRv4_ROM_NRTidalv2:
+    case SEOBNRv4_ROM_NRTidalv2_NSBH:
+    case IMRPhenomPv2:
+    case IMRPhenomD:
+    case IMRPhenomD_NRTidalv2:
+    case IMRPhenomPv2_NRTidalv2:
+    case IMRPhenomHM:
+    case IMRPhenomXAS:
+    case IMRPhenomXHM:
+    case IMRPhenomXP:
+    case IMRPhenomXPHM:
+    case IMRPhenomNSBH:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int multiband_evaluate(COMPLEX16 *hp, COMPLEX16 *hc, const REAL8 *f, size_t n, const struct multiband_source *src)
+{
+    COMPLEX16FrequencySeries *hptilde = NULL;
+    COMPLEX16FrequencySeries *hctilde = NULL;
+    REAL8Sequence *frequencies;
+    int retval;
+
+    if (n == 0)
+        return 0;
+
+    /* the first frequency is taken as f_min by the approximant, so keep it
+     * the same for every evaluation */
+    frequencies = XLALCreateREAL8Sequence(n + 1);
+    XLAL_CHECK(frequencies, XLAL_EFUNC);
+    frequencies->data[0] = src->fstart;
+    memcpy(frequencies->data + 1, f, n * sizeof(*f));
+
+    retval = XLALSimInspiralChooseFDWaveformSequence(&hptilde, &hctilde, src->phiRef, src->m1, src->m2, src->S1x, src->S1y, src->S1z, src->S2x, src->S2y, src->S2z, src->f_ref, src->distance, src->inclination, src->params, src->approx, frequencies);
+    XLALDestroyREAL8Sequence(frequencies);
+    if (retval < 0 || hptilde->data->length != n + 1 || hctilde->data->length != n + 1) {
+        XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+        XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+
+    memcpy(hp, hptilde->data->data + 1, n * sizeof(*hp));
+    memcpy(hc, hctilde->data->data + 1, n * sizeof(*hc));
+    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    return 0;
+}
+
+static void multiband_destroy_nodes(struct multiband_nodes *nodes)
+{
+    int p;
+    XLALFree(nodes->f);
+    for (p = 0; p < 2; ++p) {
+        XLALFree(nodes->amp[p]);
+        XLALFree(nodes->damp[p]);
+        XLALFree(nodes->phi[p]);
+        XLALFree(nodes->dphi[p]);
+    }
+    memset(nodes, 0, sizeof(*nodes));
+}
+
+/* evaluate the waveform about each frequency in f and append the nodes */
+static int multiband_add_nodes(struct multiband_nodes *nodes, const REAL8 *f, size_t n, REAL8 eps, const struct multiband_source *src)
+{
+    REAL8 *fpair;
+    COMPLEX16 *hpair[2];
+    size_t i;
+    int p;
+
+    if (nodes->length + n > nodes->max_length) {
+        size_t max_length = 2 * (nodes->length + n);
+        XLAL_CHECK((nodes->f = XLALRealloc(nodes->f, max_length * sizeof(*nodes->f))), XLAL_ENOMEM);
+        for (p = 0; p < 2; ++p) {
+            XLAL_CHECK((nodes->amp[p] = XLALRealloc(nodes->amp[p], max_length * sizeof(REAL8))), XLAL_ENOMEM);
+            XLAL_CHECK((nodes->damp[p] = XLALRealloc(nodes->damp[p], max_length * sizeof(REAL8))), XLAL_ENOMEM);
+            XLAL_CHECK((nodes->phi[p] = XLALRealloc(nodes->phi[p], max_length * sizeof(REAL8))), XLAL_ENOMEM);
+            XLAL_CHECK((nodes->dphi[p] = XLALRealloc(nodes->dphi[p], max_length * sizeof(REAL8))), XLAL_ENOMEM);
+        }
+        nodes->max_length = max_length;
+    }
+
+    fpair = XLALMalloc(2 * n * sizeof(*fpair));
+    hpair[0] = XLALMalloc(2 * n * sizeof(COMPLEX16));
+    hpair[1] = XLALMalloc(2 * n * sizeof(COMPLEX16));
+    if (!fpair || !hpair[0] || !hpair[1]) {
+        XLALFree(fpair);
+        XLALFree(hpair[0]);
+        XLALFree(hpair[1]);
+        XLAL_ERROR(XLAL_ENOMEM);
+    }
+
+    for (i = 0; i < n; ++i) {
+        fpair[2 * i] = f[i] - 0.5 * eps;
+        fpair[2 * i + 1] = f[i] + 0.5 * eps;
+    }
+    if (multiband_evaluate(hpair[0], hpair[1], fpair, 2 * n, src) < 0) {
+        XLALFree(fpair);
+        XLALFree(hpair[0]);
+        XLALFree(hpair[1]);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+
+    for (i = 0; i < n; ++i) {
+        size_t j = nodes->length + i;
+        nodes->f[j] = f[i];
+        for (p = 0; p < 2; ++p) {
+            COMPLEX16 lo = hpair[p][2 * i];
+            COMPLEX16 hi = hpair[p][2 * i + 1];
+            REAL8 dphase = carg(hi * conj(lo));
+            nodes->amp[p][j] = 0.5 * (cabs(lo) + cabs(hi));
+            nodes->damp[p][j] = (cabs(hi) - cabs(lo)) / eps;
+            nodes->phi[p][j] = carg(lo) + 0.5 * dphase;
+            nodes->dphi[p][j] = dphase / eps;
+        }
+    }
+    nodes->length += n;
+
+    XLALFree(fpair);
+    XLALFree(hpair[0]);
+    XLALFree(hpair[1]);
+    return 0;
+}
+
+/* cubic Hermite coefficients of amplitude and phase on the interval [a, b]:
+ * c[0..3] for the amplitude and c[4..7] for the phase, in powers of t */
+static void multiband_hermite(REAL8 c[8], const struct multiband_nodes *nodes, size_t a, size_t b, int p)
+{
+    REAL8 df = nodes->f[b] - nodes->f[a];
+    REAL8 y0, y1, d0, d1;
+    int q;
+
+    for (q = 0; q < 2; ++q) {
+        if (q == 0) {
+            y0 = nodes->amp[p][a];
+            y1 = nodes->amp[p][b];
+            d0 = nodes->damp[p][a] * df;
+            d1 = nodes->damp[p][b] * df;
+        } else {
+            y0 = nodes->phi[p][a];
+            y1 = nodes->phi[p][b];
+            d0 = nodes->dphi[p][a] * df;
+            d1 = nodes->dphi[p][b] * df;
+            /* unwrap the phase at b about the trapezoidal prediction */
+            y1 += LAL_TWOPI * round((y0 + 0.5 * (d0 + d1) - y1) / LAL_TWOPI);
+        }
+        c[4 * q] = y0;
+        c[4 * q + 1] = d0;
+        c[4 * q + 2] = 3.0 * (y1 - y0) - 2.0 * d0 - d1;
+        c[4 * q + 3] = 2.0 * (y0 - y1) + d0 + d1;
+    }
+}
+
+static COMPLEX16 multiband_hermite_eval(const REAL8 c[8], REAL8 t)
+{
+    REAL8 amp = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    REAL8 phi = c[4] + t * (c[5] + t * (c[6] + t * c[7]));
+    return amp * cexp(I * phi);
+}
+
+/* error of the interpolant at the midpoint node mid; the value error can
+ * vanish there by chance, so the derivative error over a fraction of the
+ * interval is included as well */
+static REAL8 multiband_midpoint_error(const REAL8 c[8], const struct multiband_nodes *nodes, size_t mid, REAL8 df, int p)
+{
+    REAL8 amp = c[0] + 0.5 * (c[1] + 0.5 * (c[2] + 0.5 * c[3]));
+    REAL8 phi = c[4] + 0.5 * (c[5] + 0.5 * (c[6] + 0.5 * c[7]));
+    REAL8 damp = (c[1] + c[2] + 0.75 * c[3]) / df;
+    REAL8 dphi = (c[5] + c[6] + 0.75 * c[7]) / df;
+    REAL8 err_amp = fabs(amp - nodes->amp[p][mid]) + 0.125 * df * fabs(damp - nodes->damp[p][mid]);
+    REAL8 err_phi = fabs(remainder(phi - nodes->phi[p][mid], LAL_TWOPI)) + 0.125 * df * fabs(dphi - nodes->dphi[p][mid]);
+    return err_amp + nodes->amp[p][mid] * err_phi;
+}
+
+static int multiband_compare_intervals(const void *a, const void *b)
+{
+    const struct multiband_interval *ia = a;
+    const struct multiband_interval *ib = b;
+    return (ia->fa > ib->fa) - (ia->fa < ib->fa);
+}
+
+/* initial node spacing from the leading-order stationary phase chirp: the
+ * error of cubic Hermite interpolation of the phase is bounded by
+ * df^4 |Psi''''| / 384 */
+static REAL8 multiband_initial_spacing(REAL8 f, REAL8 Mc, REAL8 threshold, REAL8 deltaF)
+{
+    REAL8 tau = 5.0 / 256.0 * pow(Mc, -5.0 / 3.0) * pow(LAL_PI * f, -8.0 / 3.0);
+    REAL8 d2 = LAL_TWOPI * (8.0 / 3.0) * tau / f;
+    REAL8 d4 = (154.0 / 9.0) * d2 / (f * f);
+    REAL8 df = pow(384.0 * threshold / d4, 0.25);
+    if (df > MULTIBAND_MAX_RELATIVE_SPACING * f)
+        df = MULTIBAND_MAX_RELATIVE_SPACING * f;
+    if (df < MULTIBAND_MIN_INTERVAL * deltaF)
+        df = MULTIBAND_MIN_INTERVAL * deltaF;
+    return df;
+}
+
+/* initial nodes between f_lo and f_hi; returns the number of nodes and
+ * stores them in f if it is not NULL */
+static size_t multiband_initial_nodes(REAL8 *f, REAL8 f_lo, REAL8 f_hi, REAL8 Mc, REAL8 threshold, REAL8 deltaF)
+{
+    REAL8 fnode = f_lo;
+    size_t n = 0;
+
+    while (fnode < f_hi - 0.5 * MULTIBAND_MIN_INTERVAL * deltaF) {
+        if (f)
+            f[n] = fnode;
+        ++n;
+        fnode += multiband_initial_spacing(fnode, Mc, threshold, deltaF);
+    }
+    if (f)
+        f[n] = f_hi;
+    return n + 1;
+}
+
+static int generate_multibanded_fd_waveform(COMPLEX16FrequencySeries **hplus, COMPLEX16FrequencySeries **hcross, LALDict *params, int approx, REAL8 threshold)
+{
+    struct multiband_source src;
+    struct multiband_nodes nodes;
+    struct multiband_interval *pending = NULL;
+    struct multiband_interval *next = NULL;
+    struct multiband_interval *final = NULL;
+    REAL8 *f = NULL;
+    COMPLEX16 *hdirect[2] = {NULL, NULL};
+    COMPLEX16 *hpdata, *hcdata;
+    LIGOTimeGPS epoch = LIGOTIMEGPSZERO;
+    REAL8 longAscNodes, eccentricity, meanPerAno, deltaF, f_min, f_max;
+    REAL8 Mc, eps, fend, amp_floor;
+    size_t npending, nnext, nfinal, ndirect;
+    size_t k, kstart, kend, n, i, j;
+    int chirplen_exp;
+    int iter;
+
+    memset(&nodes, 0, sizeof(nodes));
+
+    XLALSimInspiralParseDictionaryToChooseFDWaveform(&src.m1, &src.m2, &src.S1x, &src.S1y, &src.S1z, &src.S2x, &src.S2y, &src.S2z, &src.distance, &src.inclination, &src.phiRef, &longAscNodes, &eccentricity, &meanPerAno, &deltaF, &f_min, &f_max, &src.f_ref, params);
+    XLAL_CHECK(deltaF > 0.0, XLAL_EINVAL, "Multibanding requires a nonzero frequency interval");
+    src.fstart = f_min;
+    src.params = params;
+    src.approx = approx;
+
+    /* same length as the uniform-grid approximants: the next power of two
+     * multiple of deltaF above f_max, including the Nyquist frequency */
+    n = round(f_max / deltaF);
+    if ((n & (n - 1))) {
+        frexp(n, &chirplen_exp);
+        n = ldexp(1.0, chirplen_exp);
+    }
+    fend = f_max < n * deltaF ? f_max : n * deltaF;
+    kstart = ceil(f_min / deltaF);
+    kend = floor(fend / deltaF);
+    XLAL_CHECK(kend > kstart, XLAL_EINVAL, "Frequency band [%g, %g] Hz is empty", f_min, fend);
+
+    *hplus = *hcross = NULL;
+    XLAL_CHECK((*hplus = XLALCreateCOMPLEX16FrequencySeries("hptilde: FD waveform", &epoch, 0.0, deltaF, &lalStrainUnit, n + 1)), XLAL_EFUNC);
+    XLAL_CHECK_FAIL((*hcross = XLALCreateCOMPLEX16FrequencySeries("hctilde: FD waveform", &epoch, 0.0, deltaF, &lalStrainUnit, n + 1)), XLAL_EFUNC);
+    memset((*hplus)->data->data, 0, (n + 1) * sizeof(COMPLEX16));
+    memset((*hcross)->data->data, 0, (n + 1) * sizeof(COMPLEX16));
+    /* coalesce at t=0 */
+    XLAL_CHECK_FAIL(XLALGPSAdd(&(*hplus)->epoch, -1.0 / deltaF), XLAL_EFUNC);
+    XLAL_CHECK_FAIL(XLALGPSAdd(&(*hcross)->epoch, -1.0 / deltaF), XLAL_EFUNC);
+
+    /* initial nodes: a node at f is evaluated at f -/+ eps/2, so keep the
+     * outermost nodes inside [f_min, fend] */
+    eps = MULTIBAND_DERIVATIVE_STEP * deltaF;
+    Mc = pow(src.m1 * src.m2, 0.6) * pow(src.m1 + src.m2, -0.2) * LAL_MTSUN_SI / LAL_MSUN_SI;
+    n = multiband_initial_nodes(NULL, f_min + 0.5 * eps, fend - 0.5 * eps, Mc, threshold, deltaF);
+    if (n < 2) {
+        /* band too narrow to interpolate: evaluate it directly */
+        XLAL_CHECK_FAIL((final = XLALMalloc(sizeof(*final))), XLAL_ENOMEM);
+        final[0].a = final[0].b = 0;
+        final[0].fa = f_min;
+        final[0].fb = fend;
+        final[0].direct = 1;
+        nfinal = 1;
+        goto multiband_intervals_done;
+    }
+    XLAL_CHECK_FAIL((f = XLALMalloc(n * sizeof(*f))), XLAL_ENOMEM);
+    multiband_initial_nodes(f, f_min + 0.5 * eps, fend - 0.5 * eps, Mc, threshold, deltaF);
+    XLAL_CHECK_FAIL(multiband_add_nodes(&nodes, f, n, eps, &src) == 0, XLAL_EFUNC);
+
+    XLAL_CHECK_FAIL((pending = XLALMalloc((n - 1) * sizeof(*pending))), XLAL_ENOMEM);
+    for (npending = 0; npending < n - 1; ++npending) {
+        pending[npending].a = npending;
+        pending[npending].b = npending + 1;
+        pending[npending].fa = nodes.f[npending];
+        pending[npending].fb = nodes.f[npending + 1];
+        pending[npending].direct = 0;
+    }
+    XLAL_CHECK_FAIL((final = XLALMalloc(npending * sizeof(*final))), XLAL_ENOMEM);
+    nfinal = 0;
+
+    /* peak amplitude over the initial nodes sets an absolute error floor,
+     * so that zeros of one polarization do not force endless refinement */
+    amp_floor = 0.0;
+    for (i = 0; i < nodes.length; ++i)
+        for (int p = 0; p < 2; ++p)
+            if (nodes.amp[p][i] > amp_floor)
+                amp_floor = nodes.amp[p][i];
+    amp_floor *= MULTIBAND_AMPLITUDE_FLOOR;
+
+    /* refine until every interval passes its midpoint test */
+    for (iter = 0; npending > 0 && iter < MULTIBAND_MAX_ITERATIONS; ++iter) {
+        size_t first = nodes.length;
+
+        XLALFree(f);
+        XLAL_CHECK_FAIL((f = XLALMalloc(npending * sizeof(*f))), XLAL_ENOMEM);
+        for (i = 0; i < npending; ++i)
+            f[i] = 0.5 * (pending[i].fa + pending[i].fb);
+        XLAL_CHECK_FAIL(multiband_add_nodes(&nodes, f, npending, eps, &src) == 0, XLAL_EFUNC);
+
+        XLAL_CHECK_FAIL((next = XLALMalloc(2 * npending * sizeof(*next))), XLAL_ENOMEM);
+        XLAL_CHECK_FAIL((final = XLALRealloc(final, (nfinal + npending) * sizeof(*final))), XLAL_ENOMEM);
+        for (nnext = 0, i = 0; i < npending; ++i) {
+            struct multiband_interval *in = pending + i;
+            size_t c = first + i;
+            int pass = 1;
+            for (int p = 0; p < 2; ++p) {
+                REAL8 coef[8];
+                REAL8 tol;
+                multiband_hermite(coef, &nodes, in->a, in->b, p);
+                tol = threshold * (nodes.amp[0][c] > nodes.amp[1][c] ? nodes.amp[0][c] : nodes.amp[1][c]);
+                if (multiband_midpoint_error(coef, &nodes, c, in->fb - in->fa, p) > (tol > amp_floor ? tol : amp_floor))
+                    pass = 0;
+            }
+            if (pass)
+                final[nfinal++] = *in;
+            else if (in->fb - in->fa < 2.0 * MULTIBAND_MIN_INTERVAL * deltaF) {
+                final[nfinal] = *in;
+                final[nfinal++].direct = 1;
+            } else {
+                next[nnext] = *in;
+                next[nnext].b = c;
+                next[nnext++].fb = nodes.f[c];
+                next[nnext] = *in;
+                next[nnext].a = c;
+                next[nnext++].fa = nodes.f[c];
+            }
+        }
+        XLALFree(pending);
+        pending = next;
+        next = NULL;
+        npending = nnext;
+    }
+    /* anything left over is evaluated directly */
+    XLAL_CHECK_FAIL((final = XLALRealloc(final, (nfinal + npending) * sizeof(*final))), XLAL_ENOMEM);
+    for (i = 0; i < npending; ++i) {
+        final[nfinal] = pending[i];
+        final[nfinal++].direct = 1;
+    }
+    qsort(final, nfinal, sizeof(*final), multiband_compare_intervals);
+
+multiband_intervals_done:
+
+    /* uniform frequency bins belonging to each interval: the first and last
+     * intervals also take the bins just outside the outermost nodes */
+    for (j = 0; j < nfinal; ++j) {
+        final[j].ka = j == 0 ? kstart : (size_t)ceil(final[j].fa / deltaF);
+        final[j].kb = j == nfinal - 1 ? kend + 1 : (size_t)ceil(final[j].fb / deltaF);
+    }
+
+    /* intervals that could not be interpolated */
+    for (ndirect = 0, j = 0; j < nfinal; ++j)
+        if (final[j].direct && final[j].kb > final[j].ka)
+            ndirect += final[j].kb - final[j].ka;
+    if (ndirect) {
+        XLALFree(f);
+        XLAL_CHECK_FAIL((f = XLALMalloc(ndirect * sizeof(*f))), XLAL_ENOMEM);
+        XLAL_CHECK_FAIL((hdirect[0] = XLALMalloc(ndirect * sizeof(COMPLEX16))), XLAL_ENOMEM);
+        XLAL_CHECK_FAIL((hdirect[1] = XLALMalloc(ndirect * sizeof(COMPLEX16))), XLAL_ENOMEM);
+        for (i = 0, j = 0; j < nfinal; ++j)
+            if (final[j].direct)
+                for (k = final[j].ka; k < final[j].kb; ++k)
+                    f[i++] = k * deltaF;
+        XLAL_CHECK_FAIL(multiband_evaluate(hdirect[0], hdirect[1], f, ndirect, &src) == 0, XLAL_EFUNC);
+        for (i = 0, j = 0; j < nfinal; ++j)
+            if (final[j].direct)
+                for (k = final[j].ka; k < final[j].kb; ++k, ++i) {
+                    (*hplus)->data->data[k] = hdirect[0][i];
+                    (*hcross)->data->data[k] = hdirect[1][i];
+                }
+    }
+
+    /* interpolate onto the uniform frequency grid */
+    hpdata = (*hplus)->data->data;
+    hcdata = (*hcross)->data->data;
+    #pragma omp parallel for schedule(dynamic)
+    for (j = 0; j < nfinal; ++j) {
+        const struct multiband_interval *in = final + j;
+        REAL8 coef[2][8];
+        REAL8 df;
+        if (in->direct)
+            continue;
+        df = in->fb - in->fa;
+        multiband_hermite(coef[0], &nodes, in->a, in->b, 0);
+        multiband_hermite(coef[1], &nodes, in->a, in->b, 1);
+        for (size_t kk = in->ka; kk < in->kb; ++kk) {
+            REAL8 t = (kk * deltaF - in->fa) / df;
+            hpdata[kk] = multiband_hermite_eval(coef[0], t);
+            hcdata[kk] = multiband_hermite_eval(coef[1], t);
+        }
+    }
+
+    XLALFree(f);
+    XLALFree(hdirect[0]);
+    XLALFree(hdirect[1]);
+    XLALFree(pending);
+    XLALFree(final);
+    multiband_destroy_nodes(&nodes);
+    return 0;
+
+XLAL_FAIL:
+    XLALFree(f);
+    XLALFree(hdirect[0]);
+    XLALFree(hdirect[1]);
+    XLALFree(pending);
+    XLALFree(next);
+    XLALFree(final);
+    multiband_destroy_nodes(&nodes);
+    XLALDestroyCOMPLEX16FrequencySeries(*hplus);
+    XLALDestroyCOMPLEX16FrequencySeries(*hcross);
+    *hplus = *hcross = NULL;
+    return XLAL_FAILURE;
+}
+
 /* Conditioning a Fourier domain waveform to be properly transformed to the time domain. This code was taken from the original XLALSimInspiralFD() function, corresponding to the FD approximants part.
  * The redshift correction has been removed, now it is up to the user to apply the proper corrections depending on the meanining of the masses and distance they use.
  */
@@ -320,6 +802,7 @@ static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **h
     double tchirp, tmerge, textra, tshift;
     double fstart, fisco;
     double m1, m2, s1z, s2z, s;
+    double threshold;
     size_t k, k0, k1;
     int chirplen_exp;
     int retval;
@@ -333,6 +816,7 @@ static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **h
     m2 = XLALSimInspiralWaveformParamsLookupMass2(params);
     s1z = XLALSimInspiralWaveformParamsLookupSpin1z(params);
     s2z = XLALSimInspiralWaveformParamsLookupSpin2z(params);
+    threshold = XLALSimInspiralWaveformParamsLookupConditioningThresholdMband(params);
 
     /* adjust the reference frequency for certain precessing approximants:
      * if that approximate interprets f_ref==0 to be f_min, set f_ref=f_min;
@@ -440,7 +924,10 @@ static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **h
     XLALSimInspiralWaveformParamsInsertF22Ref(new_params, f_ref);
     XLALSimInspiralWaveformParamsInsertF22Start(new_params, fstart);
     XLALSimInspiralWaveformParamsInsertDeltaF(new_params, deltaF);
-    retval = internal_generator->generate_fd_waveform(hplus, hcross, new_params, internal_generator);
+    if (threshold > 0.0 && multiband_supported(approx))
+        retval = generate_multibanded_fd_waveform(hplus, hcross, new_params, approx, threshold);
+    else
+        retval = internal_generator->generate_fd_waveform(hplus, hcross, new_params, internal_generator);
     XLALDestroyDict(new_params);
     if (retval < 0)
         XLAL_ERROR(XLAL_EFUNC);
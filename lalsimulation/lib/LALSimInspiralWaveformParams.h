@@ -144,6 +144,9 @@ int XLALSimInspiralWaveformParamsInsertPhenomXPHMModesL0Frame(LALDict *params, I
 int XLALSimInspiralWaveformParamsInsertPhenomXPHMPrecModes(LALDict *params, INT4 value);
 int XLALSimInspiralWaveformParamsInsertPhenomXPHMTwistPhenomHM(LALDict *params, INT4 value);
 
+/* Generator conditioning */
+int XLALSimInspiralWaveformParamsInsertConditioningThresholdMband(LALDict *params, REAL8 value);
+
 /* IMRPhenomXCP Parameters */
 int XLALSimInspiralWaveformParamsInsertPhenomXCPMU1(LALDict *params, REAL8 value);
 int XLALSimInspiralWaveformParamsInsertPhenomXCPMU2(LALDict *params, REAL8 value);
@@ -421,6 +424,9 @@ INT4 XLALSimInspiralWaveformParamsLookupPhenomXPHMPrecModes(LALDict *params);
 INT4 XLALSimInspiralWaveformParamsLookupPhenomXPHMTwistPhenomHM(LALDict *params);
 INT4 XLALSimInspiralWaveformParamsLookupPhenomXPTransPrecessionMethod(LALDict *params);
 
+/* Generator conditioning */
+REAL8 XLALSimInspiralWaveformParamsLookupConditioningThresholdMband(LALDict *params);
+
 /* IMRPhenomXCP Parameters */
 REAL8 XLALSimInspiralWaveformParamsLookupPhenomXCPMU1(LALDict *params);
 REAL8 XLALSimInspiralWaveformParamsLookupPhenomXCPMU2(LALDict *params);
@@ -630,6 +636,9 @@ int XLALSimInspiralWaveformParamsPhenomXPHMModesL0FrameIsDefault(LALDict *params
 int XLALSimInspiralWaveformParamsPhenomXPHMPrecModesIsDefault(LALDict *params);
 int XLALSimInspiralWaveformParamsPhenomXPHMTwistPhenomHMIsDefault(LALDict *params);
 
+/* Generator conditioning */
+int XLALSimInspiralWaveformParamsConditioningThresholdMbandIsDefault(LALDict *params);
+
 /* IMRPhenomTHM Parameters */
 int XLALSimInspiralWaveformParamsPhenomTHMInspiralVersionIsDefault(LALDict *params);
 int XLALSimInspiralWaveformParamsPhenomTPHMMergerVersionIsDefault(LALDict *params);
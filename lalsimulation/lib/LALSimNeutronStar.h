@@ -32,6 +32,7 @@
 #ifndef _LALSIMNEUTRONSTAR_H
 #define _LALSIMNEUTRONSTAR_H
 
+#include <lal/LALDatatypes.h>
 #include <lal/LALConstants.h>
 
 
@@ -127,6 +128,14 @@ double XLALSimNeutronStarEOSSpeedOfSoundGeometerized(double h,
 
 /* TOV ROUTINES */
 
+/** Incomplete type for a reusable TOV integration workspace. */
+typedef struct tagLALSimNeutronStarTOVWorkspace LALSimNeutronStarTOVWorkspace;
+
+void XLALDestroySimNeutronStarTOVWorkspace(LALSimNeutronStarTOVWorkspace *
+    work);
+LALSimNeutronStarTOVWorkspace *XLALCreateSimNeutronStarTOVWorkspace(double
+    epsrel);
+
 int XLALSimNeutronStarTOVODEIntegrate(double *radius, double *mass,
     double *love_number_k2, double central_pressure_si,
     LALSimNeutronStarEOS * eos);
@@ -135,6 +144,10 @@ int XLALSimNeutronStarTOVODEIntegrateWithTolerance(double *radius, double *mass,
     double *love_number_k2, double central_pressure_si,
     LALSimNeutronStarEOS * eos, double epsrel);
 
+int XLALSimNeutronStarTOVODEIntegrateWithWorkspace(double *radius,
+    double *mass, double *love_number_k2, double central_pressure_si,
+    LALSimNeutronStarEOS * eos, LALSimNeutronStarTOVWorkspace * work);
+
 int XLALSimNeutronStarVirialODEIntegrate(double *radius, double *mass,
     double *int1, double *int2, double *int3, double *int4, double *int5, double *int6, 
     double *love_number_k2, double central_pressure_si,
@@ -150,6 +163,13 @@ int XLALSimNeutronStarVirialODEIntegrateWithTolerance(double *radius, double *ma
 void XLALDestroySimNeutronStarFamily(LALSimNeutronStarFamily * fam);
 LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamily(
     LALSimNeutronStarEOS * eos);
+LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamilyAdaptive(
+    LALSimNeutronStarEOS * eos, double tolerance);
+int XLALCreateSimNeutronStarFamilies(LALSimNeutronStarFamily ** fam,
+    LALSimNeutronStarEOS ** eos, size_t n, double tolerance);
+REAL8Vector * XLALSimNeutronStarFamilySerialize(LALSimNeutronStarFamily * fam);
+LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamilyFromSerialization(
+    const REAL8Vector * data);
 
 double XLALSimNeutronStarFamMinimumMass(LALSimNeutronStarFamily * fam);
 double XLALSimNeutronStarMaximumMass(LALSimNeutronStarFamily * fam);
@@ -157,6 +177,8 @@ double XLALSimNeutronStarCentralPressure(double m,
     LALSimNeutronStarFamily * fam);
 double XLALSimNeutronStarRadius(double m, LALSimNeutronStarFamily * fam);
 double XLALSimNeutronStarLoveNumberK2(double m, LALSimNeutronStarFamily * fam);
+double XLALSimNeutronStarTidalDeformability(double m,
+    LALSimNeutronStarFamily * fam);
 
 #endif /* _LALSIMNEUTRONSTAR_H */
 
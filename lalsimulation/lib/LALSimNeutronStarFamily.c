@@ -31,8 +31,13 @@
 GSL_VAR const gsl_interp_type * lal_gsl_interp_steffen;
 
 #include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/AVFactories.h>
 #include <lal/LALSimNeutronStar.h>
 
+/** Version number of the serialized neutron star family format. */
+#define LAL_SIM_NEUTRON_STAR_FAMILY_SERIALIZATION_VERSION 1
+
 /** @cond */
 
 /* Contents of the neutron star family structure. */
@@ -50,16 +55,88 @@ struct tagLALSimNeutronStarFamily {
     gsl_interp_accel *k_of_m_acc;
 };
 
+/* parameters of the gsl function used to find the maximum mass */
+struct fminimizer_params {
+    LALSimNeutronStarEOS *eos;
+    LALSimNeutronStarTOVWorkspace *work;
+};
+
 /* gsl function for use in finding the maximum neutron star mass */
 static double fminimizer_gslfunction(double x, void * params);
 static double fminimizer_gslfunction(double x, void * params)
 {
-    LALSimNeutronStarEOS * eos = params;
+    struct fminimizer_params *p = params;
     double r, m, k;
-    XLALSimNeutronStarTOVODEIntegrate(&r, &m, &k, x, eos);
+    XLALSimNeutronStarTOVODEIntegrateWithWorkspace(&r, &m, &k, x, p->eos,
+        p->work);
     return -m; /* maximum mass is minimum negative mass */
 }
 
+/* find the central pressure of the maximum mass star bracketed by the
+ * points a < x < b with masses -fa, -fx, -fb, where fx < fa, fb */
+static double family_maximum_mass_pressure(double a, double x, double b,
+    double fa, double fx, double fb, struct fminimizer_params *params)
+{
+    const double epsabs = 0.0, epsrel = 1e-6;
+    int status;
+    gsl_function F;
+    gsl_min_fminimizer * s;
+    F.function = &fminimizer_gslfunction;
+    F.params = params;
+    s = gsl_min_fminimizer_alloc(gsl_min_fminimizer_brent);
+    gsl_min_fminimizer_set_with_values(s, &F, x, fx, a, fa, b, fb);
+    do {
+        status = gsl_min_fminimizer_iterate(s);
+        x = gsl_min_fminimizer_x_minimum(s);
+        a = gsl_min_fminimizer_x_lower(s);
+        b = gsl_min_fminimizer_x_upper(s);
+        status = gsl_min_test_interval(a, b, epsabs, epsrel);
+    } while (status == GSL_CONTINUE);
+    gsl_min_fminimizer_free(s);
+    return x;
+}
+
+/* allocate the interpolators once the data tables are filled */
+static int family_init_interp(LALSimNeutronStarFamily * fam)
+{
+    fam->p_of_m_acc = gsl_interp_accel_alloc();
+    fam->r_of_m_acc = gsl_interp_accel_alloc();
+    fam->k_of_m_acc = gsl_interp_accel_alloc();
+
+    fam->p_of_m_interp = gsl_interp_alloc(gsl_interp_cspline, fam->ndat);
+    fam->r_of_m_interp = gsl_interp_alloc(lal_gsl_interp_steffen, fam->ndat);
+    fam->k_of_m_interp = gsl_interp_alloc(lal_gsl_interp_steffen, fam->ndat);
+
+    if (!fam->p_of_m_acc || !fam->r_of_m_acc || !fam->k_of_m_acc
+        || !fam->p_of_m_interp || !fam->r_of_m_interp || !fam->k_of_m_interp)
+        XLAL_ERROR(XLAL_ENOMEM);
+
+    gsl_interp_init(fam->p_of_m_interp, fam->mdat, fam->pdat, fam->ndat);
+    gsl_interp_init(fam->r_of_m_interp, fam->mdat, fam->rdat, fam->ndat);
+    gsl_interp_init(fam->k_of_m_interp, fam->mdat, fam->kdat, fam->ndat);
+
+    return 0;
+}
+
+/* allocate an empty family with data tables of length ndat */
+static LALSimNeutronStarFamily * family_alloc(size_t ndat)
+{
+    LALSimNeutronStarFamily * fam;
+    fam = LALCalloc(1, sizeof(*fam));
+    if (!fam)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    fam->pdat = LALMalloc(ndat * sizeof(*fam->pdat));
+    fam->mdat = LALMalloc(ndat * sizeof(*fam->mdat));
+    fam->rdat = LALMalloc(ndat * sizeof(*fam->rdat));
+    fam->kdat = LALMalloc(ndat * sizeof(*fam->kdat));
+    if (!fam->pdat || !fam->mdat || !fam->rdat || !fam->kdat) {
+        XLALDestroySimNeutronStarFamily(fam);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    fam->ndat = ndat;
+    return fam;
+}
+
 /** @endcond */
 
 /**
@@ -69,12 +146,18 @@ static double fminimizer_gslfunction(double x, void * params)
 void XLALDestroySimNeutronStarFamily(LALSimNeutronStarFamily * fam)
 {
     if (fam) {
-        gsl_interp_accel_free(fam->k_of_m_acc);
-        gsl_interp_accel_free(fam->r_of_m_acc);
-        gsl_interp_accel_free(fam->p_of_m_acc);
-        gsl_interp_free(fam->k_of_m_interp);
-        gsl_interp_free(fam->r_of_m_interp);
-        gsl_interp_free(fam->p_of_m_interp);
+        if (fam->k_of_m_acc)
+            gsl_interp_accel_free(fam->k_of_m_acc);
+        if (fam->r_of_m_acc)
+            gsl_interp_accel_free(fam->r_of_m_acc);
+        if (fam->p_of_m_acc)
+            gsl_interp_accel_free(fam->p_of_m_acc);
+        if (fam->k_of_m_interp)
+            gsl_interp_free(fam->k_of_m_interp);
+        if (fam->r_of_m_interp)
+            gsl_interp_free(fam->r_of_m_interp);
+        if (fam->p_of_m_interp)
+            gsl_interp_free(fam->p_of_m_interp);
         LALFree(fam->kdat);
         LALFree(fam->rdat);
         LALFree(fam->mdat);
@@ -99,6 +182,7 @@ LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamily(
     LALSimNeutronStarEOS * eos)
 {
     LALSimNeutronStarFamily * fam;
+    struct fminimizer_params params;
     const size_t ndatmax = 100;
     const double logpmin = 75.5;
     double logpmax;
@@ -107,23 +191,23 @@ LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamily(
     size_t i;
 
     /* allocate memory */
-    fam = LALMalloc(sizeof(*fam));
+    fam = family_alloc(ndat);
     if (!fam)
-        XLAL_ERROR_NULL(XLAL_ENOMEM);
-    fam->pdat = LALMalloc(ndat * sizeof(*fam->pdat));
-    fam->mdat = LALMalloc(ndat * sizeof(*fam->mdat));
-    fam->rdat = LALMalloc(ndat * sizeof(*fam->rdat));
-    fam->kdat = LALMalloc(ndat * sizeof(*fam->kdat));
-    if (!fam->mdat || !fam->rdat || !fam->kdat)
-        XLAL_ERROR_NULL(XLAL_ENOMEM);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    params.eos = eos;
+    params.work = XLALCreateSimNeutronStarTOVWorkspace(1e-6);
+    if (!params.work) {
+        XLALDestroySimNeutronStarFamily(fam);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
 
     /* compute data tables */
     logpmax = log(XLALSimNeutronStarEOSMaxPressure(eos));
     dlogp = (logpmax - logpmin) / ndat;
     for (i = 0; i < ndat; ++i) {
         fam->pdat[i] = exp(logpmin + i * dlogp);
-        XLALSimNeutronStarTOVODEIntegrate(&fam->rdat[i], &fam->mdat[i],
-            &fam->kdat[i], fam->pdat[i], eos);
+        XLALSimNeutronStarTOVODEIntegrateWithWorkspace(&fam->rdat[i],
+            &fam->mdat[i], &fam->kdat[i], fam->pdat[i], eos, params.work);
         /* determine if maximum mass has been found */
         if (i > 0 && fam->mdat[i] <= fam->mdat[i-1])
             break;
@@ -131,31 +215,11 @@ LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamily(
 
     if (i < ndat) {
         /* replace the ith point with the maximum mass */
-        const double epsabs = 0.0, epsrel = 1e-6;
-        double a = fam->pdat[i - 2];
-        double x = fam->pdat[i - 1];
-        double b = fam->pdat[i];
-        double fa = -fam->mdat[i - 2];
-        double fx = -fam->mdat[i - 1];
-        double fb = -fam->mdat[i];
-        int status;
-        gsl_function F;
-        gsl_min_fminimizer * s;
-        F.function = &fminimizer_gslfunction;
-        F.params = eos;
-        s = gsl_min_fminimizer_alloc(gsl_min_fminimizer_brent);
-        gsl_min_fminimizer_set_with_values(s, &F, x, fx, a, fa, b, fb);
-        do {
-            status = gsl_min_fminimizer_iterate(s);
-            x = gsl_min_fminimizer_x_minimum(s);
-            a = gsl_min_fminimizer_x_lower(s);
-            b = gsl_min_fminimizer_x_upper(s);
-            status = gsl_min_test_interval(a, b, epsabs, epsrel);
-        } while (status == GSL_CONTINUE);
-        gsl_min_fminimizer_free(s);
-        fam->pdat[i] = x;
-        XLALSimNeutronStarTOVODEIntegrate(&fam->rdat[i], &fam->mdat[i],
-            &fam->kdat[i], fam->pdat[i], eos);
+        fam->pdat[i] = family_maximum_mass_pressure(fam->pdat[i - 2],
+            fam->pdat[i - 1], fam->pdat[i], -fam->mdat[i - 2],
+            -fam->mdat[i - 1], -fam->mdat[i], &params);
+        XLALSimNeutronStarTOVODEIntegrateWithWorkspace(&fam->rdat[i],
+            &fam->mdat[i], &fam->kdat[i], fam->pdat[i], eos, params.work);
 
         /* resize arrays */
         if(fam->pdat[i] <= fam->pdat[i-1]){
@@ -172,21 +236,282 @@ LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamily(
         fam->kdat = LALRealloc(fam->kdat, ndat * sizeof(*fam->kdat));
     }
     fam->ndat = ndat;
+    XLALDestroySimNeutronStarTOVWorkspace(params.work);
 
     /* setup interpolators */
+    if (family_init_interp(fam) < 0) {
+        XLALDestroySimNeutronStarFamily(fam);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
 
-    fam->p_of_m_acc = gsl_interp_accel_alloc();
-    fam->r_of_m_acc = gsl_interp_accel_alloc();
-    fam->k_of_m_acc = gsl_interp_accel_alloc();
+    return fam;
+}
+
+/**
+ * @brief Creates a neutron star family structure for a given equation of
+ * state with adaptive sampling of the central pressure.
+ * @details
+ * As XLALCreateSimNeutronStarFamily(), but the family is first computed on a
+ * coarse grid in log central pressure, which is then refined by bisection
+ * wherever adjacent stars differ in mass by more than @a tolerance times the
+ * maximum mass, or in radius or Love number k2 by more than @a tolerance
+ * relative to the larger value.  This places the stars where the
+ * mass-radius-k2 curves actually vary, so typically fewer TOV integrations
+ * are needed for the same interpolation accuracy.  All stars are integrated
+ * with a single reusable TOV workspace.
+ * @param eos Pointer to the Equation of State structure.
+ * @param tolerance Maximum fractional change between adjacent stars.
+ * @return A pointer to the neutron star family structure.
+ */
+LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamilyAdaptive(
+    LALSimNeutronStarEOS * eos, double tolerance)
+{
+    LALSimNeutronStarFamily * fam = NULL;
+    struct fminimizer_params params;
+    const size_t ncoarse = 32;
+    const size_t ndatmax = 1024;
+    const double logpmin = 75.5;
+    double *pdat = NULL, *mdat = NULL, *rdat = NULL, *kdat = NULL;
+    double logpmax;
+    double dlogp;
+    size_t ndat = ncoarse;
+    size_t inserted;
+    size_t i, j;
+
+    XLAL_CHECK_NULL(tolerance > 0.0, XLAL_EINVAL,
+        "Tolerance must be positive");
+
+    params.eos = eos;
+    params.work = XLALCreateSimNeutronStarTOVWorkspace(1e-6);
+    XLAL_CHECK_NULL(params.work, XLAL_EFUNC);
+    fam = family_alloc(ndatmax);
+    XLAL_CHECK_FAIL(fam, XLAL_EFUNC);
+
+    /* coarse sweep up to the maximum mass */
+    logpmax = log(XLALSimNeutronStarEOSMaxPressure(eos));
+    dlogp = (logpmax - logpmin) / ncoarse;
+    for (i = 0; i < ncoarse; ++i) {
+        fam->pdat[i] = exp(logpmin + i * dlogp);
+        XLAL_CHECK_FAIL(XLALSimNeutronStarTOVODEIntegrateWithWorkspace(
+            &fam->rdat[i], &fam->mdat[i], &fam->kdat[i], fam->pdat[i], eos,
+            params.work) == 0, XLAL_EFUNC);
+        if (i > 0 && fam->mdat[i] <= fam->mdat[i-1])
+            break;
+    }
+    if (i < ncoarse) {
+        XLAL_CHECK_FAIL(i >= 2, XLAL_EFAILED,
+            "Mass decreases with central pressure at the lowest pressures");
+        fam->pdat[i] = family_maximum_mass_pressure(fam->pdat[i - 2],
+            fam->pdat[i - 1], fam->pdat[i], -fam->mdat[i - 2],
+            -fam->mdat[i - 1], -fam->mdat[i], &params);
+        XLAL_CHECK_FAIL(XLALSimNeutronStarTOVODEIntegrateWithWorkspace(
+            &fam->rdat[i], &fam->mdat[i], &fam->kdat[i], fam->pdat[i], eos,
+            params.work) == 0, XLAL_EFUNC);
+        if (fam->pdat[i] <= fam->pdat[i-1]) {
+            fam->pdat[i-1] = fam->pdat[i];
+            fam->mdat[i-1] = fam->mdat[i];
+            fam->rdat[i-1] = fam->rdat[i];
+            fam->kdat[i-1] = fam->kdat[i];
+            ndat = i;
+        } else
+            ndat = i + 1;
+    }
+
+    /* refine by bisection in log central pressure */
+    pdat = LALMalloc(ndatmax * sizeof(*pdat));
+    mdat = LALMalloc(ndatmax * sizeof(*mdat));
+    rdat = LALMalloc(ndatmax * sizeof(*rdat));
+    kdat = LALMalloc(ndatmax * sizeof(*kdat));
+    XLAL_CHECK_FAIL(pdat && mdat && rdat && kdat, XLAL_ENOMEM);
+    do {
+        double mmax = fam->mdat[ndat - 1];
+        double kmax = 0.0;
+        size_t n = 0;
+        for (i = 0; i < ndat; ++i)
+            if (fabs(fam->kdat[i]) > kmax)
+                kmax = fabs(fam->kdat[i]);
+        inserted = 0;
+        for (i = 0; i < ndat; ++i) {
+            pdat[n] = fam->pdat[i];
+            mdat[n] = fam->mdat[i];
+            rdat[n] = fam->rdat[i];
+            kdat[n] = fam->kdat[i];
+            ++n;
+            if (i + 1 == ndat || ndat + inserted >= ndatmax)
+                continue;
+            if (fabs(fam->mdat[i + 1] - fam->mdat[i]) > tolerance * mmax
+                || fabs(fam->rdat[i + 1] - fam->rdat[i])
+                > tolerance * fmax(fam->rdat[i], fam->rdat[i + 1])
+                || fabs(fam->kdat[i + 1] - fam->kdat[i]) > tolerance * kmax) {
+                double p = sqrt(fam->pdat[i] * fam->pdat[i + 1]);
+                double r, m, k;
+                XLAL_CHECK_FAIL(XLALSimNeutronStarTOVODEIntegrateWithWorkspace(
+                    &r, &m, &k, p, eos, params.work) == 0, XLAL_EFUNC);
+                /* mass is the family parameter: keep it monotonic */
+                if (m <= fam->mdat[i] || m >= fam->mdat[i + 1])
+                    continue;
+                pdat[n] = p;
+                mdat[n] = m;
+                rdat[n] = r;
+                kdat[n] = k;
+                ++n;
+                ++inserted;
+            }
+        }
+        for (j = 0; j < n; ++j) {
+            fam->pdat[j] = pdat[j];
+            fam->mdat[j] = mdat[j];
+            fam->rdat[j] = rdat[j];
+            fam->kdat[j] = kdat[j];
+        }
+        ndat = n;
+    } while (inserted && ndat < ndatmax);
+
+    fam->ndat = ndat;
+    fam->pdat = LALRealloc(fam->pdat, ndat * sizeof(*fam->pdat));
+    fam->mdat = LALRealloc(fam->mdat, ndat * sizeof(*fam->mdat));
+    fam->rdat = LALRealloc(fam->rdat, ndat * sizeof(*fam->rdat));
+    fam->kdat = LALRealloc(fam->kdat, ndat * sizeof(*fam->kdat));
+    XLAL_CHECK_FAIL(family_init_interp(fam) == 0, XLAL_EFUNC);
+
+    LALFree(kdat);
+    LALFree(rdat);
+    LALFree(mdat);
+    LALFree(pdat);
+    XLALDestroySimNeutronStarTOVWorkspace(params.work);
+    return fam;
+
+XLAL_FAIL:
+    LALFree(kdat);
+    LALFree(rdat);
+    LALFree(mdat);
+    LALFree(pdat);
+    XLALDestroySimNeutronStarFamily(fam);
+    XLALDestroySimNeutronStarTOVWorkspace(params.work);
+    return NULL;
+}
+
+/**
+ * @brief Creates neutron star families for many equations of state at once.
+ * @details
+ * The families are computed in parallel (if OpenMP is available), one
+ * equation of state per thread.  This is intended for sweeps over
+ * parametrized equations of state, where some parameter vectors may not give
+ * a valid family: on return @a fam[i] is NULL for every equation of state
+ * for which the family could not be constructed.  A single equation of
+ * state is not shared between threads, since the interpolation accelerators
+ * of tabulated equations of state are not thread safe; each entry of @a eos
+ * must therefore be a distinct object.
+ * @param[out] fam Array of @a n pointers to the families created.
+ * @param[in] eos Array of @a n pointers to Equation of State structures.
+ * @param[in] n Number of equations of state.
+ * @param[in] tolerance If positive, create the families with
+ * XLALCreateSimNeutronStarFamilyAdaptive() with this tolerance; otherwise
+ * use XLALCreateSimNeutronStarFamily().
+ * @return The number of families that could not be constructed, or
+ * XLAL_FAILURE on invalid input.
+ */
+int XLALCreateSimNeutronStarFamilies(LALSimNeutronStarFamily ** fam,
+    LALSimNeutronStarEOS ** eos, size_t n, double tolerance)
+{
+    int nfailed = 0;
+    size_t i;
+
+    XLAL_CHECK(fam && eos, XLAL_EFAULT);
+
+    #pragma omp parallel for schedule(dynamic) reduction(+:nfailed)
+    for (i = 0; i < n; ++i) {
+        int errnum;
+        if (tolerance > 0.0)
+            XLAL_TRY(fam[i] = XLALCreateSimNeutronStarFamilyAdaptive(eos[i],
+                    tolerance), errnum);
+        else
+            XLAL_TRY(fam[i] = XLALCreateSimNeutronStarFamily(eos[i]), errnum);
+        if (!fam[i] || errnum) {
+            XLALDestroySimNeutronStarFamily(fam[i]);
+            fam[i] = NULL;
+            ++nfailed;
+        }
+    }
+
+    if (nfailed)
+        XLAL_PRINT_WARNING("Could not construct %d of %zu neutron star families", nfailed, n);
+    return nfailed;
+}
+
+/**
+ * @brief Serializes a neutron star family.
+ * @details
+ * The family is fully described by the stars it was interpolated from, so
+ * the serialized form is a vector holding a format version number, the
+ * number of stars, and then the central pressures (Pa), masses (kg), radii
+ * (m), and Love numbers k2 of the stars.  It can be stored and turned back
+ * into a family with XLALCreateSimNeutronStarFamilyFromSerialization()
+ * without solving the TOV equations again.
+ * @param fam Pointer to the neutron star family structure.
+ * @return A vector holding the serialized family.
+ */
+REAL8Vector * XLALSimNeutronStarFamilySerialize(LALSimNeutronStarFamily * fam)
+{
+    REAL8Vector *data;
+    size_t i;
 
-    fam->p_of_m_interp = gsl_interp_alloc(gsl_interp_cspline, ndat);
-    fam->r_of_m_interp = gsl_interp_alloc(lal_gsl_interp_steffen, ndat);
-    fam->k_of_m_interp = gsl_interp_alloc(lal_gsl_interp_steffen, ndat);
+    XLAL_CHECK_NULL(fam, XLAL_EFAULT);
+    data = XLALCreateREAL8Vector(2 + 4 * fam->ndat);
+    XLAL_CHECK_NULL(data, XLAL_EFUNC);
+    data->data[0] = LAL_SIM_NEUTRON_STAR_FAMILY_SERIALIZATION_VERSION;
+    data->data[1] = fam->ndat;
+    for (i = 0; i < fam->ndat; ++i) {
+        data->data[2 + i] = fam->pdat[i];
+        data->data[2 + fam->ndat + i] = fam->mdat[i];
+        data->data[2 + 2 * fam->ndat + i] = fam->rdat[i];
+        data->data[2 + 3 * fam->ndat + i] = fam->kdat[i];
+    }
+    return data;
+}
 
-    gsl_interp_init(fam->p_of_m_interp, fam->mdat, fam->pdat, ndat);
-    gsl_interp_init(fam->r_of_m_interp, fam->mdat, fam->rdat, ndat);
-    gsl_interp_init(fam->k_of_m_interp, fam->mdat, fam->kdat, ndat);
+/**
+ * @brief Creates a neutron star family structure from its serialized form.
+ * @param data Vector produced by XLALSimNeutronStarFamilySerialize().
+ * @return A pointer to the neutron star family structure.
+ */
+LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamilyFromSerialization(
+    const REAL8Vector * data)
+{
+    LALSimNeutronStarFamily * fam;
+    size_t ndat;
+    size_t i;
 
+    XLAL_CHECK_NULL(data && data->length >= 2, XLAL_EINVAL);
+    XLAL_CHECK_NULL(data->data[0]
+        == LAL_SIM_NEUTRON_STAR_FAMILY_SERIALIZATION_VERSION, XLAL_EINVAL,
+        "Unknown neutron star family serialization version %g",
+        data->data[0]);
+    /* check the number of stars before converting it to an integer */
+    XLAL_CHECK_NULL(isfinite(data->data[1])
+        && data->data[1] == floor(data->data[1]) && data->data[1] >= 2
+        && data->data[1] <= (data->length - 2) / 4, XLAL_EBADLEN,
+        "Invalid number of stars %g in serialization of length %u",
+        data->data[1], data->length);
+    ndat = data->data[1];
+    XLAL_CHECK_NULL(data->length == 2 + 4 * ndat, XLAL_EBADLEN);
+
+    fam = family_alloc(ndat);
+    XLAL_CHECK_NULL(fam, XLAL_EFUNC);
+    for (i = 0; i < ndat; ++i) {
+        fam->pdat[i] = data->data[2 + i];
+        fam->mdat[i] = data->data[2 + ndat + i];
+        fam->rdat[i] = data->data[2 + 2 * ndat + i];
+        fam->kdat[i] = data->data[2 + 3 * ndat + i];
+        if (i > 0 && fam->mdat[i] <= fam->mdat[i - 1]) {
+            XLALDestroySimNeutronStarFamily(fam);
+            XLAL_ERROR_NULL(XLAL_EINVAL, "Masses are not increasing");
+        }
+    }
+    if (family_init_interp(fam) < 0) {
+        XLALDestroySimNeutronStarFamily(fam);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
     return fam;
 }
 
@@ -253,4 +578,22 @@ double XLALSimNeutronStarLoveNumberK2(double m, LALSimNeutronStarFamily * fam)
     return k;
 }
 
+/**
+ * @brief Returns the dimensionless tidal deformability of a neutron star of
+ * mass @a m.
+ * @details
+ * Lambda = (2/3) k2 / C^5 where C = G m / (c^2 R) is the compactness.
+ * @param m The mass of the neutron star (kg).
+ * @param fam Pointer to the neutron star family structure.
+ * @return The dimensionless tidal deformability Lambda.
+ */
+double XLALSimNeutronStarTidalDeformability(double m,
+    LALSimNeutronStarFamily * fam)
+{
+    double r = XLALSimNeutronStarRadius(m, fam);
+    double k = XLALSimNeutronStarLoveNumberK2(m, fam);
+    double c = m * LAL_MRSUN_SI / (LAL_MSUN_SI * r);
+    return (2.0 / 3.0) * k / pow(c, 5);
+}
+
 /** @} */
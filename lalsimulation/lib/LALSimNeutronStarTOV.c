@@ -118,36 +118,91 @@ static int tov_ode(double h, const double *y, double *dy, void *params)
 
 /** @endcond */
 
+/** @cond */
+
+/* Contents of the TOV integration workspace structure. */
+struct tagLALSimNeutronStarTOVWorkspace {
+    gsl_odeiv_step *step;
+    gsl_odeiv_control *ctrl;
+    gsl_odeiv_evolve *evolv;
+};
+
+/** @endcond */
+
 /**
- * @brief Integrates the Tolman-Oppenheimer-Volkov stellar structure equations.
+ * @brief Frees the memory associated with a TOV integration workspace.
+ * @param work Pointer to the workspace structure to be freed.
+ */
+void XLALDestroySimNeutronStarTOVWorkspace(LALSimNeutronStarTOVWorkspace *
+    work)
+{
+    if (work) {
+        if (work->evolv)
+            gsl_odeiv_evolve_free(work->evolv);
+        if (work->ctrl)
+            gsl_odeiv_control_free(work->ctrl);
+        if (work->step)
+            gsl_odeiv_step_free(work->step);
+        LALFree(work);
+    }
+    return;
+}
+
+/**
+ * @brief Creates a workspace for repeated integrations of the
+ * Tolman-Oppenheimer-Volkov equations.
  * @details
- * Solves the Tolman-Oppenheimer-Volkov stellar structure equations using the
- * pseudo-enthalpy formalism introduced in:
- * Lindblom (1992) "Determining the Nuclear Equation of State from Neutron-Star
- * Masses and Radii", Astrophys. J. 398 569.
+ * The workspace holds the ODE stepper, step-size control, and evolution
+ * state so that they are allocated once for a sweep over many central
+ * pressures rather than once per star.  A workspace must not be used by
+ * more than one thread at a time.
+ * @param[in] epsrel The relative error for the TOV solver routine.
+ * @return A pointer to the workspace structure.
+ */
+LALSimNeutronStarTOVWorkspace *XLALCreateSimNeutronStarTOVWorkspace(double
+    epsrel)
+{
+    const double epsabs = 0.0;
+    LALSimNeutronStarTOVWorkspace *work;
+
+    work = LALCalloc(1, sizeof(*work));
+    if (!work)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    work->step = gsl_odeiv_step_alloc(gsl_odeiv_step_rk8pd, TOV_ODE_VARS_DIM);
+    work->ctrl = gsl_odeiv_control_y_new(epsabs, epsrel);
+    work->evolv = gsl_odeiv_evolve_alloc(TOV_ODE_VARS_DIM);
+    if (!work->step || !work->ctrl || !work->evolv) {
+        XLALDestroySimNeutronStarTOVWorkspace(work);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    return work;
+}
+
+/**
+ * @brief Integrates the Tolman-Oppenheimer-Volkov stellar structure equations
+ * using a preallocated workspace.
+ * @details
+ * Identical to XLALSimNeutronStarTOVODEIntegrateWithTolerance() but the
+ * integrator memory is taken from @a work, whose relative error sets the
+ * tolerance of the solver.
  * @param[out] radius The radius of the star in m.
  * @param[out] mass The mass of the star in kg.
  * @param[out] love_number_k2 The k_2 tidal love number of the star.
  * @param[in] central_pressure_si The central pressure of the star in Pa.
  * @param eos Pointer to the Equation of State structure.
- * @param[in] epsrel The relative error for the TOV solver routine
+ * @param work Pointer to the TOV integration workspace.
  * @retval 0 Success.
  * @retval <0 Failure.
  */
-int XLALSimNeutronStarTOVODEIntegrateWithTolerance(double *radius, double *mass,
-    double *love_number_k2, double central_pressure_si,
-    LALSimNeutronStarEOS * eos, double epsrel)
+int XLALSimNeutronStarTOVODEIntegrateWithWorkspace(double *radius,
+    double *mass, double *love_number_k2, double central_pressure_si,
+    LALSimNeutronStarEOS * eos, LALSimNeutronStarTOVWorkspace * work)
 {
     /* ode integration variables */
-    const double epsabs = 0.0;
     double y[TOV_ODE_VARS_DIM];
     double dy[TOV_ODE_VARS_DIM];
     struct tov_ode_vars *vars = tov_ode_vars_cast(y);
     gsl_odeiv_system sys = { tov_ode, NULL, TOV_ODE_VARS_DIM, eos };
-    gsl_odeiv_step *step =
-        gsl_odeiv_step_alloc(gsl_odeiv_step_rk8pd, TOV_ODE_VARS_DIM);
-    gsl_odeiv_control *ctrl = gsl_odeiv_control_y_new(epsabs, epsrel);
-    gsl_odeiv_evolve *evolv = gsl_odeiv_evolve_alloc(TOV_ODE_VARS_DIM);
 
     /* central values */
     /* note: will be updated with Lindblom's series expansion */
@@ -187,9 +242,11 @@ int XLALSimNeutronStarTOVODEIntegrateWithTolerance(double *radius, double *mass,
     vars->H = H0;
     vars->b = b0;
     h = h0;
+    gsl_odeiv_step_reset(work->step);
+    gsl_odeiv_evolve_reset(work->evolv);
     while (h > h1) {
-        int s =
-            gsl_odeiv_evolve_apply(evolv, ctrl, step, &sys, &h, h1, &dh, y);
+        int s = gsl_odeiv_evolve_apply(work->evolv, work->ctrl, work->step,
+            &sys, &h, h1, &dh, y);
         if (s != GSL_SUCCESS)
             XLAL_ERROR(XLAL_EERR,
                 "Error encountered in GSL's ODE integrator\n");
@@ -209,10 +266,40 @@ int XLALSimNeutronStarTOVODEIntegrateWithTolerance(double *radius, double *mass,
     *mass = vars->m * LAL_MSUN_SI / LAL_MRSUN_SI;
     *love_number_k2 = tidal_Love_number_k2(c, yy);
 
-    /* free ode memory */
-    gsl_odeiv_evolve_free(evolv);
-    gsl_odeiv_control_free(ctrl);
-    gsl_odeiv_step_free(step);
+    return 0;
+}
+
+/**
+ * @brief Integrates the Tolman-Oppenheimer-Volkov stellar structure equations.
+ * @details
+ * Solves the Tolman-Oppenheimer-Volkov stellar structure equations using the
+ * pseudo-enthalpy formalism introduced in:
+ * Lindblom (1992) "Determining the Nuclear Equation of State from Neutron-Star
+ * Masses and Radii", Astrophys. J. 398 569.
+ * @param[out] radius The radius of the star in m.
+ * @param[out] mass The mass of the star in kg.
+ * @param[out] love_number_k2 The k_2 tidal love number of the star.
+ * @param[in] central_pressure_si The central pressure of the star in Pa.
+ * @param eos Pointer to the Equation of State structure.
+ * @param[in] epsrel The relative error for the TOV solver routine
+ * @retval 0 Success.
+ * @retval <0 Failure.
+ */
+int XLALSimNeutronStarTOVODEIntegrateWithTolerance(double *radius, double *mass,
+    double *love_number_k2, double central_pressure_si,
+    LALSimNeutronStarEOS * eos, double epsrel)
+{
+    LALSimNeutronStarTOVWorkspace *work;
+    int retval;
+
+    work = XLALCreateSimNeutronStarTOVWorkspace(epsrel);
+    if (!work)
+        XLAL_ERROR(XLAL_EFUNC);
+    retval = XLALSimNeutronStarTOVODEIntegrateWithWorkspace(radius, mass,
+        love_number_k2, central_pressure_si, eos, work);
+    XLALDestroySimNeutronStarTOVWorkspace(work);
+    if (retval < 0)
+        XLAL_ERROR(XLAL_EFUNC);
     return 0;
 }
 
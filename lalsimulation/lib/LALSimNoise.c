@@ -28,11 +28,16 @@
 #include <lal/LALStdlib.h>
 #include <lal/FrequencySeries.h>
 #include <lal/Sequence.h>
+#include <lal/AVFactories.h>
 #include <lal/TimeSeries.h>
 #include <lal/TimeFreqFFT.h>
 #include <lal/Units.h>
 #include <lal/LALSimNoise.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 /* 
  * This routine generates a single segment of data.  Note that this segment is
@@ -73,6 +78,80 @@ static int XLALSimNoiseSegment(REAL8TimeSeries *s, REAL8FrequencySeries *psd, gs
 	return 0;
 }
 
+/*
+ * Counter-based random numbers for XLALSimNoiseGeneratorFill().
+ *
+ * Philox4x32-10 of Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3", Proc. SC11 (2011): a keyed bijection of a 128-bit counter, so
+ * that the random numbers for any counter value can be computed directly
+ * without generating all the ones before it.
+ */
+static void XLALSimNoisePhilox4x32(UINT4 ctr[4], const UINT4 key[2])
+{
+	UINT4 k0 = key[0], k1 = key[1];
+	int r;
+	for (r = 0; r < 10; ++r) {
+		const UINT8 p0 = (UINT8)0xD2511F53 * ctr[0];
+		const UINT8 p1 = (UINT8)0xCD9E8D57 * ctr[2];
+		const UINT4 c1 = ctr[1], c3 = ctr[3];
+		ctr[0] = (UINT4)(p1 >> 32) ^ c1 ^ k0;
+		ctr[1] = (UINT4)p1;
+		ctr[2] = (UINT4)(p0 >> 32) ^ c3 ^ k1;
+		ctr[3] = (UINT4)p0;
+		k0 += 0x9E3779B9;
+		k1 += 0xBB67AE85;
+	}
+	return;
+}
+
+/* structure for the block-wise noise generator */
+struct tagSimNoiseGenerator {
+	REAL8 deltaT;		/* sampling interval */
+	INT8 srate;		/* sampling rate, which must be an integer */
+	size_t length;		/* length of each block */
+	size_t hop;		/* stride between blocks, half the block length */
+	UINT4 key[2];		/* random number key made from the seed */
+	UINT4 stream;		/* random number stream, e.g. detector index */
+	REAL8Vector *sigma;	/* standard deviation of each frequency bin, including the FFT normalisation */
+	REAL8Vector *cosw;	/* feathering weight of the earlier block */
+	REAL8Vector *sinw;	/* feathering weight of the later block */
+	REAL8FFTPlan *plan;	/* reverse FFT plan shared by all threads */
+	LALUnit sampleUnits;	/* units of the generated noise */
+};
+
+/*
+ * Generate the (periodic) block of noise starting at global sample
+ * block * gen->hop. The random numbers for frequency bin k of a block are
+ * obtained from the counter (k, block, stream), so that every block can be
+ * generated independently of, and in any order relative to, the others.
+ */
+static int XLALSimNoiseGeneratorBlock(REAL8Vector *x, COMPLEX16Vector *stilde, const SimNoiseGenerator *gen, INT8 block)
+{
+	const UINT8 b = (UINT8)block;
+	size_t k;
+
+	for (k = 0; k < stilde->length; ++k) {
+		UINT4 ctr[4] = { (UINT4)k, (UINT4)b, (UINT4)(b >> 32), gen->stream };
+		double u1, u2, r;
+		XLALSimNoisePhilox4x32(ctr, gen->key);
+		/* two uniform deviates in (0,1] and [0,1) with 53-bit resolution */
+		u1 = 1.0 - ((ctr[0] >> 5) * 67108864.0 + (ctr[1] >> 6)) / 9007199254740992.0;
+		u2 = ((ctr[2] >> 5) * 67108864.0 + (ctr[3] >> 6)) / 9007199254740992.0;
+		/* Box-Muller transform to two normal deviates */
+		r = gen->sigma->data[k] * sqrt(-2.0 * log(u1));
+		stilde->data[k] = r * cos(LAL_TWOPI * u2) + I * r * sin(LAL_TWOPI * u2);
+	}
+
+	/* DC and Nyquist components must be real */
+	stilde->data[0] = 0.0;
+	stilde->data[stilde->length - 1] = creal(stilde->data[stilde->length - 1]);
+
+	if (XLALREAL8ReverseFFT(x, stilde, gen->plan) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	return 0;
+}
+
 /**
  * @addtogroup LALSimNoise_c
  * @brief Routines to produce a continuous stream of simulated
@@ -197,6 +276,201 @@ int XLALSimNoise(
 	return 0;
 }
 
+/**
+ * @brief Creates a generator of coloured Gaussian noise that can fill any
+ * stretch of time independently and reproducibly.
+ *
+ * Where XLALSimNoise() produces a continuous stream of noise by advancing a
+ * single segment through time, the generator defines one realisation of
+ * noise for all times, determined only by the power spectrum, the seed and
+ * the stream number.  Time is divided into blocks, of the length implied
+ * by the resolution of the power spectrum, which start every half block
+ * length from GPS time zero.  Each block is a periodic realisation of
+ * noise, generated as in XLALSimNoise() but with normal deviates from a
+ * counter-based random number generator keyed on the seed, the stream and
+ * the block number.  Neighbouring blocks are feathered together as in
+ * XLALSimNoise() with a stride of half the block length.
+ *
+ * Consequently the noise at a given GPS time does not depend on how the
+ * data is divided into time series, and separate time series may be
+ * filled in any order or in parallel.  Different detectors should use
+ * different values of @p stream with the same seed.
+ *
+ * The sampling rate 1 / @p deltaT must be an integer, and the power
+ * spectrum must have a frequency resolution commensurate with an even
+ * number of samples.
+ */
+SimNoiseGenerator *XLALCreateSimNoiseGenerator(
+	const REAL8FrequencySeries *psd,	/**< [in] power spectrum frequency series */
+	REAL8 deltaT,				/**< [in] sampling interval (s) */
+	UINT8 seed,				/**< [in] random number seed */
+	UINT4 stream				/**< [in] random number stream, e.g. detector index */
+)
+{
+	SimNoiseGenerator *gen;
+	double srate;
+	size_t length;
+	size_t j, k;
+
+	if (!psd || !psd->data)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if (!(deltaT > 0.0) || !(psd->deltaF > 0.0))
+		XLAL_ERROR_NULL(XLAL_EINVAL);
+
+	/* sampling rate must be an integer so that blocks align with GPS seconds */
+	srate = 1.0 / deltaT;
+	if (fabs(srate - floor(0.5 + srate)) > 1e-6 * srate)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Sampling rate %g Hz is not an integer", srate);
+
+	/* block length must be even and commensurate with the power spectrum */
+	length = (size_t)floor(0.5 + 1.0/(deltaT * psd->deltaF));
+	if (length < 2 || length % 2 || length/2 + 1 != psd->data->length)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Power spectrum resolution is not commensurate with an even block length");
+
+	gen = XLALCalloc(1, sizeof(*gen));
+	if (!gen)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	gen->deltaT = deltaT;
+	gen->srate = (INT8)floor(0.5 + srate);
+	gen->length = length;
+	gen->hop = length / 2;
+	gen->key[0] = (UINT4)seed;
+	gen->key[1] = (UINT4)(seed >> 32);
+	gen->stream = stream;
+
+	gen->sigma = XLALCreateREAL8Vector(psd->data->length);
+	gen->cosw = XLALCreateREAL8Vector(gen->hop);
+	gen->sinw = XLALCreateREAL8Vector(gen->hop);
+	gen->plan = XLALCreateReverseREAL8FFTPlan(length, 0);
+	if (!gen->sigma || !gen->cosw || !gen->sinw || !gen->plan) {
+		XLALDestroySimNoiseGenerator(gen);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	/* as in XLALSimNoiseSegment(), with the deltaF normalisation of
+	 * XLALREAL8FreqTimeFFT() folded in */
+	gen->sigma->data[0] = 0.0;
+	for (k = 1; k < psd->data->length; ++k)
+		gen->sigma->data[k] = 0.5 * sqrt(psd->data->data[k] / psd->deltaF) * psd->deltaF;
+
+	for (j = 0; j < gen->hop; ++j) {
+		gen->cosw->data[j] = cos(LAL_PI*j/(2.0 * gen->hop));
+		gen->sinw->data[j] = sin(LAL_PI*j/(2.0 * gen->hop));
+	}
+
+	/* correct units: [s] = sqrt([psd] * seconds) * hertz */
+	XLALUnitMultiply(&gen->sampleUnits, &psd->sampleUnits, &lalSecondUnit);
+	XLALUnitSqrt(&gen->sampleUnits, &gen->sampleUnits);
+	XLALUnitMultiply(&gen->sampleUnits, &gen->sampleUnits, &lalHertzUnit);
+
+	return gen;
+}
+
+/**
+ * @brief Destroys a generator created by XLALCreateSimNoiseGenerator().
+ */
+void XLALDestroySimNoiseGenerator(
+	SimNoiseGenerator *gen			/**< [in] noise generator */
+)
+{
+	if (gen) {
+		XLALDestroyREAL8Vector(gen->sigma);
+		XLALDestroyREAL8Vector(gen->cosw);
+		XLALDestroyREAL8Vector(gen->sinw);
+		XLALDestroyREAL8FFTPlan(gen->plan);
+		XLALFree(gen);
+	}
+	return;
+}
+
+/**
+ * @brief Fills a time series with the noise of a generator at the times
+ * spanned by the time series.
+ *
+ * The epoch of the time series must lie on the sampling grid of the
+ * generator, i.e. an integer number of samples from GPS time zero.  The
+ * blocks of noise required are generated in parallel, each thread working
+ * on a contiguous range of blocks.
+ *
+ * @sa XLALCreateSimNoiseGenerator()
+ */
+int XLALSimNoiseGeneratorFill(
+	REAL8TimeSeries *s,			/**< [in/out] noise time series */
+	const SimNoiseGenerator *gen		/**< [in] noise generator */
+)
+{
+	const INT8 hop = gen ? (INT8)gen->hop : 0;
+	double frac;
+	INT8 n0, nend, cfirst, nchunks, nranges, r;
+	int status_in_for = XLAL_SUCCESS;
+
+	if (!s || !s->data || !gen)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (fabs(s->deltaT - gen->deltaT) > LAL_REAL8_EPS * gen->deltaT)
+		XLAL_ERROR(XLAL_EINVAL, "Time series sampling interval does not match generator");
+	if (s->data->length == 0)
+		return 0;
+
+	/* index of first sample, counting from GPS time zero */
+	frac = s->epoch.gpsNanoSeconds * 1e-9 * gen->srate;
+	if (fabs(frac - floor(0.5 + frac)) > 1e-3)
+		XLAL_ERROR(XLAL_EINVAL, "Time series epoch is not on the sampling grid");
+	n0 = (INT8)s->epoch.gpsSeconds * gen->srate + (INT8)floor(0.5 + frac);
+	nend = n0 + (INT8)s->data->length;
+
+	/* chunk c is the first half of block c and the second half of block c-1 */
+	cfirst = n0 >= 0 ? n0 / hop : -((-n0 + hop - 1) / hop);
+	nchunks = (nend - 1 >= 0 ? (nend - 1) / hop : -((-(nend - 1) + hop - 1) / hop)) - cfirst + 1;
+
+	nranges = 1;
+#ifdef _OPENMP
+	nranges = omp_get_max_threads();
+#endif
+	if (nranges > nchunks)
+		nranges = nchunks;
+
+	#pragma omp parallel for schedule(static)
+	for (r = 0; r < nranges; ++r) {
+		const INT8 cbegin = cfirst + r * nchunks / nranges;
+		const INT8 cend = cfirst + (r + 1) * nchunks / nranges;
+		REAL8Vector *prev = XLALCreateREAL8Vector(gen->length);
+		REAL8Vector *next = XLALCreateREAL8Vector(gen->length);
+		COMPLEX16Vector *stilde = XLALCreateCOMPLEX16Vector(gen->length/2 + 1);
+		INT8 c;
+
+		int ok = prev && next && stilde && XLALSimNoiseGeneratorBlock(prev, stilde, gen, cbegin - 1) == 0;
+
+		for (c = cbegin; ok && c < cend; ++c) {
+			const INT8 jbegin = n0 > c * hop ? n0 - c * hop : 0;
+			const INT8 jend = nend < (c + 1) * hop ? nend - c * hop : hop;
+			REAL8Vector *tmp;
+			INT8 j;
+			if (XLALSimNoiseGeneratorBlock(next, stilde, gen, c) < 0) {
+				ok = 0;
+				break;
+			}
+			/* feather second half of previous block with first half of next block */
+			for (j = jbegin; j < jend; ++j)
+				s->data->data[c * hop + j - n0] = gen->cosw->data[j] * prev->data[hop + j] + gen->sinw->data[j] * next->data[j];
+			tmp = prev;
+			prev = next;
+			next = tmp;
+		}
+
+		if (!ok)
+			status_in_for = XLAL_EFUNC;
+		XLALDestroyREAL8Vector(prev);
+		XLALDestroyREAL8Vector(next);
+		XLALDestroyCOMPLEX16Vector(stilde);
+	}
+	if (status_in_for != XLAL_SUCCESS)
+		XLAL_ERROR(status_in_for);
+
+	s->f0 = 0.0;
+	s->sampleUnits = gen->sampleUnits;
+	return 0;
+}
+
 /** @} */
 
 /*
@@ -70,6 +70,13 @@ SWIGLAL(FUNCTION_POINTER(aLIGOQuantumHighFrequency, XLALSimNoisePSDAdvVirgo,
 
 int XLALSimNoise(REAL8TimeSeries *s, size_t stride, REAL8FrequencySeries *psd, gsl_rng *rng);
 
+/** Opaque structure for the block-wise noise generator; see XLALCreateSimNoiseGenerator() */
+typedef struct tagSimNoiseGenerator SimNoiseGenerator;
+
+SimNoiseGenerator *XLALCreateSimNoiseGenerator(const REAL8FrequencySeries *psd, REAL8 deltaT, UINT8 seed, UINT4 stream);
+void XLALDestroySimNoiseGenerator(SimNoiseGenerator *gen);
+int XLALSimNoiseGeneratorFill(REAL8TimeSeries *s, const SimNoiseGenerator *gen);
+
 
 /*
  * PSD GENERATION FUNCTIONS
@@ -30,44 +30,142 @@
 #include <lal/FrequencySeries.h>
 #include <lal/Sequence.h>
 #include <lal/TimeFreqFFT.h>
+#include <lal/TimeSeries.h>
 #include <lal/Units.h>
 #include <lal/LALSimSGWB.h>
 
 #include <lal/LALSimReadData.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* per-frequency correlation factors for a detector network */
+struct tagSimSGWBFactors {
+	size_t numDetectors;	/* number of detectors in network */
+	size_t length;		/* length of the time-domain segments */
+	double deltaT;		/* sample interval of the time-domain segments (s) */
+	double *sigma;		/* noise amplitude at each frequency bin */
+	double *L;		/* packed lower-triangular Cholesky factors at each frequency bin */
+	REAL8FFTPlan *plan;	/* reverse FFT plan for the segment length */
+};
+
+/* offset of element (i,j), i >= j, of the packed Cholesky factor of bin k */
+#define SGWB_FACTOR(factors, k, i, j) ((factors)->L[(k) * ((factors)->numDetectors * ((factors)->numDetectors + 1) / 2) + (i) * ((i) + 1) / 2 + (j)])
+
+/*
+ * This routine computes the noise amplitude and the Cholesky decomposition
+ * of the correlation matrix at each frequency (excluding DC and Nyquist).
+ * These depend only on the detector network and the spectrum, so they are
+ * computed once and shared by all subsequent segments.
+ */
+static SimSGWBFactors *XLALSimSGWBFactorsCreate(const LALDetector *detectors, size_t numDetectors, const REAL8FrequencySeries *OmegaGW, double H0, size_t length, double deltaT)
+{
+	SimSGWBFactors *factors;
+	double psdfac;
+	double deltaF;
+	size_t npacked;
+	long k;
+	int errnum = 0;
+
+	factors = LALCalloc(1, sizeof(*factors));
+	if (! factors)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	factors->numDetectors = numDetectors;
+	factors->length = length;
+	factors->deltaT = deltaT;
+
+	npacked = numDetectors * (numDetectors + 1) / 2;
+	factors->sigma = LALCalloc(length/2 + 1, sizeof(*factors->sigma));
+	factors->L = LALCalloc((length/2 + 1) * npacked, sizeof(*factors->L));
+	if (! factors->sigma || ! factors->L) {
+		XLALDestroySimSGWBFactors(factors);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+
+	factors->plan = XLALCreateReverseREAL8FFTPlan(length, 0);
+	if (! factors->plan) {
+		XLALDestroySimSGWBFactors(factors);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	deltaF = 1.0 / (length * deltaT);
+	psdfac = 0.3 * pow(H0 / LAL_PI, 2.0);
+
+	/* the overlap reduction function is expensive, so the frequency bins
+	 * are shared between threads, each with its own correlation matrix */
+#pragma omp parallel
+	{
+		gsl_matrix *R = gsl_matrix_alloc(numDetectors, numDetectors);
+		if (! R) {
+#pragma omp critical (XLALSimSGWBFactorsCreate)
+			errnum = XLAL_ENOMEM;
+		} else {
+#pragma omp for schedule(static)
+			for (k = 1; k < (long)(length/2); ++k) {
+				double f = k * deltaF;
+				size_t i, j;
+
+				factors->sigma[k] = 0.5 * sqrt(psdfac * OmegaGW->data->data[k] * pow(f, -3.0) / deltaF);
+
+				/* construct correlation matrix at this frequency */
+				/* diagonal elements of correlation matrix are unity */
+				gsl_matrix_set_identity(R);
+				/* now do the off-diagonal elements */
+				for (i = 0; i < numDetectors; ++i)
+					for (j = i + 1; j < numDetectors; ++j) {
+						double Rij = XLALSimSGWBOverlapReductionFunction(f, &detectors[i], &detectors[j]);
+						/* if the two sites are the same, the overlap reduciton
+						 * function will be unity, but this will cause problems
+						 * for the cholesky decomposition; a hack is to make it
+						 * unity only to single precision */
+						if (fabs(Rij - 1.0) < LAL_REAL4_EPS)
+							Rij = 1.0 - LAL_REAL4_EPS;
+
+						gsl_matrix_set(R, i, j, Rij);
+						gsl_matrix_set(R, j, i, Rij); /* it is symmetric */
+					}
+
+				/* perform Cholesky decomposition and keep the lower-diagonal part */
+				gsl_linalg_cholesky_decomp(R);
+				for (i = 0; i < numDetectors; ++i)
+					for (j = 0; j <= i; ++j)
+						SGWB_FACTOR(factors, k, i, j) = gsl_matrix_get(R, i, j);
+			}
+			gsl_matrix_free(R);
+		}
+	}
+	if (errnum) {
+		XLALDestroySimSGWBFactors(factors);
+		XLAL_ERROR_NULL(errnum);
+	}
+
+	return factors;
+}
+
 /* 
  * This routine generates a single segment of data.  Note that this segment is
  * generated in the frequency domain and is inverse Fourier transformed into
  * the time domain; consequently the data is periodic in the time domain.
  */
-static int XLALSimSGWBSegment(REAL8TimeSeries **h, const LALDetector *detectors, size_t numDetectors, const REAL8FrequencySeries *OmegaGW, double H0, gsl_rng *rng)
+static int XLALSimSGWBSegment(REAL8TimeSeries **h, const SimSGWBFactors *factors, gsl_rng *rng)
 {
 #	define CLEANUP_AND_RETURN(errnum) do { \
 		if (htilde) for (i = 0; i < numDetectors; ++i) XLALDestroyCOMPLEX16FrequencySeries(htilde[i]); \
-		XLALFree(htilde); XLALDestroyREAL8FFTPlan(plan); gsl_matrix_free(R); \
+		XLALFree(htilde); \
 		if (errnum) XLAL_ERROR(errnum); else return 0; \
 		} while (0)
-	REAL8FFTPlan *plan = NULL;
 	COMPLEX16FrequencySeries **htilde = NULL;
-	gsl_matrix *R = NULL;
 	LIGOTimeGPS epoch;
-	double psdfac;
+	size_t numDetectors;
 	double deltaF;
 	size_t length;
 	size_t i, j, k;
 
+	numDetectors = factors->numDetectors;
 	epoch = h[0]->epoch;
 	length = h[0]->data->length;
 	deltaF = 1.0 / (length * h[0]->deltaT);
-	psdfac = 0.3 * pow(H0 / LAL_PI, 2.0);
-
-	R = gsl_matrix_alloc(numDetectors, numDetectors);
-	if (! R)
-		CLEANUP_AND_RETURN(XLAL_ENOMEM);
-
-	plan = XLALCreateReverseREAL8FFTPlan(length, 0);
-	if (! plan)
-		CLEANUP_AND_RETURN(XLAL_EFUNC);
 
 	/* allocate frequency series for the various detector strains */
 	htilde = LALCalloc(numDetectors, sizeof(*htilde));
@@ -87,29 +185,7 @@ static int XLALSimSGWBSegment(REAL8TimeSeries **h, const LALDetector *detectors,
 
 	/* compute frequencies (excluding DC and Nyquist) */
 	for (k = 1; k < length/2; ++k) {
-		double f = k * deltaF;
-		double sigma = 0.5 * sqrt(psdfac * OmegaGW->data->data[k] * pow(f, -3.0) / deltaF);
-
-		/* construct correlation matrix at this frequency */
-		/* diagonal elements of correlation matrix are unity */
-		gsl_matrix_set_identity(R);
-		/* now do the off-diagonal elements */
-		for (i = 0; i < numDetectors; ++i)
-			for (j = i + 1; j < numDetectors; ++j) {
-				double Rij = XLALSimSGWBOverlapReductionFunction(f, &detectors[i], &detectors[j]);
-				/* if the two sites are the same, the overlap reduciton
-				 * function will be unity, but this will cause problems
-				 * for the cholesky decomposition; a hack is to make it
-				 * unity only to single precision */
-				if (fabs(Rij - 1.0) < LAL_REAL4_EPS)
-					Rij = 1.0 - LAL_REAL4_EPS;
-
-				gsl_matrix_set(R, i, j, Rij);
-				gsl_matrix_set(R, j, i, Rij); /* it is symmetric */
-			}
-
-		/* perform Cholesky decomposition */
-		gsl_linalg_cholesky_decomp(R);
+		double sigma = factors->sigma[k];
 
 		/* generate numDetector random numbers (both re and im parts) and use
  		 * lower-diagonal part of Cholesky decomposition to create correlations */
@@ -117,15 +193,16 @@ static int XLALSimSGWBSegment(REAL8TimeSeries **h, const LALDetector *detectors,
 			double re = gsl_ran_gaussian_ziggurat(rng, sigma);
 			double im = gsl_ran_gaussian_ziggurat(rng, sigma);
 			for (i = j; i < numDetectors; ++i) {
-				htilde[i]->data->data[k] += gsl_matrix_get(R, i, j) * re;
-				htilde[i]->data->data[k] += I * gsl_matrix_get(R, i, j) * im;
+				htilde[i]->data->data[k] += SGWB_FACTOR(factors, k, i, j) * re;
+				htilde[i]->data->data[k] += I * SGWB_FACTOR(factors, k, i, j) * im;
 			}
 		}
 	}
 
 	/* now go back to the time domain */
 	for (i = 0; i < numDetectors; ++i)
-		XLALREAL8FreqTimeFFT(h[i], htilde[i], plan);
+		if (XLALREAL8FreqTimeFFT(h[i], htilde[i], factors->plan))
+			CLEANUP_AND_RETURN(XLAL_EFUNC);
 
 	/* normal exit */
 	CLEANUP_AND_RETURN(0);
@@ -203,6 +280,52 @@ REAL8FrequencySeries *XLALSimSGWBOmegaGWPowerLawSpectrum(
 }
 
 
+/**
+ * Computes the correlation factors used to generate stochastic background
+ * signals with spectrum OmegaGW in a network of detectors.
+ *
+ * The overlap reduction functions and their Cholesky decompositions depend
+ * only on the network and on the frequency resolution, so when many segments
+ * are to be generated it is far cheaper to compute them once here and pass
+ * the result to XLALSimSGWBWithFactors() or XLALSimSGWBSeries().  The time
+ * series must have length 2 * (OmegaGW->data->length - 1) and sample interval
+ * 1 / (length * OmegaGW->deltaF).
+ *
+ * The detector array is not referenced after this routine returns.
+ */
+SimSGWBFactors *XLALCreateSimSGWBFactors(
+	const LALDetector *detectors,		/**< [in] array of detectors in network */
+	size_t numDetectors,			/**< [in] number of detectors in network */
+	const REAL8FrequencySeries *OmegaGW,	/**< [in] sgwb spectrum frequeny series */
+	double H0				/**< [in] Hubble's constant (s) */
+)
+{
+	SimSGWBFactors *factors;
+	size_t length;
+
+	if (! detectors || numDetectors == 0 || ! OmegaGW || OmegaGW->data->length < 2 || ! (OmegaGW->deltaF > 0.0))
+		XLAL_ERROR_NULL(XLAL_EINVAL);
+
+	length = 2 * (OmegaGW->data->length - 1);
+	factors = XLALSimSGWBFactorsCreate(detectors, numDetectors, OmegaGW, H0, length, 1.0 / (length * OmegaGW->deltaF));
+	if (! factors)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	return factors;
+}
+
+/** Destroys correlation factors created by XLALCreateSimSGWBFactors(). */
+void XLALDestroySimSGWBFactors(SimSGWBFactors *factors)
+{
+	if (factors) {
+		XLALDestroyREAL8FFTPlan(factors->plan);
+		LALFree(factors->L);
+		LALFree(factors->sigma);
+		LALFree(factors);
+	}
+	return;
+}
+
+
 /**
  * Routine that may be used to generate sequential segments of stochastic
  * background gravitational wave signals for a network of detectors with a
@@ -283,16 +406,11 @@ int XLALSimSGWB(
 	gsl_rng *rng				/**< [in] GSL random number generator */
 )
 {
-#	define CLEANUP_AND_RETURN(errnum) do { \
-		if (overlap) for (i = 0; i < numDetectors; ++i) XLALDestroyREAL8Sequence(overlap[i]); \
-		XLALFree(overlap); \
-		if (errnum) XLAL_ERROR(errnum); else return 0; \
-		} while (0)
-	REAL8Vector **overlap = NULL;
+	SimSGWBFactors *factors;
 	LIGOTimeGPS epoch;
 	size_t length;
 	double deltaT;
-	size_t i, j;
+	size_t i;
 
 	length = h[0]->data->length;
 	deltaT = h[0]->deltaT;
@@ -311,17 +429,83 @@ int XLALSimSGWB(
 			|| (size_t)floor(0.5 + 1.0/(deltaT * OmegaGW->deltaF)) != length)
 		XLAL_ERROR(XLAL_EINVAL);
 
+	factors = XLALSimSGWBFactorsCreate(detectors, numDetectors, OmegaGW, H0, length, deltaT);
+	if (! factors)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	if (XLALSimSGWBWithFactors(h, stride, factors, rng)) {
+		XLALDestroySimSGWBFactors(factors);
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+
+	XLALDestroySimSGWBFactors(factors);
+	return 0;
+}
+
+/**
+ * Routine that may be used to generate sequential segments of stochastic
+ * background gravitational wave signals for a network of detectors with a
+ * specified stride from one segment to the next, using correlation factors
+ * precomputed by XLALCreateSimSGWBFactors().
+ *
+ * The calling instructions are the same as for XLALSimSGWB(); the array h
+ * must hold one time series for each detector used to create the factors.
+ * For the same sequence of random numbers the output is identical to that of
+ * XLALSimSGWB(), but the overlap reduction functions and their Cholesky
+ * decompositions are not recomputed on each call.
+ *
+ * @warning Only the first stride points are valid.
+ */
+int XLALSimSGWBWithFactors(
+	REAL8TimeSeries **h,			/**< [in/out] array of sgwb timeseries for detector network */
+	size_t stride,				/**< [in] stride (samples) */
+	const SimSGWBFactors *factors,		/**< [in] precomputed correlation factors */
+	gsl_rng *rng				/**< [in] GSL random number generator */
+)
+{
+#	define CLEANUP_AND_RETURN(errnum) do { \
+		if (overlap) for (i = 0; i < numDetectors; ++i) XLALDestroyREAL8Sequence(overlap[i]); \
+		XLALFree(overlap); \
+		if (errnum) XLAL_ERROR(errnum); else return 0; \
+		} while (0)
+	REAL8Vector **overlap = NULL;
+	LIGOTimeGPS epoch;
+	size_t numDetectors;
+	size_t length;
+	double deltaT;
+	size_t i, j;
+
+	if (! h || ! factors || ! rng)
+		XLAL_ERROR(XLAL_EFAULT);
+
+	numDetectors = factors->numDetectors;
+	length = h[0]->data->length;
+	deltaT = h[0]->deltaT;
+	epoch = h[0]->epoch;
+
+	/* make sure all the lengths and other metadata are the same and
+	 * agree with those used to compute the correlation factors */
+	if (length != factors->length || fabs(deltaT - factors->deltaT) > LAL_REAL8_EPS * factors->deltaT)
+		XLAL_ERROR(XLAL_EINVAL);
+	for (i = 1; i < numDetectors; ++i)
+		if (h[i]->data->length != length
+				|| fabs(h[i]->deltaT - deltaT) > LAL_REAL8_EPS
+				|| XLALGPSCmp(&epoch, &h[i]->epoch))
+			XLAL_ERROR(XLAL_EINVAL);
+
 	/* stride cannot be longer than data length */
 	if (stride > length)
 		XLAL_ERROR(XLAL_EINVAL);
 
 	if (stride == 0) { /* generate segment with no feathering */
-		XLALSimSGWBSegment(h, detectors, numDetectors, OmegaGW, H0, rng);
+		if (XLALSimSGWBSegment(h, factors, rng))
+			XLAL_ERROR(XLAL_EFUNC);
 		return 0;
 	} else if (stride == length) {
 		/* will generate two independent noise realizations
 		 * and feather them together with full overlap */
-		XLALSimSGWBSegment(h, detectors, numDetectors, OmegaGW, H0, rng);
+		if (XLALSimSGWBSegment(h, factors, rng))
+			XLAL_ERROR(XLAL_EFUNC);
 		stride = 0;
 	}
 
@@ -336,7 +520,7 @@ int XLALSimSGWB(
 		memcpy(overlap[i]->data, h[i]->data->data + stride, overlap[i]->length*sizeof(*overlap[i]->data));
 	}
 
-	if (XLALSimSGWBSegment(h, detectors, numDetectors, OmegaGW, H0, rng))
+	if (XLALSimSGWBSegment(h, factors, rng))
 		CLEANUP_AND_RETURN(XLAL_EFUNC);
 
 	/* feather old data in overlap region with new data */
@@ -356,6 +540,146 @@ int XLALSimSGWB(
 #	undef CLEANUP_AND_RETURN
 }
 
+/**
+ * Routine that fills an arbitrarily long stretch of stochastic background
+ * gravitational wave signals for a network of detectors in a single call,
+ * using correlation factors precomputed by XLALCreateSimSGWBFactors().
+ *
+ * The data is built from periodic segments of length factors->length that
+ * start every stride samples and are feathered together exactly as in
+ * successive calls to XLALSimSGWBWithFactors(), so the output has the same
+ * statistical properties as the stream produced by that routine.  Unlike
+ * XLALSimSGWBWithFactors(), every point of the time series is valid and the
+ * epoch is not changed.
+ *
+ * The segments are independent, so they are generated in batches in parallel
+ * when OpenMP is available.  Each segment draws from its own random number
+ * generator, of the same type as rng, seeded from rng in segment order; the
+ * output therefore depends only on the state of rng and not on the number of
+ * threads.  It is not, however, the same realization that sequential calls to
+ * XLALSimSGWBWithFactors() would produce from the same rng.
+ *
+ * @note The stride must be non-zero and less than the segment length.
+ */
+int XLALSimSGWBSeries(
+	REAL8TimeSeries **h,			/**< [out] array of sgwb timeseries for detector network */
+	size_t stride,				/**< [in] stride (samples) */
+	const SimSGWBFactors *factors,		/**< [in] precomputed correlation factors */
+	gsl_rng *rng				/**< [in] GSL random number generator */
+)
+{
+#	define CLEANUP_AND_RETURN(errnum) do { \
+		if (seg) for (b = 0; b < nbatch; ++b) if (seg[b]) { \
+			for (i = 0; i < numDetectors; ++i) XLALDestroyREAL8TimeSeries(seg[b][i]); \
+			XLALFree(seg[b]); } \
+		if (rngs) for (b = 0; b < nbatch; ++b) if (rngs[b]) gsl_rng_free(rngs[b]); \
+		XLALFree(seg); XLALFree(rngs); XLALFree(seeds); XLALFree(status); \
+		if (errnum) XLAL_ERROR(errnum); else return 0; \
+		} while (0)
+	REAL8TimeSeries ***seg = NULL;
+	gsl_rng **rngs = NULL;
+	unsigned long *seeds = NULL;
+	int *status = NULL;
+	LIGOTimeGPS epoch;
+	size_t numDetectors;
+	size_t length;
+	size_t seglen;
+	size_t numSegments;
+	size_t nbatch = 1;
+	size_t first, i, j;
+	long b;
+
+	if (! h || ! factors || ! rng)
+		XLAL_ERROR(XLAL_EFAULT);
+
+	numDetectors = factors->numDetectors;
+	seglen = factors->length;
+	length = h[0]->data->length;
+	epoch = h[0]->epoch;
+
+	/* make sure all the lengths and other metadata are the same and
+	 * agree with those used to compute the correlation factors */
+	for (i = 0; i < numDetectors; ++i)
+		if (h[i]->data->length != length
+				|| fabs(h[i]->deltaT - factors->deltaT) > LAL_REAL8_EPS * factors->deltaT
+				|| XLALGPSCmp(&epoch, &h[i]->epoch))
+			XLAL_ERROR(XLAL_EINVAL);
+
+	/* segments must overlap so they can be feathered */
+	if (stride == 0 || stride >= seglen)
+		XLAL_ERROR(XLAL_EINVAL);
+
+	/* number of segments needed to cover the requested length */
+	numSegments = 1;
+	if (length > seglen)
+		numSegments += (length - seglen + stride - 1) / stride;
+
+#ifdef _OPENMP
+	nbatch = omp_get_max_threads();
+#endif
+	if (nbatch > numSegments)
+		nbatch = numSegments;
+
+	seg = LALCalloc(nbatch, sizeof(*seg));
+	rngs = LALCalloc(nbatch, sizeof(*rngs));
+	seeds = LALCalloc(nbatch, sizeof(*seeds));
+	status = LALCalloc(nbatch, sizeof(*status));
+	if (! seg || ! rngs || ! seeds || ! status)
+		CLEANUP_AND_RETURN(XLAL_ENOMEM);
+	for (b = 0; b < (long)nbatch; ++b) {
+		seg[b] = LALCalloc(numDetectors, sizeof(*seg[b]));
+		rngs[b] = gsl_rng_alloc(rng->type);
+		if (! seg[b] || ! rngs[b])
+			CLEANUP_AND_RETURN(XLAL_ENOMEM);
+		for (i = 0; i < numDetectors; ++i) {
+			seg[b][i] = XLALCreateREAL8TimeSeries(h[i]->name, &epoch, h[i]->f0, factors->deltaT, &h[i]->sampleUnits, seglen);
+			if (! seg[b][i])
+				CLEANUP_AND_RETURN(XLAL_EFUNC);
+		}
+	}
+
+	for (first = 0; first < numSegments; first += nbatch) {
+		long nb = (first + nbatch > numSegments) ? (long)(numSegments - first) : (long)nbatch;
+
+		/* draw the seeds serially so the result does not depend on the
+		 * number of threads */
+		for (b = 0; b < nb; ++b)
+			seeds[b] = gsl_rng_get(rng);
+
+		/* generate this batch of segments */
+#pragma omp parallel for schedule(dynamic, 1)
+		for (b = 0; b < nb; ++b) {
+			gsl_rng_set(rngs[b], seeds[b]);
+			status[b] = XLALSimSGWBSegment(seg[b], factors, rngs[b]);
+		}
+		for (b = 0; b < nb; ++b)
+			if (status[b])
+				CLEANUP_AND_RETURN(XLAL_EFUNC);
+
+		/* feather each segment with the data already produced */
+		for (b = 0; b < nb; ++b) {
+			size_t offset = (first + b) * stride;
+			size_t overlap = (first + b) ? seglen - stride : 0;
+			size_t n = (offset + seglen > length) ? length - offset : seglen;
+			for (i = 0; i < numDetectors; ++i) {
+				REAL8 *out = h[i]->data->data + offset;
+				const REAL8 *in = seg[b][i]->data->data;
+				for (j = 0; j < n && j < overlap; ++j) {
+					double x = cos(LAL_PI*j/(2.0 * overlap));
+					double y = sin(LAL_PI*j/(2.0 * overlap));
+					out[j] = x*out[j] + y*in[j];
+				}
+				for (; j < n; ++j)
+					out[j] = in[j];
+			}
+		}
+	}
+
+	/* success */
+	CLEANUP_AND_RETURN(0);
+#	undef CLEANUP_AND_RETURN
+}
+
 
 /**
  * Routine that may be used to generate sequential segments of stochastic
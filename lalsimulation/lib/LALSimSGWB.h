@@ -60,6 +60,17 @@ REAL8FrequencySeries *XLALSimSGWBOmegaGWFlatSpectrum(double Omega0, double flow,
 REAL8FrequencySeries *XLALSimSGWBOmegaGWPowerLawSpectrum(double Omegaref, double alpha, double fref, double flow, double deltaF, size_t length);
 REAL8FrequencySeries *XLALSimSGWBOmegaGWNumericalSpectrumFromFile(const char *fname, size_t length);
 
+/*
+ * SGWB CORRELATION FACTORS
+ * in module LALSimSGWB.c
+ */
+
+/** Opaque structure holding the per-frequency correlation factors for a detector network */
+typedef struct tagSimSGWBFactors SimSGWBFactors;
+
+SimSGWBFactors *XLALCreateSimSGWBFactors(const LALDetector *detectors, size_t numDetectors, const REAL8FrequencySeries *OmegaGW, double H0);
+void XLALDestroySimSGWBFactors(SimSGWBFactors *factors);
+
 /*
  * SGWB GENERATION ROUTINES
  * in module LALSimSGWB.c
@@ -68,6 +79,8 @@ REAL8FrequencySeries *XLALSimSGWBOmegaGWNumericalSpectrumFromFile(const char *fn
 int XLALSimSGWB(REAL8TimeSeries **h, const LALDetector *detectors, size_t numDetectors, size_t stride, const REAL8FrequencySeries *OmegaGW, double H0, gsl_rng *rng);
 int XLALSimSGWBFlatSpectrum(REAL8TimeSeries **h, const LALDetector *detectors, size_t numDetectors, size_t stride, double Omega0, double flow, double H0, gsl_rng *rng);
 int XLALSimSGWBPowerLawSpectrum(REAL8TimeSeries **h, const LALDetector *detectors, size_t numDetectors, size_t stride, double Omegaref, double alpha, double fref, double flow, double H0, gsl_rng *rng);
+int XLALSimSGWBWithFactors(REAL8TimeSeries **h, size_t stride, const SimSGWBFactors *factors, gsl_rng *rng);
+int XLALSimSGWBSeries(REAL8TimeSeries **h, size_t stride, const SimSGWBFactors *factors, gsl_rng *rng);
 
 #if 0
 { /* so that editors will match succeeding brace */
@@ -344,4 +344,131 @@ int XLALSimNewTimeSeriesFromModesAngleTimeSeries(
 	return 0;
 }
 
+/* Number of samples summed over all modes before moving on to the next block */
+#define SPHHARM_MATRIX_BLOCK_LENGTH 1024
+
+/**
+ * For all modes contained within a SphHarmTimeSeriesMatrix, multiplies
+ * each mode h(l,m) by a spin-2 weighted spherical harmonic to obtain
+ * hplus - i hcross, which is added to the time series.
+ *
+ * Unlike XLALSimAddModeFromModes(), no equatorial symmetry is assumed: every
+ * mode to be summed must be present in the matrix. The spherical harmonics
+ * are computed once per mode, and the sum is performed over blocks of
+ * samples so that the output stays in cache while the rows of the matrix
+ * are streamed through; blocks are distributed over OpenMP threads.
+ *
+ * @sa XLALSimAddMode()
+ */
+int XLALSimAddModesFromSphHarmTimeSeriesMatrix(
+		REAL8TimeSeries *hplus,              /**< +-polarization waveform */
+		REAL8TimeSeries *hcross,             /**< x-polarization waveform */
+		const SphHarmTimeSeriesMatrix *hmodes, /**< complex modes h(l,m) */
+		REAL8 theta,                         /**< polar angle (rad) */
+		REAL8 phi                            /**< azimuthal angle (rad) */
+		)
+{
+	LAL_CHECK_VALID_SERIES(hplus, XLAL_FAILURE);
+	LAL_CHECK_VALID_SERIES(hcross, XLAL_FAILURE);
+	XLAL_CHECK(hmodes != NULL, XLAL_EFAULT);
+	XLAL_CHECK(hplus->data->length == hmodes->length && hcross->data->length == hmodes->length, XLAL_EBADLEN);
+	XLAL_CHECK(XLALGPSCmp(&hplus->epoch, &hmodes->epoch) == 0 && XLALGPSCmp(&hcross->epoch, &hmodes->epoch) == 0, XLAL_ETIME);
+	XLAL_CHECK(fabs(hplus->deltaT - hmodes->deltaT) <= LAL_REAL8_EPS && fabs(hcross->deltaT - hmodes->deltaT) <= LAL_REAL8_EPS, XLAL_ETIME);
+
+	const UINT4 nmodes = hmodes->nmodes;
+	const UINT4 length = hmodes->length;
+	REAL8 *Yre = XLALMalloc(nmodes * sizeof(*Yre));
+	REAL8 *Yim = XLALMalloc(nmodes * sizeof(*Yim));
+	XLAL_CHECK(Yre && Yim, XLAL_ENOMEM);
+	for (UINT4 k = 0; k < nmodes; ++k) {
+		COMPLEX16 Y = XLALSpinWeightedSphericalHarmonic(theta, phi, -2, hmodes->l[k], hmodes->m[k]);
+		if (XLAL_IS_REAL8_FAIL_NAN(creal(Y))) {
+			XLALFree(Yre);
+			XLALFree(Yim);
+			XLAL_ERROR(XLAL_EFUNC);
+		}
+		Yre[k] = creal(Y);
+		Yim[k] = cimag(Y);
+	}
+
+	REAL8 *restrict hp = hplus->data->data;
+	REAL8 *restrict hc = hcross->data->data;
+	const UINT4 nblocks = (length + SPHHARM_MATRIX_BLOCK_LENGTH - 1) / SPHHARM_MATRIX_BLOCK_LENGTH;
+	#pragma omp parallel for
+	for (UINT4 b = 0; b < nblocks; ++b) {
+		const UINT4 j0 = b * SPHHARM_MATRIX_BLOCK_LENGTH;
+		const UINT4 j1 = j0 + SPHHARM_MATRIX_BLOCK_LENGTH < length ? j0 + SPHHARM_MATRIX_BLOCK_LENGTH : length;
+		for (UINT4 k = 0; k < nmodes; ++k) {
+			/* complex samples are stored as (re, im) pairs of REAL8 */
+			const REAL8 *restrict h = (const REAL8 *) hmodes->rows[k];
+			const REAL8 yr = Yre[k], yi = Yim[k];
+			for (UINT4 j = j0; j < j1; ++j) {
+				const REAL8 hr = h[2*j], hi = h[2*j+1];
+				hp[j] += yr * hr - yi * hi;
+				hc[j] -= yr * hi + yi * hr;
+			}
+		}
+	}
+
+	XLALFree(Yre);
+	XLALFree(Yim);
+	return XLAL_SUCCESS;
+}
+
+/**
+ * For all modes contained within a SphHarmFrequencySeriesMatrix, adds
+ * the contribution of each Fourier-domain mode to hptilde and hctilde.
+ * Each mode is added as by XLALSimAddModeFD() with sym = 0.
+ *
+ * @sa XLALSimAddModesFromSphHarmTimeSeriesMatrix()
+ */
+int XLALSimAddModesFromSphHarmFrequencySeriesMatrix(
+		COMPLEX16FrequencySeries *hptilde,      /**< +-polarization waveform */
+		COMPLEX16FrequencySeries *hctilde,      /**< x-polarization waveform */
+		const SphHarmFrequencySeriesMatrix *hlms, /**< complex modes h(l,m) */
+		REAL8 theta,                            /**< polar angle (rad) */
+		REAL8 phi                               /**< azimuthal angle (rad) */
+		)
+{
+	LAL_CHECK_VALID_SERIES(hptilde, XLAL_FAILURE);
+	LAL_CHECK_VALID_SERIES(hctilde, XLAL_FAILURE);
+	XLAL_CHECK(hlms != NULL, XLAL_EFAULT);
+	XLAL_CHECK(hptilde->data->length == hlms->length && hctilde->data->length == hlms->length, XLAL_EBADLEN);
+	XLAL_CHECK(fabs(hptilde->deltaF - hlms->deltaF) <= LAL_REAL8_EPS && fabs(hctilde->deltaF - hlms->deltaF) <= LAL_REAL8_EPS, XLAL_EFREQ);
+
+	const UINT4 nmodes = hlms->nmodes;
+	const UINT4 length = hlms->length;
+	COMPLEX16 *factorp = XLALMalloc(nmodes * sizeof(*factorp));
+	XLAL_CHECK(factorp, XLAL_ENOMEM);
+	for (UINT4 k = 0; k < nmodes; ++k) {
+		COMPLEX16 Y = XLALSpinWeightedSphericalHarmonic(theta, phi, -2, hlms->l[k], hlms->m[k]);
+		if (XLAL_IS_REAL8_FAIL_NAN(creal(Y))) {
+			XLALFree(factorp);
+			XLAL_ERROR(XLAL_EFUNC);
+		}
+		factorp[k] = 0.5 * Y;
+	}
+
+	COMPLEX16 *restrict hp = hptilde->data->data;
+	COMPLEX16 *restrict hc = hctilde->data->data;
+	const UINT4 nblocks = (length + SPHHARM_MATRIX_BLOCK_LENGTH - 1) / SPHHARM_MATRIX_BLOCK_LENGTH;
+	#pragma omp parallel for
+	for (UINT4 b = 0; b < nblocks; ++b) {
+		const UINT4 j0 = b * SPHHARM_MATRIX_BLOCK_LENGTH;
+		const UINT4 j1 = j0 + SPHHARM_MATRIX_BLOCK_LENGTH < length ? j0 + SPHHARM_MATRIX_BLOCK_LENGTH : length;
+		for (UINT4 k = 0; k < nmodes; ++k) {
+			const COMPLEX16 *restrict hlm = hlms->rows[k];
+			const COMPLEX16 fp = factorp[k];
+			const COMPLEX16 fc = I * fp;
+			for (UINT4 j = j0; j < j1; ++j) {
+				hp[j] += fp * hlm[j];
+				hc[j] += fc * hlm[j];
+			}
+		}
+	}
+
+	XLALFree(factorp);
+	return XLAL_SUCCESS;
+}
+
 /** @} */
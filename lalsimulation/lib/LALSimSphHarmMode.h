@@ -52,6 +52,8 @@ int XLALSimAddModeFromModes(REAL8TimeSeries *hplus, REAL8TimeSeries *hcross, Sph
 int XLALSimAddModeFromModesAngleTimeSeries(REAL8TimeSeries *hplus, REAL8TimeSeries *hcross, SphHarmTimeSeries *hmode, REAL8TimeSeries *theta, REAL8TimeSeries *phi);
 int XLALSimNewTimeSeriesFromModes(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, SphHarmTimeSeries *hmode, REAL8 theta, REAL8 phi);
 int XLALSimNewTimeSeriesFromModesAngleTimeSeries(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, SphHarmTimeSeries *hmode, REAL8TimeSeries *theta, REAL8TimeSeries *phi);
+int XLALSimAddModesFromSphHarmTimeSeriesMatrix(REAL8TimeSeries *hplus, REAL8TimeSeries *hcross, const SphHarmTimeSeriesMatrix *hmodes, REAL8 theta, REAL8 phi);
+int XLALSimAddModesFromSphHarmFrequencySeriesMatrix(COMPLEX16FrequencySeries *hptilde, COMPLEX16FrequencySeries *hctilde, const SphHarmFrequencySeriesMatrix *hlms, REAL8 theta, REAL8 phi);
 
 #if 0
 { /* so that editors will match succeeding brace */
@@ -17,6 +17,9 @@
  *  MA  02110-1301  USA
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include <lal/LALSimSphHarmSeries.h>
 #include <lal/LALStdlib.h>
 #include <lal/Sequence.h>
@@ -24,6 +27,7 @@
 #include <lal/FrequencySeries.h>
 #include <lal/TimeFreqFFT.h>
 #include <lal/Units.h>
+#include <lal/Date.h>
 #include <lal/SphericalHarmonics.h>
 
 #ifdef __GNUC__
@@ -701,5 +705,470 @@ UINT4 XLALSphHarmFrequencySeriesGetMaxL( SphHarmFrequencySeries* ts ){
     return maxl;
 }
 
+/** @} */
+
+/**
+ * @name SphHarmTimeSeriesMatrix and SphHarmFrequencySeriesMatrix Routines
+ * @{
+ */
+
+/*
+ * Allocate the mode bookkeeping shared by both matrix types: the (l,m)
+ * indices of each row, the row pointers, and the table mapping l*l+l+m to
+ * a row so that a mode can be found without a search.
+ */
+static int SphHarmMatrixInitModes(
+            UINT4 *nmodes, UINT4 *lmax, UINT4 **l, INT4 **m, INT4 **index, COMPLEX16 ***rows,
+            UINT4 n, const UINT4 *lin, const INT4 *min
+            )
+{
+    XLAL_CHECK( n > 0, XLAL_EINVAL, "Need at least one mode" );
+    UINT4 maxl = 0;
+    for ( UINT4 k = 0; k < n; ++k ) {
+        XLAL_CHECK( abs(min[k]) <= (INT4) lin[k], XLAL_EINVAL, "Invalid mode (%u,%d)", lin[k], min[k] );
+        maxl = lin[k] > maxl ? lin[k] : maxl;
+    }
+    const size_t nindex = ( (size_t) maxl + 1 ) * ( (size_t) maxl + 1 );
+
+    *l = XLALMalloc( n * sizeof(**l) );
+    *m = XLALMalloc( n * sizeof(**m) );
+    *index = XLALMalloc( nindex * sizeof(**index) );
+    *rows = XLALCalloc( n, sizeof(**rows) );
+    XLAL_CHECK( *l && *m && *index && *rows, XLAL_ENOMEM );
+
+    for ( size_t i = 0; i < nindex; ++i ) {
+        (*index)[i] = -1;
+    }
+    for ( UINT4 k = 0; k < n; ++k ) {
+        const size_t i = (size_t) lin[k] * lin[k] + lin[k] + min[k];
+        XLAL_CHECK( (*index)[i] < 0, XLAL_EINVAL, "Duplicate mode (%u,%d)", lin[k], min[k] );
+        (*index)[i] = k;
+        (*l)[k] = lin[k];
+        (*m)[k] = min[k];
+    }
+
+    *nmodes = n;
+    *lmax = maxl;
+    return XLAL_SUCCESS;
+}
+
+/* Read (l,m) pairs from an INT2Sequence, as returned by XLALSimInspiralModeArrayReadModes() */
+static int SphHarmMatrixModesFromSequence( UINT4 *n, UINT4 **l, INT4 **m, const INT2Sequence *modes )
+{
+    XLAL_CHECK( modes != NULL && modes->data != NULL, XLAL_EFAULT );
+    XLAL_CHECK( modes->length > 0 && modes->length % 2 == 0, XLAL_EBADLEN, "Modes must be given as (l,m) pairs" );
+    *n = modes->length / 2;
+    *l = XLALMalloc( (*n) * sizeof(**l) );
+    *m = XLALMalloc( (*n) * sizeof(**m) );
+    XLAL_CHECK( *l && *m, XLAL_ENOMEM );
+    for ( UINT4 k = 0; k < *n; ++k ) {
+        XLAL_CHECK( modes->data[2*k] >= 0, XLAL_EINVAL, "Invalid mode l=%d", modes->data[2*k] );
+        (*l)[k] = modes->data[2*k];
+        (*m)[k] = modes->data[2*k+1];
+    }
+    return XLAL_SUCCESS;
+}
+
+/* Allocate contiguous [mode][sample] storage and point the rows into it */
+static int SphHarmMatrixAllocData( COMPLEX16 **data, COMPLEX16 **rows, UINT4 nmodes, UINT4 length )
+{
+    XLAL_CHECK( length > 0, XLAL_EINVAL, "Need at least one sample per mode" );
+    *data = XLALCalloc( (size_t) nmodes * length, sizeof(**data) );
+    XLAL_CHECK( *data, XLAL_ENOMEM );
+    for ( UINT4 k = 0; k < nmodes; ++k ) {
+        rows[k] = *data + (size_t) k * length;
+    }
+    return XLAL_SUCCESS;
+}
+
+static COMPLEX16 *SphHarmMatrixGetModeData( UINT4 lmax, const INT4 *index, COMPLEX16 *const *rows, UINT4 l, INT4 m )
+{
+    if ( l > lmax || abs(m) > (INT4) l ) {
+        return NULL;
+    }
+    const INT4 k = index[(size_t) l * l + l + m];
+    return k < 0 ? NULL : rows[k];
+}
+
+/**
+ * Create a SphHarmTimeSeriesMatrix holding the given modes, with the samples
+ * of all modes in a single contiguous allocation initialised to zero.
+ * The modes are given as a sequence of (l,m) pairs, such as returned by
+ * XLALSimInspiralModeArrayReadModes().
+ */
+SphHarmTimeSeriesMatrix *XLALCreateSphHarmTimeSeriesMatrix(
+            const LIGOTimeGPS *epoch, /**< epoch of all modes */
+            REAL8 f0, /**< heterodyning frequency of all modes */
+            REAL8 deltaT, /**< sampling interval of all modes */
+            const LALUnit *sampleUnits, /**< units of all modes */
+            size_t length, /**< number of samples per mode */
+            const INT2Sequence *modes /**< sequence of (l,m) pairs */
+            )
+{
+    XLAL_CHECK_NULL( epoch != NULL && sampleUnits != NULL, XLAL_EFAULT );
+    XLAL_CHECK_NULL( length <= UINT32_MAX, XLAL_EINVAL );
+
+    UINT4 n = 0, *l = NULL;
+    INT4 *m = NULL;
+    SphHarmTimeSeriesMatrix *mat = XLALCalloc( 1, sizeof(*mat) );
+    XLAL_CHECK_NULL( mat, XLAL_ENOMEM );
+    if ( SphHarmMatrixModesFromSequence( &n, &l, &m, modes ) != XLAL_SUCCESS
+         || SphHarmMatrixInitModes( &mat->nmodes, &mat->lmax, &mat->l, &mat->m, &mat->index, &mat->rows, n, l, m ) != XLAL_SUCCESS
+         || SphHarmMatrixAllocData( &mat->data, mat->rows, mat->nmodes, length ) != XLAL_SUCCESS ) {
+        XLALFree( l );
+        XLALFree( m );
+        XLALDestroySphHarmTimeSeriesMatrix( mat );
+        XLAL_ERROR_NULL( XLAL_EFUNC );
+    }
+    XLALFree( l );
+    XLALFree( m );
+
+    mat->epoch = *epoch;
+    mat->f0 = f0;
+    mat->deltaT = deltaT;
+    mat->sampleUnits = *sampleUnits;
+    mat->length = length;
+
+    return mat;
+}
+
+/** Destroy a SphHarmTimeSeriesMatrix; the sample data of a view are not freed */
+void XLALDestroySphHarmTimeSeriesMatrix(
+            SphHarmTimeSeriesMatrix *mat /**< matrix to destroy */
+            )
+{
+    if ( mat ) {
+        XLALFree( mat->l );
+        XLALFree( mat->m );
+        XLALFree( mat->index );
+        XLALFree( mat->rows );
+        XLALFree( mat->data );
+        XLALFree( mat );
+    }
+}
+
+/*
+ * Create a matrix with the same modes, metadata and length as a
+ * SphHarmTimeSeries linked list. If copy is non-zero, the samples are
+ * copied into contiguous storage; otherwise the rows point at the sample
+ * data of the list.
+ */
+static SphHarmTimeSeriesMatrix *SphHarmTimeSeriesMatrixFromList( const SphHarmTimeSeries *ts, int copy )
+{
+    XLAL_CHECK_NULL( ts != NULL, XLAL_EFAULT );
+
+    UINT4 n = 0;
+    for ( const SphHarmTimeSeries *itr = ts; itr; itr = itr->next ) {
+        XLAL_CHECK_NULL( itr->mode && itr->mode->data && itr->mode->data->length, XLAL_EINVAL, "Mode (%u,%d) has no data", itr->l, itr->m );
+        XLAL_CHECK_NULL( itr->mode->data->length == ts->mode->data->length, XLAL_EBADLEN, "All modes must have the same length" );
+        XLAL_CHECK_NULL( XLALGPSCmp( &itr->mode->epoch, &ts->mode->epoch ) == 0, XLAL_ETIME, "All modes must have the same epoch" );
+        XLAL_CHECK_NULL( itr->mode->deltaT == ts->mode->deltaT, XLAL_ETIME, "All modes must have the same sampling interval" );
+        ++n;
+    }
+
+    UINT4 *l = XLALMalloc( n * sizeof(*l) );
+    INT4 *m = XLALMalloc( n * sizeof(*m) );
+    SphHarmTimeSeriesMatrix *mat = XLALCalloc( 1, sizeof(*mat) );
+    if ( !l || !m || !mat ) {
+        XLALFree( l );
+        XLALFree( m );
+        XLALFree( mat );
+        XLAL_ERROR_NULL( XLAL_ENOMEM );
+    }
+    n = 0;
+    for ( const SphHarmTimeSeries *itr = ts; itr; itr = itr->next, ++n ) {
+        l[n] = itr->l;
+        m[n] = itr->m;
+    }
+
+    int retn = SphHarmMatrixInitModes( &mat->nmodes, &mat->lmax, &mat->l, &mat->m, &mat->index, &mat->rows, n, l, m );
+    XLALFree( l );
+    XLALFree( m );
+    const UINT4 length = ts->mode->data->length;
+    if ( retn == XLAL_SUCCESS && copy ) {
+        retn = SphHarmMatrixAllocData( &mat->data, mat->rows, mat->nmodes, length );
+    }
+    if ( retn != XLAL_SUCCESS ) {
+        XLALDestroySphHarmTimeSeriesMatrix( mat );
+        XLAL_ERROR_NULL( XLAL_EFUNC );
+    }
+
+    n = 0;
+    for ( const SphHarmTimeSeries *itr = ts; itr; itr = itr->next, ++n ) {
+        if ( copy ) {
+            memcpy( mat->rows[n], itr->mode->data->data, length * sizeof(COMPLEX16) );
+        } else {
+            mat->rows[n] = itr->mode->data->data;
+        }
+    }
+
+    mat->epoch = ts->mode->epoch;
+    mat->f0 = ts->mode->f0;
+    mat->deltaT = ts->mode->deltaT;
+    mat->sampleUnits = ts->mode->sampleUnits;
+    mat->length = length;
+
+    return mat;
+}
+
+/**
+ * Copy the modes of a SphHarmTimeSeries linked list into a new
+ * SphHarmTimeSeriesMatrix with contiguous storage. All modes must have
+ * the same length, epoch and sampling interval.
+ */
+SphHarmTimeSeriesMatrix *XLALSphHarmTimeSeriesMatrixFromSphHarmTimeSeries(
+            const SphHarmTimeSeries *ts /**< linked list of modes to copy */
+            )
+{
+    SphHarmTimeSeriesMatrix *mat = SphHarmTimeSeriesMatrixFromList( ts, 1 );
+    XLAL_CHECK_NULL( mat, XLAL_EFUNC );
+    return mat;
+}
+
+/**
+ * Create a SphHarmTimeSeriesMatrix which is a view of the modes of a
+ * SphHarmTimeSeries linked list, without copying any sample data. The
+ * view gives constant-time access to each mode, but the rows are not
+ * contiguous in memory. The linked list must not be modified or destroyed
+ * while the view is in use.
+ */
+SphHarmTimeSeriesMatrix *XLALSphHarmTimeSeriesMatrixViewSphHarmTimeSeries(
+            const SphHarmTimeSeries *ts /**< linked list of modes to view */
+            )
+{
+    SphHarmTimeSeriesMatrix *mat = SphHarmTimeSeriesMatrixFromList( ts, 0 );
+    XLAL_CHECK_NULL( mat, XLAL_EFUNC );
+    return mat;
+}
+
+/**
+ * Copy the modes of a SphHarmTimeSeriesMatrix into a new SphHarmTimeSeries
+ * linked list.
+ */
+SphHarmTimeSeries *XLALSphHarmTimeSeriesFromSphHarmTimeSeriesMatrix(
+            const SphHarmTimeSeriesMatrix *mat /**< matrix of modes to copy */
+            )
+{
+    XLAL_CHECK_NULL( mat != NULL, XLAL_EFAULT );
+
+    COMPLEX16TimeSeries *h_lm = XLALCreateCOMPLEX16TimeSeries( "h_lm", &mat->epoch, mat->f0, mat->deltaT, &mat->sampleUnits, mat->length );
+    XLAL_CHECK_NULL( h_lm, XLAL_EFUNC );
+
+    SphHarmTimeSeries *ts = NULL;
+    for ( UINT4 k = mat->nmodes; k-- > 0; ) {
+        memcpy( h_lm->data->data, mat->rows[k], mat->length * sizeof(COMPLEX16) );
+        SphHarmTimeSeries *newts = XLALSphHarmTimeSeriesAddMode( ts, h_lm, mat->l[k], mat->m[k] );
+        if ( !newts ) {
+            XLALDestroyCOMPLEX16TimeSeries( h_lm );
+            XLALDestroySphHarmTimeSeries( ts );
+            XLAL_ERROR_NULL( XLAL_EFUNC );
+        }
+        ts = newts;
+    }
+    XLALDestroyCOMPLEX16TimeSeries( h_lm );
+
+    return ts;
+}
+
+/**
+ * Get the samples of a waveform's (l,m) spherical harmonic mode from a
+ * SphHarmTimeSeriesMatrix, or NULL if the matrix does not contain that mode.
+ */
+COMPLEX16 *XLALSphHarmTimeSeriesMatrixGetModeData(
+            const SphHarmTimeSeriesMatrix *mat, /**< matrix to extract mode from */
+            UINT4 l, /**< l index of h_lm mode to get */
+            INT4 m /**< m index of h_lm mode to get */
+            )
+{
+    if ( !mat ) return NULL;
+    return SphHarmMatrixGetModeData( mat->lmax, mat->index, mat->rows, l, m );
+}
+
+/**
+ * Create a SphHarmFrequencySeriesMatrix holding the given modes, with the
+ * samples of all modes in a single contiguous allocation initialised to zero.
+ * @sa XLALCreateSphHarmTimeSeriesMatrix()
+ */
+SphHarmFrequencySeriesMatrix *XLALCreateSphHarmFrequencySeriesMatrix(
+            const LIGOTimeGPS *epoch, /**< epoch of all modes */
+            REAL8 f0, /**< starting frequency of all modes */
+            REAL8 deltaF, /**< frequency spacing of all modes */
+            const LALUnit *sampleUnits, /**< units of all modes */
+            size_t length, /**< number of samples per mode */
+            const INT2Sequence *modes /**< sequence of (l,m) pairs */
+            )
+{
+    XLAL_CHECK_NULL( epoch != NULL && sampleUnits != NULL, XLAL_EFAULT );
+    XLAL_CHECK_NULL( length <= UINT32_MAX, XLAL_EINVAL );
+
+    UINT4 n = 0, *l = NULL;
+    INT4 *m = NULL;
+    SphHarmFrequencySeriesMatrix *mat = XLALCalloc( 1, sizeof(*mat) );
+    XLAL_CHECK_NULL( mat, XLAL_ENOMEM );
+    if ( SphHarmMatrixModesFromSequence( &n, &l, &m, modes ) != XLAL_SUCCESS
+         || SphHarmMatrixInitModes( &mat->nmodes, &mat->lmax, &mat->l, &mat->m, &mat->index, &mat->rows, n, l, m ) != XLAL_SUCCESS
+         || SphHarmMatrixAllocData( &mat->data, mat->rows, mat->nmodes, length ) != XLAL_SUCCESS ) {
+        XLALFree( l );
+        XLALFree( m );
+        XLALDestroySphHarmFrequencySeriesMatrix( mat );
+        XLAL_ERROR_NULL( XLAL_EFUNC );
+    }
+    XLALFree( l );
+    XLALFree( m );
+
+    mat->epoch = *epoch;
+    mat->f0 = f0;
+    mat->deltaF = deltaF;
+    mat->sampleUnits = *sampleUnits;
+    mat->length = length;
+
+    return mat;
+}
+
+/** Destroy a SphHarmFrequencySeriesMatrix; the sample data of a view are not freed */
+void XLALDestroySphHarmFrequencySeriesMatrix(
+            SphHarmFrequencySeriesMatrix *mat /**< matrix to destroy */
+            )
+{
+    if ( mat ) {
+        XLALFree( mat->l );
+        XLALFree( mat->m );
+        XLALFree( mat->index );
+        XLALFree( mat->rows );
+        XLALFree( mat->data );
+        XLALFree( mat );
+    }
+}
+
+/* Frequency-domain counterpart of SphHarmTimeSeriesMatrixFromList() */
+static SphHarmFrequencySeriesMatrix *SphHarmFrequencySeriesMatrixFromList( const SphHarmFrequencySeries *fs, int copy )
+{
+    XLAL_CHECK_NULL( fs != NULL, XLAL_EFAULT );
+
+    UINT4 n = 0;
+    for ( const SphHarmFrequencySeries *itr = fs; itr; itr = itr->next ) {
+        XLAL_CHECK_NULL( itr->mode && itr->mode->data && itr->mode->data->length, XLAL_EINVAL, "Mode (%u,%d) has no data", itr->l, itr->m );
+        XLAL_CHECK_NULL( itr->mode->data->length == fs->mode->data->length, XLAL_EBADLEN, "All modes must have the same length" );
+        XLAL_CHECK_NULL( itr->mode->f0 == fs->mode->f0, XLAL_EFREQ, "All modes must have the same starting frequency" );
+        XLAL_CHECK_NULL( itr->mode->deltaF == fs->mode->deltaF, XLAL_EFREQ, "All modes must have the same frequency spacing" );
+        ++n;
+    }
+
+    UINT4 *l = XLALMalloc( n * sizeof(*l) );
+    INT4 *m = XLALMalloc( n * sizeof(*m) );
+    SphHarmFrequencySeriesMatrix *mat = XLALCalloc( 1, sizeof(*mat) );
+    if ( !l || !m || !mat ) {
+        XLALFree( l );
+        XLALFree( m );
+        XLALFree( mat );
+        XLAL_ERROR_NULL( XLAL_ENOMEM );
+    }
+    n = 0;
+    for ( const SphHarmFrequencySeries *itr = fs; itr; itr = itr->next, ++n ) {
+        l[n] = itr->l;
+        m[n] = itr->m;
+    }
+
+    int retn = SphHarmMatrixInitModes( &mat->nmodes, &mat->lmax, &mat->l, &mat->m, &mat->index, &mat->rows, n, l, m );
+    XLALFree( l );
+    XLALFree( m );
+    const UINT4 length = fs->mode->data->length;
+    if ( retn == XLAL_SUCCESS && copy ) {
+        retn = SphHarmMatrixAllocData( &mat->data, mat->rows, mat->nmodes, length );
+    }
+    if ( retn != XLAL_SUCCESS ) {
+        XLALDestroySphHarmFrequencySeriesMatrix( mat );
+        XLAL_ERROR_NULL( XLAL_EFUNC );
+    }
+
+    n = 0;
+    for ( const SphHarmFrequencySeries *itr = fs; itr; itr = itr->next, ++n ) {
+        if ( copy ) {
+            memcpy( mat->rows[n], itr->mode->data->data, length * sizeof(COMPLEX16) );
+        } else {
+            mat->rows[n] = itr->mode->data->data;
+        }
+    }
+
+    mat->epoch = fs->mode->epoch;
+    mat->f0 = fs->mode->f0;
+    mat->deltaF = fs->mode->deltaF;
+    mat->sampleUnits = fs->mode->sampleUnits;
+    mat->length = length;
+
+    return mat;
+}
+
+/**
+ * Copy the modes of a SphHarmFrequencySeries linked list into a new
+ * SphHarmFrequencySeriesMatrix with contiguous storage.
+ * @sa XLALSphHarmTimeSeriesMatrixFromSphHarmTimeSeries()
+ */
+SphHarmFrequencySeriesMatrix *XLALSphHarmFrequencySeriesMatrixFromSphHarmFrequencySeries(
+            const SphHarmFrequencySeries *fs /**< linked list of modes to copy */
+            )
+{
+    SphHarmFrequencySeriesMatrix *mat = SphHarmFrequencySeriesMatrixFromList( fs, 1 );
+    XLAL_CHECK_NULL( mat, XLAL_EFUNC );
+    return mat;
+}
+
+/**
+ * Create a SphHarmFrequencySeriesMatrix which is a view of the modes of a
+ * SphHarmFrequencySeries linked list, without copying any sample data.
+ * @sa XLALSphHarmTimeSeriesMatrixViewSphHarmTimeSeries()
+ */
+SphHarmFrequencySeriesMatrix *XLALSphHarmFrequencySeriesMatrixViewSphHarmFrequencySeries(
+            const SphHarmFrequencySeries *fs /**< linked list of modes to view */
+            )
+{
+    SphHarmFrequencySeriesMatrix *mat = SphHarmFrequencySeriesMatrixFromList( fs, 0 );
+    XLAL_CHECK_NULL( mat, XLAL_EFUNC );
+    return mat;
+}
+
+/**
+ * Copy the modes of a SphHarmFrequencySeriesMatrix into a new
+ * SphHarmFrequencySeries linked list.
+ */
+SphHarmFrequencySeries *XLALSphHarmFrequencySeriesFromSphHarmFrequencySeriesMatrix(
+            const SphHarmFrequencySeriesMatrix *mat /**< matrix of modes to copy */
+            )
+{
+    XLAL_CHECK_NULL( mat != NULL, XLAL_EFAULT );
+
+    COMPLEX16FrequencySeries *h_lm = XLALCreateCOMPLEX16FrequencySeries( "h_lm", &mat->epoch, mat->f0, mat->deltaF, &mat->sampleUnits, mat->length );
+    XLAL_CHECK_NULL( h_lm, XLAL_EFUNC );
+
+    SphHarmFrequencySeries *fs = NULL;
+    for ( UINT4 k = mat->nmodes; k-- > 0; ) {
+        memcpy( h_lm->data->data, mat->rows[k], mat->length * sizeof(COMPLEX16) );
+        SphHarmFrequencySeries *newfs = XLALSphHarmFrequencySeriesAddMode( fs, h_lm, mat->l[k], mat->m[k] );
+        if ( !newfs ) {
+            XLALDestroyCOMPLEX16FrequencySeries( h_lm );
+            XLALDestroySphHarmFrequencySeries( fs );
+            XLAL_ERROR_NULL( XLAL_EFUNC );
+        }
+        fs = newfs;
+    }
+    XLALDestroyCOMPLEX16FrequencySeries( h_lm );
+
+    return fs;
+}
+
+/**
+ * Get the samples of a waveform's (l,m) spherical harmonic mode from a
+ * SphHarmFrequencySeriesMatrix, or NULL if the matrix does not contain that mode.
+ */
+COMPLEX16 *XLALSphHarmFrequencySeriesMatrixGetModeData(
+            const SphHarmFrequencySeriesMatrix *mat, /**< matrix to extract mode from */
+            UINT4 l, /**< l index of h_lm mode to get */
+            INT4 m /**< m index of h_lm mode to get */
+            )
+{
+    if ( !mat ) return NULL;
+    return SphHarmMatrixGetModeData( mat->lmax, mat->index, mat->rows, l, m );
+}
+
 /** @} */
 /** @} */
@@ -72,6 +72,57 @@ typedef struct tagSphHarmFrequencySeries {
     struct tagSphHarmFrequencySeries*    next; /**< next pointer */
 } SphHarmFrequencySeries;
 
+/**
+ * Structure to carry a collection of spherical harmonic modes of equal
+ * length as a dense [mode][sample] matrix. Unlike SphHarmTimeSeries, a given
+ * (l,m) mode is located in constant time, and the samples of all modes
+ * normally live in a single contiguous allocation. A matrix may also be a
+ * view of the modes of an existing SphHarmTimeSeries, in which case it does
+ * not own any sample data.
+ */
+#ifdef SWIG /* SWIG interface directives */
+SWIGLAL(IMMUTABLE_MEMBERS(tagSphHarmTimeSeriesMatrix, nmodes, length, lmax));
+SWIGLAL(IGNORE_MEMBERS(tagSphHarmTimeSeriesMatrix, l, m, index, rows, data));
+#endif /* SWIG */
+typedef struct tagSphHarmTimeSeriesMatrix {
+    LIGOTimeGPS                     epoch; /**< Epoch of all modes */
+    REAL8                           f0; /**< Heterodyning frequency of all modes */
+    REAL8                           deltaT; /**< Sampling interval of all modes */
+    LALUnit                         sampleUnits; /**< Units of all modes */
+    UINT4                           nmodes; /**< Number of modes */
+    UINT4                           length; /**< Number of samples per mode */
+    UINT4                           lmax; /**< Largest l index of any mode */
+    UINT4*                          l; /**< l index of each mode */
+    INT4*                           m; /**< m index of each mode */
+    INT4*                           index; /**< Row of mode (l,m) at l*l+l+m, or -1 */
+    COMPLEX16**                     rows; /**< Samples of each mode */
+    COMPLEX16*                      data; /**< Contiguous samples of all modes, or NULL for a view */
+} SphHarmTimeSeriesMatrix;
+
+/**
+ * Structure to carry a collection of spherical harmonic modes of equal
+ * length as a dense [mode][sample] matrix.
+ * @sa SphHarmTimeSeriesMatrix
+ */
+#ifdef SWIG /* SWIG interface directives */
+SWIGLAL(IMMUTABLE_MEMBERS(tagSphHarmFrequencySeriesMatrix, nmodes, length, lmax));
+SWIGLAL(IGNORE_MEMBERS(tagSphHarmFrequencySeriesMatrix, l, m, index, rows, data));
+#endif /* SWIG */
+typedef struct tagSphHarmFrequencySeriesMatrix {
+    LIGOTimeGPS                     epoch; /**< Epoch of all modes */
+    REAL8                           f0; /**< Starting frequency of all modes */
+    REAL8                           deltaF; /**< Frequency spacing of all modes */
+    LALUnit                         sampleUnits; /**< Units of all modes */
+    UINT4                           nmodes; /**< Number of modes */
+    UINT4                           length; /**< Number of samples per mode */
+    UINT4                           lmax; /**< Largest l index of any mode */
+    UINT4*                          l; /**< l index of each mode */
+    INT4*                           m; /**< m index of each mode */
+    INT4*                           index; /**< Row of mode (l,m) at l*l+l+m, or -1 */
+    COMPLEX16**                     rows; /**< Samples of each mode */
+    COMPLEX16*                      data; /**< Contiguous samples of all modes, or NULL for a view */
+} SphHarmFrequencySeriesMatrix;
+
 /** @} */
 
 SphHarmTimeSeries* XLALSphHarmTimeSeriesAddMode(SphHarmTimeSeries *appended, const COMPLEX16TimeSeries* inmode, UINT4 l, INT4 m);
@@ -121,6 +172,21 @@ SWIGLAL(RETURN_OWNED_BY_1ST_ARG(COMPLEX16FrequencySeries*, XLALSphHarmFrequencyS
 
 COMPLEX16FrequencySeries* XLALSphHarmFrequencySeriesGetMode(SphHarmFrequencySeries *ts, UINT4 l, INT4 m);
 
+
+SphHarmTimeSeriesMatrix *XLALCreateSphHarmTimeSeriesMatrix(const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length, const INT2Sequence *modes);
+void XLALDestroySphHarmTimeSeriesMatrix(SphHarmTimeSeriesMatrix *mat);
+SphHarmTimeSeriesMatrix *XLALSphHarmTimeSeriesMatrixFromSphHarmTimeSeries(const SphHarmTimeSeries *ts);
+SphHarmTimeSeriesMatrix *XLALSphHarmTimeSeriesMatrixViewSphHarmTimeSeries(const SphHarmTimeSeries *ts);
+SphHarmTimeSeries *XLALSphHarmTimeSeriesFromSphHarmTimeSeriesMatrix(const SphHarmTimeSeriesMatrix *mat);
+COMPLEX16 *XLALSphHarmTimeSeriesMatrixGetModeData(const SphHarmTimeSeriesMatrix *mat, UINT4 l, INT4 m);
+
+SphHarmFrequencySeriesMatrix *XLALCreateSphHarmFrequencySeriesMatrix(const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length, const INT2Sequence *modes);
+void XLALDestroySphHarmFrequencySeriesMatrix(SphHarmFrequencySeriesMatrix *mat);
+SphHarmFrequencySeriesMatrix *XLALSphHarmFrequencySeriesMatrixFromSphHarmFrequencySeries(const SphHarmFrequencySeries *fs);
+SphHarmFrequencySeriesMatrix *XLALSphHarmFrequencySeriesMatrixViewSphHarmFrequencySeries(const SphHarmFrequencySeries *fs);
+SphHarmFrequencySeries *XLALSphHarmFrequencySeriesFromSphHarmFrequencySeriesMatrix(const SphHarmFrequencySeriesMatrix *mat);
+COMPLEX16 *XLALSphHarmFrequencySeriesMatrixGetModeData(const SphHarmFrequencySeriesMatrix *mat, UINT4 l, INT4 m);
+
 #if 0
 { /* so that editors will match succeeding brace */
 #elif defined(__cplusplus)
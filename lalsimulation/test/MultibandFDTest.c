@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Tests multibanded generation of conditioned frequency domain
+ * waveforms against generation on the uniform frequency grid.
+ *
+ * The relative L2 error between the two must stay within a small multiple
+ * of the requested ConditioningThresholdMband; the threshold bounds the
+ * interpolation error relative to the local amplitude at each node.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/Date.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralWaveformParams.h>
+
+/* allowed relative L2 error, in units of the multiband threshold */
+#define ERROR_FACTOR 10.0
+
+static int generate(COMPLEX16FrequencySeries **hp, COMPLEX16FrequencySeries **hc, Approximant approx, REAL8 deltaF, REAL8 f_min, REAL8 f_max, REAL8 threshold)
+{
+    LALSimInspiralGenerator *gen;
+    LALDict *params;
+    int retval;
+
+    params = XLALCreateDict();
+    XLAL_CHECK(params, XLAL_EFUNC);
+    XLALSimInspiralWaveformParamsInsertMass1(params, 1.4 * LAL_MSUN_SI);
+    XLALSimInspiralWaveformParamsInsertMass2(params, 1.3 * LAL_MSUN_SI);
+    XLALSimInspiralWaveformParamsInsertSpin1z(params, 0.05);
+    XLALSimInspiralWaveformParamsInsertSpin2z(params, -0.02);
+    XLALSimInspiralWaveformParamsInsertDistance(params, 100.0 * 1e6 * LAL_PC_SI);
+    XLALSimInspiralWaveformParamsInsertInclination(params, 0.4);
+    XLALSimInspiralWaveformParamsInsertRefPhase(params, 0.3);
+    XLALSimInspiralWaveformParamsInsertDeltaF(params, deltaF);
+    XLALSimInspiralWaveformParamsInsertF22Start(params, f_min);
+    XLALSimInspiralWaveformParamsInsertF22Ref(params, f_min);
+    XLALSimInspiralWaveformParamsInsertFMax(params, f_max);
+    if (threshold > 0.0)
+        XLALSimInspiralWaveformParamsInsertConditioningThresholdMband(params, threshold);
+
+    gen = XLALSimInspiralChooseGenerator(approx, params);
+    if (!gen) {
+        XLALDestroyDict(params);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+    retval = XLALSimInspiralGeneratorAddStandardConditioning(gen);
+    if (retval == 0)
+        retval = XLALSimInspiralGenerateFDWaveform(hp, hc, params, gen);
+    XLALDestroySimInspiralGenerator(gen);
+    XLALDestroyDict(params);
+    XLAL_CHECK(retval == 0, XLAL_EFUNC);
+    return 0;
+}
+
+/* relative L2 error of h with respect to href */
+static REAL8 relative_error(const COMPLEX16FrequencySeries *h, const COMPLEX16FrequencySeries *href)
+{
+    REAL8 num = 0.0, den = 0.0;
+    size_t k;
+    for (k = 0; k < href->data->length; ++k) {
+        COMPLEX16 d = h->data->data[k] - href->data->data[k];
+        num += creal(d) * creal(d) + cimag(d) * cimag(d);
+        den += creal(href->data->data[k]) * creal(href->data->data[k]) + cimag(href->data->data[k]) * cimag(href->data->data[k]);
+    }
+    return den > 0.0 ? sqrt(num / den) : (num > 0.0 ? INFINITY : 0.0);
+}
+
+static int compare(Approximant approx, REAL8 deltaF, REAL8 f_min, REAL8 f_max, REAL8 threshold)
+{
+    COMPLEX16FrequencySeries *hp = NULL, *hc = NULL;
+    COMPLEX16FrequencySeries *hpref = NULL, *hcref = NULL;
+    REAL8 errp, errc;
+
+    XLAL_CHECK(generate(&hpref, &hcref, approx, deltaF, f_min, f_max, 0.0) == 0, XLAL_EFUNC);
+    XLAL_CHECK(generate(&hp, &hc, approx, deltaF, f_min, f_max, threshold) == 0, XLAL_EFUNC);
+
+    XLAL_CHECK(hp->data->length == hpref->data->length && hc->data->length == hcref->data->length, XLAL_EFAILED, "%s: multibanded length %u differs from uniform length %u", XLALSimInspiralGetStringFromApproximant(approx), hp->data->length, hpref->data->length);
+    XLAL_CHECK(hp->deltaF == hpref->deltaF, XLAL_EFAILED);
+    XLAL_CHECK(XLALGPSCmp(&hp->epoch, &hpref->epoch) == 0, XLAL_EFAILED);
+
+    errp = relative_error(hp, hpref);
+    errc = relative_error(hc, hcref);
+    printf("%s: deltaF=%g f_min=%g f_max=%g threshold=%g: relative error hplus=%.3e hcross=%.3e\n", XLALSimInspiralGetStringFromApproximant(approx), deltaF, f_min, f_max, threshold, errp, errc);
+    XLAL_CHECK(errp <= ERROR_FACTOR * threshold && errc <= ERROR_FACTOR * threshold, XLAL_ETOL, "%s: relative error (%g, %g) exceeds %g", XLALSimInspiralGetStringFromApproximant(approx), errp, errc, ERROR_FACTOR * threshold);
+
+    XLALDestroyCOMPLEX16FrequencySeries(hp);
+    XLALDestroyCOMPLEX16FrequencySeries(hc);
+    XLALDestroyCOMPLEX16FrequencySeries(hpref);
+    XLALDestroyCOMPLEX16FrequencySeries(hcref);
+    return 0;
+}
+
+int main(void)
+{
+    const Approximant approx[] = {TaylorF2, IMRPhenomD};
+    const REAL8 threshold[] = {1e-3, 1e-4};
+    size_t i, j;
+
+    for (i = 0; i < XLAL_NUM_ELEM(approx); ++i) {
+        for (j = 0; j < XLAL_NUM_ELEM(threshold); ++j)
+            XLAL_CHECK_MAIN(compare(approx[i], 1.0 / 128.0, 30.0, 1024.0, threshold[j]) == 0, XLAL_EFUNC);
+        /* band narrower than the minimum interpolation interval, which is
+         * evaluated directly on the uniform grid */
+        XLAL_CHECK_MAIN(compare(approx[i], 8.0, 30.0, 32.0, threshold[0]) == 0, XLAL_EFUNC);
+    }
+
+    LALCheckMemoryLeaks();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+/*
+ *  Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Tests the adaptive, serialized, and batched neutron star family
+ * builders against the fixed-grid family.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/AVFactories.h>
+#include <lal/LALSimNeutronStar.h>
+
+/* number of piecewise polytropes; the first is close to SLy */
+#define NUM_EOS 4
+
+/* tolerance of the adaptive family */
+#define ADAPTIVE_TOLERANCE 1e-3
+
+/* allowed fractional difference between the adaptive and fixed-grid
+ * families, which is dominated by interpolation on the fixed grid */
+#define FAMILY_TOLERANCE 1e-2
+
+/* number of masses at which families are compared */
+#define NUM_MASS 50
+
+static LALSimNeutronStarEOS *create_eos(size_t i)
+{
+    return XLALSimNeutronStarEOS4ParameterPiecewisePolytrope(33.384 + 0.05 * i, 3.005 - 0.1 * i, 2.988, 2.851);
+}
+
+/* masses between 1 solar mass and just below the smaller maximum mass */
+static double test_mass(size_t k, LALSimNeutronStarFamily *fam1, LALSimNeutronStarFamily *fam2)
+{
+    double mmin = LAL_MSUN_SI;
+    double mmax = 0.98 * fmin(XLALSimNeutronStarMaximumMass(fam1), XLALSimNeutronStarMaximumMass(fam2));
+    return mmin + (mmax - mmin) * k / (NUM_MASS - 1);
+}
+
+/* fractional differences in maximum mass, radius, and Love number k2 */
+static int compare_families(LALSimNeutronStarFamily *fam, LALSimNeutronStarFamily *ref, double tol)
+{
+    double mmax = XLALSimNeutronStarMaximumMass(fam);
+    double mmax_ref = XLALSimNeutronStarMaximumMass(ref);
+    size_t k;
+
+    XLAL_CHECK(fabs(mmax - mmax_ref) <= tol * mmax_ref, XLAL_ETOL, "Maximum mass %g differs from %g", mmax / LAL_MSUN_SI, mmax_ref / LAL_MSUN_SI);
+    for (k = 0; k < NUM_MASS; ++k) {
+        double m = test_mass(k, fam, ref);
+        double r = XLALSimNeutronStarRadius(m, fam);
+        double r_ref = XLALSimNeutronStarRadius(m, ref);
+        double k2 = XLALSimNeutronStarLoveNumberK2(m, fam);
+        double k2_ref = XLALSimNeutronStarLoveNumberK2(m, ref);
+        XLAL_CHECK(fabs(r - r_ref) <= tol * r_ref, XLAL_ETOL, "Radius %g m differs from %g m at mass %g", r, r_ref, m / LAL_MSUN_SI);
+        XLAL_CHECK(fabs(k2 - k2_ref) <= tol * k2_ref, XLAL_ETOL, "Love number %g differs from %g at mass %g", k2, k2_ref, m / LAL_MSUN_SI);
+    }
+    return 0;
+}
+
+/* a corrupted serialization must be rejected */
+static int check_bad_serialization(const REAL8Vector *data, double ndat)
+{
+    LALSimNeutronStarFamily *fam;
+    REAL8Vector *bad;
+    int errnum;
+
+    bad = XLALCreateREAL8Vector(data->length);
+    XLAL_CHECK(bad, XLAL_EFUNC);
+    memcpy(bad->data, data->data, data->length * sizeof(*bad->data));
+    bad->data[1] = ndat;
+    XLAL_TRY_SILENT(fam = XLALCreateSimNeutronStarFamilyFromSerialization(bad), errnum);
+    XLALDestroyREAL8Vector(bad);
+    XLAL_CHECK(fam == NULL && errnum == XLAL_EBADLEN, XLAL_EFAILED, "Serialization with %g stars was not rejected", ndat);
+    return 0;
+}
+
+int main(void)
+{
+    LALSimNeutronStarEOS *eos[NUM_EOS];
+    LALSimNeutronStarFamily *fixed[NUM_EOS];
+    LALSimNeutronStarFamily *adaptive[NUM_EOS];
+    LALSimNeutronStarFamily *batch[NUM_EOS];
+    size_t i, k;
+
+    for (i = 0; i < NUM_EOS; ++i) {
+        XLAL_CHECK_MAIN((eos[i] = create_eos(i)), XLAL_EFUNC);
+        XLAL_CHECK_MAIN((fixed[i] = XLALCreateSimNeutronStarFamily(eos[i])), XLAL_EFUNC);
+        XLAL_CHECK_MAIN((adaptive[i] = XLALCreateSimNeutronStarFamilyAdaptive(eos[i], ADAPTIVE_TOLERANCE)), XLAL_EFUNC);
+    }
+
+    /* adaptive against fixed-grid families */
+    for (i = 0; i < NUM_EOS; ++i)
+        XLAL_CHECK_MAIN(compare_families(adaptive[i], fixed[i], FAMILY_TOLERANCE) == 0, XLAL_EFUNC, "EOS %zu: adaptive family differs from fixed-grid family", i);
+
+    /* serialization round trip reproduces the family exactly */
+    for (i = 0; i < NUM_EOS; ++i) {
+        REAL8Vector *data;
+        LALSimNeutronStarFamily *fam;
+        XLAL_CHECK_MAIN((data = XLALSimNeutronStarFamilySerialize(adaptive[i])), XLAL_EFUNC);
+        XLAL_CHECK_MAIN((fam = XLALCreateSimNeutronStarFamilyFromSerialization(data)), XLAL_EFUNC);
+        XLAL_CHECK_MAIN(compare_families(fam, adaptive[i], 0.0) == 0, XLAL_EFUNC, "EOS %zu: serialization round trip differs", i);
+        XLAL_CHECK_MAIN(check_bad_serialization(data, NAN) == 0, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(check_bad_serialization(data, INFINITY) == 0, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(check_bad_serialization(data, data->data[1] + 0.5) == 0, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(check_bad_serialization(data, data->length) == 0, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(check_bad_serialization(data, -1.0) == 0, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(check_bad_serialization(data, 1e300) == 0, XLAL_EFUNC);
+        XLALDestroySimNeutronStarFamily(fam);
+        XLALDestroyREAL8Vector(data);
+    }
+
+    /* batched families match single ones exactly */
+    XLAL_CHECK_MAIN(XLALCreateSimNeutronStarFamilies(batch, eos, NUM_EOS, 0.0) == 0, XLAL_EFUNC);
+    for (i = 0; i < NUM_EOS; ++i) {
+        XLAL_CHECK_MAIN(compare_families(batch[i], fixed[i], 0.0) == 0, XLAL_EFUNC, "EOS %zu: batched fixed-grid family differs", i);
+        XLALDestroySimNeutronStarFamily(batch[i]);
+    }
+    XLAL_CHECK_MAIN(XLALCreateSimNeutronStarFamilies(batch, eos, NUM_EOS, ADAPTIVE_TOLERANCE) == 0, XLAL_EFUNC);
+    for (i = 0; i < NUM_EOS; ++i) {
+        XLAL_CHECK_MAIN(compare_families(batch[i], adaptive[i], 0.0) == 0, XLAL_EFUNC, "EOS %zu: batched adaptive family differs", i);
+        XLALDestroySimNeutronStarFamily(batch[i]);
+    }
+
+    for (i = 0; i < NUM_EOS; ++i) {
+        for (k = 0; k < NUM_MASS; k += NUM_MASS / 5) {
+            double m = test_mass(k, adaptive[i], fixed[i]);
+            printf("EOS %zu: m = %.3f Msun: R = %.4f km (fixed %.4f km), k2 = %.5f (fixed %.5f)\n", i, m / LAL_MSUN_SI, XLALSimNeutronStarRadius(m, adaptive[i]) / 1e3, XLALSimNeutronStarRadius(m, fixed[i]) / 1e3, XLALSimNeutronStarLoveNumberK2(m, adaptive[i]), XLALSimNeutronStarLoveNumberK2(m, fixed[i]));
+        }
+        XLALDestroySimNeutronStarFamily(adaptive[i]);
+        XLALDestroySimNeutronStarFamily(fixed[i]);
+        XLALDestroySimNeutronStarEOS(eos[i]);
+    }
+
+    LALCheckMemoryLeaks();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Tests stochastic background generation with precomputed
+ * correlation factors.
+ *
+ * XLALSimSGWBWithFactors() must reproduce XLALSimSGWB() exactly for the same
+ * random number generator state, and the power spectral density of a long
+ * record made by XLALSimSGWBSeries() must agree with the requested spectrum.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDetectors.h>
+#include <lal/Date.h>
+#include <lal/Units.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/Window.h>
+#include <lal/RealFFT.h>
+#include <lal/TimeFreqFFT.h>
+#include <lal/LALSimSGWB.h>
+
+#define NUM_DETECTORS 3
+#define SEED 4096
+
+/* allowed fractional error of the band-averaged PSD; with the record below
+ * each band averages over about 10^4 independent estimates, so this is about
+ * five standard deviations */
+#define PSD_TOLERANCE 0.05
+
+static const double srate = 1024.0; /* sample rate (Hz) */
+static const double segdur = 4.0; /* segment duration (s) */
+static const double flow = 10.0; /* low frequency cutoff (Hz) */
+static const double Omega0 = 1e-6;
+
+static int create_series(REAL8TimeSeries **h, size_t length)
+{
+    const LIGOTimeGPS epoch = {1000000000, 0};
+    size_t i;
+    for (i = 0; i < NUM_DETECTORS; ++i)
+        XLAL_CHECK((h[i] = XLALCreateREAL8TimeSeries("STRAIN", &epoch, 0.0, 1.0 / srate, &lalStrainUnit, length)), XLAL_EFUNC);
+    return 0;
+}
+
+static void destroy_series(REAL8TimeSeries **h)
+{
+    size_t i;
+    for (i = 0; i < NUM_DETECTORS; ++i)
+        XLALDestroyREAL8TimeSeries(h[i]);
+}
+
+/* XLALSimSGWBWithFactors() against XLALSimSGWB() over several strides */
+static int test_with_factors(const LALDetector *detectors, const REAL8FrequencySeries *OmegaGW, double H0)
+{
+    const size_t seglen = segdur * srate;
+    const size_t strides[] = {0, seglen / 2, seglen / 4, seglen};
+    REAL8TimeSeries *h[NUM_DETECTORS];
+    REAL8TimeSeries *href[NUM_DETECTORS];
+    SimSGWBFactors *factors;
+    gsl_rng *rng, *rngref;
+    size_t s, i, j;
+
+    XLAL_CHECK(create_series(h, seglen) == 0, XLAL_EFUNC);
+    XLAL_CHECK(create_series(href, seglen) == 0, XLAL_EFUNC);
+    XLAL_CHECK((factors = XLALCreateSimSGWBFactors(detectors, NUM_DETECTORS, OmegaGW, H0)), XLAL_EFUNC);
+    rng = gsl_rng_alloc(gsl_rng_mt19937);
+    rngref = gsl_rng_alloc(gsl_rng_mt19937);
+    XLAL_CHECK(rng && rngref, XLAL_ENOMEM);
+    gsl_rng_set(rng, SEED);
+    gsl_rng_set(rngref, SEED);
+
+    for (s = 0; s < XLAL_NUM_ELEM(strides); ++s) {
+        XLAL_CHECK(XLALSimSGWBWithFactors(h, strides[s], factors, rng) == 0, XLAL_EFUNC);
+        XLAL_CHECK(XLALSimSGWB(href, detectors, NUM_DETECTORS, strides[s], OmegaGW, H0, rngref) == 0, XLAL_EFUNC);
+        for (i = 0; i < NUM_DETECTORS; ++i) {
+            XLAL_CHECK(XLALGPSCmp(&h[i]->epoch, &href[i]->epoch) == 0, XLAL_EFAILED, "Stride %zu: epochs differ", strides[s]);
+            for (j = 0; j < seglen; ++j)
+                XLAL_CHECK(h[i]->data->data[j] == href[i]->data->data[j], XLAL_EFAILED, "Stride %zu: detector %zu sample %zu differs: %e != %e", strides[s], i, j, h[i]->data->data[j], href[i]->data->data[j]);
+        }
+    }
+
+    gsl_rng_free(rngref);
+    gsl_rng_free(rng);
+    XLALDestroySimSGWBFactors(factors);
+    destroy_series(href);
+    destroy_series(h);
+    return 0;
+}
+
+/* Welch PSD of a record made by XLALSimSGWBSeries() against the spectrum */
+static int test_series_psd(const LALDetector *detectors, const REAL8FrequencySeries *OmegaGW, double H0)
+{
+    const size_t seglen = segdur * srate;
+    const size_t reclen = 256 * seglen;
+    const double bands[][2] = {{20.0, 40.0}, {40.0, 80.0}, {80.0, 160.0}, {160.0, 320.0}};
+    const double psdfac = 0.3 * pow(H0 / LAL_PI, 2.0);
+    const LIGOTimeGPS epoch = {0, 0};
+    REAL8TimeSeries *h[NUM_DETECTORS];
+    REAL8FrequencySeries *psd;
+    SimSGWBFactors *factors;
+    REAL8Window *window;
+    REAL8FFTPlan *plan;
+    gsl_rng *rng;
+    size_t b, i, k;
+
+    XLAL_CHECK(create_series(h, reclen) == 0, XLAL_EFUNC);
+    XLAL_CHECK((factors = XLALCreateSimSGWBFactors(detectors, NUM_DETECTORS, OmegaGW, H0)), XLAL_EFUNC);
+    XLAL_CHECK((rng = gsl_rng_alloc(gsl_rng_mt19937)), XLAL_ENOMEM);
+    gsl_rng_set(rng, SEED);
+    XLAL_CHECK(XLALSimSGWBSeries(h, seglen / 2, factors, rng) == 0, XLAL_EFUNC);
+
+    XLAL_CHECK((psd = XLALCreateREAL8FrequencySeries("PSD", &epoch, 0.0, OmegaGW->deltaF, &lalSecondUnit, seglen / 2 + 1)), XLAL_EFUNC);
+    XLAL_CHECK((window = XLALCreateHannREAL8Window(seglen)), XLAL_EFUNC);
+    XLAL_CHECK((plan = XLALCreateForwardREAL8FFTPlan(seglen, 0)), XLAL_EFUNC);
+    for (i = 0; i < NUM_DETECTORS; ++i) {
+        XLAL_CHECK(XLALREAL8AverageSpectrumWelch(psd, h[i], seglen, seglen / 2, window, plan) == 0, XLAL_EFUNC);
+        for (b = 0; b < XLAL_NUM_ELEM(bands); ++b) {
+            double ratio = 0.0;
+            size_t n = 0;
+            for (k = bands[b][0] / psd->deltaF; k < bands[b][1] / psd->deltaF; ++k, ++n) {
+                double f = k * psd->deltaF;
+                ratio += psd->data->data[k] / (psdfac * OmegaGW->data->data[k] * pow(f, -3.0));
+            }
+            ratio /= n;
+            printf("detector %zu: %g-%g Hz: PSD / expected = %.4f\n", i, bands[b][0], bands[b][1], ratio);
+            XLAL_CHECK(fabs(ratio - 1.0) < PSD_TOLERANCE, XLAL_ETOL, "Detector %zu: PSD in %g-%g Hz is %g times the expected PSD", i, bands[b][0], bands[b][1], ratio);
+        }
+    }
+
+    XLALDestroyREAL8FFTPlan(plan);
+    XLALDestroyREAL8Window(window);
+    XLALDestroyREAL8FrequencySeries(psd);
+    gsl_rng_free(rng);
+    XLALDestroySimSGWBFactors(factors);
+    destroy_series(h);
+    return 0;
+}
+
+int main(void)
+{
+    const double H0 = 0.72 * LAL_H0FAC_SI;
+    const size_t seglen = segdur * srate;
+    LALDetector detectors[NUM_DETECTORS];
+    REAL8FrequencySeries *OmegaGW;
+
+    detectors[0] = lalCachedDetectors[LAL_LHO_4K_DETECTOR];
+    detectors[1] = lalCachedDetectors[LAL_LLO_4K_DETECTOR];
+    detectors[2] = lalCachedDetectors[LAL_VIRGO_DETECTOR];
+    XLAL_CHECK_MAIN((OmegaGW = XLALSimSGWBOmegaGWFlatSpectrum(Omega0, flow, 1.0 / segdur, seglen / 2 + 1)), XLAL_EFUNC);
+
+    XLAL_CHECK_MAIN(test_with_factors(detectors, OmegaGW, H0) == 0, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(test_series_psd(detectors, OmegaGW, H0) == 0, XLAL_EFUNC);
+
+    XLALDestroyREAL8FrequencySeries(OmegaGW);
+    LALCheckMemoryLeaks();
+    return EXIT_SUCCESS;
+}
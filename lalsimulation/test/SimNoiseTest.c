@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2026 LIGO Scientific Collaboration
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Tests that XLALSimNoiseGeneratorFill() gives the same noise at a
+ * given time however the data are divided into time series.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/Date.h>
+#include <lal/FrequencySeries.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+#include <lal/LALSimNoise.h>
+
+int main(void)
+{
+	const double srate = 256.0;
+	const double segdur = 4.0;
+	const size_t seglen = segdur * srate;
+	const size_t reclen = 16 * seglen + 123;
+	const double psdval = 1e-3;
+	LIGOTimeGPS epoch = { 1000000000, 0 };
+	REAL8FrequencySeries *psd;
+	REAL8TimeSeries *rec, *part;
+	SimNoiseGenerator *gen, *gen2;
+	double mean = 0.0, var = 0.0;
+	size_t j, k, split;
+
+	XLALSetErrorHandler(XLALAbortErrorHandler);
+
+	psd = XLALCreateREAL8FrequencySeries("PSD", &epoch, 0.0, 1.0/segdur, &lalSecondUnit, seglen/2 + 1);
+	for (k = 0; k < psd->data->length; ++k)
+		psd->data->data[k] = psdval;
+
+	gen = XLALCreateSimNoiseGenerator(psd, 1.0/srate, 12345, 0);
+	gen2 = XLALCreateSimNoiseGenerator(psd, 1.0/srate, 12345, 1);
+
+	/* fill the whole record at once */
+	rec = XLALCreateREAL8TimeSeries("STRAIN", &epoch, 0.0, 1.0/srate, &lalStrainUnit, reclen);
+	XLALSimNoiseGeneratorFill(rec, gen);
+
+	/* white noise should have variance psd * srate / 2 */
+	for (j = 0; j < reclen; ++j)
+		mean += rec->data->data[j] / reclen;
+	for (j = 0; j < reclen; ++j)
+		var += (rec->data->data[j] - mean) * (rec->data->data[j] - mean) / (reclen - 1);
+	XLAL_CHECK_EXIT(fabs(var / (0.5 * psdval * srate) - 1.0) < 0.1);
+
+	/* fill the record again in pieces that do not align with the blocks */
+	part = XLALCreateREAL8TimeSeries("STRAIN", &epoch, 0.0, 1.0/srate, &lalStrainUnit, 1);
+	for (j = 0; j < reclen; j += split) {
+		split = 1 + (7 * j + 333) % (3 * seglen / 2);
+		if (j + split > reclen)
+			split = reclen - j;
+		part = XLALResizeREAL8TimeSeries(part, 0, split);
+		part->epoch = epoch;
+		XLALGPSAdd(&part->epoch, j / srate);
+		XLALSimNoiseGeneratorFill(part, gen);
+		XLAL_CHECK_EXIT(memcmp(part->data->data, rec->data->data + j, split * sizeof(*part->data->data)) == 0);
+	}
+
+	/* another stream gives different noise */
+	XLALSimNoiseGeneratorFill(part, gen2);
+	XLAL_CHECK_EXIT(memcmp(part->data->data, rec->data->data + reclen - split, split * sizeof(*part->data->data)) != 0);
+
+	XLALDestroyREAL8TimeSeries(part);
+	XLALDestroyREAL8TimeSeries(rec);
+	XLALDestroyREAL8FrequencySeries(psd);
+	XLALDestroySimNoiseGenerator(gen);
+	XLALDestroySimNoiseGenerator(gen2);
+	LALCheckMemoryLeaks();
+	return 0;
+}
@@ -26,11 +26,15 @@
  */
 
 
+#include <math.h>
+#include <string.h>
+
 #include <lal/Sequence.h>
 #include <lal/LALSimInspiral.h>
 #include <lal/TimeSeries.h>
 #include <lal/Date.h>
 #include <lal/Units.h>
+#include <lal/LALSimSphHarmMode.h>
 
 int main(void){
 		// Empty time series -- technically works, but doesn't make a lot
@@ -92,6 +96,72 @@ int main(void){
 		REAL8Sequence *tdata_hlm = XLALSphHarmTimeSeriesGetTData( ts );
 		XLAL_CHECK_EXIT( tdata_hlm == tdata );
 
+		// Fill the modes with some data, then check that the matrix
+		// copy and view give the same modes and the same polarisations
+		for( l=2; l<3; l++ ){
+			for( m=-l; m<=l; m++ ){
+				h_lm = XLALSphHarmTimeSeriesGetMode( ts, l, m );
+				for( i=0; i<(int)h_lm->data->length; i++ ){
+					h_lm->data->data[i] = cos(0.1*i*(l+m)) + I*sin(0.2*i*m);
+				}
+			}
+		}
+		SphHarmTimeSeriesMatrix *mat = XLALSphHarmTimeSeriesMatrixFromSphHarmTimeSeries( ts );
+		SphHarmTimeSeriesMatrix *view = XLALSphHarmTimeSeriesMatrixViewSphHarmTimeSeries( ts );
+		XLAL_CHECK_EXIT( mat && view );
+		XLAL_CHECK_EXIT( mat->nmodes == 9 && mat->length == 100 && mat->lmax == 2 );
+		XLAL_CHECK_EXIT( XLALSphHarmTimeSeriesMatrixGetModeData( mat, 3, 0 ) == NULL );
+		for( l=0; l<3; l++ ){
+			for( m=-l; m<=l; m++ ){
+				h_lm = XLALSphHarmTimeSeriesGetMode( ts, l, m );
+				XLAL_CHECK_EXIT( XLALSphHarmTimeSeriesMatrixGetModeData( view, l, m ) == h_lm->data->data );
+				XLAL_CHECK_EXIT( memcmp( XLALSphHarmTimeSeriesMatrixGetModeData( mat, l, m ), h_lm->data->data, h_lm->data->length*sizeof(COMPLEX16) ) == 0 );
+			}
+		}
+
+		// Only l=2 modes have a spin-weight -2 harmonic
+		SphHarmTimeSeries *ts2 = NULL;
+		for( m=-2; m<=2; m++ ){
+			ts2 = XLALSphHarmTimeSeriesAddMode( ts2, XLALSphHarmTimeSeriesGetMode( ts, 2, m ), 2, m );
+		}
+		XLALDestroySphHarmTimeSeriesMatrix( mat );
+		mat = XLALSphHarmTimeSeriesMatrixFromSphHarmTimeSeries( ts2 );
+		XLAL_CHECK_EXIT( mat );
+		REAL8TimeSeries *hp = XLALCreateREAL8TimeSeries( "hplus", &epoch, 0, 1.0/16384, &lalStrainUnit, 100 );
+		REAL8TimeSeries *hc = XLALCreateREAL8TimeSeries( "hcross", &epoch, 0, 1.0/16384, &lalStrainUnit, 100 );
+		REAL8TimeSeries *hp_ref = XLALCreateREAL8TimeSeries( "hplus", &epoch, 0, 1.0/16384, &lalStrainUnit, 100 );
+		REAL8TimeSeries *hc_ref = XLALCreateREAL8TimeSeries( "hcross", &epoch, 0, 1.0/16384, &lalStrainUnit, 100 );
+		memset( hp->data->data, 0, hp->data->length*sizeof(REAL8) );
+		memset( hc->data->data, 0, hc->data->length*sizeof(REAL8) );
+		memset( hp_ref->data->data, 0, hp_ref->data->length*sizeof(REAL8) );
+		memset( hc_ref->data->data, 0, hc_ref->data->length*sizeof(REAL8) );
+		for( m=-2; m<=2; m++ ){
+			XLAL_CHECK_EXIT( XLALSimAddMode( hp_ref, hc_ref, XLALSphHarmTimeSeriesGetMode( ts2, 2, m ), 0.3, 1.2, 2, m, 0 ) == 0 );
+		}
+		XLAL_CHECK_EXIT( XLALSimAddModesFromSphHarmTimeSeriesMatrix( hp, hc, mat, 0.3, 1.2 ) == XLAL_SUCCESS );
+		for( i=0; i<100; i++ ){
+			XLAL_CHECK_EXIT( fabs( hp->data->data[i] - hp_ref->data->data[i] ) < 1e-12 );
+			XLAL_CHECK_EXIT( fabs( hc->data->data[i] - hc_ref->data->data[i] ) < 1e-12 );
+		}
+
+		// Round trip back to a linked list
+		SphHarmTimeSeries *ts3 = XLALSphHarmTimeSeriesFromSphHarmTimeSeriesMatrix( mat );
+		XLAL_CHECK_EXIT( ts3 );
+		for( m=-2; m<=2; m++ ){
+			COMPLEX16TimeSeries *h_lm2 = XLALSphHarmTimeSeriesGetMode( ts3, 2, m );
+			h_lm = XLALSphHarmTimeSeriesGetMode( ts2, 2, m );
+			XLAL_CHECK_EXIT( h_lm2 && memcmp( h_lm2->data->data, h_lm->data->data, h_lm->data->length*sizeof(COMPLEX16) ) == 0 );
+		}
+
+		XLALDestroyREAL8TimeSeries( hp );
+		XLALDestroyREAL8TimeSeries( hc );
+		XLALDestroyREAL8TimeSeries( hp_ref );
+		XLALDestroyREAL8TimeSeries( hc_ref );
+		XLALDestroySphHarmTimeSeriesMatrix( mat );
+		XLALDestroySphHarmTimeSeriesMatrix( view );
+		XLALDestroySphHarmTimeSeries( ts2 );
+		XLALDestroySphHarmTimeSeries( ts3 );
+
 		XLALDestroySphHarmTimeSeries( ts );
 
 		LALCheckMemoryLeaks();